@@ -78,6 +78,23 @@ if(Ant_MARCH)
 endif()
 
 string(TOUPPER ${CMAKE_BUILD_TYPE} BUILD_TYPE)
+
+# verbose logs above this level are compiled out (see base/Logger.h),
+# such that release builds don't pay for the per-event debug messages
+set(Ant_MAX_VLOG_LEVEL "" CACHE STRING
+  "Verbose logs above this level (0..9) are compiled out, empty for 6 in Release builds and 9 otherwise")
+if(Ant_MAX_VLOG_LEVEL STREQUAL "")
+  if(BUILD_TYPE STREQUAL "RELEASE" OR BUILD_TYPE STREQUAL "MINSIZEREL")
+    set(ANT_MAX_VLOG_LEVEL 6)
+  else()
+    set(ANT_MAX_VLOG_LEVEL 9)
+  endif()
+else()
+  set(ANT_MAX_VLOG_LEVEL ${Ant_MAX_VLOG_LEVEL})
+endif()
+add_definitions(-DANT_MAX_VLOG_LEVEL=${ANT_MAX_VLOG_LEVEL})
+message(STATUS "Verbose logs above level ${ANT_MAX_VLOG_LEVEL} are compiled out")
+
 set(DEFAULT_COMPILE_FLAGS ${CMAKE_CXX_FLAGS_${BUILD_TYPE}})
 
 # build shared libraries by default
@@ -0,0 +1,470 @@
+/**
+  * @file Ant-bench.cc
+  * @brief Measures the throughput of the individual processing stages
+  *
+  * Runs raw file decompression, unpacking, reconstruction (with clustering and
+  * candidate building separately), kinematic fitting and TEvent serialization
+  * on the given input files (by default all test blobs) and writes the
+  * results as JSON, such that they can be compared across commits.
+  *
+  * Additionally measures the cost of logging statements which don't write
+  * anything, as they appear in the per-event code. Comparing the per-event results
+  * of builds with different Ant_MAX_VLOG_LEVEL gives the total logging overhead.
+  */
+
+#include "unpacker/Unpacker.h"
+#include "unpacker/RawFileReader.h"
+
+#include "reconstruct/Reconstruct.h"
+
+#include "expconfig/ExpConfig.h"
+
+#include "analysis/input/pluto/PlutoReader.h"
+#include "analysis/input/event_t.h"
+#include "analysis/input/treeEvents_t.h"
+#include "analysis/utils/MCFakeReconstructed.h"
+#include "analysis/utils/ParticleTools.h"
+#include "analysis/utils/fitter/KinFitter.h"
+#include "analysis/utils/fitter/TreeFitter.h"
+#include "analysis/utils/uncertainties/FitterSergey.h"
+
+#include "tree/TEvent.h"
+#include "tree/TEventData.h"
+
+#include "base/WrapTFile.h"
+#include "base/GitInfo.h"
+#include "base/Paths.h"
+#include "base/StageTimer.h"
+#include "base/tmpfile_t.h"
+#include "base/std_ext/system.h"
+#include "base/std_ext/string.h"
+#include "base/Logger.h"
+
+#include "tclap/CmdLine.h"
+#include "tclap/ValuesConstraintExtra.h"
+
+#include "TTree.h"
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <new>
+
+using namespace std;
+using namespace ant;
+using namespace ant::analysis;
+using namespace ant::analysis::input;
+
+// count all allocations of the process by replacing the global operator new,
+// the array and nothrow variants forward to it by default
+static atomic<unsigned long long> nAllocations{0};
+
+void* operator new(size_t size) {
+    ++nAllocations;
+    if(void* p = malloc(size == 0 ? 1 : size))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+/**
+ * @brief The stopwatch_t struct accumulates the wall time and the number of allocations
+ * of possibly many Start/Stop intervals
+ */
+struct stopwatch_t {
+    using clock_t = chrono::steady_clock;
+
+    double Seconds = 0;
+    unsigned long long Allocations = 0;
+
+    void Start() {
+        allocations = nAllocations;
+        start = clock_t::now();
+    }
+
+    void Stop() {
+        Seconds += chrono::duration<double>(clock_t::now() - start).count();
+        Allocations += nAllocations - allocations;
+    }
+
+protected:
+    clock_t::time_point start;
+    unsigned long long allocations = 0;
+};
+
+struct result_t {
+    string Stage;
+    string Input;
+    string Unit;
+    unsigned long long N;
+    stopwatch_t Watch;
+    long PeakRSS_kB;
+};
+
+static list<result_t> results;
+
+static long peak_rss_kB() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static void add_result(const string& stage, const string& input,
+                       unsigned long long n, const stopwatch_t& watch,
+                       const string& unit = "event")
+{
+    results.emplace_back(result_t{stage, input, unit, n, watch, peak_rss_kB()});
+    const auto& r = results.back();
+    LOG(INFO) << stage << " " << std_ext::basename(input) << ": " << n << " " << unit << "s in "
+              << r.Watch.Seconds << " s (" << (r.Watch.Seconds>0 ? n/r.Watch.Seconds : 0) << " " << unit << "/s)";
+}
+
+static string json_string(const string& s) {
+    string escaped("\"");
+    for(auto c : s) {
+        if(c == '"' || c == '\\')
+            escaped += '\\';
+        if(static_cast<unsigned char>(c) < 0x20)
+            continue;
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+static void write_json(ostream& s, unsigned repeat) {
+    s << "{\n"
+      << "  \"git\": " << json_string(GitInfo().GetDescription()) << ",\n"
+      << "  \"repeat\": " << repeat << ",\n"
+      << "  \"peak_rss_kb\": " << peak_rss_kB() << ",\n"
+      << "  \"stages\": [";
+    bool first = true;
+    for(const auto& r : results) {
+        const auto n = max(r.N, 1ull);
+        s << (first ? "\n" : ",\n")
+          << "    {\"stage\": " << json_string(r.Stage)
+          << ", \"input\": " << json_string(std_ext::basename(r.Input))
+          << ", \"unit\": " << json_string(r.Unit)
+          << ", \"n\": " << r.N
+          << ", \"seconds\": " << r.Watch.Seconds
+          << ", \"per_second\": " << (r.Watch.Seconds>0 ? r.N/r.Watch.Seconds : 0)
+          << ", \"ns_per_unit\": " << 1e9*r.Watch.Seconds/n
+          << ", \"allocs_per_unit\": " << double(r.Watch.Allocations)/n
+          << ", \"peak_rss_kb\": " << r.PeakRSS_kB
+          << "}";
+        first = false;
+    }
+    s << "\n  ]\n}" << endl;
+}
+
+/**
+ * @brief The timer_delta_t struct gets the time spent in a StageTimer since construction,
+ * as the timers accumulate over all inputs
+ * @note allocations are not counted by StageTimers
+ */
+struct timer_delta_t {
+    explicit timer_delta_t(const string& name) :
+        Timer(StageTimer::Get(name)),
+        seconds(Timer.GetTotalSeconds())
+    {}
+
+    stopwatch_t Get() const {
+        stopwatch_t watch;
+        watch.Seconds = Timer.GetTotalSeconds() - seconds;
+        return watch;
+    }
+
+    const StageTimer& Timer;
+protected:
+    const double seconds;
+};
+
+static void bench_rawfile(const string& filename, unsigned repeat) {
+    stopwatch_t watch;
+    unsigned long long bytes = 0;
+    vector<char> buffer(1 << 20);
+    for(unsigned r=0;r<repeat;r++) {
+        RawFileReader reader;
+        watch.Start();
+        reader.open(filename);
+        while(reader) {
+            reader.read(buffer.data(), buffer.size());
+            bytes += reader.gcount();
+            if(reader.gcount() < streamsize(buffer.size()))
+                break;
+        }
+        watch.Stop();
+    }
+    add_result("RawFileReader", filename, bytes, watch, "byte");
+}
+
+static void bench_unpacker(const string& filename, unsigned repeat) {
+    stopwatch_t unpacking;
+    stopwatch_t reconstructing;
+    stopwatch_t serializing;
+    unsigned long long nEvents = 0;
+
+    unique_ptr<Reconstruct> reconstruct;
+    // filled by the Reconstruct itself
+    const timer_delta_t clustering("Reconstruct/Clustering");
+    const timer_delta_t candidatebuilding("Reconstruct/CandidateBuilder");
+    tmpfile_t tmpfile;
+    WrapTFileOutput outputfile(tmpfile.filename, true);
+    treeEvents_t treeEvents;
+    treeEvents.CreateBranches(new TTree("treeEvents","TEvent data"));
+
+    for(unsigned r=0;r<repeat;r++) {
+        // opening is not part of the measurement
+        unique_ptr<Unpacker::Module> unpacker;
+        try {
+            unpacker = Unpacker::Get(filename);
+        }
+        catch(const Unpacker::Exception& e) {
+            VLOG(5) << "Not unpackable: " << e.what();
+            return;
+        }
+        catch(const ExpConfig::Exception& e) {
+            LOG(WARNING) << "Skipping " << filename << ": " << e.what() << " (use --setup)";
+            return;
+        }
+
+        vector<TEvent> events;
+        unpacking.Start();
+        while(auto event = unpacker->NextEvent())
+            events.emplace_back(move(event));
+        unpacking.Stop();
+        nEvents += events.size();
+
+        // the setup is known now
+        if(!reconstruct) {
+            try {
+                reconstruct = std_ext::make_unique<Reconstruct>();
+            }
+            catch(const ExpConfig::Exception& e) {
+                LOG(WARNING) << "Cannot reconstruct " << filename << ": " << e.what();
+            }
+        }
+
+        if(reconstruct) {
+            reconstructing.Start();
+            for(auto& event : events)
+                reconstruct->DoReconstruct(event.Reconstructed());
+            reconstructing.Stop();
+        }
+
+        serializing.Start();
+        for(auto& event : events) {
+            treeEvents.data = move(event);
+            treeEvents.Tree->Fill();
+        }
+        treeEvents.Tree->FlushBaskets();
+        serializing.Stop();
+    }
+
+    add_result("Unpacker", filename, nEvents, unpacking);
+    if(reconstruct) {
+        add_result("Reconstruct", filename, nEvents, reconstructing);
+        add_result("Reconstruct/Clustering", filename, nEvents, clustering.Get());
+        add_result("Reconstruct/CandidateBuilder", filename, nEvents, candidatebuilding.Get());
+    }
+    add_result("treeEvents", filename, nEvents, serializing);
+}
+
+static void bench_fitters(const string& filename, unsigned repeat) {
+    struct fitinput_t {
+        double Ebeam;
+        TParticlePtr Proton;
+        TParticleList Photons;
+    };
+    vector<fitinput_t> inputs;
+    TParticleTree_t ptree;
+
+    try {
+        PlutoReader reader(make_shared<WrapTFileInput>(filename));
+        utils::MCFakeReconstructed mc_fake(true);
+        while(true) {
+            event_t event;
+            if(!reader.ReadNextEvent(event))
+                break;
+            const auto& mctrue = event.MCTrue();
+            if(!mctrue.ParticleTree)
+                continue;
+            if(!ptree)
+                ptree = mctrue.ParticleTree;
+            auto particles = mc_fake.Get(mctrue);
+            auto protons = particles.Get(ParticleTypeDatabase::Proton);
+            if(protons.size() != 1)
+                continue;
+            inputs.emplace_back(fitinput_t{mctrue.ParticleTree->Get()->Ek(),
+                                           protons.front(),
+                                           particles.Get(ParticleTypeDatabase::Photon)});
+        }
+    }
+    catch(const ExpConfig::Exception& e) {
+        LOG(WARNING) << "Skipping " << filename << ": " << e.what() << " (use --setup)";
+        return;
+    }
+    catch(const WrapTFile::Exception& e) {
+        VLOG(5) << "Not a ROOT file: " << e.what();
+        return;
+    }
+
+    if(inputs.empty())
+        return;
+
+    auto model = make_shared<utils::UncertaintyModels::FitterSergey>();
+
+    {
+        utils::KinFitter kinfitter(model, true);
+        stopwatch_t watch;
+        for(unsigned r=0;r<repeat;r++) {
+            watch.Start();
+            for(const auto& input : inputs)
+                kinfitter.DoFit(input.Ebeam, input.Proton, input.Photons);
+            watch.Stop();
+        }
+        add_result("KinFitter", filename, repeat*inputs.size(), watch);
+    }
+
+    ParticleTypeTreeDatabase::Channel channel;
+    if(!utils::ParticleTools::TryFindParticleDatabaseChannel(ptree, channel)) {
+        VLOG(5) << "No known decay tree in " << filename << ", skipping TreeFitter";
+        return;
+    }
+
+    utils::TreeFitter treefitter(ParticleTypeTreeDatabase::Get(channel), model, true);
+    stopwatch_t watch;
+    for(unsigned r=0;r<repeat;r++) {
+        watch.Start();
+        for(const auto& input : inputs) {
+            treefitter.PrepareFits(input.Ebeam, input.Proton, input.Photons);
+            APLCON::Result_t res;
+            while(treefitter.NextFit(res)) {}
+        }
+        watch.Stop();
+    }
+    add_result("TreeFitter", filename, repeat*inputs.size(), watch);
+}
+
+template<typename Statement>
+static void bench_statement(const string& stage, unsigned long long n, Statement statement) {
+    stopwatch_t watch;
+    watch.Start();
+    for(unsigned long long i=0;i<n;i++)
+        statement();
+    watch.Stop();
+    add_result(stage, "logging", n, watch, "call");
+}
+
+static void bench_logging(unsigned repeat) {
+    // nothing should be written, except the first time for the occasional ones
+    const auto prev_level = el::Loggers::verboseLevel();
+    el::Loggers::setVerboseLevel(0);
+
+    const unsigned long long n = repeat*10000000ull;
+    // stream something the compiler cannot see through
+    volatile double value = 1.0;
+
+    bench_statement("VLOG disabled", n, [&value] () {
+        VLOG(1) << "Value " << value;
+    });
+    bench_statement("VLOG compiled out", n, [&value] () {
+        VLOG(ANT_MAX_VLOG_LEVEL+1) << "Value " << value;
+    });
+    bench_statement("VLOG_N_TIMES disabled", n, [&value] () {
+        VLOG_N_TIMES(1, 1) << "Value " << value;
+    });
+    bench_statement("LOG_N_TIMES easylogging", n, [&value] () {
+        CLOG_N_TIMES(1, INFO, ELPP_CURR_FILE_LOGGER_ID) << "Logged once by easylogging, value " << value;
+    });
+    bench_statement("LOG_N_TIMES", n, [&value] () {
+        LOG_N_TIMES(1, INFO) << "Logged once, value " << value;
+    });
+    bench_statement("LOG_EVERY_SECONDS", n, [&value] () {
+        LOG_EVERY_SECONDS(3600, INFO) << "Logged once per hour, value " << value;
+    });
+
+    el::Loggers::setVerboseLevel(prev_level);
+}
+
+int main(int argc, char** argv) {
+    SetupLogger();
+
+    TCLAP::CmdLine cmd("Ant-bench", ' ', "0.1");
+
+    auto cmd_verbose = cmd.add<TCLAP::ValueArg<int>>("v","verbose","Verbosity level (0..9)", false, 0,"int");
+    auto cmd_input  = cmd.add<TCLAP::MultiArg<string>>("i","input","Input files (default: all test blobs)",false,"filename");
+    TCLAP::ValuesConstraintExtra<decltype(ExpConfig::Setup::GetNames())> allowedsetupnames(ExpConfig::Setup::GetNames());
+    auto cmd_setup  = cmd.add<TCLAP::ValueArg<string>>("s","setup","Choose setup manually by name",false,"", &allowedsetupnames);
+    auto cmd_repeat = cmd.add<TCLAP::ValueArg<unsigned>>("r","repeat","Scale up the inputs by processing each that many times",false,1,"n");
+    auto cmd_output = cmd.add<TCLAP::ValueArg<string>>("o","output","JSON output file (default: stdout)",false,"","filename");
+    auto cmd_nologging = cmd.add<TCLAP::SwitchArg>("","nologging","Skip measuring the logging overhead",false);
+
+    cmd.parse(argc, argv);
+    if(cmd_verbose->isSet()) {
+        el::Loggers::setVerboseLevel(cmd_verbose->getValue());
+    }
+
+    if(cmd_setup->isSet())
+        ExpConfig::Setup::SetByName(cmd_setup->getValue());
+
+    // the reconstruct stages are timed by its StageTimers
+    StageTimer::Enable();
+
+    list<string> inputs;
+    if(cmd_input->isSet()) {
+        const auto& v = cmd_input->getValue();
+        inputs.assign(v.begin(), v.end());
+    }
+    else {
+        inputs = std_ext::system::lsFiles(string(ANT_PATH_GITREPO)+"/test/_blobs");
+    }
+
+    const auto repeat = max(cmd_repeat->getValue(), 1u);
+
+    for(const auto& input : inputs) {
+        LOG(INFO) << "Benchmarking " << input;
+        try {
+            if(std_ext::string_ends_with(input, ".dat") ||
+               std_ext::string_ends_with(input, ".dat.xz") ||
+               std_ext::string_ends_with(input, ".dat.gz")) {
+                bench_rawfile(input, repeat);
+            }
+            bench_unpacker(input, repeat);
+            if(std_ext::string_ends_with(input, ".root"))
+                bench_fitters(input, repeat);
+        }
+        catch(const exception& e) {
+            // some blobs are deliberately broken
+            LOG(WARNING) << "Benchmarking " << input << " failed: " << e.what();
+        }
+    }
+
+    if(!cmd_nologging->isSet())
+        bench_logging(repeat);
+
+    if(cmd_output->isSet()) {
+        ofstream outputfile(cmd_output->getValue());
+        write_json(outputfile, repeat);
+        if(!outputfile) {
+            LOG(ERROR) << "Cannot write " << cmd_output->getValue();
+            return EXIT_FAILURE;
+        }
+    }
+    else {
+        write_json(cout, repeat);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -4,6 +4,7 @@
 #include "base/std_ext/memory.h"
 #include "base/ProgressCounter.h"
 #include "base/std_ext/system.h"
+#include "base/tmpfile_t.h"
 
 #include "root-addons/analysis_codes/hadd.h"
 
@@ -13,10 +14,13 @@
 #include "TFileMerger.h"
 #include "TFile.h"
 #include "TClass.h"
+#include "RVersion.h"
 
 #include <list>
 #include <string>
 #include <map>
+#include <thread>
+#include <algorithm>
 
 using namespace std;
 using namespace ant;
@@ -79,6 +83,50 @@ void do_nativemode(const string& outputfile, const list<string>& inputfiles) {
     LOG(INFO) << "hadd merged " << merger.GetMergeList()->GetEntries() << " input files in " << outputfile << ".\n";
 }
 
+void merge_files(const string& outputfilename, const list<string>& inputfiles,
+                 const hadd::options_t& options, unsigned& nPaths) {
+    auto outputfile = std_ext::make_unique<TFile>(outputfilename.c_str(), "RECREATE");
+    hadd::sources_t sources;
+    for(const auto& filename : inputfiles) {
+        sources.emplace_back(std_ext::make_unique<TFile>(filename.c_str(), "READ"));
+    }
+
+    hadd::MergeRecursive(*outputfile, sources, nPaths, options);
+
+    LOG(INFO) << "Finished, writing file " << outputfile->GetName();
+
+    outputfile->Write();
+}
+
+// merge in chunks of at most maxopen files into intermediate files,
+// then merge those (repeatedly, if there are still too many)
+void merge_chunked(const string& outputfilename, list<string> filenames, unsigned maxopen,
+                   const hadd::options_t& options, unsigned& nPaths) {
+    // the intermediate files of one step go into a private folder,
+    // removed once the next step has merged them
+    list<tmpfolder_t> tmpfolders;
+    while(filenames.size() > maxopen) {
+        tmpfolders.emplace_back();
+        list<string> merged;
+        while(!filenames.empty()) {
+            list<string> chunk;
+            while(!filenames.empty() && chunk.size() < maxopen) {
+                chunk.emplace_back(filenames.front());
+                filenames.pop_front();
+            }
+            merged.emplace_back(std_ext::formatter() << tmpfolders.back().foldername
+                                << "/" << merged.size() << ".root");
+            LOG(INFO) << "Merging " << chunk.size() << " files into intermediate " << merged.back();
+            merge_files(merged.back(), chunk, options, nPaths);
+        }
+        filenames = move(merged);
+        // intermediate files of previous step not needed anymore
+        if(tmpfolders.size()>1)
+            tmpfolders.pop_front();
+    }
+    merge_files(outputfilename, filenames, options, nPaths);
+}
+
 //___________________________________________________________________________
 int main( int argc, char **argv )
 {
@@ -88,6 +136,10 @@ int main( int argc, char **argv )
    TCLAP::CmdLine cmd("Ant-hadd - Merge ROOT objects in files", ' ', "0.1");
    auto cmd_verbose = cmd.add<TCLAP::ValueArg<int>>("v","verbose","Verbosity level (0..9)", false, 0,"int");
    auto cmd_nativemode = cmd.add<TCLAP::MultiSwitchArg>("","native","Run native TFileMerger, is slow on large trees",false);
+   auto cmd_threads = cmd.add<TCLAP::ValueArg<unsigned>>("j","threads","Number of threads to add histograms, 0 for all cores", false, 1,"n");
+   auto cmd_maxopen = cmd.add<TCLAP::ValueArg<unsigned>>("","maxopen","Open at most n>=2 input files at once, merge in steps via temporary files (0 for unlimited)", false, 0,"n");
+   auto cmd_notrees = cmd.add<TCLAP::SwitchArg>("","notrees","Do not merge TTrees",false);
+   auto cmd_noFastClone = cmd.add<TCLAP::SwitchArg>("","noFastClone","Always decompress and re-compress TTree baskets",false);
    auto cmd_filenames  = cmd.add<TCLAP::UnlabeledMultiArg<string>>("files","ROOT files, first one is output",true,"ROOT files");
    cmd.parse(argc, argv);
    if(cmd_verbose->isSet()) {
@@ -113,15 +165,31 @@ int main( int argc, char **argv )
    const auto outputfilename = filenames.front();
    filenames.pop_front();
 
+   // merging in steps needs at least two files per step
+   const auto maxopen = cmd_maxopen->getValue();
+   if(maxopen == 1) {
+       LOG(ERROR) << "--maxopen must be at least 2 (or 0 for unlimited)";
+       exit(EXIT_FAILURE);
+   }
+
    if(cmd_nativemode->isSet()) {
        do_nativemode(outputfilename, filenames);
        exit(EXIT_SUCCESS);
    }
 
-   auto outputfile = std_ext::make_unique<TFile>(outputfilename.c_str(), "RECREATE");
-   hadd::sources_t sources;
-   for(const auto& filename : filenames) {
-       sources.emplace_back(std_ext::make_unique<TFile>(filename.c_str(), "READ"));
+   hadd::options_t options;
+   options.nThreads = cmd_threads->getValue() == 0 ? std::max(1u, std::thread::hardware_concurrency())
+                                                   : cmd_threads->getValue();
+   options.Trees = !cmd_notrees->isSet();
+   options.FastCloneTrees = !cmd_noFastClone->isSet();
+
+   if(options.nThreads > 1) {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+       ROOT::EnableThreadSafety();
+#else
+       LOG(WARNING) << "ROOT version too old for thread-safe histogram adding, using one thread";
+       options.nThreads = 1;
+#endif
    }
 
    // progress updates only when running interactively
@@ -134,11 +202,12 @@ int main( int argc, char **argv )
        nPaths = 0;
    });
 
-   hadd::MergeRecursive(*outputfile, sources, nPaths);
-
-   LOG(INFO) << "Finished, writing file " << outputfile->GetName();
+   if(maxopen == 0 || filenames.size() <= maxopen) {
+       merge_files(outputfilename, filenames, options, nPaths);
+       return EXIT_SUCCESS;
+   }
 
-   outputfile->Write();
+   merge_chunked(outputfilename, move(filenames), maxopen, options, nPaths);
 
-   exit(EXIT_SUCCESS);
+   return EXIT_SUCCESS;
 }
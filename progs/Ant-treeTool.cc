@@ -4,6 +4,7 @@
 #include "base/WrapTFile.h"
 #include "TTree.h"
 #include "tree/TID.h"
+#include "tree/TIDIndex.h"
 
 using namespace std;
 using namespace ant;
@@ -74,6 +75,29 @@ int main (int argc, char** argv)
 
         LOG(INFO) << "All OK";
 
+    } else if(cmd_cmd->getValue() == "tid_intersect") {
+
+        if(cmd_inputfiles->getValue().size() != 2) {
+            LOG(ERROR) << "exactly two files required for tid intersect!";
+            return EXIT_FAILURE;
+        }
+
+        const auto treename = cmd_treename->isSet() ? cmd_treename->getValue() : "treeEvents";
+
+        TIDIndex index[2];
+        for(int i=0;i<2;i++) {
+            const auto& filename = cmd_inputfiles->getValue().at(i);
+            WrapTFileInput file(filename);
+            if(!index[i].Read(file, treename)) {
+                LOG(ERROR) << "No TID index for tree " << treename << " in " << filename;
+                return 10+i;
+            }
+        }
+
+        const auto common = TIDIndex::Intersect(index[0], index[1]);
+        LOG(INFO) << "Entries with common TID: " << common.size()
+                  << " (of " << index[0].Size() << " and " << index[1].Size() << ")";
+
     } else {
 
         const auto treename = cmd_treename->getValue();
@@ -2,6 +2,8 @@
   * @file Ant.cc
   * @brief Main Ant executable
   *
+  * Started as "Ant --daemon <socket> -s <setup>", it keeps the given setups loaded
+  * and runs the jobs submitted by "Ant --submit <socket> <usual arguments>".
   */
 
 #include "analysis/input/DataReader.h"
@@ -18,6 +20,9 @@
 #include "calibration/DataBase.h"
 
 #include "unpacker/Unpacker.h"
+#include "unpacker/UnpackerA2Geant.h"
+#include "unpacker/UnpackerAcqu.h"
+#include "unpacker/UnpackerRawHitsCache.h"
 #include "unpacker/RawFileReader.h"
 
 #include "reconstruct/Reconstruct.h"
@@ -32,14 +37,21 @@
 #include "base/std_ext/system.h"
 #include "base/std_ext/container.h"
 #include "base/GitInfo.h"
+#include "base/CounterRNG.h"
+#include "base/StageTimer.h"
+
+#include "detail/AntDaemon.h"
 
 #include "TRint.h"
 #include "TSystem.h"
 #include "TROOT.h"
+#include "RVersion.h"
 
 #include <sstream>
 #include <string>
 #include <csignal>
+#include <map>
+#include <thread>
 
 using namespace std;
 using namespace ant;
@@ -47,8 +59,14 @@ using namespace ant;
 volatile bool interrupt = false;
 volatile bool terminated = false;
 
+// set in the jobs run by the daemon
+bool daemon_job = false;
+// loaded by the daemon, by PID cuts directory and raster size
+map<pair<string, unsigned>, unique_ptr<analysis::utils::ParticleID>> warm_particleIDs;
 
-int main(int argc, char** argv) {
+constexpr unsigned DefaultRasterParticleID = 256;
+
+int run(int argc, char** argv) {
     SetupLogger();
 
     signal(SIGINT, [] (int) {
@@ -86,17 +104,37 @@ int main(int argc, char** argv) {
     auto cmd_calibrations  = cmd.add<TCLAP::MultiArg<string>>("c","calibration","Calibration to run",false,"calibration");
 
     auto cmd_u_disablerecon  = cmd.add<TCLAP::SwitchArg>("","u_disablereconstruct","Unpacker: Disable Reconstruct (disables also all analysis)",false);
+    auto cmd_u_treecache  = cmd.add<TCLAP::ValueArg<long long>>("","u_treecache","Unpacker: Size of Geant input tree cache in MB (0 uses ROOT's default)",false,0,"MB");
+    auto cmd_u_readahead  = cmd.add<TCLAP::ValueArg<unsigned>>("","u_readahead","Unpacker: Unpack that many Geant events ahead on helper thread (0 disables)",false,0,"events");
+    auto cmd_u_acquworkers  = cmd.add<TCLAP::ValueArg<unsigned>>("","u_acquworkers","Unpacker: Unpack Acqu records on that many worker threads (0 disables)",false,0,"threads");
+    auto cmd_u_writecache  = cmd.add<TCLAP::ValueArg<string>>("","u_writecache","Unpacker: Write the unpacked raw hits to this cache file, which can be given as input later",false,"","filename");
+    auto cmd_u_recocache  = cmd.add<TCLAP::ValueArg<string>>("","u_reconstructcache","Unpacker: Reuse reconstructed events from this cache file if their calibration did not change, updates the cache",false,"","filename");
+
+    auto cmd_timers = cmd.add<TCLAP::SwitchArg>("","timers","Measure the latencies of the processing stages, written as histograms to output file",false);
+    auto cmd_startupprofile = cmd.add<TCLAP::SwitchArg>("","startup_profile","Report the time spent creating setups, calibrations, mappings and physics classes (implies --timers)",false);
+    auto cmd_checkpoint = cmd.add<TCLAP::ValueArg<unsigned>>("","checkpoint","Save a checkpoint <output>.checkpoint that often, to be resumed after interruption",false,600,"seconds");
+    auto cmd_resume = cmd.add<TCLAP::SwitchArg>("","resume","Resume from the checkpoint <output>.checkpoint (if existing), input and physics must be the same",false);
+    auto cmd_seed = cmd.add<TCLAP::ValueArg<unsigned long long>>("","seed","Seed for the random numbers of MC smearing and simulation (reproducible per event)",false,0,"seed");
 
     auto cmd_p_disableParticleID  = cmd.add<TCLAP::SwitchArg>("","p_disableParticleID","Physics: Disable ParticleID",false);
     auto cmd_p_simpleParticleID  = cmd.add<TCLAP::SwitchArg>("","p_simpleParticleID","Physics: Use simple ParticleID (just protons/photons)",false);
+    auto cmd_p_rasterParticleID  = cmd.add<TCLAP::ValueArg<unsigned>>("","p_rasterParticleID","Physics: Grid size for rasterized ParticleID cuts (0 tests polygons only)",false,DefaultRasterParticleID,"bins");
+    auto cmd_p_compressionthreads  = cmd.add<TCLAP::ValueArg<unsigned>>("","p_compressionthreads","Physics: Compress baskets of saved events in parallel, using ROOT implicit MT with that many threads (0 disables)",false,0,"threads");
 
 
 
     cmd.parse(argc, argv);
     if(cmd_verbose->isSet()) {
         el::Loggers::setVerboseLevel(cmd_verbose->getValue());
+        LOG_IF(!VLOG_IS_COMPILED(cmd_verbose->getValue()), WARNING)
+                << "Verbose logs above level " << ANT_MAX_VLOG_LEVEL
+                << " are compiled out, configure with -DAnt_MAX_VLOG_LEVEL=9 to get them";
     }
 
+    // the setup might be created right away
+    if(cmd_startupprofile->isSet())
+        StageTimer::Enable();
+
     // progress updates only when running interactively
     if(std_ext::system::isInteractive())
         ProgressCounter::Interval = 3;
@@ -119,6 +157,9 @@ int main(int argc, char** argv) {
         for(const auto& opt : cmd_setupOptions->getValue()) {
             setup_opts->SetOption(opt);
         }
+        // setups kept by the daemon were created without these options
+        if(daemon_job)
+            ExpConfig::Setup::Cleanup();
         ant::expconfig::SetupRegistry::SetSetupOptions(setup_opts);
     }
 
@@ -155,6 +196,14 @@ int main(int argc, char** argv) {
     }
 
 
+    CounterRNG::SetSeed(cmd_seed->getValue());
+    StageTimer::Enable(cmd_timers->getValue() || cmd_startupprofile->getValue());
+
+    UnpackerA2Geant::IOSettings.CacheSize = cmd_u_treecache->getValue()*1024*1024;
+    UnpackerA2Geant::IOSettings.ReadAhead = cmd_u_readahead->getValue();
+    UnpackerAcqu::Settings.Workers = cmd_u_acquworkers->getValue();
+    analysis::PhysicsManager::IOSettings.ParallelCompression = cmd_p_compressionthreads->getValue()>0;
+
     // now we can try to open the files with an unpacker
     std::unique_ptr<Unpacker::Module> unpacker = nullptr;
     for(const auto& inputfile : cmd_input->getValue()) {
@@ -182,6 +231,15 @@ int main(int argc, char** argv) {
     }
 
 
+    if(unpacker && cmd_u_writecache->isSet()) {
+        if(!dynamic_cast<UnpackerAcqu*>(unpacker.get())) {
+            LOG(ERROR) << "Raw hits cache can only be written for Acqu raw data";
+            return EXIT_FAILURE;
+        }
+        LOG(INFO) << "Writing raw hits cache " << cmd_u_writecache->getValue();
+        unpacker = std_ext::make_unique<UnpackerRawHitsCache::Writer>(move(unpacker), cmd_u_writecache->getValue());
+    }
+
     // we can finally we can create the available input readers
     // for the analysis
 
@@ -192,7 +250,11 @@ int main(int argc, char** argv) {
         std::unique_ptr<Reconstruct_traits> reconstruct;
         if(!cmd_u_disablerecon->isSet()) {
             try {
-                reconstruct = std_ext::make_unique<Reconstruct>();
+                StageTimer::Scope timing(StageTimer::Get("Startup/Reconstruct"));
+                auto reconstruct_ = std_ext::make_unique<Reconstruct>();
+                if(cmd_u_recocache->isSet())
+                    reconstruct_->EnableCache(cmd_u_recocache->getValue());
+                reconstruct = move(reconstruct_);
             }
             catch(ExpConfig::ExceptionNoSetup&) {
                 LOG(WARNING) << "Cannot activate reconstruct without setup";
@@ -243,6 +305,12 @@ int main(int argc, char** argv) {
         return EXIT_FAILURE;
     }
 
+    const bool checkpoints = cmd_checkpoint->isSet() || cmd_resume->isSet();
+    if(checkpoints && !cmd_output->isSet()) {
+        LOG(ERROR) << "Checkpoints need an output file";
+        return EXIT_FAILURE;
+    }
+
     // the real output file, create it here to get all
     // further ROOT objects into this output file
     unique_ptr<WrapTFileOutput> masterFile;
@@ -342,12 +410,18 @@ int main(int argc, char** argv) {
 
     if(!cmd_p_disableParticleID->isSet()) {
         try {
+            StageTimer::Scope timing(StageTimer::Get("Startup/ParticleID"));
             unique_ptr<analysis::utils::ParticleID> particleID;
             if(cmd_p_simpleParticleID->isSet()) {
                 particleID = std_ext::make_unique<analysis::utils::SimpleParticleID>();
             } else {
                 auto& setup = ExpConfig::Setup::Get();
-                particleID = std_ext::make_unique<analysis::utils::CBTAPSBasicParticleID>(setup.GetPIDCutsDirectory());
+                auto it_warm = warm_particleIDs.find(make_pair(setup.GetPIDCutsDirectory(), cmd_p_rasterParticleID->getValue()));
+                if(it_warm != warm_particleIDs.end() && it_warm->second)
+                    particleID = move(it_warm->second);
+                else
+                    particleID = std_ext::make_unique<analysis::utils::CBTAPSBasicParticleID>(setup.GetPIDCutsDirectory(),
+                                                                                              cmd_p_rasterParticleID->getValue());
             }
             analysis::utils::ParticleID::SetDefault(move(particleID));
         }
@@ -364,10 +438,24 @@ int main(int argc, char** argv) {
             :  numeric_limits<long long>::max();
 
 
+    if(checkpoints)
+        pm.EnableCheckpoints(cmd_output->getValue()+".checkpoint", cmd_checkpoint->getValue(), cmd_resume->isSet());
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+    // enabled only now, such that the trees of the readers and physics classes
+    // were created without implicit MT, only treeEvents uses it
+    if(cmd_p_compressionthreads->getValue()>0)
+        ROOT::EnableImplicitMT(cmd_p_compressionthreads->getValue());
+#endif
+
     // this method does the hard work...
     pm.ReadFrom(move(readers), maxevents);
     rootfiles = nullptr; // cleanup opened ROOT files for reading
 
+    // after reading, as the setup might have been found by the first event
+    if(cmd_startupprofile->isSet())
+        LOG(INFO) << "Startup profile:\n" << StageTimer::Profile("Startup/");
+
     TAntHeader* header = new TAntHeader();
     gDirectory->Add(header);
     {
@@ -422,3 +510,91 @@ int main(int argc, char** argv) {
 
     return EXIT_SUCCESS;
 }
+
+int run_daemon(int argc, char** argv) {
+    SetupLogger();
+
+    signal(SIGINT, [] (int) {
+        cout << ">>> Interrupted" << endl;
+        interrupt = true;
+    });
+
+    signal(SIGTERM, [] (int) {
+        cout << ">>> Terminated" << endl;
+        interrupt = true;
+    });
+
+    TCLAP::CmdLine cmd("Ant daemon", ' ', "0.1");
+
+    auto cmd_verbose = cmd.add<TCLAP::ValueArg<int>>("v","verbose","Verbosity level (0..9)", false, 0,"int");
+    auto cmd_daemon = cmd.add<TCLAP::ValueArg<string>>("","daemon","Run jobs submitted to this socket by Ant --submit <socket> <usual arguments>",true,"","socket");
+    auto cmd_workers = cmd.add<TCLAP::ValueArg<unsigned>>("","workers","Number of jobs running in parallel",false,max(1u, thread::hardware_concurrency()),"jobs");
+
+    TCLAP::ValuesConstraintExtra<decltype(ExpConfig::Setup::GetNames())> allowedsetupnames(ExpConfig::Setup::GetNames());
+    auto cmd_setups = cmd.add<TCLAP::MultiArg<string>>("s","setup","Keep this setup loaded",false,&allowedsetupnames);
+
+    cmd.parse(argc, argv);
+    if(cmd_verbose->isSet()) {
+        el::Loggers::setVerboseLevel(cmd_verbose->getValue());
+    }
+
+    ant::calibration::DataBase::OnDiskLayout::EnableCaching = true;
+
+    // everything loaded here is inherited by the forked jobs,
+    // but note that the calibration data itself is loaded lazily per TID,
+    // so it is reloaded in every job. Only the scan of the database layout is kept
+    for(const auto& setupname : cmd_setups->getValue()) {
+        ExpConfig::Setup::SetByName(setupname);
+        auto& setup = ExpConfig::Setup::Get();
+        // builds the detectors, hooks and calibration modules
+        Reconstruct reconstruct;
+        if(auto calmgr = setup.GetCalibrationDataManager()) {
+            // fills the cached data ranges of each calibration ID
+            for(const auto& calibrationID : calmgr->GetCalibrationIDs())
+                calmgr->GetNumberOfCalibrationData(calibrationID);
+        }
+        const auto pidcutsdir = setup.GetPIDCutsDirectory();
+        warm_particleIDs[make_pair(pidcutsdir, DefaultRasterParticleID)]
+                = std_ext::make_unique<analysis::utils::CBTAPSBasicParticleID>(pidcutsdir, DefaultRasterParticleID);
+        LOG(INFO) << "Loaded setup " << setupname;
+    }
+    // jobs choose their setup themselves
+    ExpConfig::Setup::Unset();
+
+    try {
+        return progs::daemon::Serve(cmd_daemon->getValue(), cmd_workers->getValue(),
+                                    [] (const vector<string>& args) {
+            daemon_job = true;
+            vector<char*> job_argv;
+            for(const auto& arg : args)
+                job_argv.push_back(const_cast<char*>(arg.c_str()));
+            job_argv.push_back(nullptr);
+            return run(int(args.size()), job_argv.data());
+        }, addressof(interrupt));
+    }
+    catch(const progs::daemon::Exception& e) {
+        LOG(ERROR) << e.what();
+        return EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char** argv) {
+    // daemon and submitting to it are told by the first argument
+    if(argc > 1 && string(argv[1]) == "--daemon")
+        return run_daemon(argc, argv);
+
+    if(argc > 2 && string(argv[1]) == "--submit") {
+        SetupLogger();
+        vector<string> args{argv[0]};
+        args.insert(args.end(), argv+3, argv+argc);
+        try {
+            return progs::daemon::Submit(argv[2], args);
+        }
+        catch(const progs::daemon::Exception& e) {
+            LOG(ERROR) << e.what();
+            return EXIT_FAILURE;
+        }
+    }
+
+    return run(argc, argv);
+}
@@ -5,6 +5,7 @@
 
 #include "tree/TEvent.h"
 #include "tree/TEventData.h"
+#include "tree/TIDIndex.h"
 
 #include "TTree.h"
 #include "TRint.h"
@@ -65,22 +66,32 @@ int main( int argc, char** argv )
     tree1->SetBranchAddress("data",addressof(event1));
     tree2->SetBranchAddress("data",addressof(event2));
 
-    long long entry1 = 0;
-    long long entry2 = 0;
-
     long long maxevents = cmd_maxevents->isSet()
             ? cmd_maxevents->getValue().back()
             :  numeric_limits<long long>::max();
     long long nEvents = 0;
 
+    // align entries by TID if both files provide an index,
+    // otherwise compare them in lockstep
+    vector<pair<long long, long long>> entries;
+    TIDIndex index1, index2;
+    if(index1.Read(input1, "treeEvents") && index2.Read(input2, "treeEvents")) {
+        entries = TIDIndex::Intersect(index1, index2);
+        LOG(INFO) << "Using TID index, found " << entries.size() << " common events";
+    }
+    else {
+        const auto n = min(tree1->GetEntries(), tree2->GetEntries());
+        for(long long entry=0;entry<n;entry++)
+            entries.emplace_back(entry, entry);
+    }
 
-    while(entry1 < tree1->GetEntries() && entry2 < tree2->GetEntries()) {
+    for(const auto& entry : entries) {
 
         if(interrupt)
             break;
 
-        tree1->GetEntry(entry1);
-        tree2->GetEntry(entry2);
+        tree1->GetEntry(entry.first);
+        tree2->GetEntry(entry.second);
 
         const TEventData& recon1 = event1->Reconstructed();
         const TEventData& recon2 = event2->Reconstructed();
@@ -99,8 +110,6 @@ int main( int argc, char** argv )
         nEvents++;
         if(nEvents==maxevents)
             break;
-        entry1++;
-        entry2++;
     }
 
     LOG(INFO) << "Compared " << nEvents << " events";
@@ -0,0 +1,302 @@
+#include "AntDaemon.h"
+
+#include "base/std_ext/system.h"
+#include "base/std_ext/string.h"
+#include "base/Logger.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <csignal>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cerrno>
+#include <map>
+#include <iostream>
+
+using namespace std;
+using namespace ant;
+using namespace ant::progs;
+
+namespace {
+
+// sent after the output of a job, followed by its exit code
+constexpr char     TrailerMarker[4] = {'A','n','t','X'};
+constexpr size_t   TrailerSize = sizeof(TrailerMarker) + sizeof(int32_t);
+// sanity limits for job messages
+constexpr uint32_t MaxArgs = 1 << 16;
+constexpr uint32_t MaxStringSize = 1 << 20;
+
+sockaddr_un makeAddress(const string& socketpath)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if(socketpath.size() >= sizeof(address.sun_path))
+        throw daemon::Exception("Socket path too long: "+socketpath);
+    strncpy(address.sun_path, socketpath.c_str(), sizeof(address.sun_path)-1);
+    return address;
+}
+
+int connectTo(const string& socketpath)
+{
+    const auto address = makeAddress(socketpath);
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0)
+        throw daemon::Exception(std_ext::formatter() << "Cannot create socket: " << strerror(errno));
+    if(connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool writeAll(int fd, const void* data, size_t size)
+{
+    auto ptr = reinterpret_cast<const char*>(data);
+    while(size>0) {
+        const auto n = write(fd, ptr, size);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            return false;
+        ptr += n;
+        size -= n;
+    }
+    return true;
+}
+
+bool readAll(int fd, void* data, size_t size)
+{
+    auto ptr = reinterpret_cast<char*>(data);
+    while(size>0) {
+        const auto n = read(fd, ptr, size);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            return false;
+        ptr += n;
+        size -= n;
+    }
+    return true;
+}
+
+bool writeString(int fd, const string& s)
+{
+    const uint32_t n = s.size();
+    return writeAll(fd, &n, sizeof(n)) && writeAll(fd, s.data(), s.size());
+}
+
+bool readString(int fd, string& s)
+{
+    uint32_t n = 0;
+    if(!readAll(fd, &n, sizeof(n)) || n > MaxStringSize)
+        return false;
+    s.resize(n);
+    return n == 0 || readAll(fd, &s[0], n);
+}
+
+void sendTrailer(int fd, int32_t code)
+{
+    char trailer[TrailerSize];
+    memcpy(trailer, TrailerMarker, sizeof(TrailerMarker));
+    memcpy(trailer+sizeof(TrailerMarker), &code, sizeof(code));
+    // client might have gone already
+    writeAll(fd, trailer, sizeof(trailer));
+}
+
+} // namespace
+
+int daemon::Serve(const string& socketpath, unsigned workers, const job_t& job, volatile bool* interrupt)
+{
+    {
+        const int fd = connectTo(socketpath);
+        if(fd >= 0) {
+            close(fd);
+            throw Exception("Another daemon is listening on "+socketpath);
+        }
+    }
+    // remove stale socket of previous daemon
+    unlink(socketpath.c_str());
+
+    const auto address = makeAddress(socketpath);
+    const int listenfd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listenfd < 0)
+        throw Exception(std_ext::formatter() << "Cannot create socket: " << strerror(errno));
+
+    // jobs run as the user of the daemon, so only that user may connect:
+    // the socket is created with mode 0600 right away
+    const auto prev_umask = umask(S_IRWXG | S_IRWXO | S_IXUSR);
+    const bool bound = bind(listenfd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    umask(prev_umask);
+    if(!bound || listen(listenfd, 64) != 0)
+        throw Exception(std_ext::formatter() << "Cannot listen on " << socketpath << ": " << strerror(errno));
+
+    // clients going away must not kill the daemon,
+    // and finished jobs should wake up the poll below
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGCHLD, [] (int) {});
+
+    LOG(INFO) << "Accepting jobs on " << socketpath << " with " << workers << " workers";
+
+    // running jobs with their client connection
+    map<pid_t, int> running;
+
+    auto reap = [&running] (bool block) {
+        int status = 0;
+        pid_t pid;
+        while((pid = waitpid(-1, addressof(status), block ? 0 : WNOHANG)) > 0) {
+            block = false;
+            auto it = running.find(pid);
+            if(it == running.end())
+                continue;
+            const int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128+WTERMSIG(status);
+            VLOG(3) << "Job " << pid << " finished with exit code " << code;
+            sendTrailer(it->second, code);
+            close(it->second);
+            running.erase(it);
+        }
+    };
+
+    unsigned long long nJobs = 0;
+    while(!*interrupt) {
+        reap(false);
+
+        // further jobs wait in the backlog until a worker is free
+        pollfd p{running.size() < workers ? listenfd : -1, POLLIN, 0};
+        if(poll(addressof(p), 1, 1000) <= 0 || !(p.revents & POLLIN))
+            continue;
+
+        const int conn = accept(listenfd, nullptr, nullptr);
+        if(conn < 0)
+            continue;
+
+        string cwd;
+        uint32_t nArgs = 0;
+        bool good = readString(conn, cwd) && readAll(conn, addressof(nArgs), sizeof(nArgs))
+                    && nArgs > 0 && nArgs < MaxArgs;
+        vector<string> args(good ? nArgs : 0);
+        for(auto& arg : args)
+            good = good && readString(conn, arg);
+        if(!good) {
+            LOG(WARNING) << "Ignoring malformed job";
+            close(conn);
+            continue;
+        }
+
+        std_ext::formatter cmdline;
+        for(const auto& arg : args)
+            cmdline << arg << " ";
+
+        const pid_t pid = fork();
+        if(pid < 0) {
+            LOG(ERROR) << "Cannot fork job: " << strerror(errno);
+            sendTrailer(conn, EXIT_FAILURE);
+            close(conn);
+            continue;
+        }
+
+        if(pid == 0) {
+            // in the job process now
+            close(listenfd);
+            for(const auto& r : running)
+                close(r.second);
+            signal(SIGPIPE, SIG_DFL);
+            signal(SIGCHLD, SIG_DFL);
+
+            cout.flush();
+            cerr.flush();
+            // the daemon's terminal is not the job's,
+            // also makes Ant not start a ROOT shell without -b
+            const int devnull = open("/dev/null", O_RDONLY);
+            if(devnull >= 0) {
+                dup2(devnull, STDIN_FILENO);
+                close(devnull);
+            }
+            dup2(conn, STDOUT_FILENO);
+            dup2(conn, STDERR_FILENO);
+            close(conn);
+
+            int code = EXIT_FAILURE;
+            if(chdir(cwd.c_str()) != 0) {
+                cerr << "Cannot change to working directory " << cwd << endl;
+            }
+            else {
+                try {
+                    code = job(args);
+                }
+                catch(const std::exception& e) {
+                    cerr << "Job failed: " << e.what() << endl;
+                }
+            }
+
+            cout.flush();
+            cerr.flush();
+            fflush(nullptr);
+            // the static objects belong to the daemon, don't destroy them
+            _exit(code);
+        }
+
+        nJobs++;
+        LOG(INFO) << "Started job " << pid << " in " << cwd << ": " << cmdline.str();
+        running.emplace(pid, conn);
+    }
+
+    LOG(INFO) << "Stopping, waiting for " << running.size() << " running jobs";
+    while(!running.empty())
+        reap(true);
+
+    close(listenfd);
+    unlink(socketpath.c_str());
+    LOG(INFO) << "Served " << nJobs << " jobs";
+    return EXIT_SUCCESS;
+}
+
+int daemon::Submit(const string& socketpath, const vector<string>& args)
+{
+    const int fd = connectTo(socketpath);
+    if(fd < 0)
+        throw Exception(std_ext::formatter() << "Cannot connect to daemon at " << socketpath << ": " << strerror(errno));
+
+    const uint32_t nArgs = args.size();
+    bool good = writeString(fd, std_ext::system::getCwd()) && writeAll(fd, addressof(nArgs), sizeof(nArgs));
+    for(const auto& arg : args)
+        good = good && writeString(fd, arg);
+    if(!good) {
+        close(fd);
+        throw Exception("Cannot submit job to daemon at "+socketpath);
+    }
+
+    // pass the output through, but hold back what might be the trailer
+    vector<char> pending;
+    char buffer[4096];
+    while(true) {
+        const auto n = read(fd, buffer, sizeof(buffer));
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            break;
+        pending.insert(pending.end(), buffer, buffer+n);
+        if(pending.size() > TrailerSize) {
+            const auto nOutput = pending.size() - TrailerSize;
+            fwrite(pending.data(), 1, nOutput, stdout);
+            fflush(stdout);
+            pending.erase(pending.begin(), pending.begin()+nOutput);
+        }
+    }
+    close(fd);
+
+    if(pending.size() != TrailerSize || memcmp(pending.data(), TrailerMarker, sizeof(TrailerMarker)) != 0) {
+        fwrite(pending.data(), 1, pending.size(), stdout);
+        throw Exception("Connection to daemon lost before job finished");
+    }
+    int32_t code = 0;
+    memcpy(addressof(code), pending.data()+sizeof(TrailerMarker), sizeof(code));
+    return code;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+
+namespace ant {
+namespace progs {
+namespace daemon {
+
+/**
+ * @brief job_t runs one submitted job, given its command line (including the program name)
+ * @return exit code of the job
+ */
+using job_t = std::function<int(const std::vector<std::string>& args)>;
+
+/**
+ * @brief Serve accepts jobs on a Unix socket until interrupted
+ *
+ * Each job runs in a forked child process, which inherits everything
+ * the daemon has loaded so far (setups, calibration data, ...) and
+ * is isolated from the other jobs. The output of the job is sent back to the
+ * submitting client, followed by the exit code once the child has finished.
+ *
+ * @param socketpath path of the socket, must not be in use by another daemon
+ * @param workers maximum number of jobs running in parallel, further jobs wait in the socket's backlog
+ * @param job called in the child process for each submitted job
+ * @param interrupt stops accepting new jobs, running jobs are waited for
+ * @return exit code of the daemon
+ */
+int Serve(const std::string& socketpath, unsigned workers, const job_t& job, volatile bool* interrupt);
+
+/**
+ * @brief Submit runs a job in the daemon listening on the given socket
+ * @param socketpath the socket of the daemon
+ * @param args command line of the job, working directory is the current one
+ * @return exit code of the job
+ * @throw Exception if the daemon is not reachable
+ */
+int Submit(const std::string& socketpath, const std::vector<std::string>& args);
+
+class Exception : public std::runtime_error {
+    using std::runtime_error::runtime_error; // use base class constructor
+};
+
+}}} // namespace ant::progs::daemon
@@ -121,6 +121,13 @@ bool GoatReader::treeDetectorHitInput_t::LinkBranches(const WrapTFileInput& inpu
     MWPC.LinkBranches(tree);
     BaF2.LinkBranches(tree);
     Veto.LinkBranches(tree);
+    // all share the same tree, so only the first one deactivates the other branches
+    NaI.PruneBranches();
+    PID.PruneBranches(false);
+    MWPC.PruneBranches(false);
+    BaF2.PruneBranches(false);
+    Veto.PruneBranches(false);
+    enable_cache(NaI, PID, MWPC, BaF2, Veto);
     insert_trees(trees, NaI, PID, MWPC, BaF2, Veto);
     return true;
 }
@@ -130,6 +137,8 @@ bool GoatReader::treeTaggerInput_t::LinkBranches(const WrapTFileInput& input, tr
     if(!input.GetObject("tagger",t.Tree))
         return false;
     t.LinkBranches();
+    t.PruneBranches();
+    enable_cache(t);
     insert_trees(trees, t);
     return true;
 }
@@ -142,6 +151,8 @@ bool GoatReader::treeTriggerInput_t::LinkBranches(const WrapTFileInput& input, t
         return false;
     t.LinkBranches();
     tEventParams.LinkBranches();
+    t.PruneBranches();
+    tEventParams.PruneBranches();
 
     if(t.MC_evt_id.IsPresent ^ t.MC_rnd_id.IsPresent)
         throw Exception("Branch MC_evt_id and MC_rnd_id inconsistenly present");
@@ -149,6 +160,7 @@ bool GoatReader::treeTriggerInput_t::LinkBranches(const WrapTFileInput& input, t
     LOG_IF(!t.helicity.IsPresent,  WARNING) << "Helicity bit information not found in input";
     LOG_IF(!t.MC_evt_id.IsPresent, WARNING) << "MC_evt_id/MC_rnd_id not found in input";
 
+    enable_cache(t, tEventParams);
     insert_trees(trees, t, tEventParams);
     return true;
 }
@@ -158,6 +170,8 @@ bool GoatReader::treeTrackInput_t::LinkBranches(const WrapTFileInput& input, tre
     if(!input.GetObject("tracks", t.Tree))
         return false;
     t.LinkBranches();
+    t.PruneBranches();
+    enable_cache(t);
     insert_trees(trees, t);
     return true;
 }
@@ -7,6 +7,7 @@
 
 #include <string>
 #include <set>
+#include <initializer_list>
 
 namespace ant {
 
@@ -134,6 +135,12 @@ protected:
         trees.insert({std::ref(static_cast<TTree&>(*args.Tree))...});
     }
 
+    template<typename... Args>
+    static void enable_cache(Args&... args) {
+        // pack expansion in initializer list to call it in order
+        (void)std::initializer_list<int>{(args.EnableCache(), 0)...};
+    }
+
     trees_t trees;
     long long current_entry;
     long long max_entries;
@@ -17,6 +17,7 @@
 #include "base/Logger.h"
 #include "base/std_ext/string.h"
 #include "base/std_ext/container.h"
+#include "base/std_ext/memory.h"
 
 #include "TTree.h"
 
@@ -61,37 +62,35 @@ PlutoReader::PlutoReader(const std::shared_ptr<WrapTFileInput>& rootfiles) :
     }
 
     pluto_database = makeStaticData();
+    // looking up by name is expensive, so do it only once
+    dileptonID = pluto_database->GetParticleID("dilepton");
+    dimuonID   = pluto_database->GetParticleID("dimuon");
 }
 
 PlutoReader::~PlutoReader() {}
 
-/**
- * @brief Find a PParticle in a vector by its ID. ID has to be unique in the vector.
- * @param particles vector to search
- * @param ID Id to look for
- * @return pair<size_t,bool>, first=Index of found particle, bool: true if found and unique, false else
- */
-std::pair<std::size_t,bool> FindParticleByID(const std::vector<const PParticle*> particles, const int ID) {
-
-    std::pair<std::size_t,bool> result = {0, false};
-
+void PlutoReader::id_index_t::Build(const std::vector<const PParticle*>& particles)
+{
+    Map.clear();
+    Map.reserve(particles.size());
     for(std::size_t i = 0; i<particles.size(); ++i) {
-        if(particles.at(i)->ID() == ID) {
-            if(!result.second) {
-                result.first = i;
-                result.second = true;
-            } else {
-                result.second = false;
-                return result;
-            }
-        }
+        auto r = Map.emplace(particles[i]->ID(), long(i));
+        if(!r.second)
+            r.first->second = NotUnique;
     }
+    Built = true;
+}
 
-    return result;
-
+long PlutoReader::id_index_t::Find(const std::vector<const PParticle*>& particles, int ID)
+{
+    // build lazily, but at most once per event
+    if(!Built)
+        Build(particles);
+    auto it = Map.find(ID);
+    return it == Map.end() ? NotUnique : it->second;
 }
 
-std::string PlutoTable(const std::vector<const PParticle*> particles) {
+std::string PlutoTable(const std::vector<const PParticle*>& particles) {
     stringstream s;
     int i=0;
     s << "Index\tParticleName\tParentIndex\tNameOfParent\t|\tDaughterIndex\n";
@@ -107,23 +106,15 @@ using PlutoParticles_t = std::vector<const PParticle*>;
 
 bool BuildParticleGunTree(
         TParticleTree_t& mctrueTree,
-        const PlutoParticles_t& plutoParticles,
-        const vector<TParticleTree_t>& flatTree)
+        const vector<TParticleTree_t>& flatTree,
+        bool maybeGun)
 {
     // any particle with parent or daughter
-    // means it's not a gun
-    for(auto& plutoParticle : plutoParticles) {
-        if(plutoParticle->GetParentIndex()>=0)
-            return false;
-        if(plutoParticle->GetDaughterIndex()>=0)
-            return false;
-    }
-
+    // means it's not a gun,
     // BeamTarget type is also not allowed in guns
-    for(auto& antParticleTree : flatTree) {
-        if(antParticleTree->Get()->Type() == ParticleTypeDatabase::BeamTarget)
-            return false;
-    }
+    // (both already checked while converting the particles)
+    if(!maybeGun)
+        return false;
 
     // build a  tree with all particles as leaves and
     // "pseudo" GunParticle as headnode
@@ -142,26 +133,28 @@ bool BuildParticleGunTree(
 }
 
 
+template<typename FindByID>
 bool BuildDecayTree(
         TParticleTree_t& mctrueTree,
         const PlutoParticles_t& plutoParticles,
         const vector<TParticleTree_t>& flatTree,
-        const std::vector<size_t>& dileptonIndices)
+        const std::vector<size_t>& dileptonIndices,
+        FindByID findByID)
 {
     // loop over both lists (pluto and and the flat tree)
     // in parallel
     bool missing_decay_treeinfo = false;
     for(size_t i=0; i<plutoParticles.size(); ++i) {
 
-        auto plutoParticle = plutoParticles.at(i);
-        auto& treeNode = flatTree.at(i);
+        auto plutoParticle = plutoParticles[i];
+        auto& treeNode = flatTree[i];
 
         auto parent_index = plutoParticle->GetParentIndex();
 
         // Set up tree relations (parent/daughter)
         if(parent_index >= 0 && size_t(parent_index) < flatTree.size()) {
 
-            treeNode->SetParent(flatTree.at(parent_index));
+            treeNode->SetParent(flatTree[size_t(parent_index)]);
 
         } else {
 
@@ -176,11 +169,11 @@ bool BuildDecayTree(
             }
             else
             {
-                auto search_result = FindParticleByID(plutoParticles, plutoParticle->GetParentId());
+                const long parent = findByID(plutoParticle->GetParentId());
 
-                if(search_result.second) {
+                if(parent >= 0) {
                     VLOG(7) << "Recovered missing pluto decay tree information.";
-                    treeNode->SetParent(flatTree.at(search_result.first));
+                    treeNode->SetParent(flatTree[size_t(parent)]);
                 } else {
                     // recovery failed
                     missing_decay_treeinfo = true;
@@ -218,35 +211,47 @@ bool BuildDecayTree(
 void PlutoReader::CopyPluto(TEventData& mctrue)
 {
     const auto nParticles = plutoTree.Particles().GetEntries();
-    PlutoParticles_t plutoParticles;
-    plutoParticles.reserve(size_t(nParticles));
 
-    std::vector<size_t> dileptonIndices;
+    // clear per event buffers, but keep their memory
+    plutoParticles.clear();
+    flatTree.clear();
+    dileptonIndices.clear();
+    isDilepton.clear();
+    finalstateParticles.clear();
+    idIndex.Reset();
+
+    plutoParticles.reserve(size_t(nParticles));
+    flatTree.reserve(size_t(nParticles));
+    isDilepton.reserve(size_t(nParticles));
 
     for(auto i=0;i<nParticles;++i) {
         auto particle = dynamic_cast<const PParticle*>(plutoTree.Particles()[i]);
         // remember positions of those weird dilepton/dimuon particles
-        if(particle->ID() == pluto_database->GetParticleID("dilepton") ||
-           particle->ID() == pluto_database->GetParticleID("dimuon"))
-            dileptonIndices.push_back(i);
+        const bool dilepton = particle->ID() == dileptonID || particle->ID() == dimuonID;
+        if(dilepton)
+            dileptonIndices.push_back(size_t(i));
+        isDilepton.push_back(dilepton);
         plutoParticles.push_back(particle);
     }
 
+    // while converting, check if this could be a particle gun event
+    bool maybeGun = true;
 
-    vector<TParticleTree_t> flatTree;
-    TParticleList finalstateParticles;
     // convert pluto particles to ant particles and place in buffer list
     for(size_t i=0; i<plutoParticles.size(); ++i) {
 
         auto& plutoParticle = plutoParticles[i];
 
+        if(plutoParticle->GetParentIndex()>=0 || plutoParticle->GetDaughterIndex()>=0)
+            maybeGun = false;
+
         // find pluto type in database
         auto type = ParticleTypeDatabase::GetTypeFromPlutoID( plutoParticle->ID() );
 
         // note that type might by nullptr (in particular for those dileptons...)
         // then just add some "empty" tree node
         if(!type) {
-            if(!std_ext::contains(dileptonIndices, i))
+            if(!isDilepton[i])
                 // check $PLUTOSYS/src/PStdData.cc what to do, you may add it to the ant Database if you wish
                 throw Exception(std_ext::formatter() << "Unknown pluto particle found: ID="
                                 << plutoParticle->ID());
@@ -258,7 +263,7 @@ void PlutoReader::CopyPluto(TEventData& mctrue)
         // make an AntParticle out of it
         LorentzVec lv = *plutoParticle;
         lv *= 1000.0;   // convert to MeV
-        auto antParticle = make_shared<TParticle>(*type,lv);
+        auto antParticle = std_ext::make_pooled<TParticle>(*type,lv);
 
         // Consider final state particle
         if(plutoParticle->GetDaughterIndex() == -1 ) { // final state
@@ -267,6 +272,7 @@ void PlutoReader::CopyPluto(TEventData& mctrue)
 
         // Simulate some tagger hit
         if( antParticle->Type() == ParticleTypeDatabase::BeamTarget) {
+            maybeGun = false;
             const double energy = antParticle->Ek();
             unsigned channel = 0;
             if(tagger && tagger->TryGetChannelFromPhoton(energy, channel)) {
@@ -283,8 +289,9 @@ void PlutoReader::CopyPluto(TEventData& mctrue)
     // try building the particle tree
     // first check if it's a particle gun event
     // then try building the usual decay tree
-    if(!BuildParticleGunTree(mctrue.ParticleTree, plutoParticles, flatTree)) {
-        if(!BuildDecayTree(mctrue.ParticleTree, plutoParticles, flatTree, dileptonIndices)) {
+    if(!BuildParticleGunTree(mctrue.ParticleTree, flatTree, maybeGun)) {
+        auto findByID = [this] (int ID) { return idIndex.Find(plutoParticles, ID); };
+        if(!BuildDecayTree(mctrue.ParticleTree, plutoParticles, flatTree, dileptonIndices, findByID)) {
             LOG_N_TIMES(10, WARNING) << "Missing decay tree info for event " << mctrue.ID
                                      << " (max 10 times reported)";
             VLOG(5)      << "Dumping Pluto particles:\n" << PlutoTable(plutoParticles);
@@ -310,6 +317,10 @@ void PlutoReader::CopyPluto(TEventData& mctrue)
         }
     }
     triggerInfos.CBEnergySum = Esum;
+
+    // don't hold on to the nodes, the tree is owned by the event now
+    flatTree.clear();
+    finalstateParticles.clear();
 }
 
 
@@ -4,12 +4,16 @@
 
 #include "analysis/utils/A2GeoAcceptance.h"
 
+#include "tree/TParticle.h"
+
 #include "base/ParticleType.h"
 #include "base/WrapTTree.h"
 
 #include <memory>
 #include <string>
 #include <list>
+#include <vector>
+#include <unordered_map>
 
 #include "TClonesArray.h"
 
@@ -52,6 +56,31 @@ protected:
     void CopyPluto(TEventData& mctrue);
 
     PStaticData* pluto_database;
+    int dileptonID = 0;
+    int dimuonID = 0;
+
+    /**
+     * @brief The id_index_t struct maps the pluto particle IDs of one event to their index,
+     * it is only built when recovering missing parent indices
+     */
+    struct id_index_t {
+        static constexpr long NotUnique = -1;
+        std::unordered_map<int, long> Map;
+        bool Built = false;
+
+        void Reset() { Map.clear(); Built = false; }
+        void Build(const std::vector<const PParticle*>& particles);
+        /// @return index of particle with ID, or -1 if not found or not unique
+        long Find(const std::vector<const PParticle*>& particles, int ID);
+    };
+
+    // per event buffers, kept as members to re-use their memory
+    std::vector<const PParticle*> plutoParticles;
+    std::vector<TParticleTree_t> flatTree;
+    std::vector<std::size_t> dileptonIndices;
+    std::vector<bool> isDilepton;
+    TParticleList finalstateParticles;
+    id_index_t idIndex;
 
 public:
     PlutoReader(const std::shared_ptr<ant::WrapTFileInput>& rootfiles);
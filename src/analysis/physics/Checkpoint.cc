@@ -0,0 +1,313 @@
+#include "Checkpoint.h"
+
+#include "tree/TIDIndex.h"
+
+#include "base/std_ext/misc.h"
+#include "base/std_ext/string.h"
+#include "base/std_ext/system.h"
+#include "base/Logger.h"
+
+#include "TFile.h"
+#include "TKey.h"
+#include "TH1.h"
+#include "TTree.h"
+#include "TDirectory.h"
+
+#include <cstdio>
+#include <memory>
+#include <set>
+#include <map>
+#include <algorithm>
+
+using namespace std;
+using namespace ant;
+using namespace ant::analysis;
+
+namespace {
+
+constexpr auto TreeName = "Checkpoint";
+constexpr auto OutputDirName = "Output";
+constexpr auto TreeEventsName = "treeEvents";
+constexpr auto TIDLeafList = "Flags/i:Timestamp/i:Lower/i";
+
+// TID has a vtable, so store the fields as leaves
+struct tid_leaves_t {
+    UInt_t Flags = 0;
+    UInt_t Timestamp = 0;
+    UInt_t Lower = 0;
+
+    tid_leaves_t() = default;
+    explicit tid_leaves_t(const TID& id) :
+        Flags(id.Flags), Timestamp(id.Timestamp), Lower(id.Lower) {}
+
+    TID GetTID() const {
+        TID id;
+        id.Flags = Flags;
+        id.Timestamp = Timestamp;
+        id.Lower = Lower;
+        return id;
+    }
+};
+
+void copyHists(TDirectory& from, TDirectory& to)
+{
+    TIter next(from.GetList());
+    while(auto obj = next()) {
+        if(auto subdir = dynamic_cast<TDirectory*>(obj)) {
+            auto to_subdir = to.mkdir(subdir->GetName(), subdir->GetTitle());
+            copyHists(*subdir, *to_subdir);
+        }
+        else if(auto hist = dynamic_cast<TH1*>(obj)) {
+            to.WriteTObject(hist);
+        }
+    }
+}
+
+// copies the entries of the trees not yet in the given entries, which are updated
+void copyNewEntries(TDirectory& from, TDirectory& to, const string& path,
+                    map<string, long long>& entries)
+{
+    TIter next(from.GetList());
+    while(auto obj = next()) {
+        if(auto subdir = dynamic_cast<TDirectory*>(obj)) {
+            auto to_subdir = to.mkdir(subdir->GetName(), subdir->GetTitle());
+            copyNewEntries(*subdir, *to_subdir, path+subdir->GetName()+"/", entries);
+        }
+        else if(auto tree = dynamic_cast<TTree*>(obj)) {
+            to.cd();
+            unique_ptr<TTree> clone(tree->CloneTree(0));
+            if(!clone)
+                throw Checkpoint::Exception(std_ext::formatter() << "Cannot copy tree " << tree->GetName());
+            // the clone shares the branch addresses of the tree
+            auto& first = entries[path+tree->GetName()];
+            const auto nEntries = tree->GetEntries();
+            for(auto entry = first; entry < nEntries; entry++) {
+                tree->GetEntry(entry);
+                clone->Fill();
+            }
+            first = nEntries;
+            clone->Write();
+        }
+    }
+}
+
+void countEntries(TDirectory& dir, const string& path, map<string, long long>& entries)
+{
+    TIter next(dir.GetList());
+    while(auto obj = next()) {
+        if(auto subdir = dynamic_cast<TDirectory*>(obj))
+            countEntries(*subdir, path+subdir->GetName()+"/", entries);
+        else if(auto tree = dynamic_cast<TTree*>(obj))
+            entries[path+tree->GetName()] = tree->GetEntries();
+    }
+}
+
+void restoreObjects(TDirectory& from, TDirectory& to, const string& path)
+{
+    // keys of older cycles have the same name
+    set<string> restored;
+    TIter next(from.GetListOfKeys());
+    while(auto key = dynamic_cast<TKey*>(next())) {
+        const string name = key->GetName();
+        if(!restored.insert(name).second)
+            continue;
+
+        auto target = to.FindObject(name.c_str());
+        if(target == nullptr) {
+            LOG(WARNING) << "Checkpoint object " << path << name << " not found in output, ignored";
+            continue;
+        }
+
+        auto obj = from.Get(name.c_str());
+        if(auto subdir = dynamic_cast<TDirectory*>(obj)) {
+            if(auto to_subdir = dynamic_cast<TDirectory*>(target)) {
+                restoreObjects(*subdir, *to_subdir, path+name+"/");
+                continue;
+            }
+        }
+        else if(auto hist = dynamic_cast<TH1*>(obj)) {
+            if(auto to_hist = dynamic_cast<TH1*>(target)) {
+                to_hist->Add(hist);
+                continue;
+            }
+        }
+        else if(auto tree = dynamic_cast<TTree*>(obj)) {
+            if(auto to_tree = dynamic_cast<TTree*>(target)) {
+                to_tree->CopyEntries(tree);
+                continue;
+            }
+        }
+        else {
+            continue;
+        }
+        throw Checkpoint::Exception(std_ext::formatter() << "Checkpoint object " << path << name
+                                    << " does not match type of output object");
+    }
+}
+
+} // namespace
+
+Checkpoint::Checkpoint(const string& filename_) :
+    filename(filename_)
+{}
+
+string Checkpoint::PartFilename(unsigned part) const
+{
+    return std_ext::formatter() << filename << "." << part;
+}
+
+void Checkpoint::Save(const state_t& state, TDirectory& dir, const TIDIndex& treeEventsIndex)
+{
+    const auto prev_Directory = gDirectory;
+    std_ext::execute_on_destroy restoreDir([prev_Directory] () {
+        gDirectory = prev_Directory;
+    });
+
+    // the new part is only referenced once the checkpoint is replaced,
+    // so a part left behind by an interrupted Save is simply overwritten
+    auto entries = treeEntries;
+    auto indexed = indexedEntries;
+    {
+        const auto partname = PartFilename(nParts);
+        TFile part(partname.c_str(), "RECREATE");
+        if(part.IsZombie())
+            throw Exception("Cannot open checkpoint part "+partname+" for writing");
+
+        copyNewEntries(dir, *part.mkdir(OutputDirName), "", entries);
+
+        // the index is sorted by TID, so pick the items of the new entries
+        TIDIndex index;
+        for(const auto& item : treeEventsIndex.Items()) {
+            if(item.Entry < indexedEntries)
+                continue;
+            index.Add(item.GetTID(), item.Entry);
+            indexed = max(indexed, item.Entry+1);
+        }
+        index.Write(part, TreeEventsName);
+
+        part.Close();
+    }
+
+    // never leave a half-written checkpoint behind
+    const auto filename_new = filename + ".new";
+    {
+        TFile file(filename_new.c_str(), "RECREATE");
+        if(file.IsZombie())
+            throw Exception("Cannot open checkpoint "+filename_new+" for writing");
+
+        file.cd();
+        auto tree = new TTree(TreeName, "Checkpoint of PhysicsManager");
+        Long64_t eventsRead = state.EventsRead;
+        Long64_t eventsProcessed = state.EventsProcessed;
+        Long64_t eventsAnalyzed = state.EventsAnalyzed;
+        Long64_t eventsSaved = state.EventsSaved;
+        tid_leaves_t firstID(state.ProcessedTIDRange.Start());
+        tid_leaves_t lastAnalyzedID(state.ProcessedTIDRange.Stop());
+        tid_leaves_t lastID(state.LastID);
+        UInt_t parts = nParts + 1;
+        tree->Branch("EventsRead", addressof(eventsRead), "EventsRead/L");
+        tree->Branch("EventsProcessed", addressof(eventsProcessed), "EventsProcessed/L");
+        tree->Branch("EventsAnalyzed", addressof(eventsAnalyzed), "EventsAnalyzed/L");
+        tree->Branch("EventsSaved", addressof(eventsSaved), "EventsSaved/L");
+        tree->Branch("FirstID", addressof(firstID), TIDLeafList);
+        tree->Branch("LastAnalyzedID", addressof(lastAnalyzedID), TIDLeafList);
+        tree->Branch("LastID", addressof(lastID), TIDLeafList);
+        tree->Branch("Parts", addressof(parts), "Parts/i");
+        tree->Fill();
+        tree->Write();
+        delete tree;
+
+        copyHists(dir, *file.mkdir(OutputDirName));
+
+        file.Close();
+    }
+
+    if(rename(filename_new.c_str(), filename.c_str()) != 0)
+        throw Exception("Cannot replace checkpoint "+filename);
+
+    nParts++;
+    treeEntries = move(entries);
+    indexedEntries = indexed;
+
+    VLOG(3) << "Wrote checkpoint " << filename << " (" << nParts << " parts) after "
+            << state.EventsRead << " read events";
+}
+
+bool Checkpoint::Load(state_t& state, TDirectory& dir, TIDIndex& treeEventsIndex)
+{
+    if(!std_ext::system::testopen(filename))
+        return false;
+
+    const auto prev_Directory = gDirectory;
+    std_ext::execute_on_destroy restoreDir([prev_Directory] () {
+        gDirectory = prev_Directory;
+    });
+
+    TFile file(filename.c_str(), "READ");
+    if(file.IsZombie())
+        throw Exception("Cannot open checkpoint "+filename);
+
+    TTree* tree = nullptr;
+    file.GetObject(TreeName, tree);
+    auto output = file.GetDirectory(OutputDirName);
+    if(tree == nullptr || tree->GetEntries() != 1 || output == nullptr)
+        throw Exception("Checkpoint "+filename+" is incomplete");
+
+    Long64_t eventsRead, eventsProcessed, eventsAnalyzed, eventsSaved;
+    tid_leaves_t firstID, lastAnalyzedID, lastID;
+    UInt_t parts;
+    tree->SetBranchAddress("EventsRead", addressof(eventsRead));
+    tree->SetBranchAddress("EventsProcessed", addressof(eventsProcessed));
+    tree->SetBranchAddress("EventsAnalyzed", addressof(eventsAnalyzed));
+    tree->SetBranchAddress("EventsSaved", addressof(eventsSaved));
+    // leaf list branches, tid_leaves_t has no dictionary
+    tree->SetBranchAddress("FirstID", static_cast<void*>(addressof(firstID)));
+    tree->SetBranchAddress("LastAnalyzedID", static_cast<void*>(addressof(lastAnalyzedID)));
+    tree->SetBranchAddress("LastID", static_cast<void*>(addressof(lastID)));
+    tree->SetBranchAddress("Parts", addressof(parts));
+    tree->GetEntry(0);
+    tree->ResetBranchAddresses();
+
+    state.EventsRead = eventsRead;
+    state.EventsProcessed = eventsProcessed;
+    state.EventsAnalyzed = eventsAnalyzed;
+    state.EventsSaved = eventsSaved;
+    state.ProcessedTIDRange = interval<TID>(firstID.GetTID(), lastAnalyzedID.GetTID());
+    state.LastID = lastID.GetTID();
+
+    restoreObjects(*output, dir, "");
+
+    for(unsigned i=0;i<parts;i++) {
+        const auto partname = PartFilename(i);
+        TFile part(partname.c_str(), "READ");
+        auto part_output = part.IsZombie() ? nullptr : part.GetDirectory(OutputDirName);
+        if(part_output == nullptr)
+            throw Exception("Checkpoint part "+partname+" is missing");
+
+        restoreObjects(*part_output, dir, "");
+
+        TTree* indextree = nullptr;
+        part.GetObject(TIDIndex::IndexName(TreeEventsName).c_str(), indextree);
+        if(indextree != nullptr)
+            treeEventsIndex.Append(*indextree);
+    }
+
+    // further Saves add parts with the entries after the restored ones
+    nParts = parts;
+    treeEntries.clear();
+    countEntries(dir, "", treeEntries);
+    indexedEntries = 0;
+    for(const auto& item : treeEventsIndex.Items())
+        indexedEntries = max(indexedEntries, item.Entry+1);
+
+    LOG(INFO) << "Restored checkpoint " << filename << " with " << state.EventsAnalyzed << " analyzed events";
+    return true;
+}
+
+void Checkpoint::Remove()
+{
+    remove(filename.c_str());
+    // including a part possibly left behind by an interrupted Save
+    for(unsigned i=0;i<=nParts;i++)
+        remove(PartFilename(i).c_str());
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "tree/TID.h"
+#include "base/interval.h"
+
+#include <string>
+#include <map>
+#include <stdexcept>
+
+class TDirectory;
+
+namespace ant {
+
+class TIDIndex;
+
+namespace analysis {
+
+/**
+ * @brief The Checkpoint class saves and restores the output of an interrupted PhysicsManager run
+ *
+ * A checkpoint is a ROOT file containing the event counters of the run and
+ * a copy of all histograms found in the output directory (recursively, thus
+ * including the directories of the physics classes).
+ * The trees (including treeEvents) and the TID index of treeEvents are written incrementally:
+ * Each Save adds a part file "<filename>.<n>" holding only the entries added since the previous Save,
+ * so the run is not slowed down by copying its whole output again and again.
+ * It is taken between two slowcontrol-complete blocks of events, so no event is buffered.
+ *
+ * Restoring adds the histograms and appends the tree entries of all parts to the objects of same name,
+ * which the freshly constructed physics classes created in the output directory.
+ * The input position is not stored as such, the PhysicsManager reads the input again
+ * up to the checkpoint without analyzing it, which also brings the calibrations and the
+ * slowcontrol to the state they had at the checkpoint.
+ *
+ * @note State of the physics classes not kept in histograms or trees is lost
+ */
+class Checkpoint {
+public:
+    struct state_t {
+        long long EventsRead = 0;
+        long long EventsProcessed = 0;
+        long long EventsAnalyzed = 0;
+        long long EventsSaved = 0;
+        interval<TID> ProcessedTIDRange{TID(), TID()};
+        // ID of the last processed event, to check that the input matches when resuming
+        TID LastID;
+    };
+
+    /**
+     * @param filename of the checkpoint file, the parts are stored next to it
+     */
+    explicit Checkpoint(const std::string& filename);
+
+    /**
+     * @brief Save writes the checkpoint, replacing an existing one only if successful
+     * @param state the counters of the run
+     * @param dir output directory, all histograms in it are copied, trees only the entries new since the last Save or Load
+     * @param treeEventsIndex index of treeEvents
+     */
+    void Save(const state_t& state, TDirectory& dir, const TIDIndex& treeEventsIndex);
+
+    /**
+     * @brief Load restores a checkpoint
+     * @param state set to the counters of the run
+     * @param dir output directory, histograms and trees of same name are added to
+     * @param treeEventsIndex index of treeEvents, items are appended
+     * @return false if the file does not exist
+     */
+    bool Load(state_t& state, TDirectory& dir, TIDIndex& treeEventsIndex);
+
+    /**
+     * @brief Remove deletes the checkpoint file and its parts
+     */
+    void Remove();
+
+    class Exception : public std::runtime_error {
+        using std::runtime_error::runtime_error; // use base class constructor
+    };
+
+protected:
+    const std::string filename;
+
+    // number of part files the written checkpoint consists of
+    unsigned nParts = 0;
+    // entries of each tree (by path) already stored in the parts
+    std::map<std::string, long long> treeEntries;
+    // treeEvents entries already covered by the stored index
+    long long indexedEntries = 0;
+
+    std::string PartFilename(unsigned part) const;
+};
+
+}} // namespace ant::analysis
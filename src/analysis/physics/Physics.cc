@@ -1,6 +1,7 @@
 #include "Physics.h"
 
 #include "base/Logger.h"
+#include "base/StageTimer.h"
 #include <stdexcept>
 #include "base/std_ext/string.h"
 
@@ -32,6 +33,7 @@ std::unique_ptr<Physics> PhysicsRegistry::Create(const string& name, OptionsPtr
         throw std::runtime_error("Physics class " + name + " not found");
 
     // this may throw an exception
+    StageTimer::Scope timing(StageTimer::Get("Startup/Physics/"+name));
     auto physics = creator->second(name, opts);
 
     return physics;
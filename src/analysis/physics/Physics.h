@@ -40,6 +40,11 @@ public:
 
     virtual void ProcessEvent(const TEvent& event, physics::manager_t& manager) =0;
     virtual void Finish() {}
+    /**
+     * @brief MergeThreadHists merges fills of thread-aware histograms made by HistFac,
+     * called by PhysicsManager before Finish()
+     */
+    void MergeThreadHists() { HistFac.MergeThreadHists(); }
     virtual void ShowResult() {}
     std::string GetName() const { return name_; }
 
@@ -1,26 +1,38 @@
 #include "PhysicsManager.h"
+#include "Checkpoint.h"
 
 #include "utils/ParticleID.h"
 #include "input/DataReader.h"
 
 #include "tree/TSlowControl.h"
 #include "base/Logger.h"
+#include "base/CounterRNG.h"
 
 #include "slowcontrol/SlowControlManager.h"
 
 #include "base/ProgressCounter.h"
 
 #include "TTree.h"
+#include "TDirectory.h"
+#include "TROOT.h"
+#include "RVersion.h"
 
 #include <iomanip>
+#include <chrono>
 
 
 using namespace std;
 using namespace ant;
 using namespace ant::analysis;
 
+PhysicsManager::io_settings_t PhysicsManager::IOSettings;
+
 PhysicsManager::PhysicsManager(volatile bool* interrupt_) :
     physics(),
+    timer_read(StageTimer::Get("Read")),
+    timer_slowcontrol(StageTimer::Get("SlowControl")),
+    timer_process(StageTimer::Get("Process")),
+    timer_save(StageTimer::Get("Save")),
     interrupt(interrupt_),
     processedTIDrange(TID(), TID())
 {}
@@ -70,9 +82,40 @@ void PhysicsManager::ReadFrom(
     // register slowcontrol variables in constructor
     SlowControlManager slowControlManager(reader_flags);
 
+    // the physics classes created their histograms and trees in here
+    TDirectory& outputDir = *gDirectory;
 
     // prepare output of TEvents
     treeEvents.CreateBranches(new TTree("treeEvents","TEvent data"));
+    nTreeEvents = 0;
+
+    // the input up to the checkpoint is read again, but not analyzed
+    Checkpoint checkpoint(checkpoints.Filename);
+    Checkpoint::state_t resumed;
+    if(checkpoints.Resume) {
+        if(checkpoint.Load(resumed, outputDir, treeEventsIndex))
+            nTreeEvents = treeEvents.Tree->GetEntries();
+        else
+            LOG(WARNING) << "No checkpoint " << checkpoints.Filename << " found, starting from the beginning";
+    }
+    bool replaying = resumed.EventsRead > 0;
+    auto lastCheckpoint = chrono::steady_clock::now();
+
+    // the filling (and writing to the output file) stays on this thread,
+    // only the baskets of treeEvents are compressed in parallel by ROOT's implicit MT,
+    // which the application has to enable. The other trees keep their own setting
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+    treeEvents.Tree->SetImplicitMT(IOSettings.ParallelCompression);
+    if(IOSettings.ParallelCompression) {
+        if(ROOT::IsImplicitMTEnabled())
+            LOG(INFO) << "Compressing baskets of treeEvents in parallel";
+        else
+            LOG(WARNING) << "ROOT's implicit multi-threading not enabled, baskets of treeEvents compressed serially";
+    }
+#else
+    if(IOSettings.ParallelCompression)
+        LOG(WARNING) << "ROOT version too old for compressing baskets in parallel, disabled";
+#endif
 
     long long nEventsRead = 0;
     long long nEventsProcessed = 0;
@@ -80,6 +123,7 @@ void PhysicsManager::ReadFrom(
     long long nEventsSaved = 0;
 
     bool reached_maxevents = false;
+    TID lastID;
 
 
     ProgressCounter progress(
@@ -96,6 +140,7 @@ void PhysicsManager::ReadFrom(
         const double speed = (percent - last_PercentDone)/elapsed.count();
         LOG(INFO) << setw(2) << std::setprecision(4)
                   << percent*100 << " % done, ETA: " << ProgressCounter::TimeToStr((1-percent)/speed);
+        LOG_IF(StageTimer::IsEnabled(), INFO) << "Mean latencies: " << StageTimer::Summary();
         last_PercentDone = percent;
     });
     while(true) {
@@ -110,7 +155,12 @@ void PhysicsManager::ReadFrom(
             }
 
             input::event_t event;
-            if(!TryReadEvent(event)) {
+            bool event_read;
+            {
+                StageTimer::Scope timing(timer_read);
+                event_read = TryReadEvent(event);
+            }
+            if(!event_read) {
                 VLOG(5) << "No more events to read, finish.";
                 reached_maxevents = true;
                 break;
@@ -118,7 +168,12 @@ void PhysicsManager::ReadFrom(
             nEventsRead++;
 
             // dump it into slowcontrol until full...
-            if(slowControlManager.ProcessEvent(move(event)))
+            bool slowcontrol_complete;
+            {
+                StageTimer::Scope timing(timer_slowcontrol);
+                slowcontrol_complete = slowControlManager.ProcessEvent(move(event));
+            }
+            if(slowcontrol_complete)
                 break;
             // ..or max buffersize reached: 20000 corresponds to two Acqu Scaler blocks
             if(slowControlManager.BufferSize()>20000) {
@@ -138,6 +193,10 @@ void PhysicsManager::ReadFrom(
                 break;
             }
 
+            lastID = event.HasReconstructed() ? event.Reconstructed().ID : event.MCTrue().ID;
+            if(replaying)
+                continue;
+
             logger::DebugInfo::nProcessedEvents = nEventsProcessed;
 
             physics::manager_t manager;
@@ -156,7 +215,10 @@ void PhysicsManager::ReadFrom(
 
                 if(!reached_maxevents && !buf_event.WantsSkip) {
 
-                    ProcessEvent(event, manager);
+                    {
+                        StageTimer::Scope timing(timer_process);
+                        ProcessEvent(event, manager);
+                    }
 
                     // prefer Reconstructed ID, but at least one branch should be non-null
                     const auto& eventid = event.HasReconstructed() ? event.Reconstructed().ID : event.MCTrue().ID;
@@ -172,14 +234,51 @@ void PhysicsManager::ReadFrom(
             }
 
             // SaveEvent is the sink for events
-            SaveEvent(move(event), manager);
+            {
+                StageTimer::Scope timing(timer_save);
+                SaveEvent(move(event), manager);
+            }
 
             nEventsProcessed++;
         }
+
+        if(replaying && !interrupt && nEventsRead >= resumed.EventsRead) {
+            if(nEventsRead != resumed.EventsRead || lastID != resumed.LastID)
+                throw Exception(std_ext::formatter() << "Input does not match checkpoint " << checkpoints.Filename
+                                << ", expected event " << resumed.LastID << " after " << resumed.EventsRead << " read events");
+            replaying = false;
+            nEventsProcessed = resumed.EventsProcessed;
+            nEventsAnalyzed = resumed.EventsAnalyzed;
+            nEventsSaved = resumed.EventsSaved;
+            processedTIDrange = resumed.ProcessedTIDRange;
+            LOG(INFO) << "Resuming after " << nEventsAnalyzed << " analyzed events";
+        }
+
         ProgressCounter::Tick();
+
+        // all read events are processed here, a consistent point for a checkpoint
+        if(!checkpoints.Filename.empty() && !replaying && !reached_maxevents && !interrupt
+           && chrono::steady_clock::now() - lastCheckpoint >= chrono::duration<double>(checkpoints.Interval)) {
+            for(auto& pclass : physics)
+                pclass->MergeThreadHists();
+
+            Checkpoint::state_t state;
+            state.EventsRead = nEventsRead;
+            state.EventsProcessed = nEventsProcessed;
+            state.EventsAnalyzed = nEventsAnalyzed;
+            state.EventsSaved = nEventsSaved;
+            state.ProcessedTIDRange = processedTIDrange;
+            state.LastID = lastID;
+            checkpoint.Save(state, outputDir, treeEventsIndex);
+            lastCheckpoint = chrono::steady_clock::now();
+        }
     }
 
+    if(replaying && !interrupt)
+        throw Exception(std_ext::formatter() << "Input ended before reaching checkpoint " << checkpoints.Filename);
+
     for(auto& pclass : physics) {
+        pclass->MergeThreadHists();
         pclass->Finish();
     }
 
@@ -196,6 +295,12 @@ void PhysicsManager::ReadFrom(
               << processed_str << ", speed "
               << nEventsProcessed/progress.GetTotalSecs() << " event/s";
 
+    // latency distributions go next to treeEvents, usually into the output file
+    if(StageTimer::IsEnabled()) {
+        LOG(INFO) << "Mean latencies: " << StageTimer::Summary();
+        StageTimer::WriteAll(*gDirectory);
+    }
+
     const auto nEventsSavedTotal = treeEvents.Tree->GetEntries();
     if(nEventsSaved==0) {
         if(nEventsSavedTotal>0)
@@ -204,6 +309,7 @@ void PhysicsManager::ReadFrom(
     }
     else if(treeEvents.Tree->GetCurrentFile() != nullptr) {
         treeEvents.Tree->Write();
+        treeEventsIndex.Write(*treeEvents.Tree->GetDirectory(), treeEvents.Tree->GetName());
         const auto n_sc = nEventsSavedTotal - nEventsSaved;
         LOG(INFO) << "Wrote " << nEventsSaved  << " treeEvents"
                   << (n_sc>0 ? string(std_ext::formatter() << " (+slowcontrol: " << n_sc << ")") : "")
@@ -215,6 +321,17 @@ void PhysicsManager::ReadFrom(
     // cleanup readers (important for stopping progress output)
     source = nullptr;
     amenders.clear();
+
+    // a complete run does not need to be resumed
+    if(!checkpoints.Filename.empty() && !interrupt)
+        checkpoint.Remove();
+}
+
+void PhysicsManager::EnableCheckpoints(const string& filename, double interval, bool resume)
+{
+    checkpoints.Filename = filename;
+    checkpoints.Interval = interval;
+    checkpoints.Resume = resume;
 }
 
 
@@ -249,8 +366,23 @@ void PhysicsManager::ProcessEvent(input::event_t& event, physics::manager_t& man
 
     event.EnsureTempBranches();
 
+    // MC smearing in the physics classes draws random numbers for this event
+    if(event.HasReconstructed())
+        CounterRNG::SetEvent(event.Reconstructed().ID.Value());
+    else if(event.HasMCTrue())
+        CounterRNG::SetEvent(event.MCTrue().ID.Value());
+
+    // physics classes might have been added since last call
+    if(timers_physics.size() != physics.size()) {
+        timers_physics.clear();
+        for(auto& p : physics)
+            timers_physics.push_back(&StageTimer::Get("Physics/"+p->GetName()));
+    }
+
     // run the physics classes
+    auto it_timer = timers_physics.begin();
     for( auto& m : physics ) {
+        StageTimer::Scope timing(**it_timer++);
         m->ProcessEvent(event, manager);
     }
 
@@ -269,6 +401,11 @@ void PhysicsManager::SaveEvent(input::event_t event, const physics::manager_t& m
         if(!manager.keepReadHits && !event.SavedForSlowControls)
             event.ClearDetectorReadHits();
 
+        // prefer Reconstructed ID, as in ReadFrom
+        const TID eventid = event.HasReconstructed() ? event.Reconstructed().ID : event.MCTrue().ID;
+
+        treeEventsIndex.Add(eventid, nTreeEvents++);
+
         treeEvents.data = move(event);
         treeEvents.Tree->Fill();
     }
@@ -3,6 +3,8 @@
 #include "Physics.h"
 #include "analysis/input/treeEvents_t.h"
 #include "analysis/input/reader_flags_t.h"
+#include "tree/TIDIndex.h"
+#include "base/StageTimer.h"
 
 #include <memory>
 #include <queue>
@@ -32,6 +34,14 @@ protected:
 
     physics_list_t physics;
 
+    // timers for the stages of the event loop, see StageTimer::Enable
+    StageTimer& timer_read;
+    StageTimer& timer_slowcontrol;
+    StageTimer& timer_process;
+    StageTimer& timer_save;
+    // in same order as physics
+    std::vector<StageTimer*> timers_physics;
+
     std::unique_ptr<input::DataReader> source;
     using readers_t = std::list< std::unique_ptr<input::DataReader> >;
     readers_t amenders;
@@ -61,6 +71,16 @@ protected:
 
     // for output of TEvents to TTree
     input::treeEvents_t treeEvents;
+    // written next to treeEvents for random access by TID
+    TIDIndex treeEventsIndex;
+    long long nTreeEvents = 0;
+
+    struct checkpoints_t {
+        std::string Filename; // empty disables checkpoints
+        double Interval = 0;  // in seconds
+        bool Resume = false;
+    };
+    checkpoints_t checkpoints;
 
 public:
 
@@ -91,6 +111,29 @@ public:
 
     virtual void ShowResults();
 
+    /**
+     * @brief EnableCheckpoints saves the output regularly during ReadFrom, such that an interrupted run can be resumed
+     * @param filename of the checkpoint, removed when ReadFrom finishes without interruption
+     * @param interval minimum seconds between two checkpoints
+     * @param resume restores the checkpoint (if existing) at the beginning of ReadFrom
+     * @see Checkpoint
+     */
+    void EnableCheckpoints(const std::string& filename, double interval, bool resume);
+
+    /**
+     * @brief The io_settings_t struct tunes the writing of treeEvents,
+     * must be set before ReadFrom is called
+     */
+    struct io_settings_t {
+        /**
+         * @brief ParallelCompression compresses the baskets of treeEvents in parallel,
+         * only effective if ROOT's implicit multi-threading was enabled by the application
+         * (needs ROOT 6.10 or later). Other trees are not affected.
+         */
+        bool ParallelCompression = false;
+    };
+    static io_settings_t IOSettings;
+
     class Exception : public std::runtime_error {
         using std::runtime_error::runtime_error; // use base class constructor
     };
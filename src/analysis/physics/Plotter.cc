@@ -1,5 +1,7 @@
 #include "Plotter.h"
 
+#include "base/StageTimer.h"
+
 using namespace ant;
 using namespace ant::analysis;
 using namespace std;
@@ -19,6 +21,7 @@ std::unique_ptr<Plotter> PlotterRegistry::Create(const string &name, const WrapT
         throw std::runtime_error("Plotter class " + name + " not found");
 
     // this may throw an exception
+    StageTimer::Scope timing(StageTimer::Get("Startup/Plotter/"+name));
     auto plotter = creator->second(name, input, opts);
 
     return plotter;
@@ -274,7 +274,7 @@ struct PIDEfficiencyCheck_plot : Plotter {
 
     virtual void ProcessEntry(const long long entry) override
     {
-        tree.Tree->GetEntry(entry);
+        tree.GetEntry(entry);
         cuttree::Fill<Hist_t>(mycuttree, tree);
     }
 
@@ -19,15 +19,16 @@ CandidatesAnalysis::CandidatesAnalysis(const std::string& name, OptionsPtr opts)
         CandMultiplicities->GetXaxis()->SetBinLabel(i,string(to_string(i-1)+"+").c_str());
     }
 
-    energy = HistFac.makeTH1D("Energy","E [MeV]","",BinSettings(1000),"energy");
-    theta  = HistFac.makeTH1D("Theta","#theta [#circ]","",BinSettings(360,0,180),"theta");
-    phi    = HistFac.makeTH1D("Phi","#phi [#circ]","",BinSettings(720,-180,180),"phi");
-    ggIM         = HistFac.makeTH1D("2 Neutral Candidates IM","M [MeV]","",BinSettings(1000),"ggIM");
-    ttIM         = HistFac.makeTH1D("2 Candidates IM","M [MeV]","",BinSettings(1000),"ttIM");
-    cbdEE = HistFac.makeTH2D("CB dE-E","E_{CB} [MeV]","dE_{PID} [MeV]", BinSettings(1000),BinSettings(100,0,30),"cb_dEE");
-    cbtof = HistFac.makeTH2D("CB ToF","t_{CB} [ns]","E_{CB} [MeV]", BinSettings(300,-15,15),BinSettings(1000),"cb_tof");
-    tapsdEE = HistFac.makeTH2D("TAPS dE-E","E_{TAPS} [MeV]","dE_{TAPSVeto} [MeV]", BinSettings(1000),BinSettings(100,0,30),"taps_dEE");
-    tapstof = HistFac.makeTH2D("TAPS ToF","t_{TAPS} [ns]","E_{TAPS} [MeV]", BinSettings(300,-15,15),BinSettings(1000),"taps_tof");
+    // filled per candidate, so use the buffered thread-aware histograms
+    energy = HistFac.makeThreadTH1D("Energy",{"E [MeV]",BinSettings(1000)},"energy");
+    theta  = HistFac.makeThreadTH1D("Theta",{"#theta [#circ]",BinSettings(360,0,180)},"theta");
+    phi    = HistFac.makeThreadTH1D("Phi",{"#phi [#circ]",BinSettings(720,-180,180)},"phi");
+    ggIM         = HistFac.makeThreadTH1D("2 Neutral Candidates IM",{"M [MeV]",BinSettings(1000)},"ggIM");
+    ttIM         = HistFac.makeThreadTH1D("2 Candidates IM",{"M [MeV]",BinSettings(1000)},"ttIM");
+    cbdEE = HistFac.makeThreadTH2D("CB dE-E",{"E_{CB} [MeV]",BinSettings(1000)},{"dE_{PID} [MeV]",BinSettings(100,0,30)},"cb_dEE");
+    cbtof = HistFac.makeThreadTH2D("CB ToF",{"t_{CB} [ns]",BinSettings(300,-15,15)},{"E_{CB} [MeV]",BinSettings(1000)},"cb_tof");
+    tapsdEE = HistFac.makeThreadTH2D("TAPS dE-E",{"E_{TAPS} [MeV]",BinSettings(1000)},{"dE_{TAPSVeto} [MeV]",BinSettings(100,0,30)},"taps_dEE");
+    tapstof = HistFac.makeThreadTH2D("TAPS ToF",{"t_{TAPS} [ns]",BinSettings(300,-15,15)},{"E_{TAPS} [MeV]",BinSettings(1000)},"taps_tof");
     detectors = HistFac.makeTH1D("Detectors","","", BinSettings(1),"detectors");
     psa = HistFac.makeTH2D("TAPS PSA (Charged)","E_{long} [MeV]","E_{short} [MeV]", BinSettings(1000),BinSettings(1000),"psa");
     psa_all = HistFac.makeTH2D("TAPS PSA","E_{long} [MeV]","E_{short} [MeV]", BinSettings(1000),BinSettings(1000),"psa_all");
@@ -136,12 +137,12 @@ void CandidatesAnalysis::Finish()
 void CandidatesAnalysis::ShowResult()
 {
     canvas("CandidatesAnalysis")
-            << ggIM << energy << theta << phi
+            << ggIM->Hist << energy->Hist << theta->Hist << phi->Hist
             << nCandidatesEvent << CandMultiplicities
             << detectors
             << drawoption("colz")
-            << cbdEE << cbtof
-            << tapsdEE << tapstof
+            << cbdEE->Hist << cbtof->Hist
+            << tapsdEE->Hist << tapstof->Hist
             << psa << psa_all << psa_all_angles
             << lateral_moment_cb << lateral_moment_taps
             << endc;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "analysis/physics/Physics.h"
+#include "analysis/plot/ThreadHist.h"
 #include "utils/ClusterTools.h"
 
 #include <string>
@@ -15,15 +16,15 @@ class CandidatesAnalysis : public Physics {
 protected:
     TH1D* nCandidatesEvent = nullptr;
     TH1D* CandMultiplicities = nullptr;
-    TH1D* energy = nullptr;
-    TH1D* theta = nullptr;
-    TH1D* phi = nullptr;
-    TH1D* ggIM = nullptr;
-    TH1D* ttIM = nullptr;
-    TH2D* cbdEE = nullptr;
-    TH2D* cbtof = nullptr;
-    TH2D* tapsdEE = nullptr;
-    TH2D* tapstof = nullptr;
+    ThreadTH1D* energy = nullptr;
+    ThreadTH1D* theta = nullptr;
+    ThreadTH1D* phi = nullptr;
+    ThreadTH1D* ggIM = nullptr;
+    ThreadTH1D* ttIM = nullptr;
+    ThreadTH2D* cbdEE = nullptr;
+    ThreadTH2D* cbtof = nullptr;
+    ThreadTH2D* tapsdEE = nullptr;
+    ThreadTH2D* tapstof = nullptr;
     TH1D* detectors = nullptr;
     TH2D* psa = nullptr;
     TH2D* psa_all = nullptr;
@@ -2,6 +2,7 @@
 
 #include "base/std_ext/misc.h"
 #include "utils/Combinatorics.h"
+#include "utils/IMMatrix.h"
 #include "analysis/physics/Physics.h"
 #include "plot/PromptRandomHist.h"
 #include "analysis/utils/fitter/KinFitter.h"
@@ -42,6 +43,7 @@ public:
     PromptRandom::Hist2 dEvE_all_combined;
     std::vector<PromptRandom::Hist2> dEvE_combined;
     TH2D* projections;
+    utils::IMMatrix ims;
 
     utils::UncertaintyModelPtr model;
     std::vector<utils::KinFitter> kinfit;
@@ -42,15 +42,22 @@ void IMPlots::ProcessEvent(const TEvent& event, manager_t&)
     auto recon_particles = utils::ParticleTypeList::Make(event.Reconstructed().Candidates);
     const auto& photons = recon_particles.Get(ParticleTypeDatabase::Photon);
 
+    // the tagger hits are the same for all combinations,
+    // so classify them only once per event
+    taggertimes.clear();
+    for(const auto& h : event.Reconstructed().TaggerHits)
+        taggertimes.push_back(triggersimu.GetCorrectedTaggerTime(h));
+    prs.SetTaggerTimes(taggertimes);
+
+    // cache the photon four-vectors once, the subset sums re-use partial sums
+    ims.Set(photons);
     for(unsigned n = MinNGamma(); n<MaxNGamma(); ++n) {
-        for( auto comb = utils::makeCombination(photons,n); !comb.done(); ++comb) {
-            const LorentzVec sum = sumlv(comb.begin(), comb.end());
-                for(const auto& h : event.Reconstructed().TaggerHits) {
-                    prs.SetTaggerTime(triggersimu.GetCorrectedTaggerTime(h));
-                    m.at(n - MinNGamma()).Fill(sum.M());
-                }
-            }
-       }
+        auto& h = m.at(n - MinNGamma());
+        ims.ForEachSubset(n, [&h] (const LorentzVec& sum) {
+            h.Stage(sum.M());
+        });
+    }
+    prs.FillRegistered();
 }
 
 void IMPlots::ShowResult()
@@ -3,6 +3,7 @@
 #include "analysis/physics/Physics.h"
 #include "plot/PromptRandomHist.h"
 #include "utils/TriggerSimulation.h"
+#include "utils/IMMatrix.h"
 #include <vector>
 
 class TH1D;
@@ -17,6 +18,8 @@ public:
     utils::TriggerSimulation triggersimu;
     PromptRandom::Switch prs;
     std::vector<PromptRandom::Hist1> m;
+    std::vector<double> taggertimes;
+    utils::IMMatrix ims;
     unsigned MinNGamma() const noexcept { return 2;}
     unsigned MaxNGamma() const noexcept { return unsigned(m.size())+2; }
 
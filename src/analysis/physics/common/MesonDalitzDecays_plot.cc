@@ -383,7 +383,7 @@ struct MesonDalitzDecays_plot : Plotter {
 
     virtual void ProcessEntry(const long long entry) override
     {
-        Tree.Tree->GetEntry(entry);
+        Tree.GetEntry(entry);
         cuttree::Fill<MCHist_t>(hists, {Tree});
     }
 
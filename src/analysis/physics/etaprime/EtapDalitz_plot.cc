@@ -1119,7 +1119,7 @@ struct EtapDalitz_plot : Plotter {
 
     virtual void ProcessEntry(const long long entry) override
     {
-        Tree.Tree->GetEntry(entry);
+        Tree.GetEntry(entry);
         cuttree::Fill<MCHist_t>(cuttree_hists, {Tree});
     }
 
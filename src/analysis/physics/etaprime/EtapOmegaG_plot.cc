@@ -705,9 +705,9 @@ struct EtapOmegaG_plot : Plotter {
 
     virtual void ProcessEntry(const long long entry) override
     {
-        treeCommon.Tree->GetEntry(entry);
+        treeCommon.GetEntry(entry);
         if(treeMCWeighting.Tree)
-            treeMCWeighting.Tree->GetEntry(entry);
+            treeMCWeighting.GetEntry(entry);
     }
 
 };
@@ -731,7 +731,7 @@ struct EtapOmegaG_plot_Ref : EtapOmegaG_plot {
     virtual void ProcessEntry(const long long entry) override
     {
         EtapOmegaG_plot::ProcessEntry(entry);
-        treeRef.Tree->GetEntry(entry);
+        treeRef.GetEntry(entry);
         cuttree::Fill<MCRefHist_t>(cuttreeRef, {treeCommon, treeRef, treeMCWeighting});
     }
 };
@@ -766,9 +766,9 @@ struct EtapOmegaG_plot_Sig : EtapOmegaG_plot {
     virtual void ProcessEntry(const long long entry) override
     {
         EtapOmegaG_plot::ProcessEntry(entry);
-        treeSigShared.Tree->GetEntry(entry);
-        treeSigPi0.Tree->GetEntry(entry);
-        treeSigOmegaPi0.Tree->GetEntry(entry);
+        treeSigShared.GetEntry(entry);
+        treeSigPi0.GetEntry(entry);
+        treeSigOmegaPi0.GetEntry(entry);
         cuttree::Fill<MCSigPi0Hist_t>(cuttreeSigPi0, {treeCommon, treeSigShared, treeSigPi0, treeMCWeighting});
         if(cuttreeSigOmegaPi0)
             cuttree::Fill<MCSigOmegaPi0Hist_t>(cuttreeSigOmegaPi0, {treeCommon, treeSigShared, treeSigOmegaPi0, treeMCWeighting});
@@ -519,8 +519,8 @@ public:
 
     virtual void ProcessEntry(const long long entry) override
     {
-        t->GetEntry(entry);
-        rec->GetEntry(entry);
+        tree.GetEntry(entry);
+        recTree.GetEntry(entry);
 
         cuttree::Fill<MCTrue_Splitter<TriplePi0Hist_t>>(signal_hists, {tree, recTree});
     }
@@ -286,7 +286,7 @@ struct TriggerSimulation_plot : Plotter {
 
     virtual void ProcessEntry(const long long entry) override
     {
-        tree.Tree->GetEntry(entry);
+        tree.GetEntry(entry);
         cuttree::Fill<DataMC_Splitter>(mycuttree, tree);
     }
 
@@ -1,6 +1,8 @@
 #include "HistogramFactory.h"
+#include "ThreadHist.h"
 
 #include "base/std_ext/string.h"
+#include "base/std_ext/memory.h"
 
 #include "TDirectory.h"
 #include "TGraph.h"
@@ -77,7 +79,8 @@ string HistogramFactory::GetNextName(const string &name, const string& autogener
 }
 
 HistogramFactory::HistogramFactory(const string &directory_name, TDirectory* root, const string& title_prefix_):
-    title_prefix(title_prefix_)
+    title_prefix(title_prefix_),
+    thread_hists(make_shared<thread_hists_t>())
 {
 
     if(!root)
@@ -100,6 +103,7 @@ HistogramFactory::HistogramFactory(const string& directory_name, const Histogram
                                                     std_ext::formatter() << parent.title_prefix << ": " << title_prefix_))
 
 {
+    thread_hists = parent.thread_hists;
 }
 
 void HistogramFactory::SetTitlePrefix(const string& title_prefix_)
@@ -254,6 +258,35 @@ TTree* HistogramFactory::makeTTree(const string& name) const
     return make<TTree>(GetNextName(name, "").c_str(), MakeTitle(name.c_str()).c_str());
 }
 
+ThreadTH1D* HistogramFactory::makeThreadTH1D(
+        const string& title,
+        const AxisSettings& x_axis_settings,
+        const string& name, bool sumw2) const
+{
+    auto h = std_ext::make_unique<ThreadTH1D>(makeTH1D(title, x_axis_settings, name, sumw2));
+    auto ptr = h.get();
+    thread_hists->emplace_back(move(h));
+    return ptr;
+}
+
+ThreadTH2D* HistogramFactory::makeThreadTH2D(
+        const string& title,
+        const AxisSettings& x_axis_settings,
+        const AxisSettings& y_axis_settings,
+        const string& name, bool sumw2) const
+{
+    auto h = std_ext::make_unique<ThreadTH2D>(makeTH2D(title, x_axis_settings, y_axis_settings, name, sumw2));
+    auto ptr = h.get();
+    thread_hists->emplace_back(move(h));
+    return ptr;
+}
+
+void HistogramFactory::MergeThreadHists() const
+{
+    for(auto& h : *thread_hists)
+        h->Merge();
+}
+
 HistogramFactory::DirStackPush::DirStackPush(const HistogramFactory& hf): dir(gDirectory)
 {
     hf.goto_dir();
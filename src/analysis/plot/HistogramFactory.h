@@ -5,6 +5,8 @@
 
 #include <string>
 #include <vector>
+#include <list>
+#include <memory>
 
 class TDirectory;
 class TNamed;
@@ -18,6 +20,10 @@ class TGraphErrors;
 namespace ant {
 namespace analysis {
 
+class ThreadHist;
+class ThreadTH1D;
+class ThreadTH2D;
+
 class HistogramFactory {
 private:
 
@@ -37,6 +43,10 @@ private:
     mutable unsigned n_unnamed = 0;
     std::string GetNextName(const std::string& name, const std::string& autogenerate_prefix = "hist") const;
 
+    // shared with child factories, owns the thread-aware wrappers
+    using thread_hists_t = std::list<std::unique_ptr<ThreadHist>>;
+    std::shared_ptr<thread_hists_t> thread_hists;
+
 
 public:
     struct DirStackPush {
@@ -124,6 +134,30 @@ public:
 
     TTree* makeTTree(const std::string& name) const;
 
+    /**
+     * @brief makeThreadTH1D creates a TH1D which can be filled from several threads
+     * @return wrapper owned by this factory, the TH1D is found as member Hist
+     * @see MergeThreadHists
+     */
+    ThreadTH1D* makeThreadTH1D(
+            const std::string& title,
+            const AxisSettings& x_axis_settings,
+            const std::string& name="",
+            bool  sumw2 = false) const;
+
+    ThreadTH2D* makeThreadTH2D(
+            const std::string& title,
+            const AxisSettings& x_axis_settings,
+            const AxisSettings& y_axis_settings,
+            const std::string& name="",
+            bool  sumw2 = false) const;
+
+    /**
+     * @brief MergeThreadHists merges the buffered fills of all thread-aware histograms
+     * made by this factory, its parent and its children
+     */
+    void MergeThreadHists() const;
+
     template<class T, typename... Args>
     T* make(Args&&... args) const {
         // save current dir and cd back to it on exit
@@ -2,11 +2,30 @@
 
 #include "expconfig/ExpConfig.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 using namespace ant;
 using namespace ant::analysis;
 using namespace ant::analysis::PromptRandom;
 using namespace std;
 
+RegisteredHist::RegisteredHist(const Switch& D) :
+    d(D)
+{
+    d.registered.push_back(this);
+}
+
+RegisteredHist::RegisteredHist(const RegisteredHist& other) :
+    RegisteredHist(other.d)
+{}
+
+RegisteredHist::~RegisteredHist()
+{
+    auto& r = d.registered;
+    r.erase(std::remove(r.begin(), r.end(), this), r.end());
+}
+
 void Hist1::MakeHistograms(const HistogramFactory& factory, const string& name, const string& title, const BinSettings& bins, const string& xtitle, const string& ytitle) {
 
     HistogramFactory myFactory(name, factory, title);
@@ -29,6 +48,80 @@ void Hist2::MakeHistograms(const HistogramFactory& factory, const string& name,
     subtracted->Sumw2();
 }
 
+void Hist1::FillAll(const std::vector<double>& x) {
+    if(x.size() != d.NHits())
+        throw std::runtime_error("PromptRandom::Hist1: Number of values does not match number of tagger hits");
+    if(x.empty())
+        return;
+
+    subtracted->FillN(x.size(), x.data(), d.FillWeights().data());
+
+    auto fill_hits = [this, &x] (TH1D* h, const vector<unsigned>& hits) {
+        if(hits.empty())
+            return;
+        buffer.clear();
+        for(auto i : hits)
+            buffer.push_back(x[i]);
+        h->FillN(buffer.size(), buffer.data(), nullptr);
+    };
+    fill_hits(prompt, d.PromptHits());
+    fill_hits(random, d.RandomHits());
+}
+
+void Hist1::FillStaged() {
+    if(staged.empty())
+        return;
+    if(!d.TaggerTimesSet())
+        throw std::runtime_error("PromptRandom::Hist1: Values staged, but no tagger times set for this event");
+
+    // every staged value once for every hit
+    const auto& ws = d.FillWeights();
+    buffer.clear();
+    buffer_w.clear();
+    for(auto x : staged) {
+        buffer.insert(buffer.end(), ws.size(), x);
+        buffer_w.insert(buffer_w.end(), ws.begin(), ws.end());
+    }
+    if(!buffer.empty())
+        subtracted->FillN(buffer.size(), buffer.data(), buffer_w.data());
+
+    auto fill_hits = [this] (TH1D* h, std::size_t nHits) {
+        if(nHits == 0)
+            return;
+        buffer.clear();
+        for(auto x : staged)
+            buffer.insert(buffer.end(), nHits, x);
+        h->FillN(buffer.size(), buffer.data(), nullptr);
+    };
+    fill_hits(prompt, d.PromptHits().size());
+    fill_hits(random, d.RandomHits().size());
+
+    staged.clear();
+}
+
+void Hist2::FillAll(const std::vector<double>& x, const std::vector<double>& y) {
+    if(x.size() != d.NHits() || y.size() != d.NHits())
+        throw std::runtime_error("PromptRandom::Hist2: Number of values does not match number of tagger hits");
+    if(x.empty())
+        return;
+
+    subtracted->FillN(x.size(), x.data(), y.data(), d.FillWeights().data());
+
+    auto fill_hits = [this, &x, &y] (TH2D* h, const vector<unsigned>& hits) {
+        if(hits.empty())
+            return;
+        buffer_x.clear();
+        buffer_y.clear();
+        for(auto i : hits) {
+            buffer_x.push_back(x[i]);
+            buffer_y.push_back(y[i]);
+        }
+        h->FillN(buffer_x.size(), buffer_x.data(), buffer_y.data(), nullptr);
+    };
+    fill_hits(prompt, d.PromptHits());
+    fill_hits(random, d.RandomHits());
+}
+
 void Switch::update_ratio() {
     double p = promptw.Area();
     double r = randomw.Area();
@@ -37,6 +130,57 @@ void Switch::update_ratio() {
     } else {
         ratio = p/r;
     }
+    update_table();
+}
+
+Case Switch::classify_windows(const double tagtime) const {
+    // random has precedence, as in the original per-hit logic
+    if(randomw.Contains(tagtime))
+        return Case::Random;
+    if(promptw.Contains(tagtime))
+        return Case::Prompt;
+    return Case::Outside;
+}
+
+void Switch::update_table() {
+    auto& edges = table.Edges;
+    edges.clear();
+    for(const auto w : {&promptw, &randomw}) {
+        for(const auto& i : *w) {
+            edges.push_back(i.Start());
+            edges.push_back(i.Stop());
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    // windows are closed intervals, so classify the edges themselves
+    // and the open ranges between them (by their midpoint) separately
+    table.AtEdge.resize(edges.size());
+    table.AfterEdge.resize(edges.size());
+    for(size_t i=0;i<edges.size();i++) {
+        table.AtEdge[i] = classify_windows(edges[i]);
+        table.AfterEdge[i] = i+1<edges.size() ?
+                                 classify_windows((edges[i]+edges[i+1])/2.0) :
+                                 Case::Outside;
+    }
+}
+
+Case Switch::classify(const double tagtime) const {
+    const auto& edges = table.Edges;
+    auto it = std::upper_bound(edges.begin(), edges.end(), tagtime);
+    if(it == edges.begin())
+        return Case::Outside;
+    const auto i = std::distance(edges.begin(), it) - 1;
+    return edges[i] == tagtime ? table.AtEdge[i] : table.AfterEdge[i];
+}
+
+double Switch::weight(const Case c) const {
+    switch(c) {
+    case Case::Random: return -Ratio();
+    case Case::Prompt: return 1.0;
+    default: return 0.0;
+    }
 }
 
 Switch::Switch(const expconfig::Setup_traits& setup) :
@@ -57,16 +201,63 @@ void Switch::AddRandomRange(const Switch::interval_t& i) {
 }
 
 void Switch::SetTaggerTime(const double tagtime) {
+    rpcase = classify(tagtime);
+    fillw = weight(rpcase);
+}
 
-    if(randomw.Contains(tagtime)) {
-        rpcase = Case::Random;
-        fillw = -Ratio();
-    } else if(promptw.Contains(tagtime)) {
-        rpcase = Case::Prompt;
-        fillw = 1.0;
-    } else {
-        rpcase = Case::Outside;
-        fillw = 0.0;
+void Switch::FillRegistered() {
+    for(auto h : registered)
+        h->FillStaged();
+    taggertimes_set = false;
+}
+
+void Switch::SetTaggerTimes(const std::vector<double>& tagtimes) {
+    fillws.resize(tagtimes.size());
+    prompt_hits.clear();
+    random_hits.clear();
+    for(unsigned i=0;i<tagtimes.size();i++) {
+        const auto c = classify(tagtimes[i]);
+        fillws[i] = weight(c);
+        if(c == Case::Prompt)
+            prompt_hits.push_back(i);
+        else if(c == Case::Random)
+            random_hits.push_back(i);
     }
+    taggertimes_set = true;
+}
+
+void Hist2::FillStaged() {
+    if(staged_x.empty())
+        return;
+    if(!d.TaggerTimesSet())
+        throw std::runtime_error("PromptRandom::Hist2: Values staged, but no tagger times set for this event");
+
+    const auto& ws = d.FillWeights();
+    buffer_x.clear();
+    buffer_y.clear();
+    buffer_w.clear();
+    for(size_t j=0;j<staged_x.size();j++) {
+        buffer_x.insert(buffer_x.end(), ws.size(), staged_x[j]);
+        buffer_y.insert(buffer_y.end(), ws.size(), staged_y[j]);
+        buffer_w.insert(buffer_w.end(), ws.begin(), ws.end());
+    }
+    if(!buffer_x.empty())
+        subtracted->FillN(buffer_x.size(), buffer_x.data(), buffer_y.data(), buffer_w.data());
+
+    auto fill_hits = [this] (TH2D* h, std::size_t nHits) {
+        if(nHits == 0)
+            return;
+        buffer_x.clear();
+        buffer_y.clear();
+        for(size_t j=0;j<staged_x.size();j++) {
+            buffer_x.insert(buffer_x.end(), nHits, staged_x[j]);
+            buffer_y.insert(buffer_y.end(), nHits, staged_y[j]);
+        }
+        h->FillN(buffer_x.size(), buffer_x.data(), buffer_y.data(), nullptr);
+    };
+    fill_hits(prompt, d.PromptHits().size());
+    fill_hits(random, d.RandomHits().size());
 
+    staged_x.clear();
+    staged_y.clear();
 }
@@ -9,6 +9,7 @@
 #include "TH2D.h"
 
 #include <string>
+#include <vector>
 
 namespace ant {
 
@@ -25,6 +26,27 @@ enum class Case {
     Outside
 };
 
+class Switch;
+
+/**
+ * @brief The RegisteredHist struct registers a histogram at its Switch,
+ * so that Switch::FillRegistered fills all staged values at once
+ * @note the Switch must outlive its histograms
+ */
+struct RegisteredHist {
+    const Switch& d;
+
+    RegisteredHist(const Switch& D);
+    RegisteredHist(const RegisteredHist& other);
+    RegisteredHist& operator=(const RegisteredHist&) = delete;
+    virtual ~RegisteredHist();
+
+    /**
+     * @brief FillStaged fills the staged values once for every tagger hit
+     * given to Switch::SetTaggerTimes and clears them
+     */
+    virtual void FillStaged() = 0;
+};
 
 class Switch {
 public:
@@ -38,9 +60,33 @@ protected:
 
     void update_ratio();
 
+    // the windows flattened into sorted edges,
+    // the case exactly at an edge and between two edges is precomputed
+    struct window_table_t {
+        std::vector<double> Edges;
+        std::vector<Case>   AtEdge;
+        std::vector<Case>   AfterEdge;
+    };
+    window_table_t table;
+    void update_table();
+    Case classify(double tagtime) const;
+    Case classify_windows(double tagtime) const;
+    double weight(Case c) const;
+
     Case rpcase = Case::Prompt;
     double fillw = 1.0;
 
+    // results of SetTaggerTimes
+    std::vector<double>   fillws;
+    std::vector<unsigned> prompt_hits;
+    std::vector<unsigned> random_hits;
+    // reset by FillRegistered, such that staged values are never filled with old hits
+    bool taggertimes_set = false;
+
+    friend struct RegisteredHist;
+    // the histograms point to this instance, so it must not be copied
+    mutable std::vector<RegisteredHist*> registered;
+
 public:
     Switch()  = default;
     Switch(const expconfig::Setup_traits& setup);
@@ -48,7 +94,7 @@ public:
     // Since Switch and Hist1/2 are loosely bound
     // we do not allow moves/copies after Switch was created
     Switch(const Switch&) = delete;
-    Switch& operator=(Switch&) = delete;
+    Switch& operator=(const Switch&) = delete;
     Switch(Switch&&) = delete;
     Switch& operator=(Switch&&) = delete;
 
@@ -70,19 +116,38 @@ public:
 
     void SetTaggerTime(double tagtime);
 
+    /**
+     * @brief SetTaggerTimes classifies all tagger hits of an event in one pass,
+     * use Hist1::FillAll and Hist2::FillAll or FillRegistered afterwards
+     * @param tagtimes the (corrected) tagger hit times
+     */
+    void SetTaggerTimes(const std::vector<double>& tagtimes);
 
+    /**
+     * @brief FillWeights gives the weight for each hit given to SetTaggerTimes
+     */
+    const std::vector<double>& FillWeights() const { return fillws; }
+    const std::vector<unsigned>& PromptHits() const { return prompt_hits; }
+    const std::vector<unsigned>& RandomHits() const { return random_hits; }
+    std::size_t NHits() const { return fillws.size(); }
+    bool TaggerTimesSet() const { return taggertimes_set; }
+
+    /**
+     * @brief FillRegistered fills the staged values of all histograms using this Switch,
+     * call once per event after SetTaggerTimes and staging the values
+     * @throws std::runtime_error if values were staged, but SetTaggerTimes was not called since the last FillRegistered
+     */
+    void FillRegistered();
 };
 
 
-struct Hist1 {
+struct Hist1 : RegisteredHist {
     TH1D* prompt;
     TH1D* random;
     TH1D* subtracted;
 
-    const Switch& d;
-
     Hist1(Switch& D):
-        d(D) {}
+        RegisteredHist(D) {}
 
     void MakeHistograms(const HistogramFactory& factory,
                         const std::string& name,
@@ -102,17 +167,33 @@ struct Hist1 {
         }
 
     }
+
+    /**
+     * @brief FillAll fills the values for each tagger hit given to Switch::SetTaggerTimes
+     * @param x one value per tagger hit
+     */
+    void FillAll(const std::vector<double>& x);
+
+    /**
+     * @brief Stage remembers x to be filled for every tagger hit by Switch::FillRegistered
+     */
+    void Stage(const double x) { staged.push_back(x); }
+
+    void FillStaged() override;
+
+protected:
+    std::vector<double> buffer;
+    std::vector<double> buffer_w;
+    std::vector<double> staged;
 };
 
-struct Hist2 {
+struct Hist2 : RegisteredHist {
     TH2D* prompt;
     TH2D* random;
     TH2D* subtracted;
 
-    const Switch& d;
-
     Hist2(Switch& D):
-        d(D) {}
+        RegisteredHist(D) {}
 
     void MakeHistograms(const HistogramFactory& factory,
                         const std::string& name,
@@ -133,6 +214,22 @@ struct Hist2 {
         }
 
     }
+
+    void FillAll(const std::vector<double>& x, const std::vector<double>& y);
+
+    void Stage(const double x, const double y) {
+        staged_x.push_back(x);
+        staged_y.push_back(y);
+    }
+
+    void FillStaged() override;
+
+protected:
+    std::vector<double> buffer_x;
+    std::vector<double> buffer_y;
+    std::vector<double> buffer_w;
+    std::vector<double> staged_x;
+    std::vector<double> staged_y;
 };
 
 }
@@ -0,0 +1,249 @@
+#include "ThreadHist.h"
+
+#include "base/std_ext/string.h"
+
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TAxis.h"
+#include "TArrayD.h"
+
+#include <algorithm>
+#include <bitset>
+#include <mutex>
+
+using namespace std;
+using namespace ant;
+using namespace ant::analysis;
+
+constexpr unsigned ThreadSlot::MaxSlots;
+constexpr size_t ThreadHist::BufferSize;
+
+namespace {
+
+// slots assigned automatically are handed back when the thread exits,
+// so any number of short-lived threads can fill (just not more than MaxSlots at once)
+struct slot_pool_t {
+    std::mutex mutex;
+    std::bitset<ThreadSlot::MaxSlots> used;
+
+    unsigned Acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(unsigned slot=0;slot<ThreadSlot::MaxSlots;slot++) {
+            if(used[slot])
+                continue;
+            used[slot] = true;
+            return slot;
+        }
+        throw std::runtime_error(std_ext::formatter() << "More than " << ThreadSlot::MaxSlots
+                                 << " threads filling histograms at the same time");
+    }
+
+    void Release(unsigned slot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        used[slot] = false;
+    }
+};
+
+slot_pool_t& slot_pool() {
+    // never destroyed, as threads might still exit during static destruction
+    static auto pool = new slot_pool_t();
+    return *pool;
+}
+
+struct slot_holder_t {
+    unsigned Slot = ThreadSlot::MaxSlots;
+    bool Pooled = false;
+
+    void Release() {
+        if(Pooled)
+            slot_pool().Release(Slot);
+        Pooled = false;
+        Slot = ThreadSlot::MaxSlots;
+    }
+
+    ~slot_holder_t() { Release(); }
+};
+
+thread_local slot_holder_t this_slot;
+}
+
+unsigned ThreadSlot::Get()
+{
+    if(this_slot.Slot == MaxSlots) {
+        this_slot.Slot = slot_pool().Acquire();
+        this_slot.Pooled = true;
+    }
+    return this_slot.Slot;
+}
+
+void ThreadSlot::Set(unsigned slot)
+{
+    if(slot >= MaxSlots)
+        throw std::runtime_error(std_ext::formatter() << "Thread slot " << slot << " too large");
+    this_slot.Release();
+    this_slot.Slot = slot;
+}
+
+ThreadHist::axis_t::axis_t(const TAxis& axis) :
+    Axis(axis),
+    Bins(axis.GetNbins()),
+    Min(axis.GetXmin()),
+    Max(axis.GetXmax()),
+    IsUniform(axis.GetXbins()->GetSize() == 0)
+{
+    if(axis.GetLabels())
+        throw std::runtime_error("ThreadHist does not support axes with labels");
+}
+
+void ThreadHist::axis_t::FindBins(const vector<double>& values, vector<int>& bins) const
+{
+    const auto n = values.size();
+    bins.resize(n);
+    if(!IsUniform) {
+        for(size_t i=0;i<n;i++)
+            bins[i] = Axis.FindFixBin(values[i]);
+        return;
+    }
+    // same arithmetic as TAxis::FindFixBin, but simple enough to vectorize
+    const double width = Max-Min;
+    for(size_t i=0;i<n;i++) {
+        const double x = values[i];
+        bins[i] = x < Min ? 0 : !(x < Max) ? Bins+1 : 1 + int(Bins*(x-Min)/width);
+    }
+}
+
+ThreadHist::ThreadHist(TH1& hist, unsigned dim) :
+    Target(hist),
+    Dim(dim),
+    AxisX(*hist.GetXaxis()),
+    AxisY(*hist.GetYaxis())
+{
+    for(auto& s : shadows)
+        s.store(nullptr);
+}
+
+ThreadHist::~ThreadHist()
+{
+    for(auto& s : shadows)
+        delete s.load();
+}
+
+ThreadHist::shadow_t& ThreadHist::MakeShadow(unsigned slot)
+{
+    // only the thread owning the slot ever writes it,
+    // so no compare-exchange is needed
+    auto shadow = new shadow_t(Target.GetNcells());
+    shadow->X.reserve(BufferSize);
+    if(Dim>1)
+        shadow->Y.reserve(BufferSize);
+    shadow->W.reserve(BufferSize);
+    shadows[slot].store(shadow, std::memory_order_release);
+    return *shadow;
+}
+
+void ThreadHist::Flush(shadow_t& s) const
+{
+    const auto n = s.W.size();
+
+    // find all bins first
+    AxisX.FindBins(s.X, s.BinsX);
+    if(Dim>1)
+        AxisY.FindBins(s.Y, s.BinsY);
+
+    const int nx = AxisX.Bins;
+    const int ny = AxisY.Bins;
+    auto& stats = s.Stats;
+
+    for(size_t i=0;i<n;i++) {
+        const double w = s.W[i];
+        const int binx = s.BinsX[i];
+        int bin = binx;
+        bool inRange = binx > 0 && binx <= nx;
+        if(Dim>1) {
+            const int biny = s.BinsY[i];
+            bin += (nx+2)*biny;
+            inRange = inRange && biny > 0 && biny <= ny;
+        }
+
+        s.SumW[bin]  += w;
+        s.SumW2[bin] += w*w;
+        s.Entries++;
+        if(w != 1.0)
+            s.Weighted = true;
+
+        // as TH1::Fill, statistics only from in-range values
+        if(!inRange)
+            continue;
+        const double x = s.X[i];
+        stats[0] += w;
+        stats[1] += w*w;
+        stats[2] += w*x;
+        stats[3] += w*x*x;
+        if(Dim>1) {
+            const double y = s.Y[i];
+            stats[4] += w*y;
+            stats[5] += w*y*y;
+            stats[6] += w*x*y;
+        }
+    }
+
+    s.X.clear();
+    s.Y.clear();
+    s.W.clear();
+}
+
+void ThreadHist::Merge()
+{
+    const unsigned nStats = Dim>1 ? 7 : 4;
+
+    for(auto& slot : shadows) {
+        auto shadow = slot.load(std::memory_order_acquire);
+        if(!shadow)
+            continue;
+        auto& s = *shadow;
+        Flush(s);
+        if(s.Entries == 0)
+            continue;
+
+        // TH1::Fill switches to Sumw2 as soon as weights are used
+        if(s.Weighted && Target.GetSumw2N() == 0)
+            Target.Sumw2();
+
+        // get stats before changing the bin contents,
+        // otherwise ROOT might recompute them
+        double stats[7] = {};
+        Target.GetStats(stats);
+        const auto entries = Target.GetEntries();
+
+        const auto sumw2 = Target.GetSumw2N() > 0 ? Target.GetSumw2()->GetArray() : nullptr;
+        for(size_t bin=0;bin<s.SumW.size();bin++) {
+            if(s.SumW2[bin] == 0)
+                continue;
+            Target.AddBinContent(bin, s.SumW[bin]);
+            if(sumw2)
+                sumw2[bin] += s.SumW2[bin];
+        }
+
+        for(unsigned i=0;i<nStats;i++)
+            stats[i] += s.Stats[i];
+        Target.PutStats(stats);
+        Target.SetEntries(entries + s.Entries);
+
+        // reset shadow for further filling
+        std::fill(s.SumW.begin(), s.SumW.end(), 0);
+        std::fill(s.SumW2.begin(), s.SumW2.end(), 0);
+        s.Stats.fill(0);
+        s.Entries = 0;
+        s.Weighted = false;
+    }
+}
+
+ThreadTH1D::ThreadTH1D(TH1D* hist) :
+    ThreadHist(*hist, 1),
+    Hist(hist)
+{}
+
+ThreadTH2D::ThreadTH2D(TH2D* hist) :
+    ThreadHist(*hist, 2),
+    Hist(hist)
+{}
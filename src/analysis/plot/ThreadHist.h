@@ -0,0 +1,132 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <atomic>
+#include <stdexcept>
+
+class TH1;
+class TH1D;
+class TH2D;
+class TAxis;
+
+namespace ant {
+namespace analysis {
+
+/**
+ * @brief The ThreadSlot struct assigns each thread a small, fixed index
+ *
+ * The index is automatically assigned on first use and handed back to the
+ * pool when the thread exits, a later thread may then get the same slot
+ * (and continues filling the same, not yet merged shadow buffers).
+ * A worker pool should set the slots explicitly, then merging the ThreadHist's
+ * is deterministic. Explicitly set slots are not taken from the pool, so do not
+ * mix both ways while filling the same histograms concurrently.
+ */
+struct ThreadSlot {
+    static constexpr unsigned MaxSlots = 64;
+    static unsigned Get();
+    static void Set(unsigned slot);
+};
+
+/**
+ * @brief The ThreadHist class buffers fills of a TH1D/TH2D per thread
+ *
+ * Each thread fills its own shadow buffer without any locking, full buffers
+ * are binned in bulk into the thread's own bin arrays. Merge() adds all
+ * shadows into the ROOT histogram in order of the thread slot.
+ * Use ThreadTH1D and ThreadTH2D, usually made by the HistogramFactory.
+ *
+ * @note Merge() must not run concurrently to Fill().
+ * @note Axes must not have labels, as with any plain TH1::Fill(x,w) call.
+ */
+class ThreadHist {
+public:
+    virtual ~ThreadHist();
+
+    /**
+     * @brief Merge flushes all thread buffers into the ROOT histogram and resets them
+     */
+    void Merge();
+
+    static constexpr std::size_t BufferSize = 1024;
+
+    ThreadHist(const ThreadHist&) = delete;
+    ThreadHist& operator=(const ThreadHist&) = delete;
+
+protected:
+    ThreadHist(TH1& hist, unsigned dim);
+
+    struct axis_t {
+        explicit axis_t(const TAxis& axis);
+        void FindBins(const std::vector<double>& values, std::vector<int>& bins) const;
+        const TAxis& Axis;
+        const int Bins;
+        const double Min;
+        const double Max;
+        const bool IsUniform;
+    };
+
+    struct shadow_t {
+        explicit shadow_t(std::size_t nBins) : SumW(nBins), SumW2(nBins) {}
+        std::vector<double> X, Y, W;
+        std::vector<int> BinsX, BinsY;
+        std::vector<double> SumW, SumW2;
+        // stats as in TH1::GetStats, only from in-range fills
+        std::array<double, 7> Stats{};
+        double Entries = 0;
+        bool Weighted = false;
+    };
+
+    shadow_t& GetShadow() {
+        const auto slot = ThreadSlot::Get();
+        auto shadow = shadows[slot].load(std::memory_order_acquire);
+        if(shadow)
+            return *shadow;
+        return MakeShadow(slot);
+    }
+
+    void Flush(shadow_t& shadow) const;
+
+    TH1& Target;
+    const unsigned Dim;
+    const axis_t AxisX;
+    const axis_t AxisY;
+
+private:
+    shadow_t& MakeShadow(unsigned slot);
+    std::array<std::atomic<shadow_t*>, ThreadSlot::MaxSlots> shadows;
+};
+
+class ThreadTH1D : public ThreadHist {
+public:
+    explicit ThreadTH1D(TH1D* hist);
+
+    void Fill(double x, double w = 1.0) {
+        auto& s = GetShadow();
+        s.X.push_back(x);
+        s.W.push_back(w);
+        if(s.W.size() == BufferSize)
+            Flush(s);
+    }
+
+    TH1D* const Hist;
+};
+
+class ThreadTH2D : public ThreadHist {
+public:
+    explicit ThreadTH2D(TH2D* hist);
+
+    void Fill(double x, double y, double w = 1.0) {
+        auto& s = GetShadow();
+        s.X.push_back(x);
+        s.Y.push_back(y);
+        s.W.push_back(w);
+        if(s.W.size() == BufferSize)
+            Flush(s);
+    }
+
+    TH2D* const Hist;
+};
+
+}}
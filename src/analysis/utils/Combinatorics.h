@@ -4,6 +4,8 @@
 #include "base/std_ext/math.h"
 
 #include <vector>
+#include <array>
+#include <utility>
 #include <cmath>
 
 namespace ant {
@@ -34,28 +36,20 @@ protected:
 
     bool nextlevel( index_type i ) {
 
-        if(indices.at(i) >= _data.size() - (indices.size() - i)) {
+        // indices are always valid by construction, so skip bounds checking here
+        if(indices[i] >= _data.size() - (indices.size() - i)) {
             if( i!=0 && nextlevel(i-1) ) {
-                indices.at(i) = indices.at(i-1) +1;
+                indices[i] = indices[i-1] +1;
                 return true;
             } else
                 return false;
         } else {
-            indices.at(i)++;
+            indices[i]++;
             return true;
         }
     }
 
-public:
-    typedef T value_type;
-
-    /**
-     * @brief KofNvector
-     * @param _data The std::vector to draw from
-     * @param k number of elemets to draw each time
-     */
-    NchooseK( const std::vector<T>& data, index_type k): _data(data), _done(false) {
-
+    void init(index_type k) {
         if(k>_data.size()) {
             k=0;
             _done=true;
@@ -64,11 +58,30 @@ public:
         indices.resize(k);
 
         for(index_type i=0;i<k; ++i) {
-            indices.at(i) = i;
+            indices[i] = i;
         }
     }
 
-    /// \todo make a move constructor
+public:
+    typedef T value_type;
+
+    /**
+     * @brief KofNvector
+     * @param _data The std::vector to draw from
+     * @param k number of elemets to draw each time
+     */
+    NchooseK( const std::vector<T>& data, index_type k): _data(data), _done(false) {
+        init(k);
+    }
+
+    /**
+     * @brief KofNvector taking over the given data, avoids copying temporaries
+     * @param _data The std::vector to draw from
+     * @param k number of elemets to draw each time
+     */
+    NchooseK( std::vector<T>&& data, index_type k): _data(std::move(data)), _done(false) {
+        init(k);
+    }
 
     /**
      * @brief Access the ith element of the currently drawn combination
@@ -112,7 +125,7 @@ public:
 
         bool operator!=(const const_iterator& rhs) {return index!=rhs.index;}
 
-        const T& operator*() const { return v._data.at(*index); }
+        const T& operator*() const { return v._data[*index]; }
 
         typedef T value_type;
     };
@@ -148,4 +161,142 @@ NchooseK<T> makeCombination( const std::vector<T>& data, const unsigned int k) {
     return NchooseK<T>(data,k);
 }
 
+template <typename T>
+NchooseK<T> makeCombination( std::vector<T>&& data, const unsigned int k) {
+    return NchooseK<T>(std::move(data),k);
+}
+
+/**
+ * @brief KSubsets generates all k-subsets of the indices {0,...,n-1}, with k known at compile time
+ *
+ * Same order as NchooseK, but only the indices are generated, so nothing is copied or allocated.
+ * Use it together with an indexed container, for example utils::IMMatrix.
+ */
+template<unsigned K>
+class KSubsets {
+public:
+    using indices_t = std::array<unsigned, K>;
+
+    explicit KSubsets(unsigned n) noexcept : _n(n), _done(K>n) {
+        for(unsigned i=0;i<K;i++)
+            indices[i] = i;
+    }
+
+    const indices_t& operator*() const noexcept { return indices; }
+    const indices_t* operator->() const noexcept { return &indices; }
+    unsigned operator[](unsigned i) const noexcept { return indices[i]; }
+
+    bool done() const noexcept { return _done; }
+
+    /**
+     * @brief next generates the next subset
+     * @return false if no more subsets to do
+     */
+    bool next() noexcept {
+        if(_done)
+            return false;
+        // find rightmost index which can still be incremented
+        unsigned i = K;
+        while(i>0 && indices[i-1] == _n - K + i - 1)
+            --i;
+        if(i==0) {
+            _done = true;
+            return false;
+        }
+        ++indices[i-1];
+        for(unsigned j=i;j<K;j++)
+            indices[j] = indices[j-1]+1;
+        return true;
+    }
+
+    KSubsets& operator++() noexcept { next(); return *this; }
+
+    unsigned n() const noexcept { return _n; }
+    static constexpr unsigned k() noexcept { return K; }
+
+private:
+    indices_t indices;
+    unsigned  _n;
+    bool      _done;
+};
+
+/**
+ * @brief PairMatchings generates all perfect matchings of 2*NPairs elements into NPairs unordered pairs
+ *
+ * For example, 6 photons can be combined into 3 pairs in 15 different ways.
+ * Within each pair the lower index comes first, and the pairs are sorted by their first index,
+ * so every matching appears exactly once. Nothing is allocated.
+ */
+template<unsigned NPairs>
+class PairMatchings {
+public:
+    using pair_t = std::pair<unsigned, unsigned>;
+    using pairs_t = std::array<pair_t, NPairs>;
+
+    /// number of perfect matchings, which is (2*NPairs-1)!!
+    static constexpr unsigned Count(unsigned n = NPairs) noexcept {
+        return n <= 1 ? 1 : (2*n-1)*Count(n-1);
+    }
+
+    PairMatchings() noexcept : _done(false) {
+        choices.fill(0);
+        build();
+    }
+
+    const pairs_t& operator*() const noexcept { return pairs; }
+    const pairs_t* operator->() const noexcept { return &pairs; }
+    const pair_t& operator[](unsigned i) const noexcept { return pairs[i]; }
+
+    bool done() const noexcept { return _done; }
+
+    /**
+     * @brief next generates the next matching
+     * @return false if no more matchings to do
+     */
+    bool next() noexcept {
+        if(_done)
+            return false;
+        // mixed-radix counter, pair p has 2*(NPairs-p)-1 possible partners
+        unsigned p = NPairs;
+        while(p>0) {
+            --p;
+            if(choices[p]+1 < 2*(NPairs-p)-1) {
+                ++choices[p];
+                build();
+                return true;
+            }
+            choices[p] = 0;
+        }
+        _done = true;
+        return false;
+    }
+
+    PairMatchings& operator++() noexcept { next(); return *this; }
+
+private:
+    void build() noexcept {
+        std::array<bool, 2*NPairs> used;
+        used.fill(false);
+        for(unsigned p=0;p<NPairs;p++) {
+            // the first unused element is paired with the choices[p]-th of the remaining ones
+            unsigned first = 0;
+            while(used[first])
+                ++first;
+            used[first] = true;
+            unsigned second = first;
+            for(unsigned c=0;c<=choices[p];c++) {
+                ++second;
+                while(used[second])
+                    ++second;
+            }
+            used[second] = true;
+            pairs[p] = {first, second};
+        }
+    }
+
+    std::array<unsigned, NPairs> choices;
+    pairs_t pairs;
+    bool _done;
+};
+
 }}} // namespace ant::analysis::utils
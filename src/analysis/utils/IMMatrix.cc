@@ -0,0 +1,69 @@
+#include "IMMatrix.h"
+
+using namespace std;
+using namespace ant;
+using namespace ant::analysis::utils;
+
+void IMMatrix::Set(const TParticleList& particles, bool triples)
+{
+    n = particles.size();
+    E.resize(n); Px.resize(n); Py.resize(n); Pz.resize(n);
+    for(unsigned i=0;i<n;i++) {
+        const TParticle& p = *particles[i];
+        E[i]  = p.E;
+        Px[i] = p.p.x;
+        Py[i] = p.p.y;
+        Pz[i] = p.p.z;
+    }
+    build(triples);
+}
+
+void IMMatrix::Set(const vector<LorentzVec>& lvs, bool triples)
+{
+    n = lvs.size();
+    E.resize(n); Px.resize(n); Py.resize(n); Pz.resize(n);
+    for(unsigned i=0;i<n;i++) {
+        E[i]  = lvs[i].E;
+        Px[i] = lvs[i].p.x;
+        Py[i] = lvs[i].p.y;
+        Pz[i] = lvs[i].p.z;
+    }
+    build(triples);
+}
+
+void IMMatrix::build(bool triples)
+{
+    s_index.resize(n);
+    s_E.resize(n+1); s_Px.resize(n+1); s_Py.resize(n+1); s_Pz.resize(n+1);
+
+    // raw pointers help the compiler to vectorize the inner loops
+    const double* e = E.data();
+    const double* x = Px.data();
+    const double* y = Py.data();
+    const double* z = Pz.data();
+
+    IMs2.resize(n*n);
+    for(unsigned i=0;i<n;i++) {
+        double* row = &IMs2[i*n];
+        for(unsigned j=0;j<n;j++)
+            row[j] = calcM(e[i]+e[j], x[i]+x[j], y[i]+y[j], z[i]+z[j]);
+    }
+
+    if(!triples) {
+        IMs3.clear();
+        return;
+    }
+
+    IMs3.resize(n*n*n);
+    for(unsigned i=0;i<n;i++) {
+        for(unsigned j=i+1;j<n;j++) {
+            const double e_ij = e[i]+e[j];
+            const double x_ij = x[i]+x[j];
+            const double y_ij = y[i]+y[j];
+            const double z_ij = z[i]+z[j];
+            double* row = &IMs3[(i*n+j)*n];
+            for(unsigned k=j+1;k<n;k++)
+                row[k] = calcM(e_ij+e[k], x_ij+x[k], y_ij+y[k], z_ij+z[k]);
+        }
+    }
+}
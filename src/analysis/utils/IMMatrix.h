@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Combinatorics.h"
+
+#include "tree/TParticle.h"
+#include "base/vec/LorentzVec.h"
+
+#include <algorithm>
+#include <vector>
+#include <array>
+
+namespace ant {
+namespace analysis {
+namespace utils {
+
+/**
+ * @brief The IMMatrix class caches the four-vectors of some particles (usually photons)
+ * as structure of arrays, together with all pairwise and optionally all triple invariant masses
+ *
+ * Build it once per event, then the invariant masses of pairs/triples are plain lookups.
+ * The inner loops run over contiguous arrays, such that the compiler can vectorize them.
+ * The memory is kept when calling Set again, so reusing an instance does not allocate.
+ */
+class IMMatrix {
+public:
+    IMMatrix() = default;
+    explicit IMMatrix(const TParticleList& particles, bool triples = false) { Set(particles, triples); }
+    explicit IMMatrix(const std::vector<LorentzVec>& lvs, bool triples = false) { Set(lvs, triples); }
+
+    /**
+     * @brief Set fills the cache from the given particles
+     * @param particles the particles, their order defines the indices
+     * @param triples also calculate the invariant masses of all triples
+     */
+    void Set(const TParticleList& particles, bool triples = false);
+    void Set(const std::vector<LorentzVec>& lvs, bool triples = false);
+
+    unsigned size() const noexcept { return n; }
+
+    LorentzVec LV(unsigned i) const noexcept { return {{Px[i], Py[i], Pz[i]}, E[i]}; }
+
+    /// invariant mass of the pair i,j (symmetric)
+    double IM(unsigned i, unsigned j) const noexcept { return IMs2[i*n+j]; }
+
+    /// invariant mass of the triple i<j<k, only available if Set was called with triples=true
+    double IM(unsigned i, unsigned j, unsigned k) const noexcept { return IMs3[(i*n+j)*n+k]; }
+
+    /// invariant mass of an arbitrary subset, summed up from the cached four-vectors
+    template<std::size_t K>
+    double IM(const std::array<unsigned, K>& indices) const noexcept {
+        double e = 0, x = 0, y = 0, z = 0;
+        for(auto i : indices) {
+            e += E[i]; x += Px[i]; y += Py[i]; z += Pz[i];
+        }
+        return calcM(e, x, y, z);
+    }
+
+    /**
+     * @brief ForEachSubset calls f with the four-vector sum of every k-subset
+     * @param k number of particles summed up
+     * @param f callback taking const LorentzVec&, called in the same order as NchooseK generates the subsets
+     * @note partial sums are re-used, so each subset costs only one addition on average
+     */
+    template<typename Callback>
+    void ForEachSubset(unsigned k, Callback f) const;
+
+    static double calcM(double e, double x, double y, double z) noexcept {
+        // same as LorentzVec::M, but without branching
+        const double mm = e*e - (x*x + y*y + z*z);
+        return std::copysign(std::sqrt(std::fabs(mm)), mm);
+    }
+
+private:
+    void build(bool triples);
+
+    unsigned n = 0;
+    std::vector<double> E;
+    std::vector<double> Px;
+    std::vector<double> Py;
+    std::vector<double> Pz;
+
+    std::vector<double> IMs2; // n x n
+    std::vector<double> IMs3; // n x n x n, only i<j<k filled
+
+    // scratch space for ForEachSubset
+    mutable std::vector<unsigned> s_index;
+    mutable std::vector<double> s_E;
+    mutable std::vector<double> s_Px;
+    mutable std::vector<double> s_Py;
+    mutable std::vector<double> s_Pz;
+};
+
+template<typename Callback>
+void IMMatrix::ForEachSubset(unsigned k, Callback f) const
+{
+    if(k == 0 || k > n)
+        return;
+
+    // s_*[d+1] holds the sum of the particles at s_index[0..d]
+    s_E[0] = 0; s_Px[0] = 0; s_Py[0] = 0; s_Pz[0] = 0;
+    s_index[0] = 0;
+    unsigned d = 0;
+    while(true) {
+        // descend with consecutive indices
+        for(; d<k; ++d) {
+            const auto i = s_index[d];
+            s_E[d+1]  = s_E[d]  + E[i];
+            s_Px[d+1] = s_Px[d] + Px[i];
+            s_Py[d+1] = s_Py[d] + Py[i];
+            s_Pz[d+1] = s_Pz[d] + Pz[i];
+            if(d+1<k)
+                s_index[d+1] = i+1;
+        }
+
+        f(LorentzVec({s_Px[k], s_Py[k], s_Pz[k]}, s_E[k]));
+
+        // find rightmost index which can still be incremented
+        d = k;
+        while(d>0 && s_index[d-1] == n - k + d - 1)
+            --d;
+        if(d == 0)
+            return;
+        --d;
+        ++s_index[d];
+    }
+}
+
+template<unsigned NPairs>
+struct ranked_pairing_t {
+    double Chi2;
+    typename PairMatchings<NPairs>::pairs_t Pairs;
+};
+
+template<unsigned NPairs>
+using ranked_pairings_t = std::array<ranked_pairing_t<NPairs>, PairMatchings<NPairs>::Count()>;
+
+/**
+ * @brief RankPairings ranks all pairings of 2*NPairs particles
+ * by the chi2 of the pair invariant masses with respect to the expected mass
+ * @param ims cached invariant masses
+ * @param indices the particles in ims to be paired, the returned pairs refer to them
+ * @param mass expected mass of each pair, for example the Pi0 mass
+ * @param sigma resolution of the pair invariant mass
+ * @return all pairings, sorted by ascending chi2
+ *
+ * Useful to pre-select the photon pairing in 2pi0/3pi0 analyses before any kinematic fit is run.
+ */
+template<unsigned NPairs>
+ranked_pairings_t<NPairs> RankPairings(const IMMatrix& ims,
+                                       const std::array<unsigned, 2*NPairs>& indices,
+                                       double mass, double sigma) noexcept
+{
+    ranked_pairings_t<NPairs> ranked;
+    auto it = ranked.begin();
+    for(PairMatchings<NPairs> m; !m.done(); ++m, ++it) {
+        it->Chi2 = 0;
+        for(unsigned p=0;p<NPairs;p++) {
+            auto& pair = it->Pairs[p];
+            pair = {indices[m[p].first], indices[m[p].second]};
+            it->Chi2 += std_ext::sqr((ims.IM(pair.first, pair.second) - mass)/sigma);
+        }
+    }
+    std::sort(ranked.begin(), ranked.end(), [] (const ranked_pairing_t<NPairs>& a, const ranked_pairing_t<NPairs>& b) {
+        return a.Chi2 < b.Chi2;
+    });
+    return ranked;
+}
+
+/**
+ * @brief RankPairings ranks all pairings of the 2*NPairs particles in ims
+ */
+template<unsigned NPairs>
+ranked_pairings_t<NPairs> RankPairings(const IMMatrix& ims, double mass, double sigma) noexcept
+{
+    std::array<unsigned, 2*NPairs> indices;
+    for(unsigned i=0;i<indices.size();i++)
+        indices[i] = i;
+    return RankPairings<NPairs>(ims, indices, mass, sigma);
+}
+
+}}} // namespace ant::analysis::utils
@@ -3,14 +3,12 @@
 #include "tree/TParticle.h"
 #include "base/std_ext/memory.h"
 
-#include "TRandom2.h"
-
 using namespace std;
 using namespace ant;
 using namespace ant::analysis::utils;
 
-MCSmear::MCSmear(utils::UncertaintyModelPtr m):
-    model(m), rng(std_ext::make_unique<TRandom2>()) {}
+MCSmear::MCSmear(utils::UncertaintyModelPtr m, uint16_t substream):
+    model(m), rng(CounterRNG::Stream_t::MCSmear, substream) {}
 
 MCSmear::~MCSmear() {}
 
@@ -26,9 +24,9 @@ ant::TParticlePtr MCSmear::Smear(const TParticlePtr& p, Uncertainties_t& sigmas)
         // be careful about this composite particle
         // beamparticle = gamma + nucleon (at rest)
 
-        const double Ek = rng->Gaus(p->Ek(), sigmas.sigmaEk); // photon energy
+        const double Ek = rng.Gaus(p->Ek(), sigmas.sigmaEk); // photon energy
 
-        smeared = make_shared<TParticle>(
+        smeared = std_ext::make_pooled<TParticle>(
                       type,
                       // spatial components are given by photon direction,
                       // time component is sum of resting target and photon energy
@@ -38,11 +36,11 @@ ant::TParticlePtr MCSmear::Smear(const TParticlePtr& p, Uncertainties_t& sigmas)
     else {
         sigmas = model->GetSigmas(*p);
 
-        const double Ek    = rng->Gaus(p->Ek(),    sigmas.sigmaEk);
-        const double Theta = rng->Gaus(p->Theta(), sigmas.sigmaTheta);
-        const double Phi   = rng->Gaus(p->Phi(),   sigmas.sigmaPhi);
+        const double Ek    = rng.Gaus(p->Ek(),    sigmas.sigmaEk);
+        const double Theta = rng.Gaus(p->Theta(), sigmas.sigmaTheta);
+        const double Phi   = rng.Gaus(p->Phi(),   sigmas.sigmaPhi);
 
-        smeared = make_shared<TParticle>(type, Ek, Theta, Phi);
+        smeared = std_ext::make_pooled<TParticle>(type, Ek, Theta, Phi);
         smeared->Candidate = p->Candidate;
     }
 
@@ -3,8 +3,7 @@
 #include "analysis/utils/Uncertainties.h"
 #include "tree/TParticle.h"
 #include "tree/TCandidate.h"
-
-class TRandom;
+#include "base/CounterRNG.h"
 
 namespace ant {
 
@@ -13,11 +12,17 @@ namespace utils {
 class MCSmear {
 protected:
     UncertaintyModelPtr model;
-    std::unique_ptr<TRandom> rng;
+    // restarted for each event by the PhysicsManager,
+    // so the smearing does not depend on the event order
+    mutable CounterRNG rng;
 
 public:
 
-    MCSmear(UncertaintyModelPtr m);
+    /**
+     * @param m the model providing the resolutions
+     * @param substream distinguishes several instances within one physics class
+     */
+    MCSmear(UncertaintyModelPtr m, std::uint16_t substream = 0);
 
     ~MCSmear();
 
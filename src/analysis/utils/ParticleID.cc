@@ -8,6 +8,9 @@
 
 #include "TCutG.h"
 
+#include <algorithm>
+#include <cmath>
+
 
 using namespace std;
 using namespace ant;
@@ -21,7 +24,7 @@ TParticlePtr ParticleID::Process(const TCandidatePtr& cand) const
 {
     auto type = Identify(cand);
     if(type !=nullptr) {
-       return std::make_shared<TParticle>(*type, cand);
+       return std_ext::make_pooled<TParticle>(*type, cand);
     }
 
     return nullptr;
@@ -53,6 +56,101 @@ const ParticleTypeDatabase::Type* SimpleParticleID::Identify(const TCandidatePtr
         return addressof(ParticleTypeDatabase::Photon);
 }
 
+RasterizedCut::RasterizedCut(const std::shared_ptr<TCutG>& cut, unsigned nBins) :
+    Cut(cut)
+{
+    const int n = Cut ? Cut->GetN() : 0;
+    if(n < 3 || nBins == 0)
+        return;
+
+    const double* x = Cut->GetX();
+    const double* y = Cut->GetY();
+    XMin = *std::min_element(x, x+n);
+    XMax = *std::max_element(x, x+n);
+    YMin = *std::min_element(y, y+n);
+    YMax = *std::max_element(y, y+n);
+    if(!(XMax > XMin && YMax > YMin))
+        return;
+
+    NBins = nBins;
+    BinWidthX = (XMax - XMin)/NBins;
+    BinWidthY = (YMax - YMin)/NBins;
+
+    const auto nWords = (NBins*NBins + 63)/64;
+    Edge.assign(nWords, 0);
+    Inside.assign(nWords, 0);
+
+    // IsInside implicitly closes the polygon
+    for(int i=0, j=n-1; i<n; j=i++)
+        MarkEdge(x[j], y[j], x[i], y[i]);
+
+    // all other cells are not touched by the polygon,
+    // so they are either completely inside or outside
+    for(int bx=0;bx<NBins;bx++) {
+        for(int by=0;by<NBins;by++) {
+            const unsigned cell = bx*NBins + by;
+            if(TestBit(Edge, cell))
+                continue;
+            if(Cut->IsInside(XMin + (bx+0.5)*BinWidthX, YMin + (by+0.5)*BinWidthY))
+                SetBit(Inside, cell);
+        }
+    }
+}
+
+int RasterizedCut::BinX(double x) const {
+    return std::max(0, std::min(NBins-1, static_cast<int>(std::floor((x-XMin)/BinWidthX))));
+}
+
+int RasterizedCut::BinY(double y) const {
+    return std::max(0, std::min(NBins-1, static_cast<int>(std::floor((y-YMin)/BinWidthY))));
+}
+
+void RasterizedCut::MarkEdge(double x0, double y0, double x1, double y1)
+{
+    if(x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    // mark the cells the edge passes through and all their neighbours,
+    // the margin makes the cell centers of unmarked cells a safe test
+    for(int bx=BinX(x0)-1; bx<=BinX(x1)+1; bx++) {
+        if(bx < 0 || bx >= NBins)
+            continue;
+        // part of the edge within this column and its neighbouring columns
+        const double cx0 = std::max(x0, XMin + (bx-1)*BinWidthX);
+        const double cx1 = std::min(x1, XMin + (bx+2)*BinWidthX);
+        if(cx0 > cx1)
+            continue;
+        double cy0 = y0;
+        double cy1 = y1;
+        if(x1 > x0) {
+            const double slope = (y1-y0)/(x1-x0);
+            cy0 = y0 + (cx0-x0)*slope;
+            cy1 = y0 + (cx1-x0)*slope;
+        }
+        const int by0 = BinY(std::min(cy0, cy1))-1;
+        const int by1 = BinY(std::max(cy0, cy1))+1;
+        for(int by=std::max(by0, 0); by<=std::min(by1, NBins-1); by++)
+            SetBit(Edge, bx*NBins + by);
+    }
+}
+
+bool RasterizedCut::IsInside(double x, double y) const
+{
+    if(NBins == 0)
+        return Cut->IsInside(x, y);
+
+    // the polygon test is always false outside its bounding box (and for NaN)
+    if(!(x >= XMin && x <= XMax && y >= YMin && y <= YMax))
+        return false;
+
+    const unsigned cell = BinX(x)*NBins + BinY(y);
+    if(TestBit(Edge, cell))
+        return Cut->IsInside(x, y);
+    return TestBit(Inside, cell);
+}
+
 BasicParticleID::BasicParticleID() {}
 
 BasicParticleID::~BasicParticleID()
@@ -60,8 +158,25 @@ BasicParticleID::~BasicParticleID()
 
 }
 
-bool TestCut(const std::shared_ptr<TCutG>& cut, const double& x, const double& y) {
-    return (cut) && cut->IsInside(x,y);
+void BasicParticleID::Rasterize(unsigned nBins)
+{
+    rasterized.clear();
+    if(nBins == 0)
+        return;
+    for(const auto& cut : {dEE_proton, dEE_pion, dEE_electron, tof, size}) {
+        if(cut)
+            rasterized.emplace_back(cut, nBins);
+    }
+}
+
+bool BasicParticleID::TestCut(const std::shared_ptr<TCutG>& cut, double x, double y) const {
+    if(!cut)
+        return false;
+    for(const auto& r : rasterized) {
+        if(r.Cut == cut)
+            return r.IsInside(x, y);
+    }
+    return cut->IsInside(x,y);
 }
 
 
@@ -113,7 +228,8 @@ const ParticleTypeDatabase::Type* BasicParticleID::Identify(const TCandidatePtr&
 
 
 
-CBTAPSBasicParticleID::CBTAPSBasicParticleID(const string& pidcutsdir)
+CBTAPSBasicParticleID::CBTAPSBasicParticleID(const string& pidcutsdir, unsigned rasterBins_) :
+    rasterBins(rasterBins_)
 {
     try {
         WrapTFileInput cuts;
@@ -163,6 +279,9 @@ void CBTAPSBasicParticleID::LoadFrom(WrapTFile& file)
         taps.dEE_electron   = file.GetSharedClone<TCutG>("taps_dEE_electron");
         taps.tof            = file.GetSharedClone<TCutG>("taps_ToF");
         taps.size           = file.GetSharedClone<TCutG>("taps_CluserSize");
+
+        cb.Rasterize(rasterBins);
+        taps.Rasterize(rasterBins);
 }
 
 
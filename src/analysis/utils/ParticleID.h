@@ -4,6 +4,8 @@
 #include "base/ParticleType.h"
 
 #include <memory>
+#include <vector>
+#include <cstdint>
 
 class TCutG;
 
@@ -39,6 +41,45 @@ public:
 
 
 
+/**
+ * @brief The RasterizedCut class gives the same result as TCutG::IsInside,
+ * but uses a precomputed grid of cells being inside or outside.
+ * Only points in cells touched by the polygon's edges are tested exactly.
+ */
+class RasterizedCut {
+public:
+    /**
+     * @brief RasterizedCut builds the grid over the cut's bounding box
+     * @param cut the polygon, needs at least three points
+     * @param nBins number of cells in x and y
+     */
+    RasterizedCut(const std::shared_ptr<TCutG>& cut, unsigned nBins);
+
+    bool IsInside(double x, double y) const;
+
+    const std::shared_ptr<TCutG> Cut;
+
+protected:
+    int NBins = 0; // zero means always test exactly
+    double XMin = 0, XMax = 0, YMin = 0, YMax = 0;
+    double BinWidthX = 0, BinWidthY = 0;
+
+    // bit-packed, one bit per cell
+    std::vector<std::uint64_t> Edge;
+    std::vector<std::uint64_t> Inside;
+
+    int BinX(double x) const;
+    int BinY(double y) const;
+    static bool TestBit(const std::vector<std::uint64_t>& bits, unsigned cell) {
+        return (bits[cell / 64] >> (cell % 64)) & 1;
+    }
+    static void SetBit(std::vector<std::uint64_t>& bits, unsigned cell) {
+        bits[cell / 64] |= std::uint64_t(1) << (cell % 64);
+    }
+    void MarkEdge(double x0, double y0, double x1, double y1);
+};
+
+
 class BasicParticleID: public ParticleID {
 public:
     BasicParticleID();
@@ -52,17 +93,34 @@ public:
 
     std::shared_ptr<TCutG> size;
 
+    /**
+     * @brief Rasterize builds a RasterizedCut for each cut set above,
+     * cuts changed afterwards are tested exactly again
+     * @param nBins number of cells in x and y, zero removes the grids
+     */
+    void Rasterize(unsigned nBins);
+
     virtual const ParticleTypeDatabase::Type* Identify(const TCandidatePtr& cand) const override;
+
+protected:
+    std::vector<RasterizedCut> rasterized;
+    bool TestCut(const std::shared_ptr<TCutG>& cut, double x, double y) const;
 };
 
 class CBTAPSBasicParticleID: public ParticleID {
 protected:
     BasicParticleID cb;
     BasicParticleID taps;
+    const unsigned rasterBins;
     virtual void LoadFrom(WrapTFile& file);
 
 public:
-    CBTAPSBasicParticleID(const std::string& pidcutsdir);
+    /**
+     * @brief CBTAPSBasicParticleID loads the cuts from the given directory
+     * @param pidcutsdir directory with *.root files containing the cuts
+     * @param rasterBins grid size for the cuts, see BasicParticleID::Rasterize
+     */
+    CBTAPSBasicParticleID(const std::string& pidcutsdir, unsigned rasterBins = 256);
     virtual ~CBTAPSBasicParticleID();
 
     virtual const ParticleTypeDatabase::Type* Identify(const TCandidatePtr& cand) const override;
@@ -14,9 +14,9 @@ void ProtonPermutation::Fill()
 
     for(auto i = cands.cbegin(); i!=cands.cend(); ++i) {
         if(i != p_it) {
-            photons.emplace_back(make_shared<TParticle>(ParticleTypeDatabase::Photon, *i));
+            photons.emplace_back(std_ext::make_pooled<TParticle>(ParticleTypeDatabase::Photon, *i));
         } else {
-            proton = make_shared<TParticle>(ParticleTypeDatabase::Proton, *i);
+            proton = std_ext::make_pooled<TParticle>(ParticleTypeDatabase::Proton, *i);
             trueMatch = (*i == true_proton);
         }
     }
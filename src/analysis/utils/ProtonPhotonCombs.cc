@@ -1,9 +1,207 @@
 #include "ProtonPhotonCombs.h"
 
+#include "base/std_ext/memory.h"
+
+#include <numeric>
+
 using namespace std;
 using namespace ant;
 using namespace ant::analysis::utils;
 
+struct ProtonPhotonCombs::table_t {
+    struct base_t {
+        explicit base_t(const TParticlePtr& proton) : Comb(proton) {}
+        comb_t Comb;               // as pre-built, photons sorted by descending Ek
+        vector<double> Ek;         // Ek of each photon
+        vector<LorentzVec> Sums;   // Sums[n] is the sum of the first n photons
+        vector<double> IMs;        // IMs[n] = Sums[n].M()
+    };
+    vector<base_t> Combs;
+
+    // buffers of destroyed views, ready for the next operator() call
+    vector<unique_ptr<buffer_t>> Pool;
+
+    unique_ptr<buffer_t> Acquire();
+    void Release(unique_ptr<buffer_t> buffer) noexcept;
+};
+
+struct ProtonPhotonCombs::buffer_t {
+    // one slot per pre-built combination, the Photons keep their capacity
+    // when the buffer is recycled, so materializing never allocates
+    vector<comb_t> Combs;
+    vector<unsigned> NPhotons;
+    vector<bool> Materialized;
+    // the remaining combinations, compacted by the filters
+    vector<unsigned> Index;
+};
+
+unique_ptr<ProtonPhotonCombs::buffer_t> ProtonPhotonCombs::table_t::Acquire()
+{
+    unique_ptr<buffer_t> buffer;
+    if(Pool.empty()) {
+        buffer = std_ext::make_unique<buffer_t>();
+        buffer->Combs.reserve(Combs.size());
+        for(const auto& base : Combs)
+            buffer->Combs.emplace_back(base.Comb);
+        buffer->NPhotons.resize(Combs.size());
+        buffer->Materialized.resize(Combs.size());
+        buffer->Index.reserve(Combs.size());
+    }
+    else {
+        buffer = move(Pool.back());
+        Pool.pop_back();
+    }
+
+    for(auto i=0u;i<Combs.size();i++) {
+        auto& comb = buffer->Combs[i];
+        comb.DiscardedEk = std_ext::NaN;
+        comb.PhotonSum = LorentzVec{{0,0,0},0};
+        comb.MissingMass = std_ext::NaN;
+        buffer->NPhotons[i] = Combs[i].Comb.Photons.size();
+        buffer->Materialized[i] = false;
+    }
+    buffer->Index.resize(Combs.size());
+    iota(buffer->Index.begin(), buffer->Index.end(), 0u);
+    return buffer;
+}
+
+void ProtonPhotonCombs::table_t::Release(unique_ptr<buffer_t> buffer) noexcept
+{
+    try {
+        Pool.emplace_back(move(buffer));
+    }
+    catch(...) {} // then the buffer is simply freed
+}
+
+ProtonPhotonCombs::Combinations_t::Combinations_t() noexcept {}
+
+ProtonPhotonCombs::Combinations_t::Combinations_t(const shared_ptr<table_t>& table) :
+    Table(table),
+    Buffer(Table->Acquire())
+{}
+
+ProtonPhotonCombs::Combinations_t::Combinations_t(const Combinations_t& other) :
+    Table(other.Table),
+    Observer(other.Observer),
+    ObserverPrefix(other.ObserverPrefix),
+    called_FilterIM(other.called_FilterIM)
+{
+    if(!other.Buffer)
+        return;
+    Buffer = Table->Acquire();
+    Buffer->Index = other.Buffer->Index; // capacity suffices, no allocation
+    for(auto i : Buffer->Index) {
+        auto& comb = Buffer->Combs[i];
+        const auto& other_comb = other.Buffer->Combs[i];
+        Buffer->NPhotons[i] = other.Buffer->NPhotons[i];
+        // keep possible modifications made by iterating the other instance
+        if(other.Buffer->Materialized[i]) {
+            comb.Photons = other_comb.Photons;
+            comb.Proton = other_comb.Proton;
+            Buffer->Materialized[i] = true;
+        }
+        comb.DiscardedEk = other_comb.DiscardedEk;
+        comb.PhotonSum = other_comb.PhotonSum;
+        comb.MissingMass = other_comb.MissingMass;
+    }
+}
+
+ProtonPhotonCombs::Combinations_t::Combinations_t(Combinations_t&& other) noexcept :
+    Table(move(other.Table)),
+    Buffer(move(other.Buffer)),
+    Observer(move(other.Observer)),
+    ObserverPrefix(move(other.ObserverPrefix)),
+    called_FilterIM(other.called_FilterIM)
+{}
+
+ProtonPhotonCombs::Combinations_t&
+ProtonPhotonCombs::Combinations_t::operator=(Combinations_t other) noexcept
+{
+    // release our buffer now, and not when other goes out of scope
+    Combinations_t released(move(*this));
+    Table = move(other.Table);
+    Buffer = move(other.Buffer);
+    Observer = move(other.Observer);
+    ObserverPrefix = move(other.ObserverPrefix);
+    called_FilterIM = other.called_FilterIM;
+    return *this;
+}
+
+ProtonPhotonCombs::Combinations_t::~Combinations_t()
+{
+    if(Table && Buffer)
+        Table->Release(move(Buffer));
+}
+
+size_t ProtonPhotonCombs::Combinations_t::size() const noexcept
+{
+    return Buffer ? Buffer->Index.size() : 0;
+}
+
+ProtonPhotonCombs::comb_t& ProtonPhotonCombs::Combinations_t::materialize(unsigned i) const noexcept
+{
+    auto& comb = Buffer->Combs[i];
+    if(!Buffer->Materialized[i]) {
+        const auto& base = Table->Combs[i].Comb;
+        comb.Photons.assign(base.Photons.begin(), next(base.Photons.begin(), Buffer->NPhotons[i]));
+        comb.Proton = base.Proton;
+        Buffer->Materialized[i] = true;
+    }
+    return comb;
+}
+
+void ProtonPhotonCombs::Combinations_t::materialize_all() const noexcept
+{
+    if(!Buffer)
+        return;
+    for(auto i : Buffer->Index)
+        materialize(i);
+}
+
+ProtonPhotonCombs::Combinations_t::iterator ProtonPhotonCombs::Combinations_t::begin() noexcept
+{
+    if(!Buffer)
+        return {nullptr, nullptr};
+    materialize_all();
+    return {Buffer->Combs.data(), Buffer->Index.data()};
+}
+
+ProtonPhotonCombs::Combinations_t::iterator ProtonPhotonCombs::Combinations_t::end() noexcept
+{
+    if(!Buffer)
+        return {nullptr, nullptr};
+    return {Buffer->Combs.data(), Buffer->Index.data()+Buffer->Index.size()};
+}
+
+ProtonPhotonCombs::Combinations_t::const_iterator ProtonPhotonCombs::Combinations_t::begin() const noexcept
+{
+    if(!Buffer)
+        return {nullptr, nullptr};
+    materialize_all();
+    return {Buffer->Combs.data(), Buffer->Index.data()};
+}
+
+ProtonPhotonCombs::Combinations_t::const_iterator ProtonPhotonCombs::Combinations_t::end() const noexcept
+{
+    if(!Buffer)
+        return {nullptr, nullptr};
+    return {Buffer->Combs.data(), Buffer->Index.data()+Buffer->Index.size()};
+}
+
+template<typename Keep>
+void ProtonPhotonCombs::Combinations_t::compact(Keep keep)
+{
+    if(!Buffer)
+        return;
+    auto& index = Buffer->Index;
+    auto it_out = index.begin();
+    for(auto i : index) {
+        if(keep(i))
+            *it_out++ = i;
+    }
+    index.erase(it_out, index.end());
+}
+
 ProtonPhotonCombs::Combinations_t&
 ProtonPhotonCombs::Combinations_t::Observe(const Observer_t& observer, const string& prefix) noexcept
 {
@@ -20,48 +218,44 @@ ProtonPhotonCombs::Combinations_t::Observe(const Observer_t& observer, const str
 ProtonPhotonCombs::Combinations_t&
 ProtonPhotonCombs::Combinations_t::FilterMult(unsigned nPhotonsRequired, double maxDiscardedEk) noexcept
 {
-    auto it = this->begin();
-    while(it != this->end()) {
-        const auto nPhotons = it->Photons.size();
-        if(nPhotons < nPhotonsRequired) {
-            it = this->erase(it);
-            continue;
-        }
+    compact([this,nPhotonsRequired,maxDiscardedEk] (unsigned i) {
+        const auto nPhotons = Buffer->NPhotons[i];
+        if(nPhotons < nPhotonsRequired)
+            return false;
         // calc discarded Ek and do cut
-        it->DiscardedEk = 0;
-        for(auto i=nPhotonsRequired;i<nPhotons;i++) {
-            it->DiscardedEk += it->Photons[i]->Ek();
-        }
-        if(it->DiscardedEk > maxDiscardedEk) {
-            it = this->erase(it);
-            continue;
+        auto& comb = Buffer->Combs[i];
+        const auto& Ek = Table->Combs[i].Ek;
+        comb.DiscardedEk = 0;
+        for(auto j=nPhotonsRequired;j<nPhotons;j++) {
+            comb.DiscardedEk += Ek[j];
         }
+        if(comb.DiscardedEk > maxDiscardedEk)
+            return false;
         if(Observer && isfinite(maxDiscardedEk)) {
             Observer(std_ext::formatter() << ObserverPrefix << "DiscEk<=" << maxDiscardedEk);
         }
-        it->Photons.resize(nPhotonsRequired); // will always shrink, as nPhotons >= nPhotonsRequired
-        ++it;
-    }
+        // will always shrink, as nPhotons >= nPhotonsRequired
+        Buffer->NPhotons[i] = nPhotonsRequired;
+        Buffer->Materialized[i] = false;
+        return true;
+    });
     return *this;
 }
 
 ProtonPhotonCombs::Combinations_t&
 ProtonPhotonCombs::Combinations_t::FilterIM(const IntervalD& photon_IM_sum_cut) noexcept
 {
-    auto it = this->begin();
-    while(it != this->end()) {
-        it->PhotonSum = LorentzVec{{0,0,0}, 0};
-        for(const auto& p : it->Photons)
-            it->PhotonSum += *p;
-        if(!photon_IM_sum_cut.Contains(it->PhotonSum.M())) {
-            it = this->erase(it);
-        }
-        else {
-            if(Observer && photon_IM_sum_cut != nocut)
-                Observer(ObserverPrefix+photon_IM_sum_cut.AsRangeString("IM(#gamma)"));
-            ++it;
-        }
-    }
+    compact([this,&photon_IM_sum_cut] (unsigned i) {
+        // use the per-event cached sums
+        const auto& base = Table->Combs[i];
+        const auto nPhotons = Buffer->NPhotons[i];
+        Buffer->Combs[i].PhotonSum = base.Sums[nPhotons];
+        if(!photon_IM_sum_cut.Contains(base.IMs[nPhotons]))
+            return false;
+        if(Observer && photon_IM_sum_cut != nocut)
+            Observer(ObserverPrefix+photon_IM_sum_cut.AsRangeString("IM(#gamma)"));
+        return true;
+    });
     called_FilterIM = true;
     return *this;
 }
@@ -75,50 +269,49 @@ ProtonPhotonCombs::Combinations_t::FilterMM(const TTaggerHit& taggerhit,
     if(!called_FilterIM)
         FilterIM();
 
-    auto it = this->begin();
     const auto beam_target = taggerhit.GetPhotonBeam() + LorentzVec::AtRest(target.Mass());
-    while(it != this->end()) {
+    compact([this,&beam_target,&missingmass_cut] (unsigned i) {
         // remember hit and cut on missing mass
-        it->MissingMass = (beam_target - it->PhotonSum).M();
-        if(!missingmass_cut.Contains(it->MissingMass))
-            it = this->erase(it);
-        else {
-            if(Observer && missingmass_cut != nocut)
-                // note that in A2's speech is often "missing mass of proton",
-                // but it's actually the "missing mass of photons" expected to be close to the
-                // rest mass of the proton
-                Observer(ObserverPrefix+missingmass_cut.AsRangeString("MM(#gamma)"));
-            ++it;
-        }
-    }
+        auto& comb = Buffer->Combs[i];
+        comb.MissingMass = (beam_target - comb.PhotonSum).M();
+        if(!missingmass_cut.Contains(comb.MissingMass))
+            return false;
+        if(Observer && missingmass_cut != nocut)
+            // note that in A2's speech is often "missing mass of proton",
+            // but it's actually the "missing mass of photons" expected to be close to the
+            // rest mass of the proton
+            Observer(ObserverPrefix+missingmass_cut.AsRangeString("MM(#gamma)"));
+        return true;
+    });
     return *this;
 }
 
 ProtonPhotonCombs::Combinations_t&
 ProtonPhotonCombs::Combinations_t::FilterCustom(const cut_t& cut, const string& name)
 {
-    auto it = this->begin();
-    while(it != this->end()) {
-        if(cut(*it)) {
-            it = this->erase(it);
-        }
-        else {
-            if(Observer && name != "")
-                Observer(ObserverPrefix+name);
-            ++it;
-        }
-    }
+    compact([this,&cut,&name] (unsigned i) {
+        if(cut(materialize(i)))
+            return false;
+        if(Observer && name != "")
+            Observer(ObserverPrefix+name);
+        return true;
+    });
     return *this;
 }
 
-ProtonPhotonCombs::Combinations_t
-ProtonPhotonCombs::MakeCombinations(const TCandidateList& cands, const combfilter_t& filter) noexcept
+ProtonPhotonCombs::Combinations_t ProtonPhotonCombs::operator()() const noexcept
+{
+    return Combinations_t(Table);
+}
+
+ProtonPhotonCombs::ProtonPhotonCombs(const TCandidateList& cands, const combfilter_t& filter) :
+    Table(std::make_shared<table_t>())
 {
     TParticleList all_protons;
     TParticleList all_photons;
     for(auto cand : cands.get_iter()) {
-        all_protons.emplace_back(std::make_shared<TParticle>(ParticleTypeDatabase::Proton, cand));
-        all_photons.emplace_back(std::make_shared<TParticle>(ParticleTypeDatabase::Photon, cand));
+        all_protons.emplace_back(std_ext::make_pooled<TParticle>(ParticleTypeDatabase::Proton, cand));
+        all_photons.emplace_back(std_ext::make_pooled<TParticle>(ParticleTypeDatabase::Photon, cand));
     }
 
     // important for DiscardedEk cut later
@@ -127,10 +320,12 @@ ProtonPhotonCombs::MakeCombinations(const TCandidateList& cands, const combfilte
         return a->Ek() > b->Ek();
     });
 
-    Combinations_t combs;
+    auto& combs = Table->Combs;
+    combs.reserve(all_protons.size());
     for(const auto& proton : all_protons) {
         combs.emplace_back(proton);
-        auto& comb = combs.back();
+        auto& base = combs.back();
+        auto& comb = base.Comb;
         for(auto photon : all_photons) {
             if(photon->Candidate == proton->Candidate)
                 continue;
@@ -139,7 +334,18 @@ ProtonPhotonCombs::MakeCombinations(const TCandidateList& cands, const combfilte
         assert(comb.Photons.size()+1 == all_photons.size());
         // allow custom modification to combinations
         filter(comb);
+
+        // cache photon sums and invariant masses once per event,
+        // summed up in the same order as FilterIM did before
+        base.Ek.reserve(comb.Photons.size());
+        base.Sums.reserve(comb.Photons.size()+1);
+        base.IMs.reserve(comb.Photons.size()+1);
+        base.Sums.emplace_back(LorentzVec{{0,0,0},0});
+        base.IMs.emplace_back(base.Sums.back().M());
+        for(const auto& photon : comb.Photons) {
+            base.Ek.emplace_back(photon->Ek());
+            base.Sums.emplace_back(base.Sums.back() + *photon);
+            base.IMs.emplace_back(base.Sums.back().M());
+        }
     }
-    // as every candidate is the proton, it's only
-    return combs;
 }
@@ -4,6 +4,8 @@
 #include "tree/TTaggerHit.h"
 
 #include <functional>
+#include <iterator>
+#include <memory>
 
 namespace ant {
 namespace analysis {
@@ -34,10 +36,50 @@ struct ProtonPhotonCombs {
 
     using Observer_t =  std::function<void(const std::string&)>;
 
+private:
+    struct table_t;  // per-event particle table, shared by all Combinations_t
+    struct buffer_t; // per-view storage, recycled via the table
+public:
+
     /**
      * @brief The Combinations_t struct manages the available proton/photon combinations as a whole
+     *
+     * It is a lightweight view into the pre-built particle table:
+     * the remaining combinations are an index vector, which the Filter* methods compact in-place.
+     * The comb_t are materialized only for the survivors when iterated,
+     * and the storage is recycled between views, so filtering per taggerhit does not allocate.
      */
-    struct Combinations_t : std::list<comb_t> {
+    struct Combinations_t {
+
+        template<typename T>
+        struct iterator_t : std::iterator<std::forward_iterator_tag, T> {
+            iterator_t(T* combs, const unsigned* index) : Combs(combs), Index(index) {}
+            T& operator*()  const { return Combs[*Index]; }
+            T* operator->() const { return &Combs[*Index]; }
+            iterator_t& operator++() { ++Index; return *this; }
+            iterator_t  operator++(int) { auto it = *this; ++Index; return it; }
+            bool operator==(const iterator_t& other) const { return Index == other.Index; }
+            bool operator!=(const iterator_t& other) const { return Index != other.Index; }
+        private:
+            T* Combs;
+            const unsigned* Index;
+        };
+        using iterator = iterator_t<comb_t>;
+        using const_iterator = iterator_t<const comb_t>;
+
+        Combinations_t() noexcept;
+        Combinations_t(const Combinations_t& other);
+        Combinations_t(Combinations_t&& other) noexcept;
+        Combinations_t& operator=(Combinations_t other) noexcept;
+        ~Combinations_t();
+
+        std::size_t size() const noexcept;
+        bool empty() const noexcept { return size() == 0; }
+
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
 
         /**
          * @brief Observe sets the filtering observer and an optional prefix,
@@ -87,6 +129,17 @@ struct ProtonPhotonCombs {
                                      const std::string& name = "");
 
     private:
+        friend struct ProtonPhotonCombs;
+        explicit Combinations_t(const std::shared_ptr<table_t>& table);
+
+        comb_t& materialize(unsigned i) const noexcept;
+        void materialize_all() const noexcept;
+        template<typename Keep>
+        void compact(Keep keep);
+
+        std::shared_ptr<table_t>  Table;
+        std::unique_ptr<buffer_t> Buffer;
+
         Observer_t  Observer;
         std::string ObserverPrefix;
         bool called_FilterIM = false;
@@ -94,10 +147,10 @@ struct ProtonPhotonCombs {
 
 
     /**
-     * @brief operator() call this to get copy of combinations for filtering (see above)
-     * @return copy of pre-build combinations
+     * @brief operator() call this to get a fresh view of the combinations for filtering (see above)
+     * @return view containing all pre-built combinations
      */
-    Combinations_t operator()() const noexcept { return Combinations; }
+    Combinations_t operator()() const noexcept;
 
     /**
      * @brief ProtonPhotonCombs pre-builds the particle combinations from given candidates
@@ -105,13 +158,10 @@ struct ProtonPhotonCombs {
      * @note call only once per ProcessEvent to stay performant
      */
     using combfilter_t = std::function<void(comb_t&)>;
-    ProtonPhotonCombs(const TCandidateList& cands, const combfilter_t& filter = [] (comb_t&) {} ) :
-        Combinations(MakeCombinations(cands, filter))
-    {} // empty ctor
+    ProtonPhotonCombs(const TCandidateList& cands, const combfilter_t& filter = [] (comb_t&) {} );
 
 private:
-    const Combinations_t Combinations;
-    static Combinations_t MakeCombinations(const TCandidateList& cands, const combfilter_t& filter) noexcept;
+    std::shared_ptr<table_t> Table;
 };
 
 }}} // namespace ant::analysis::utils
\ No newline at end of file
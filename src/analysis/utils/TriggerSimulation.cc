@@ -11,7 +11,7 @@ using namespace ant::analysis::utils;
 
 TriggerSimulation::TriggerSimulation() :
     config(ExpConfig::Setup::Get().GetTriggerSimuConfig()),
-    random_CBESum_threshold(config.CBESum_Edge, config.CBESum_Width)
+    rng(CounterRNG::Stream_t::TriggerSimulation)
 {}
 
 bool TriggerSimulation::ProcessEvent(const TEvent& event)
@@ -62,13 +62,9 @@ bool TriggerSimulation::ProcessEvent(const TEvent& event)
 
     if(isMC) {
         if(config.Type == config_t::Type_t::CBESum) {
-            // lazy init random generator with timestamp of (first) event
-            if(!random_gen) {
-                random_gen = std_ext::make_unique<std::default_random_engine>(
-                                 event.Reconstructed().ID.Timestamp
-                                 );
-            }
-            info.hasTriggered = info.CBEnergySum > random_CBESum_threshold(*random_gen);
+            // threshold only depends on event ID, not on processing order
+            rng.Start(recon.ID.Value());
+            info.hasTriggered = info.CBEnergySum > rng.Gaus(config.CBESum_Edge, config.CBESum_Width);
         }
         // may implement other trigger simulations on MC here
         else {
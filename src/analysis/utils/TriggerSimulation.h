@@ -2,8 +2,7 @@
 
 #include "base/std_ext/math.h"
 #include "expconfig/ExpConfig.h"
-
-#include <random>
+#include "base/CounterRNG.h"
 
 namespace ant {
 
@@ -38,8 +37,7 @@ class TriggerSimulation {
     using config_t = expconfig::Setup_traits::triggersimu_config_t;
     const config_t config;
 
-    std::unique_ptr<std::default_random_engine> random_gen;
-    std::normal_distribution<double> random_CBESum_threshold;
+    CounterRNG rng;
 
 public:
 
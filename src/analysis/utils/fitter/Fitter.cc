@@ -24,7 +24,7 @@ TParticlePtr Fitter::FitParticle::AsFitted() const
     if(!isfinite(Fitted_Z_Vertex))
         throw Exception("Need z vertex to calculate LorentzVec");
 
-    auto p = make_shared<TParticle>(Particle->Type(), GetLorentzVec(Fitted_Z_Vertex));
+    auto p = std_ext::make_pooled<TParticle>(Particle->Type(), GetLorentzVec(Fitted_Z_Vertex));
     p->Candidate = Particle->Candidate; // link Candidate
     return p;
 }
@@ -69,7 +69,7 @@ double KinFitter::GetFittedBeamE() const
 
 TParticlePtr KinFitter::GetFittedBeamParticle() const
 {
-    return std::make_shared<TParticle>(ParticleTypeDatabase::BeamProton, BeamE.GetLorentzVec());
+    return std_ext::make_pooled<TParticle>(ParticleTypeDatabase::BeamProton, BeamE.GetLorentzVec());
 }
 
 double KinFitter::GetFittedZVertex() const
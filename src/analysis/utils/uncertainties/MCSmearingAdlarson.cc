@@ -2,7 +2,6 @@
 
 #include "base/std_ext/memory.h"
 
-#include "TRandom2.h"
 #include "TMath.h"
 
 using namespace std;
@@ -11,7 +10,7 @@ using namespace ant::analysis::utils;
 using namespace ant::analysis::utils::UncertaintyModels;
 
 MCSmearingAdlarson::MCSmearingAdlarson() :
-    rng(std_ext::make_unique<TRandom2>())
+    rng(CounterRNG::Stream_t::MCSmearingModel)
 {
 
 }
@@ -46,7 +45,7 @@ Uncertainties_t MCSmearingAdlarson::GetSigmas(const TParticle& particle) const
 
 
         // smear theta angle
-        theta += rng->Gaus(0.0, MC_Smear_ThetaSigma);
+        theta += rng.Gaus(0.0, MC_Smear_ThetaSigma);
 
         // "decay" constant to mimic the experimental resolution
         double c = ( TMath::Log(MC_SmearMax/MC_SmearMin) )/( MC_Smear_ThetaMax-MC_Smear_ThetaMin );
@@ -1,8 +1,7 @@
 #pragma once
 
 #include "analysis/utils/Uncertainties.h"
-
-class TRandom;
+#include "base/CounterRNG.h"
 
 namespace ant {
 namespace analysis {
@@ -29,7 +28,7 @@ public:
     static std::shared_ptr<MCSmearingAdlarson> make();
 
 protected:
-    std::unique_ptr<TRandom> rng;
+    mutable CounterRNG rng;
 };
 
 }}}} // namespace ant::analysis::utils::UncertaintyModels
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "CounterRNG.h"
+
+#include <cmath>
+
+using namespace std;
+using namespace ant;
+
+namespace {
+
+// constants from Random123
+constexpr uint32_t PhiloxM0 = 0xD2511F53;
+constexpr uint32_t PhiloxM1 = 0xCD9E8D57;
+constexpr uint32_t PhiloxW0 = 0x9E3779B9;
+constexpr uint32_t PhiloxW1 = 0xBB67AE85;
+constexpr unsigned PhiloxRounds = 10;
+
+// L independent counters as structure of arrays,
+// such that the rounds (32x32->64 bit multiplications) get vectorized
+template<size_t L>
+struct lanes_t {
+    uint32_t C0[L], C1[L], C2[L], C3[L];
+
+    void philox(CounterRNG::key_t key) noexcept {
+        for(unsigned round=0;round<PhiloxRounds;round++) {
+            for(size_t j=0;j<L;j++) {
+                const uint64_t p0 = uint64_t(PhiloxM0)*C0[j];
+                const uint64_t p1 = uint64_t(PhiloxM1)*C2[j];
+                const uint32_t c1 = C1[j];
+                const uint32_t c3 = C3[j];
+                C0[j] = uint32_t(p1 >> 32) ^ c1 ^ key[0];
+                C1[j] = uint32_t(p1);
+                C2[j] = uint32_t(p0 >> 32) ^ c3 ^ key[1];
+                C3[j] = uint32_t(p0);
+            }
+            key[0] += PhiloxW0;
+            key[1] += PhiloxW1;
+        }
+    }
+};
+
+inline double to_uniform(uint32_t a, uint32_t b) noexcept {
+    // 53 random bits, shifted by half a step to exclude 0 and 1
+    const uint64_t x = (uint64_t(a) << 21) | (b >> 11);
+    return (double(x) + 0.5) * (1.0/9007199254740992.0);
+}
+
+inline void box_muller(double u1, double u2, double& z1, double& z2) noexcept {
+    const double r = sqrt(-2.0*log(u1));
+    const double phi = 2.0*M_PI*u2;
+    z1 = r*cos(phi);
+    z2 = r*sin(phi);
+}
+
+} // namespace
+
+uint64_t CounterRNG::seed = 0;
+
+CounterRNG::CounterRNG(Stream_t stream_, uint16_t substream) noexcept :
+    stream((uint32_t(stream_) << 16) | substream)
+{}
+
+void CounterRNG::SetSeed(uint64_t seed_) noexcept
+{
+    seed = seed_;
+    // restart all sequences
+    ++current().Generation;
+}
+
+uint64_t CounterRNG::GetSeed() noexcept
+{
+    return seed;
+}
+
+void CounterRNG::SetEvent(uint64_t id) noexcept
+{
+    auto& c = current();
+    c.ID = id;
+    ++c.Generation;
+}
+
+void CounterRNG::Start(uint64_t id_) noexcept
+{
+    id = id_;
+    generation = current().Generation;
+    index = 0;
+    used = block.size();
+    hasSpareGaus = false;
+}
+
+CounterRNG::counter_t CounterRNG::Philox4x32(counter_t ctr, key_t key) noexcept
+{
+    lanes_t<1> l;
+    l.C0[0] = ctr[0]; l.C1[0] = ctr[1]; l.C2[0] = ctr[2]; l.C3[0] = ctr[3];
+    l.philox(key);
+    return {l.C0[0], l.C1[0], l.C2[0], l.C3[0]};
+}
+
+CounterRNG::counter_t CounterRNG::make_counter(uint32_t index_) const noexcept
+{
+    return {index_, stream, uint32_t(id), uint32_t(id >> 32)};
+}
+
+void CounterRNG::next_block() noexcept
+{
+    block = Philox4x32(make_counter(index++), {uint32_t(seed), uint32_t(seed >> 32)});
+    used = 0;
+}
+
+double CounterRNG::Uniform() noexcept
+{
+    const auto a = (*this)();
+    const auto b = (*this)();
+    return to_uniform(a, b);
+}
+
+double CounterRNG::Gaus(double mean, double sigma) noexcept
+{
+    sync();
+    if(hasSpareGaus) {
+        hasSpareGaus = false;
+        return mean + sigma*spareGaus;
+    }
+    const double u1 = Uniform();
+    const double u2 = Uniform();
+    double z;
+    box_muller(u1, u2, z, spareGaus);
+    hasSpareGaus = true;
+    return mean + sigma*z;
+}
+
+void CounterRNG::Uniform(double* out, size_t n) noexcept
+{
+    // gives the same numbers as n calls of Uniform()
+    sync();
+    size_t i = 0;
+    // use up the current block first
+    while(i<n && used != block.size())
+        out[i++] = Uniform();
+
+    // then each full block gives two numbers
+    constexpr size_t L = 8;
+    lanes_t<L> l;
+    const key_t key{uint32_t(seed), uint32_t(seed >> 32)};
+    while(n-i >= 2*L) {
+        for(size_t j=0;j<L;j++) {
+            const auto ctr = make_counter(index+j);
+            l.C0[j] = ctr[0]; l.C1[j] = ctr[1]; l.C2[j] = ctr[2]; l.C3[j] = ctr[3];
+        }
+        l.philox(key);
+        for(size_t j=0;j<L;j++) {
+            out[i+2*j]   = to_uniform(l.C0[j], l.C1[j]);
+            out[i+2*j+1] = to_uniform(l.C2[j], l.C3[j]);
+        }
+        index += L;
+        i += 2*L;
+    }
+
+    for(;i<n;i++)
+        out[i] = Uniform();
+}
+
+void CounterRNG::Gaus(double* out, size_t n, double mean, double sigma) noexcept
+{
+    // gives the same numbers as n calls of Gaus(mean, sigma)
+    sync();
+    size_t i = 0;
+    if(n>0 && hasSpareGaus)
+        out[i++] = Gaus(mean, sigma);
+
+    // pairs of uniforms are transformed in-place
+    const size_t nPairs = (n-i)/2;
+    Uniform(out+i, 2*nPairs);
+    for(size_t k=0;k<nPairs;k++) {
+        double* z = out+i+2*k;
+        box_muller(z[0], z[1], z[0], z[1]);
+        z[0] = mean + sigma*z[0];
+        z[1] = mean + sigma*z[1];
+    }
+    i += 2*nPairs;
+
+    if(i<n)
+        out[i] = Gaus(mean, sigma);
+}
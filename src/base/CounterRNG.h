@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace ant {
+
+/**
+ * @brief The CounterRNG class provides reproducible random numbers for MC smearing and the like
+ *
+ * It's a counter-based generator (Philox4x32-10, see Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"),
+ * so the n-th random number is a pure function of (seed, event id, stream, substream, n).
+ * The sequence restarts for every event, thus the smeared values of an event do neither depend on
+ * the order the events are processed in nor on the thread they are processed by.
+ *
+ * The event is either given explicitly by Start, or implicitly by the last call to SetEvent in the current thread,
+ * which is done by the event loops (Reconstruct, PhysicsManager).
+ *
+ * The class fulfills the UniformRandomBitGenerator requirements, so it can also be used with the
+ * std::*_distribution's. Note that those might be implemented differently in other standard libraries, though.
+ */
+class CounterRNG {
+public:
+
+    /**
+     * @brief The Stream_t enum identifies the users of the random numbers,
+     * such that they get independent sequences. Never change existing values, only append!
+     */
+    enum class Stream_t : std::uint16_t {
+        Default,
+        TaggerPromptRandom,
+        TriggerSimulation,
+        MCSmear,
+        MCSmearingModel,
+        ClusterSmearing,
+        ClusterCorrSmearing,
+    };
+
+    /**
+     * @param stream the user of the random numbers
+     * @param substream to distinguish several instances of the same user, for example the detector type
+     */
+    explicit CounterRNG(Stream_t stream, std::uint16_t substream = 0) noexcept;
+
+    /**
+     * @brief SetSeed sets the seed of all generators, which should be set once at startup
+     * @param seed the global seed
+     */
+    static void SetSeed(std::uint64_t seed) noexcept;
+    static std::uint64_t GetSeed() noexcept;
+
+    /**
+     * @brief SetEvent tells all generators used by the current thread to restart their sequence for the given event
+     * @param id usually TID::Value() of the event
+     */
+    static void SetEvent(std::uint64_t id) noexcept;
+
+    /**
+     * @brief Start restarts the sequence of this generator explicitly for the given event
+     * @param id usually TID::Value() of the event
+     */
+    void Start(std::uint64_t id) noexcept;
+
+    // UniformRandomBitGenerator interface
+    using result_type = std::uint32_t;
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()() noexcept {
+        sync();
+        if(used == block.size())
+            next_block();
+        return block[used++];
+    }
+
+    /// uniformly distributed in the open interval (0,1)
+    double Uniform() noexcept;
+    double Uniform(double a, double b) noexcept { return a + (b-a)*Uniform(); }
+    /// normal distributed, similar to TRandom::Gaus
+    double Gaus(double mean = 0, double sigma = 1) noexcept;
+
+    /**
+     * @brief Uniform fills out with n numbers uniformly distributed in (0,1)
+     * @note several Philox blocks are calculated at once, which is much faster than n single calls
+     */
+    void Uniform(double* out, std::size_t n) noexcept;
+    /**
+     * @brief Gaus fills out with n normal distributed numbers
+     */
+    void Gaus(double* out, std::size_t n, double mean = 0, double sigma = 1) noexcept;
+
+    using counter_t = std::array<std::uint32_t, 4>;
+    using key_t     = std::array<std::uint32_t, 2>;
+
+    /// the bijection behind the generator, exposed for testing
+    static counter_t Philox4x32(counter_t ctr, key_t key) noexcept;
+
+protected:
+    void sync() noexcept {
+        if(generation != current().Generation)
+            Start(current().ID);
+    }
+    void next_block() noexcept;
+    counter_t make_counter(std::uint32_t index) const noexcept;
+
+    struct current_t {
+        std::uint64_t ID = 0;
+        std::uint64_t Generation = 0;
+    };
+    static current_t& current() noexcept {
+        static thread_local current_t c;
+        return c;
+    }
+
+    const std::uint32_t stream;
+    std::uint64_t id = 0;
+    std::uint64_t generation = std::numeric_limits<std::uint64_t>::max();
+    std::uint32_t index = 0; // next block to be generated
+    counter_t block;
+    unsigned used = 4; // words of block already returned
+    bool hasSpareGaus = false;
+    double spareGaus = 0;
+
+    static std::uint64_t seed;
+};
+
+} // namespace ant
@@ -5,6 +5,7 @@
 
 #include <sstream>
 #include <map>
+#include <memory>
 
 using namespace ant;
 using namespace std;
@@ -123,6 +124,36 @@ const char* ant::Channel_t::ToString(const Type_t& type)
 }
 
 
+ClusterDetector_t::neighbour_table_t::neighbour_table_t(unsigned nChannels_) :
+    nChannels(nChannels_),
+    nWords((nChannels_+63)/64),
+    firsts(nChannels_, nullptr),
+    lasts(nChannels_, nullptr),
+    bits(nChannels_*nWords, 0)
+{
+}
+
+void ClusterDetector_t::neighbour_table_t::Add(unsigned channel, const unsigned* first, const unsigned* last)
+{
+    if(channel >= nChannels)
+        throw out_of_range(std_ext::formatter() << "Element channel out of range: " << channel << " (" << nChannels << ")");
+    firsts[channel] = first;
+    lasts[channel] = last;
+    for(auto n = first; n != last; ++n) {
+        if(*n >= nChannels)
+            throw out_of_range(std_ext::formatter() << "Neighbour of element " << channel
+                               << " out of range: " << *n << " (" << nChannels << ")");
+        bits[channel*nWords + *n/64] |= uint64_t(1) << (*n % 64);
+    }
+}
+
+ClusterDetector_t::neighbours_t ClusterDetector_t::neighbour_table_t::Get(unsigned channel) const
+{
+    if(channel >= nChannels)
+        throw out_of_range(std_ext::formatter() << "Element channel out of range: " << channel << " (" << nChannels << ")");
+    return {firsts[channel], lasts[channel], addressof(bits[channel*nWords])};
+}
+
 double TaggerDetector_t::GetPhotonEnergyWidth(unsigned channel) const
 {
     if(channel >= GetNChannels())
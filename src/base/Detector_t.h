@@ -133,11 +133,82 @@ struct LogicalChannel_t {
 
 struct ClusterDetector_t : Detector_t {
 
+    /**
+     * @brief The neighbours_t struct is a read-only view on the neighbour channels of an element
+     *
+     * It points into the static geometry table of the detector, which stores the neighbours of
+     * all elements in one array (compressed sparse rows), and into the neighbour bitmap of that table.
+     */
+    struct neighbours_t {
+        neighbours_t() = default;
+        neighbours_t(const unsigned* first_, const unsigned* last_, const std::uint64_t* bits_ = nullptr) noexcept :
+            first(first_), last(last_), bits(bits_) {}
+
+        const unsigned* begin() const noexcept { return first; }
+        const unsigned* end() const noexcept { return last; }
+        std::size_t size() const noexcept { return last - first; }
+        bool empty() const noexcept { return first == last; }
+        unsigned operator[](std::size_t i) const noexcept { return first[i]; }
+
+        /**
+         * @brief Contains checks if the given channel of the same detector is a neighbour
+         * @note constant time if built with a bitmap, otherwise linear in size()
+         */
+        bool Contains(unsigned channel) const noexcept {
+            if(bits)
+                return (bits[channel/64] >> (channel % 64)) & 1;
+            for(auto n = first; n != last; ++n)
+                if(*n == channel)
+                    return true;
+            return false;
+        }
+
+    private:
+        const unsigned* first = nullptr;
+        const unsigned* last = nullptr;
+        const std::uint64_t* bits = nullptr;
+    };
+
+    /**
+     * @brief The neighbour_table_t class provides the neighbours_t of all elements of a detector,
+     * built once from the static neighbour lists of its geometry table
+     */
+    class neighbour_table_t {
+    public:
+        explicit neighbour_table_t(unsigned nChannels);
+
+        /**
+         * @brief Add the neighbours of one element
+         * @param first,last range of neighbour channels, must stay valid (usually static data)
+         */
+        void Add(unsigned channel, const unsigned* first, const unsigned* last);
+
+        /**
+         * @brief Add the neighbours of all rows of a geometry table
+         * @param rows having the fields Channel, NeighboursBegin and NeighboursEnd
+         * @param neighbours the neighbour lists, indexed by NeighboursBegin/End
+         */
+        template<typename Rows>
+        void Add(const Rows& rows, const unsigned* neighbours) {
+            for(const auto& row : rows)
+                Add(row.Channel, neighbours+row.NeighboursBegin, neighbours+row.NeighboursEnd);
+        }
+
+        neighbours_t Get(unsigned channel) const;
+
+    private:
+        const unsigned nChannels;
+        const unsigned nWords;
+        std::vector<const unsigned*> firsts;
+        std::vector<const unsigned*> lasts;
+        std::vector<std::uint64_t> bits;
+    };
+
     struct Element_t : Detector_t::Element_t {
         Element_t(
                 unsigned channel,
                 const vec3& position,
-                const std::vector<unsigned>& neighbours,
+                const neighbours_t& neighbours,
                 double moliereRadius,
                 double criticalE,
                 double radiationLength,
@@ -150,7 +221,7 @@ struct ClusterDetector_t : Detector_t {
             RadiationLength(radiationLength),
             TouchesHole(touchesHole)
         {}
-        std::vector<unsigned> Neighbours;
+        neighbours_t Neighbours;
         double MoliereRadius;
         double CriticalE;       // in MeV
         double RadiationLength; // X0 in cm
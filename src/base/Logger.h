@@ -20,6 +20,9 @@
 #endif
 #pragma GCC diagnostic pop
 
+#include <atomic>
+#include <chrono>
+
 void SetupLogger(int argc, char* argv[]);
 void SetupLogger();
 
@@ -36,5 +39,94 @@ struct DebugInfo {
     static long long nProcessedEvents;
 };
 
-}}
+namespace detail {
+
+/**
+ * @brief The site_t struct holds the state of one LOG_N_TIMES or LOG_EVERY_SECONDS statement
+ *
+ * Each statement has its own static instance, so unlike easylogging's
+ * registered hit counters no lookup and no locking is needed.
+ */
+struct site_t {
+    std::atomic<unsigned long long> Hits{0};
+    std::atomic<std::chrono::steady_clock::rep> Next{0};
+
+    bool FirstN(unsigned long long n) noexcept {
+        // stop counting once exhausted, then it's a single load
+        if(Hits.load(std::memory_order_relaxed) >= n)
+            return false;
+        return Hits.fetch_add(1, std::memory_order_relaxed) < n;
+    }
+
+    bool Every(double seconds) noexcept {
+        using clock_t = std::chrono::steady_clock;
+        const auto now = clock_t::now().time_since_epoch().count();
+        auto next = Next.load(std::memory_order_relaxed);
+        if(now < next)
+            return false;
+        const auto interval = std::chrono::duration_cast<clock_t::duration>(
+                                  std::chrono::duration<double>(seconds)).count();
+        // only one of concurrent callers wins
+        return Next.compare_exchange_strong(next, now + interval, std::memory_order_relaxed);
+    }
+};
+
+// turns the stream expression into void, see ANT_LOG_IF
+struct voidify_t {
+    template<typename Writer>
+    void operator&(const Writer&) const noexcept {}
+};
+
+}}}
+
+/*
+ * Verbose logs above ANT_MAX_VLOG_LEVEL are compiled out,
+ * see Ant_MAX_VLOG_LEVEL in cmake/settings.cmake.
+ * All VLOG variants check VLOG_IS_ON first, so for a constant level
+ * the compiler drops the statement including its stream expressions.
+ */
+#ifndef ANT_MAX_VLOG_LEVEL
+#define ANT_MAX_VLOG_LEVEL 9
+#endif
+
+#define VLOG_IS_COMPILED(vlevel) ((vlevel) <= ANT_MAX_VLOG_LEVEL)
+
+#undef VLOG_IS_ON
+#define VLOG_IS_ON(verboseLevel) \
+    (VLOG_IS_COMPILED(verboseLevel) && ELPP->vRegistry()->allowed(verboseLevel, __FILE__))
+
+// static state for each expansion, constant initialized
+#define ANT_LOG_SITE \
+    ([] () -> ::ant::logger::detail::site_t& { static ::ant::logger::detail::site_t site; return site; }())
+
+// an expression instead of an if statement, such that a following else binds
+// to the caller's if and an enclosing if without braces does not trigger -Wdangling-else
+#define ANT_LOG_IF(condition) \
+    !(condition) ? (void)0 : ::ant::logger::detail::voidify_t() &
+
+#define ANT_VLOG_WRITER(vlevel) \
+    el::base::Writer(el::Level::Verbose, __FILE__, __LINE__, ELPP_FUNC, \
+                     el::base::DispatchAction::NormalLog, vlevel).construct(1, ELPP_CURR_FILE_LOGGER_ID)
+
+/*
+ * Cheap per-statement variants of easylogging's occasional logs,
+ * suitable for per-event code. LOG_N_TIMES and VLOG_N_TIMES replace
+ * the easylogging versions, which look up a global registry on each call.
+ * The verbose variants count only if the level is enabled.
+ */
+#undef LOG_N_TIMES
+#define LOG_N_TIMES(n, LEVEL) \
+    ANT_LOG_IF(ANT_LOG_SITE.FirstN(n)) LOG(LEVEL)
+#undef VLOG_N_TIMES
+#define VLOG_N_TIMES(n, vlevel) \
+    ANT_LOG_IF(VLOG_IS_ON(vlevel) && ANT_LOG_SITE.FirstN(n)) ANT_VLOG_WRITER(vlevel)
+
+#define LOG_ONCE(LEVEL) LOG_N_TIMES(1, LEVEL)
+#define VLOG_ONCE(vlevel) VLOG_N_TIMES(1, vlevel)
+
+// log at most once within the given number of seconds
+#define LOG_EVERY_SECONDS(seconds, LEVEL) \
+    ANT_LOG_IF(ANT_LOG_SITE.Every(seconds)) LOG(LEVEL)
+#define VLOG_EVERY_SECONDS(seconds, vlevel) \
+    ANT_LOG_IF(VLOG_IS_ON(vlevel) && ANT_LOG_SITE.Every(seconds)) ANT_VLOG_WRITER(vlevel)
 
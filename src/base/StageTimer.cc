@@ -0,0 +1,171 @@
+#include "StageTimer.h"
+
+#include "TH1D.h"
+#include "TDirectory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+
+using namespace std;
+using namespace ant;
+
+constexpr unsigned StageTimer::NBuckets;
+bool StageTimer::enabled = false;
+
+namespace {
+// the time stamp counter is converted to seconds by comparing it with the steady_clock
+struct calibration_t {
+    uint64_t Ticks = StageTimer::Now();
+    chrono::steady_clock::time_point Time = chrono::steady_clock::now();
+};
+calibration_t calibration;
+}
+
+list<StageTimer>& StageTimer::registry() noexcept
+{
+    static list<StageTimer> timers;
+    return timers;
+}
+
+StageTimer& StageTimer::Get(const string& name)
+{
+    auto& timers = registry();
+    auto it = find_if(timers.begin(), timers.end(), [&name] (const StageTimer& t) {
+        return t.name == name;
+    });
+    if(it != timers.end())
+        return *it;
+    timers.emplace_back(name);
+    return timers.back();
+}
+
+void StageTimer::Enable(bool enable)
+{
+    enabled = enable;
+    if(enabled)
+        calibration = calibration_t();
+}
+
+double StageTimer::SecondsPerTick()
+{
+#ifdef ANT_STAGETIMER_TSC
+    // make sure the calibration interval is not too short
+    chrono::duration<double> elapsed;
+    uint64_t ticks;
+    do {
+        elapsed = chrono::steady_clock::now() - calibration.Time;
+        ticks = Now() - calibration.Ticks;
+    }
+    while(elapsed.count() < 1e-3 || ticks == 0);
+    return elapsed.count()/ticks;
+#else
+    return 1e-9;
+#endif
+}
+
+double StageTimer::BucketLowEdge(unsigned bucket) noexcept
+{
+    if(bucket < 4)
+        return bucket;
+    const int octave = bucket/4 + 1;
+    return ldexp(4 + bucket % 4, octave-2);
+}
+
+double StageTimer::GetTotalSeconds() const
+{
+    return total*SecondsPerTick();
+}
+
+double StageTimer::GetMeanSeconds() const
+{
+    return count>0 ? GetTotalSeconds()/count : 0;
+}
+
+TH1D* StageTimer::MakeHistogram() const
+{
+    auto first = find_if(buckets.begin(), buckets.end(), [] (uint64_t n) { return n>0; });
+    if(first == buckets.end())
+        first = buckets.begin();
+    auto last = find_if(buckets.rbegin(), buckets.rend(), [] (uint64_t n) { return n>0; }).base();
+    if(last <= first)
+        last = next(first);
+
+    const auto b_first = distance(buckets.begin(), first);
+    const auto nBins = distance(first, last);
+
+    const auto us_per_tick = 1e6*SecondsPerTick();
+    vector<double> edges(nBins+1);
+    for(auto i=0;i<=nBins;i++)
+        edges[i] = us_per_tick*BucketLowEdge(b_first+i);
+
+    string histname(name);
+    replace_if(histname.begin(), histname.end(), [] (char c) { return !isalnum(c); }, '_');
+
+    auto h = new TH1D(histname.c_str(), (name+";Latency / #mus;#").c_str(), nBins, edges.data());
+    for(auto i=0;i<nBins;i++)
+        h->SetBinContent(i+1, first[i]);
+    h->SetEntries(count);
+    return h;
+}
+
+void StageTimer::WriteAll(TDirectory& dir)
+{
+    const auto& timers = GetAll();
+    if(none_of(timers.begin(), timers.end(), [] (const StageTimer& t) { return t.count>0; }))
+        return;
+
+    TDirectory* subdir = nullptr;
+    dir.GetObject("StageTimers", subdir);
+    if(!subdir)
+        subdir = dir.mkdir("StageTimers");
+    if(!subdir)
+        return;
+
+    auto prev = gDirectory;
+    subdir->cd();
+    for(const auto& t : timers) {
+        if(t.count>0)
+            t.MakeHistogram();
+    }
+    prev->cd();
+}
+
+string StageTimer::Summary()
+{
+    stringstream ss;
+    ss << setprecision(3);
+    bool first = true;
+    for(const auto& t : GetAll()) {
+        if(t.count==0)
+            continue;
+        ss << (first ? "" : ", ") << t.name << " " << 1e6*t.GetMeanSeconds() << " us";
+        first = false;
+    }
+    return ss.str();
+}
+
+string StageTimer::Profile(const string& prefix)
+{
+    vector<const StageTimer*> used;
+    for(const auto& t : GetAll()) {
+        if(t.count>0 && t.name.compare(0, prefix.size(), prefix) == 0)
+            used.push_back(addressof(t));
+    }
+    sort(used.begin(), used.end(), [] (const StageTimer* a, const StageTimer* b) {
+        return a->total > b->total;
+    });
+
+    stringstream ss;
+    ss << fixed << setprecision(1);
+    for(auto t : used) {
+        ss << t->name << " " << 1e3*t->GetTotalSeconds() << " ms";
+        if(t->count>1)
+            ss << " (" << t->count << " times)";
+        ss << "\n";
+    }
+    return ss.str();
+}
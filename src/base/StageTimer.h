@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define ANT_STAGETIMER_TSC
+#endif
+
+class TDirectory;
+class TH1D;
+
+namespace ant {
+
+/**
+ * @brief The StageTimer class collects the latency distribution of one processing stage,
+ * such as reading an event, a reconstruct hook or a physics class
+ *
+ * Timing is off by default and switched on for all timers with Enable.
+ * When disabled, a Scope costs a single branch. The latencies are measured with the time stamp counter
+ * (if available, steady_clock otherwise) and collected in logarithmic buckets (four per octave).
+ *
+ * Timers are registered by name, get them once at construction and keep the reference.
+ * @note not thread-safe, meant for the event loop thread
+ */
+class StageTimer {
+public:
+
+    /**
+     * @brief Get returns the timer for the given stage, which is created on first use
+     * @param name of the stage, use '/' to group, e.g. "Physics/EtapOmegaG"
+     * @return reference which stays valid until the end of the program
+     */
+    static StageTimer& Get(const std::string& name);
+
+    /// all timers, in the order of their first use
+    static const std::list<StageTimer>& GetAll() noexcept { return registry(); }
+
+    static void Enable(bool enable = true);
+    static bool IsEnabled() noexcept { return enabled; }
+
+    /**
+     * @brief The Scope struct measures its lifetime, if timing is enabled
+     */
+    struct Scope {
+        explicit Scope(StageTimer& timer_) noexcept :
+            timer(enabled ? &timer_ : nullptr),
+            start(timer ? Now() : 0)
+        {}
+        ~Scope() {
+            if(timer)
+                timer->Add(Now() - start);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        StageTimer* const timer;
+        const std::uint64_t start;
+    };
+
+    /**
+     * @brief Add records one measurement, for stages which cannot be wrapped in a Scope
+     * @param ticks elapsed ticks, see Now
+     */
+    void Add(std::uint64_t ticks) noexcept {
+        ++count;
+        total += ticks;
+        ++buckets[Bucket(ticks)];
+    }
+
+    const std::string& GetName() const noexcept { return name; }
+    std::uint64_t GetCount() const noexcept { return count; }
+    double GetTotalSeconds() const;
+    double GetMeanSeconds() const;
+
+    /**
+     * @brief MakeHistogram creates the latency distribution in the current directory
+     * @return histogram with logarithmic bins in microseconds, owned by the current directory
+     */
+    TH1D* MakeHistogram() const;
+
+    /**
+     * @brief WriteAll creates the latency histograms of all used timers in a subdirectory "StageTimers" of dir
+     */
+    static void WriteAll(TDirectory& dir);
+
+    /**
+     * @brief Summary lists the mean latency of all used timers
+     * @return string like "Read 12.3 us, Process 4.56 us"
+     */
+    static std::string Summary();
+
+    /**
+     * @brief Profile lists the total time of the used timers whose name starts with prefix,
+     * most expensive first, one per line
+     * @param prefix e.g. "Startup/"
+     * @return string like "Startup/Setup/Setup_2014_EPT 35.2 ms\n..."
+     */
+    static std::string Profile(const std::string& prefix);
+
+    /// current ticks, either from the time stamp counter or in ns
+    static std::uint64_t Now() noexcept {
+#ifdef ANT_STAGETIMER_TSC
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+    /// conversion from ticks to seconds, calibrated since Enable was called
+    static double SecondsPerTick();
+
+    // bucketing, exposed for testing
+    static constexpr unsigned NBuckets = 256;
+    static unsigned Bucket(std::uint64_t ticks) noexcept {
+        if(ticks < 4)
+            return ticks;
+        // octave and the two bits below the leading one
+        const unsigned octave = 63 - __builtin_clzll(ticks);
+        return 4*(octave-1) + ((ticks >> (octave-2)) & 3);
+    }
+    static double BucketLowEdge(unsigned bucket) noexcept;
+
+    explicit StageTimer(const std::string& name_) : name(name_) {}
+
+protected:
+    const std::string name;
+    std::uint64_t count = 0;
+    std::uint64_t total = 0;
+    std::array<std::uint64_t, NBuckets> buckets{};
+
+    static bool enabled;
+    static std::list<StageTimer>& registry() noexcept;
+};
+
+} // namespace ant
@@ -6,6 +6,7 @@
 
 #include "TBufferFile.h"
 #include "TLeaf.h"
+#include "RVersion.h"
 
 using namespace std;
 using namespace ant;
@@ -104,6 +105,9 @@ void WrapTTree::LinkBranches(TTree* tree, bool requireOptional) {
             throw Exception(std_ext::formatter() << "Cannot set address for branch " << b.Name << " in tree " << Tree->GetName());
     }
 
+    // branches might be different now
+    lazy.CurrentTree = nullptr;
+
     // hook notify (important for TChain)
     if(Tree->GetNotify() != ROOTArrayNotifier.get()) {
         ROOTArrayNotifier->PrevNotifier = Tree->GetNotify(); // maybe nullptr, but that's handled by our notifier
@@ -116,6 +120,163 @@ void WrapTTree::LinkBranches(bool requireOptional)
     LinkBranches(nullptr, requireOptional);
 }
 
+vector<string> WrapTTree::GetLinkedBranchNames() const
+{
+    vector<string> names;
+    for(const auto& b : branches) {
+        if(b.OptionalIsPresent && !*b.OptionalIsPresent)
+            continue;
+        const auto& fullbranchname = branchNamePrefix+b.Name;
+        names.emplace_back(fullbranchname);
+        auto rootbranch = Tree->GetBranch(fullbranchname.c_str());
+        if(!rootbranch)
+            continue;
+        // variable size arrays need their count branch
+        auto leaves = rootbranch->GetListOfLeaves();
+        for(int i=0;i<leaves->GetEntriesFast();i++) {
+            auto leaf = dynamic_cast<TLeaf*>(leaves->At(i));
+            if(leaf && leaf->GetLeafCount())
+                names.emplace_back(leaf->GetLeafCount()->GetBranch()->GetName());
+        }
+    }
+    return names;
+}
+
+void WrapTTree::PruneBranches(bool deactivateOthers)
+{
+    if(!Tree)
+        throw Exception("Set the Tree pointer before calling PruneBranches");
+
+    if(deactivateOthers)
+        Tree->SetBranchStatus("*", 0);
+    for(const auto& name : GetLinkedBranchNames()) {
+        // also activate sub-branches of split objects
+        Tree->SetBranchStatus(name.c_str(), 1);
+        Tree->SetBranchStatus((name+".*").c_str(), 1);
+    }
+}
+
+void WrapTTree::EnableCache(Long64_t cacheSize, bool parallelUnzip)
+{
+    if(!Tree)
+        throw Exception("Set the Tree pointer before calling EnableCache");
+
+    if(parallelUnzip)
+        TTree::SetParallelUnzip(kTRUE);
+
+    // keep an existing cache (possibly shared with other instances) if no size is requested,
+    // as changing the size creates a new cache, negative size means ROOT's default
+    if(cacheSize > 0 && Tree->GetCacheSize() != cacheSize)
+        Tree->SetCacheSize(cacheSize);
+    else if(cacheSize <= 0 && Tree->GetCacheSize() == 0)
+        Tree->SetCacheSize(-1);
+
+    for(const auto& name : GetLinkedBranchNames())
+        Tree->AddBranchToCache(name.c_str(), kTRUE);
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,34,0)
+    // we know the branches, so no learning necessary
+    Tree->StopCacheLearningPhase();
+#endif
+}
+
+Long64_t WrapTTree::GetEntry(Long64_t entry)
+{
+    if(!Tree)
+        throw Exception("Set the Tree pointer before calling GetEntry");
+
+    // mark all values as not loaded
+    ++lazy.EntryGen;
+    lazy.Entry = entry;
+
+    if(Tree->LoadTree(entry) < 0)
+        return 0;
+
+    // read the branches which are most likely accessed again
+    Long64_t nbytes = 0;
+    for(size_t i=0;i<branches.size();i++) {
+        if(branches[i].State->Touched)
+            nbytes += LoadBranch(i);
+    }
+    return nbytes;
+}
+
+Long64_t WrapTTree::ReadColumns(Long64_t first, Long64_t n)
+{
+    if(!Tree)
+        throw Exception("Set the Tree pointer before calling ReadColumns");
+
+    // mark all columns as not loaded
+    ++lazy.ColumnsGen;
+    lazy.ColumnsFirst = first;
+    lazy.ColumnsN = std::max<Long64_t>(0, std::min(n, Tree->GetEntries()-first));
+
+    for(size_t i=0;i<branches.size();i++) {
+        if(branches[i].State->ColumnTouched)
+            LoadColumn(i);
+    }
+    return lazy.ColumnsN;
+}
+
+TBranch* WrapTTree::GetLazyBranch(size_t index) const
+{
+    // TChain switches the underlying tree, so look up the branches again then
+    auto tree = Tree->GetTree();
+    if(tree == nullptr)
+        return nullptr;
+    if(lazy.CurrentTree != tree || lazy.CurrentTreeNumber != Tree->GetTreeNumber()) {
+        lazy.CurrentTree = tree;
+        lazy.CurrentTreeNumber = Tree->GetTreeNumber();
+        lazy.Branches.assign(branches.size(), nullptr);
+    }
+
+    auto& branch = lazy.Branches[index];
+    if(branch == nullptr) {
+        const auto& b = branches[index];
+        // skip optional branches which are not present
+        if(b.OptionalIsPresent && !*b.OptionalIsPresent)
+            return nullptr;
+        branch = tree->GetBranch((branchNamePrefix+b.Name).c_str());
+    }
+    return branch;
+}
+
+Int_t WrapTTree::LoadBranch(size_t index) const
+{
+    auto& state = *branches[index].State;
+    state.Touched = true;
+    state.EntryGen = lazy.EntryGen;
+
+    // ReadColumns might have loaded another tree of a TChain in the meantime
+    const auto localentry = Tree->GetReadEntry() == lazy.Entry ?
+                                Tree->GetTree()->GetReadEntry() : Tree->LoadTree(lazy.Entry);
+    if(localentry < 0)
+        return 0;
+    auto branch = GetLazyBranch(index);
+    if(branch == nullptr)
+        return 0;
+    return branch->GetEntry(localentry);
+}
+
+void WrapTTree::LoadColumn(size_t index) const
+{
+    const auto& b = branches[index];
+    b.State->ColumnTouched = true;
+    b.State->ColumnsGen = lazy.ColumnsGen;
+    // the value does no longer correspond to lazy.Entry
+    b.State->EntryGen = 0;
+
+    // reading the entries of one branch after another
+    // decompresses each basket of this branch only once
+    b.Column->Column_clear(lazy.ColumnsN);
+    for(auto entry = lazy.ColumnsFirst; entry < lazy.ColumnsFirst+lazy.ColumnsN; entry++) {
+        const auto localentry = Tree->LoadTree(entry);
+        auto branch = GetLazyBranch(index);
+        if(branch != nullptr && localentry >= 0)
+            branch->GetEntry(localentry);
+        b.Column->Column_append();
+    }
+}
+
 bool WrapTTree::Matches(TTree* tree, bool exact, bool nowarn) const {
     if(tree == nullptr)
         tree = Tree;
@@ -167,7 +328,11 @@ bool WrapTTree::CopyFrom(const WrapTTree& src) {
         return false;
 
     // copy branches by name
-    for(const ROOT_branch_t& src_b : src.branches) {
+    for(size_t i=0;i<src.branches.size();i++) {
+        const ROOT_branch_t& src_b = src.branches[i];
+        // make sure the value is there if src reads lazily
+        if(src_b.State->EntryGen != src.lazy.EntryGen)
+            src.LoadBranch(i);
         auto it_b = std::find(branches.begin(), branches.end(), src_b.Name);
         // src branch not found in our list of branches
         if(it_b == branches.end())
@@ -187,6 +352,8 @@ bool WrapTTree::CopyFrom(const WrapTTree& src) {
             auto datatype = TDataType::GetDataType(src_b.ROOTType);
             std::memcpy(*(it_b->ValuePtr), *src_b.ValuePtr, datatype->Size());
         }
+        // don't overwrite the copied value by lazy reading
+        it_b->State->EntryGen = lazy.EntryGen;
     }
 
     return true;
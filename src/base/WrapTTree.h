@@ -45,6 +45,20 @@ namespace ant {
  *
  * Note that WrapTTree even supports branches created with "branchname[sizebranch]" via
  * `WrapTTree::ROOTArray<T>`, which wraps it into an conviniently usable `std::vector<T>`
+ *
+ * For reading large trees where only some branches are used,
+ * use `WrapTTree::GetEntry()` instead of `Tree->GetEntry()`:
+ * Branches are then read on first access only, and branches never accessed are never read.
+ * Alternatively, `WrapTTree::ReadColumns()` copies many entries at once into contiguous
+ * columns, accessible per branch via `Column()`:
+ *
+ *     for(long long first=0; first<treeTest.Tree->GetEntries(); first += 1000) {
+ *       const auto n = treeTest.ReadColumns(first, 1000);
+ *       const auto& chi2s = treeTest.KinFitChi2.Column(); // chi2s.size() == n
+ *       // ...
+ *     }
+ *
+ * Do not mix `Tree->GetEntry()` with those two methods on the same instance.
  */
 class WrapTTree {
 public:
@@ -84,6 +98,43 @@ public:
      */
     bool CopyFrom(const WrapTTree& src);
 
+    /**
+     * @brief PruneBranches deactivates all branches of Tree not linked by this instance,
+     * then TTree::GetEntry does not read (and decompress) them
+     * @param deactivateOthers if false, only activate the linked branches (needed if several instances share one TTree)
+     * @note call after LinkBranches, leaf count branches of ROOTArrays are kept active
+     */
+    void PruneBranches(bool deactivateOthers = true);
+
+    /**
+     * @brief EnableCache sets up the TTreeCache of Tree with exactly the linked branches
+     * @param cacheSize size in bytes, if zero, an existing cache is kept or one with ROOT's default size is created
+     * @param parallelUnzip decompress the baskets in the cache ahead on a helper thread
+     * @note call after LinkBranches, instances sharing one TTree all add their branches to the same cache
+     */
+    void EnableCache(Long64_t cacheSize = 0, bool parallelUnzip = true);
+
+    /**
+     * @brief GetEntry prepares reading the given entry lazily: Only branches accessed already for
+     * previous entries are read immediately, all others are read on their first access.
+     * Branches which are never accessed are thus never read (nor learnt by the TTreeCache)
+     * @param entry the entry number, as for TTree::GetEntry
+     * @return number of bytes read for the already accessed branches, 0 if entry is not present
+     */
+    Long64_t GetEntry(Long64_t entry);
+
+    /**
+     * @brief ReadColumns copies n entries starting at first, branch by branch into contiguous columns.
+     * Only branches whose Column() was accessed for previous columns are read immediately,
+     * the others are read on their first Column() access.
+     * @note This is a convenience columnar copy, not ROOT's basket-level bulk I/O:
+     * Each entry is still read by TBranch::GetEntry and copied into the column.
+     * @param first first entry to read
+     * @param n number of entries to read
+     * @return number of entries in the columns, less than n at the end of the tree
+     */
+    Long64_t ReadColumns(Long64_t first, Long64_t n);
+
     /**
      * @brief operator bool returns true if Tree is not null
      */
@@ -91,14 +142,35 @@ public:
         return Tree != nullptr;
     }
 
+private:
+    // bookkeeping of each branch for lazy/columnar reading
+    struct branch_state_t {
+        unsigned long long EntryGen = 0;   // matches lazy_t::EntryGen if value is loaded
+        unsigned long long ColumnsGen = 0; // matches lazy_t::ColumnsGen if column is loaded
+        bool Touched = false;              // accessed in lazy mode before
+        bool ColumnTouched = false;        // column accessed before
+    };
+
+    // this interface is used only internally in WrapTTree
+    struct Column_traits {
+        virtual void Column_clear(std::size_t n) =0;
+        virtual void Column_append() =0;
+    protected:
+        virtual ~Column_traits() = default;
+    };
+
+public:
+
     template<typename T>
-    struct Branch_t {
+    struct Branch_t : Column_traits {
         template<typename... Args>
         Branch_t(WrapTTree& wraptree, const std::string& name, bool* optionalIsPresent,
                  Args&&... args) :
             Name(name),
             // can't use unique_ptr because of std::addressof below
-            Value(new T(std::forward<Args>(args)...))
+            Value(new T(std::forward<Args>(args)...)),
+            Wrap(wraptree),
+            Index(wraptree.branches.size())
         {
             static_assert(std::is_same<T, TClonesArray>::value ? sizeof... (Args) > 0 : true,
                           "TClonesArray cannot be default constructed (provide contained class as string!)");
@@ -114,12 +186,16 @@ public:
                                   TDataType::GetType(typeid(T)),
                                   reinterpret_cast<void**>(std::addressof(Value.Ptr)),
                                   std::is_base_of<ROOTArray_traits, T>::value,
-                                  optionalIsPresent);
+                                  optionalIsPresent,
+                                  std::addressof(State),
+                                  this);
         }
-        ~Branch_t() = default;
+        virtual ~Branch_t() = default;
         Branch_t(const Branch_t&) = delete;
         Branch_t& operator= (const Branch_t& other) {
+            other.load();
             *Value = *(other.Value);
+            loaded();
             return *this;
         }
         Branch_t(Branch_t&&) = delete;
@@ -128,21 +204,61 @@ public:
         const std::string Name;
 
         // implicit conversion
-        operator T& () { return *Value; }
-        operator const T& () const { return *Value; }
+        operator T& () { load(); return *Value; }
+        operator const T& () const { load(); return *Value; }
         // assignment/move
-        T& operator= (const T& v) { *Value = v; return *Value; }
-        T& operator= (T&& v) { *Value = std::move(v); return *Value; }
+        T& operator= (const T& v) { *Value = v; loaded(); return *Value; }
+        T& operator= (T&& v) { *Value = std::move(v); loaded(); return *Value; }
         // if you need to call methods of T, sometimes operator() is handy
-        T& operator() () { return *Value; }
-        const T& operator() () const { return *Value; }
+        T& operator() () { load(); return *Value; }
+        const T& operator() () const { load(); return *Value; }
         // subscript access for more convenient access
         // templated to use SFINAE for typedefs T::reference, T::const_reference
         template<typename U = T>
-        typename U::reference operator[](std::size_t n) { return (*Value)[n]; }
+        typename U::reference operator[](std::size_t n) { load(); return (*Value)[n]; }
         template<typename U = T>
-        typename U::const_reference operator[](std::size_t n) const { return (*Value)[n]; }
+        typename U::const_reference operator[](std::size_t n) const { load(); return (*Value)[n]; }
+
+        /**
+         * @brief Column gives the values of this branch for all entries read by WrapTTree::ReadColumns
+         */
+        const std::vector<T>& Column() const {
+            if(State.ColumnsGen != Wrap.lazy.ColumnsGen)
+                Wrap.LoadColumn(Index);
+            return column;
+        }
+
     private:
+        // only does something after WrapTTree::GetEntry was used
+        void load() const {
+            if(State.EntryGen != Wrap.lazy.EntryGen)
+                Wrap.LoadBranch(Index);
+        }
+        // value was set explicitly, so don't overwrite it by lazy loading
+        void loaded() {
+            State.EntryGen = Wrap.lazy.EntryGen;
+        }
+
+        // columns need copyable types, dispatch to prevent compile errors for other types
+        using copyable_t = typename std::is_copy_constructible<T>::type;
+        virtual void Column_clear(std::size_t n) override {
+            column_clear(n, copyable_t());
+        }
+        virtual void Column_append() override {
+            column_append(copyable_t());
+        }
+        void column_clear(std::size_t n, std::true_type) {
+            column.clear();
+            column.reserve(n);
+        }
+        void column_clear(std::size_t, std::false_type) {
+            throw Exception("Type of branch "+Name+" cannot be copied to column");
+        }
+        void column_append(std::true_type) {
+            column.push_back(*Value);
+        }
+        void column_append(std::false_type) {}
+
         struct Value_t {
             explicit Value_t(T* ptr) : Ptr(ptr) {}
             T& operator* () { return *Ptr; }
@@ -159,6 +275,11 @@ public:
             T* Ptr;
         };
         Value_t Value;
+
+        WrapTTree& Wrap;
+        const std::size_t Index;
+        mutable branch_state_t State;
+        std::vector<T> column;
     };
 
     template<typename T>
@@ -270,17 +391,23 @@ private:
         void** const ValuePtr;
         const bool IsROOTArray;
         bool* const OptionalIsPresent; // is nullptr if branch non-optional
+        branch_state_t* const State;
+        Column_traits* const Column;
 
         ROOT_branch_t(const std::string& name,
                       TClass* rootClass,
                       EDataType rootType,
                       void** valuePtr,
                       bool isROOTArray,
-                      bool* optionalIsPresent) :
+                      bool* optionalIsPresent,
+                      branch_state_t* state,
+                      Column_traits* column) :
             ROOT_branchinfo_t(name, rootClass, rootType),
             ValuePtr(valuePtr),
             IsROOTArray(isROOTArray),
-            OptionalIsPresent(optionalIsPresent)
+            OptionalIsPresent(optionalIsPresent),
+            State(state),
+            Column(column)
         {
             if(ROOTClass==0 && ROOTType == kOther_t && !IsROOTArray)
                 throw Exception("Cannot use type of branch "+Name+" as ROOT branch, as its unknown to ROOT");
@@ -295,6 +422,26 @@ private:
     struct ROOTArrayNotifier_t;
     const std::unique_ptr<ROOTArrayNotifier_t> ROOTArrayNotifier;
     void HandleROOTArray(const std::string& branchname, void** valuePtr);
+
+    // state of lazy reading by GetEntry and columnar reading by ReadColumns,
+    // modified when loading branches on access, thus mutable
+    struct lazy_t {
+        unsigned long long EntryGen = 0; // zero means GetEntry was never called
+        Long64_t Entry = -1;
+        unsigned long long ColumnsGen = 0;
+        Long64_t ColumnsFirst = 0;
+        Long64_t ColumnsN = 0;
+        // branches of currently loaded tree (changes for TChain)
+        TTree* CurrentTree = nullptr;
+        int CurrentTreeNumber = -1;
+        std::vector<TBranch*> Branches;
+    };
+    mutable lazy_t lazy;
+    TBranch* GetLazyBranch(std::size_t index) const;
+    // linked branches present in Tree, including the leaf count branches of ROOTArrays
+    std::vector<std::string> GetLinkedBranchNames() const;
+    Int_t LoadBranch(std::size_t index) const;
+    void LoadColumn(std::size_t index) const;
 };
 
 }
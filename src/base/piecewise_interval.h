@@ -44,10 +44,12 @@ public:
 
                 auto res = i->tryJoinWith(*j);
 
-                if( res )
-                    j = this->erase(j);
-                else
-                    ++j;
+                if( res ) {
+                    // i might now overlap with intervals already skipped
+                    this->erase(j);
+                    j = i;
+                }
+                ++j;
             }
             ++i;
         }
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ant {
+namespace std_ext {
+
+/**
+ * @brief The fnv1a_t struct calculates the 64bit FNV-1a hash incrementally,
+ * fast and good enough to detect changed content, but not cryptographically secure
+ */
+struct fnv1a_t {
+    std::uint64_t Value = 14695981039346656037ull;
+
+    void add(const void* data, std::size_t n) noexcept {
+        auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+        for(std::size_t i=0;i<n;i++) {
+            Value ^= bytes[i];
+            Value *= 1099511628211ull;
+        }
+    }
+
+    template<typename T>
+    void add(const T& v) noexcept {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only arithmetic or enum types can be hashed bytewise");
+        add(&v, sizeof(v));
+    }
+
+    void add(const std::string& s) noexcept {
+        add(s.size());
+        add(s.data(), s.size());
+    }
+
+    template<typename T>
+    void add(const std::vector<T>& v) noexcept {
+        static_assert(std::is_arithmetic<T>::value, "Only vectors of arithmetic types can be hashed bytewise");
+        add(v.size());
+        add(v.data(), v.size()*sizeof(T));
+    }
+};
+
+}} // namespace ant::std_ext
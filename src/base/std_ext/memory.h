@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <list>
+#include <cstddef>
 
 namespace ant {
 namespace std_ext {
@@ -51,4 +52,120 @@ template<class T, class... Args>
 typename _Unique_if<T>::_Known_bound
 make_unique(Args&&...) = delete;
 
+namespace detail {
+
+// thread-local free list of blocks with same size,
+// blocks may be freed by another thread than the allocating one
+template<std::size_t Size>
+struct block_pool {
+    struct node_t {
+        node_t* next;
+    };
+
+    static constexpr std::size_t BlockSize = Size < sizeof(node_t) ? sizeof(node_t) : Size;
+    // upper limit of kept free blocks per thread
+    static constexpr std::size_t MaxFree = 1 << 16;
+
+    struct state_t {
+        node_t* head;
+        std::size_t nFree;
+        bool registered;
+        bool destroyed;
+    };
+
+    static state_t& state() noexcept {
+        // trivially destructible, thus still usable during thread/program exit
+        static thread_local state_t s{nullptr, 0, false, false};
+        return s;
+    }
+
+    // releases the blocks when thread exits
+    struct cleanup_t {
+        ~cleanup_t() {
+            auto& s = state();
+            while(s.head) {
+                auto next = s.head->next;
+                ::operator delete(s.head);
+                s.head = next;
+            }
+            s.nFree = 0;
+            s.destroyed = true;
+        }
+    };
+
+    static void* allocate() {
+        auto& s = state();
+        if(s.head) {
+            auto p = s.head;
+            s.head = p->next;
+            --s.nFree;
+            return p;
+        }
+        if(!s.registered && !s.destroyed) {
+            static thread_local cleanup_t cleanup;
+            (void)cleanup;
+            s.registered = true;
+        }
+        return ::operator new(BlockSize);
+    }
+
+    static void deallocate(void* p) noexcept {
+        auto& s = state();
+        if(s.destroyed || !s.registered || s.nFree >= MaxFree) {
+            ::operator delete(p);
+            return;
+        }
+        auto node = static_cast<node_t*>(p);
+        node->next = s.head;
+        s.head = node;
+        ++s.nFree;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief The pool_allocator struct recycles single-object allocations via thread-local free lists,
+ * avoiding malloc/free for objects created and destroyed at high rate (such as per event)
+ */
+template<class T>
+struct pool_allocator {
+    using value_type = T;
+
+    pool_allocator() noexcept = default;
+    template<class U>
+    pool_allocator(const pool_allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if(n != 1)
+            return static_cast<T*>(::operator new(n*sizeof(T)));
+        return static_cast<T*>(pool_t::allocate());
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if(n != 1)
+            ::operator delete(p);
+        else
+            pool_t::deallocate(p);
+    }
+
+private:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types not supported");
+    using pool_t = detail::block_pool<sizeof(T)>;
+};
+
+template<class T, class U>
+bool operator==(const pool_allocator<T>&, const pool_allocator<U>&) noexcept { return true; }
+template<class T, class U>
+bool operator!=(const pool_allocator<T>&, const pool_allocator<U>&) noexcept { return false; }
+
+/**
+ * @brief make_pooled is std::make_shared using the pool_allocator,
+ * object and control block are recycled after the last reference is gone
+ */
+template<class T, class... Args>
+std::shared_ptr<T> make_pooled(Args&&... args) {
+    return std::allocate_shared<T>(pool_allocator<T>(), std::forward<Args>(args)...);
+}
+
 }} // namespace ant::std_ext
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "memory.h"
+
 #include <vector>
 #include <memory>
 #include <functional>
@@ -196,7 +198,7 @@ public:
     template<class... Args>
     void emplace_back(Args&&... args)
     {
-        c.emplace_back(std::make_shared<T>(std::forward<Args>(args)...));
+        c.emplace_back(make_pooled<T>(std::forward<Args>(args)...));
     }
 
     template<class it_t>
@@ -5,6 +5,7 @@
 #include "base/WrapTFile.h"
 #include "base/Logger.h"
 #include "base/std_ext/memory.h"
+#include "base/std_ext/hash.h"
 #include "base/interval.h"
 #include "tree/TCalibrationData.h"
 
@@ -61,7 +62,59 @@ bool DataManager::GetData(const string& calibrationID,
                           const TID& eventID, TCalibrationData& cdata, TID& nextChangePoint) const
 {
     Init();
-    return dataBase->GetItem(calibrationID,eventID,cdata,nextChangePoint);
+    const bool found = dataBase->GetItem(calibrationID,eventID,cdata,nextChangePoint);
+    SetLoaded(calibrationID, found ? addressof(cdata) : nullptr);
+    return found;
+}
+
+namespace {
+struct hash_t : std_ext::fnv1a_t {
+    using fnv1a_t::add;
+    void add(const TID& id) {
+        add(id.Flags); add(id.Timestamp); add(id.Lower);
+    }
+};
+}
+
+uint64_t DataManager::Hash(const TCalibrationData& cdata)
+{
+    hash_t h;
+    h.add(cdata.CalibrationID);
+    h.add(cdata.FirstID);
+    h.add(cdata.LastID);
+    h.add(cdata.Data.size());
+    for(const auto& entry : cdata.Data) {
+        h.add(entry.Key);
+        h.add(entry.Value);
+    }
+    h.add(cdata.FitParameters.size());
+    for(const auto& entry : cdata.FitParameters) {
+        h.add(entry.Key);
+        h.add(entry.Value);
+    }
+    return h.Value;
+}
+
+void DataManager::SetLoaded(const string& calibrationID, const TCalibrationData* cdata) const
+{
+    loaded_t item;
+    if(cdata) {
+        item.FirstID = cdata->FirstID;
+        item.LastID = cdata->LastID;
+        item.Hash = Hash(*cdata);
+    }
+
+    auto& current = loaded[calibrationID];
+    if(current.Hash == item.Hash && loadedHash != 0)
+        return;
+    current = item;
+
+    hash_t h;
+    for(const auto& it : loaded) {
+        h.add(it.first);
+        h.add(it.second.Hash);
+    }
+    loadedHash = h.Value;
 }
 
 size_t DataManager::GetNumberOfCalibrationIDs() const
@@ -2,10 +2,14 @@
 
 #include "Calibration.h"
 
+#include "tree/TID.h"
+
 //std
 #include <list>
+#include <map>
 #include <string>
 #include <memory>
+#include <cstdint>
 
 namespace ant
 {
@@ -55,6 +59,22 @@ private:
 
     bool override_as_default = false;
 
+public:
+    /**
+     * @brief The loaded_t struct identifies the calibration data returned by GetData
+     */
+    struct loaded_t {
+        TID FirstID;
+        TID LastID;
+        std::uint64_t Hash = 0; // of the content, zero if no data was found
+    };
+    using loaded_items_t = std::map<std::string, loaded_t>;
+
+private:
+    mutable loaded_items_t loaded;
+    mutable std::uint64_t loadedHash = 0;
+    void SetLoaded(const std::string& calibrationID, const TCalibrationData* cdata) const;
+
 public:
     DataManager(const std::string& calibrationDataFolder_);
     virtual ~DataManager();
@@ -70,6 +90,21 @@ public:
                  TCalibrationData& cdata,
                  TID& nextChangePoint) const;
 
+    /**
+     * @brief GetLoaded returns per calibration ID the data last returned by GetData with nextChangePoint,
+     * which is the variant used by the updateables during reconstruction
+     */
+    const loaded_items_t& GetLoaded() const { return loaded; }
+    /**
+     * @brief GetLoadedHash changes whenever GetLoaded changes, so it identifies the currently applied calibration
+     */
+    std::uint64_t GetLoadedHash() const { return loadedHash; }
+
+    /**
+     * @brief Hash calculates a hash over the content of the given calibration data
+     */
+    static std::uint64_t Hash(const TCalibrationData& cdata);
+
     // the following methods are only useful for test cases
     std::list<std::string> GetCalibrationIDs() const;
     std::size_t GetNumberOfCalibrationIDs() const;
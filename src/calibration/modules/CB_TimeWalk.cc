@@ -40,6 +40,14 @@ CB_TimeWalk::CB_TimeWalk(
     TimeWindow(timeWindow),
     BadTDC_EnergyThreshold(badTDC_EnergyThreshold)
 {
+    // timewalks are created on first use,
+    // as one TF1 per channel makes constructing the setup slow
+}
+
+void CB_TimeWalk::CreateTimewalks()
+{
+    if(!timewalks.empty())
+        return;
     for(unsigned ch=0;ch<cb_detector->GetNChannels();ch++) {
         timewalks.emplace_back(make_shared<gui::FitTimewalk>());
     }
@@ -54,6 +62,9 @@ void CB_TimeWalk::ApplyTo(clusterhits_t& sorted_clusterhits)
     if(IsMC)
         return;
 
+    // usually done by the loader already
+    CreateTimewalks();
+
     // search for CB clusters
     const auto it_sorted_clusterhits = sorted_clusterhits.find(Detector_t::Type_t::CB);
     if(it_sorted_clusterhits == sorted_clusterhits.end())
@@ -126,6 +137,7 @@ void CB_TimeWalk::ApplyTo(clusterhits_t& sorted_clusterhits)
 }
 
 void CB_TimeWalk::GetGUIs(list<unique_ptr<gui::CalibModule_traits> >& guis, OptionsPtr) {
+    CreateTimewalks();
     guis.emplace_back(std_ext::make_unique<TheGUI>(GetName(), calibrationManager, cb_detector, timewalks));
 }
 
@@ -137,6 +149,9 @@ std::list<Updateable_traits::Loader_t> CB_TimeWalk::GetLoaders()
             TCalibrationData cdata;
             if(!calibrationManager->GetData(GetName(), currPoint, cdata, nextChangePoint))
                 return;
+            // only create the timewalks if there is something to load,
+            // otherwise ApplyTo creates them for real data
+            CreateTimewalks();
             for(const TKeyValue<vector<double>>& kv : cdata.FitParameters) {
                 if(kv.Key>=timewalks.size()) {
                     LOG(ERROR) << "Ignoring too large key=" << kv.Key;
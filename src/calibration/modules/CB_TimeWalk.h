@@ -85,6 +85,7 @@ public:
 
 
 protected:
+    void CreateTimewalks();
     std::vector< std::shared_ptr<gui::FitTimewalk> > timewalks;
 
     std::shared_ptr<expconfig::detector::CB> cb_detector;
@@ -14,9 +14,6 @@
 #include <list>
 #include <cmath>
 
-#include "TRandom.h"
-
-
 
 using namespace std;
 using namespace ant;
@@ -102,7 +99,7 @@ std::list<Updateable_traits::Loader_t> ClusterCorrection::GetLoaders()
 void ClusterSmearing::ApplyTo(TCluster& cluster)
 {
     const auto sigma  = interpolator->GetPoint(cluster.Energy, cos(cluster.Position.Theta()));
-    cluster.Energy    = gRandom->Gaus(cluster.Energy, sigma);
+    cluster.Energy    = rng.Gaus(cluster.Energy, sigma);
 }
 
 void ClusterECorr::ApplyTo(TCluster& cluster)
@@ -182,5 +179,5 @@ ClusterCorrSmearing::ClusterCorrSmearing(std::shared_ptr<ClusterDetector_t> det,
 
 void ClusterCorrSmearing::ApplyTo(TCluster& cluster)
 {
-    cluster.Energy = gRandom->Gaus(cluster.Energy, sigma);
+    cluster.Energy = rng.Gaus(cluster.Energy, sigma);
 }
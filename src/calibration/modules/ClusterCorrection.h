@@ -4,6 +4,7 @@
 #include "base/Detector_t.h"
 #include "base/OptionsList.h"
 #include "base/Detector_t.h"
+#include "base/CounterRNG.h"
 
 #include "tree/TID.h" // for TKeyValue, TID
 
@@ -65,6 +66,10 @@ public:
     using ClusterCorrection::ClusterCorrection;
 
     void ApplyTo(TCluster& cluster);
+
+protected:
+    // restarted for each event by Reconstruct
+    CounterRNG rng{CounterRNG::Stream_t::ClusterSmearing, static_cast<std::uint16_t>(DetectorType)};
 };
 
 /**
@@ -147,6 +152,7 @@ public:
 
 protected:
     const double sigma;
+    CounterRNG rng{CounterRNG::Stream_t::ClusterCorrSmearing, static_cast<std::uint16_t>(DetectorType)};
 };
 
 }}  // namespace ant::calibration
@@ -81,6 +81,12 @@ void ExpConfig::Setup::Cleanup()
     expconfig::SetupRegistry::Cleanup();
 }
 
+void ExpConfig::Setup::Unset()
+{
+    currentSetup = nullptr;
+    manualName = "";
+}
+
 std::list<string> ExpConfig::Setup::GetNames() {
     return expconfig::SetupRegistry::GetNames();
 }
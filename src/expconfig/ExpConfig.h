@@ -78,6 +78,12 @@ public:
         static std::list<std::string> GetNames();
         static void Cleanup();
 
+        /**
+         * @brief Unset forgets the current setup (and its name), but keeps the created setups for later use
+         * @see Cleanup also destroys the created setups
+         */
+        static void Unset();
+
         Setup() = delete; // this class is more a wrapper for handling the setup
 
     private:
@@ -115,6 +121,8 @@ public:
     virtual bool Matches(const TID& header) const = 0;
 
     virtual std::string GetName() const = 0;
+    /// the setup options (given by Ant -S) the setup was created with, flattened as key=value:...
+    virtual std::string GetOptions() const = 0;
     virtual double GetElectronBeamEnergy() const = 0;
     virtual std::list< std::shared_ptr< Calibration::PhysicsModule> > GetCalibrations() const = 0;
     virtual std::string GetPIDCutsDirectory() const = 0;
@@ -137,6 +145,22 @@ public:
         return candidatebuilder_config_t();
     }
 
+    struct taggerhits_config_t {
+        /// hits of the same channel closer than this are merged into one with the mean time, in ns, 0 disables
+        double DoubleHitWindow = 0;
+        /// hits of the same channel up to this time after a hit are dropped as after-pulses, in ns, 0 disables
+        double AfterPulseWindow = 0;
+        /// hits further than this from all prompt and random windows are dropped, in ns, NaN disables
+        /// @note the windows are defined for the tagger time corrected by the CB reference time,
+        /// but applied to the raw time, so the margin must cover the CB time window (at least 25ns)
+        double PromptRandomMargin = std_ext::NaN;
+        taggerhits_config_t() = default;
+    };
+
+    virtual taggerhits_config_t GetTaggerHitsConfig() const {
+        return taggerhits_config_t();
+    }
+
     struct triggersimu_config_t {
         enum class Type_t {
             Unknown,
@@ -2,6 +2,8 @@
 #include <cassert>
 #include "base/std_ext/container.h"
 
+#include <type_traits>
+
 #include "detail/CB_elements.h"
 
 using namespace std;
@@ -10,9 +12,21 @@ using namespace ant::expconfig::detector;
 
 
 CB::CB() :
-    ClusterDetector_t(Detector_t::Type_t::CB),
-    elements(elements_init)
+    ClusterDetector_t(Detector_t::Type_t::CB)
 {
+    // the neighbours only depend on the table, so they are shared by all instances
+    static const neighbour_table_t neighbours = [] () {
+        neighbour_table_t neighbours(std::extent<decltype(elements_table)>::value);
+        neighbours.Add(elements_table, neighbours_table);
+        return neighbours;
+    }();
+
+    elements.reserve(std::extent<decltype(elements_table)>::value);
+    for(const row_t& row : elements_table) {
+        elements.emplace_back(row.Channel, row.Position, row.ADC, row.TDC,
+                              neighbours.Get(row.Channel));
+    }
+
     std::vector<unsigned> holes;
     std_ext::insertRange(holes,  26,  26);
     std_ext::insertRange(holes,  29,  38);
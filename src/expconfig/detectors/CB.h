@@ -48,7 +48,7 @@ protected:
                 const vec3& position,
                 unsigned adc,
                 unsigned tdc,
-                const std::vector<unsigned>& neighbours
+                const neighbours_t& neighbours
                 ) :
             ClusterDetector_t::Element_t(
                 channel,
@@ -64,7 +64,20 @@ protected:
         unsigned ADC;
         unsigned TDC;
     };
-    static const std::vector<Element_t> elements_init;
+
+    // one row of the static geometry table,
+    // the neighbours are the range NeighboursBegin..NeighboursEnd of neighbours_table
+    struct row_t {
+        unsigned Channel;
+        vec3 Position;
+        unsigned ADC;
+        unsigned TDC;
+        unsigned NeighboursBegin;
+        unsigned NeighboursEnd;
+    };
+    static const row_t elements_table[];
+    static const unsigned neighbours_table[];
+
     std::vector<Element_t> elements;
 
     void SetTouchesHoleOfNeighbours(unsigned hole);
@@ -14,11 +14,82 @@
 
 #include <iostream>
 #include <cassert>
+#include <type_traits>
 
 using namespace std;
 using namespace ant;
 using namespace ant::expconfig::detector;
 
+TAPS::geometry_t::geometry_t(const BaF2_row_t* baf2s, size_t nBaF2s, const unsigned* baf2_neighbours,
+                             const PbWO4_row_t* pbwo4s, size_t nPbWO4s, const unsigned* pbwo4_neighbours) :
+    BaF2s(baf2s),
+    NBaF2s(nBaF2s),
+    PbWO4s(pbwo4s),
+    NPbWO4s(nPbWO4s),
+    Neighbours(nBaF2s+nPbWO4s)
+{
+    for(auto baf2 = BaF2s; baf2 != BaF2s+NBaF2s; ++baf2)
+        Neighbours.Add(baf2->Channel, baf2_neighbours+baf2->NeighboursBegin, baf2_neighbours+baf2->NeighboursEnd);
+    for(auto pbwo4 = PbWO4s; pbwo4 != PbWO4s+NPbWO4s; ++pbwo4)
+        Neighbours.Add(pbwo4->Channel, pbwo4_neighbours+pbwo4->NeighboursBegin, pbwo4_neighbours+pbwo4->NeighboursEnd);
+}
+
+TAPS::TAPS(bool cherenkovInstalled, bool pizzaInstalled, bool useSensitiveChannels,
+           const geometry_t& geometry) :
+    ClusterDetector_t(Detector_t::Type_t::TAPS),
+    CherenkovInstalled(cherenkovInstalled),
+    PizzaInstalled(pizzaInstalled),
+    UseSensitiveChannels(useSensitiveChannels)
+{
+    BaF2_elements.reserve(geometry.NBaF2s);
+    for(auto baf2 = geometry.BaF2s; baf2 != geometry.BaF2s+geometry.NBaF2s; ++baf2)
+        BaF2_elements.emplace_back(*baf2, geometry.Neighbours.Get(baf2->Channel));
+    PbWO4_elements.reserve(geometry.NPbWO4s);
+    for(auto pbwo4 = geometry.PbWO4s; pbwo4 != geometry.PbWO4s+geometry.NPbWO4s; ++pbwo4)
+        PbWO4_elements.emplace_back(*pbwo4, geometry.Neighbours.Get(pbwo4->Channel));
+
+    // init clusterelements from given BaF2/PbWO4 elements
+    InitClusterElements();
+}
+
+TAPS_2013_11::TAPS_2013_11(bool cherenkovInstalled, bool pizzaInstalled, bool useSensitiveChannels) :
+    TAPS(cherenkovInstalled, pizzaInstalled, useSensitiveChannels, GetGeometry())
+{}
+
+const TAPS::geometry_t& TAPS_2013_11::GetGeometry()
+{
+    // shared by all instances, as the tables are static
+    static const geometry_t geometry(
+                BaF2_table, extent<decltype(BaF2_table)>::value, BaF2_neighbours,
+                PbWO4_table, extent<decltype(PbWO4_table)>::value, PbWO4_neighbours);
+    return geometry;
+}
+
+TAPS_2009_03::TAPS_2009_03(bool cherenkovInstalled, bool useSensitiveChannels) :
+    TAPS(cherenkovInstalled, false, useSensitiveChannels, GetGeometry())
+{}
+
+const TAPS::geometry_t& TAPS_2009_03::GetGeometry()
+{
+    static const geometry_t geometry(
+                BaF2_table, extent<decltype(BaF2_table)>::value, BaF2_neighbours,
+                PbWO4_table, extent<decltype(PbWO4_table)>::value, PbWO4_neighbours);
+    return geometry;
+}
+
+TAPS_2007::TAPS_2007(bool cherenkovInstalled, bool useSensitiveChannels) :
+    TAPS(cherenkovInstalled, false, useSensitiveChannels, GetGeometry())
+{}
+
+const TAPS::geometry_t& TAPS_2007::GetGeometry()
+{
+    // no PbWO4s in this configuration
+    static const geometry_t geometry(
+                BaF2_table, extent<decltype(BaF2_table)>::value, BaF2_neighbours,
+                nullptr, 0, nullptr);
+    return geometry;
+}
+
 
 void TAPS::SetElementFlags(unsigned channel, const ElementFlags_t& flags) {
     if(flags & ElementFlag_t::Missing)
@@ -119,31 +119,52 @@ protected:
         double ToFOffset = 0;
     };
 
+    // rows of the static geometry tables, the neighbours are the range
+    // NeighboursBegin..NeighboursEnd of the corresponding neighbours table
+    struct BaF2_row_t {
+        unsigned Channel;
+        vec2 Position;
+        unsigned TAC, LG, SG, LGS, SGS;
+        unsigned NeighboursBegin, NeighboursEnd;
+    };
+
+    struct PbWO4_row_t {
+        unsigned Channel;
+        vec2 Position;
+        unsigned TDC, QDCH, QDCL;
+        unsigned NeighboursBegin, NeighboursEnd;
+    };
+
+    /**
+     * @brief The geometry_t struct refers to the static tables of one TAPS configuration,
+     * which might have no PbWO4 elements
+     */
+    struct geometry_t {
+        geometry_t(const BaF2_row_t* baf2s, std::size_t nBaF2s, const unsigned* baf2_neighbours,
+                   const PbWO4_row_t* pbwo4s, std::size_t nPbWO4s, const unsigned* pbwo4_neighbours);
+        const BaF2_row_t* const BaF2s;
+        const std::size_t NBaF2s;
+        const PbWO4_row_t* const PbWO4s;
+        const std::size_t NPbWO4s;
+        neighbour_table_t Neighbours;
+    };
+
     struct BaF2_Element_t : TAPS_Element_t {
-        BaF2_Element_t(
-                unsigned channel,
-                const vec2& pos_xy,
-                unsigned tac,
-                unsigned lg,
-                unsigned sg,
-                unsigned lgs,
-                unsigned sgs,
-                const std::vector<unsigned>& neighbours // as last column since it's a messy list of numbers
-                ) :
+        BaF2_Element_t(const BaF2_row_t& row, const neighbours_t& neighbours) :
             TAPS_Element_t(
-                channel,
-                vec3(pos_xy.x, pos_xy.y, // z-component set by BuildClusterElements()
+                row.Channel,
+                vec3(row.Position, // z-component set by InitClusterElements()
                      std::numeric_limits<double>::quiet_NaN()),
                 neighbours,
                 3.4, /// \todo use best value from S. Lohse diploma thesis?
                 13.7, // critical energy
                 2.026 // radiation length
                 ),
-            TAC(tac),
-            LG(lg),
-            SG(sg),
-            LGS(lgs),
-            SGS(sgs)
+            TAC(row.TAC),
+            LG(row.LG),
+            SG(row.SG),
+            LGS(row.LGS),
+            SGS(row.SGS)
         {}
         unsigned TAC; // timing
         unsigned LG;  // integral, long gate
@@ -153,26 +174,19 @@ protected:
     };
 
     struct PbWO4_Element_t : TAPS_Element_t {
-        PbWO4_Element_t(
-                unsigned channel,
-                const vec2& pos_xy,
-                unsigned tdc,
-                unsigned qdch,
-                unsigned qdcl,
-                const std::vector<unsigned>& neighbours // as last column since it's a messy list of numbers
-                ) :
+        PbWO4_Element_t(const PbWO4_row_t& row, const neighbours_t& neighbours) :
             TAPS_Element_t(
-                channel,
-                vec3(pos_xy.x, pos_xy.y, // z-component set by InitClusterElements()
+                row.Channel,
+                vec3(row.Position, // z-component set by InitClusterElements()
                      std::numeric_limits<double>::quiet_NaN()),
                 neighbours,
                 2.2, /// \todo use best value from S. Lohse diploma thesis?
                 9.6, // critical energy
                 0.89 // radiation length
                 ),
-            TDC(tdc),
-            QDCH(qdch),
-            QDCL(qdcl)
+            TDC(row.TDC),
+            QDCH(row.QDCH),
+            QDCL(row.QDCL)
         {}
         unsigned TDC;  // timing
         unsigned QDCH; // integral
@@ -183,19 +197,8 @@ protected:
             bool cherenkovInstalled,
             bool pizzaInstalled,
             bool useSensitiveChannels,
-            const std::vector<BaF2_Element_t>& BaF2s,
-            const std::vector<PbWO4_Element_t>& PbWO4s
-            ) :
-        ClusterDetector_t(Detector_t::Type_t::TAPS),
-        CherenkovInstalled(cherenkovInstalled),
-        PizzaInstalled(pizzaInstalled),
-        UseSensitiveChannels(useSensitiveChannels),
-        BaF2_elements(BaF2s),
-        PbWO4_elements(PbWO4s)
-    {
-        // init clusterelements from given BaF2/PbWO4 elements
-        InitClusterElements();
-    }
+            const geometry_t& geometry
+            );
 
 
 private:
@@ -204,7 +207,7 @@ private:
     bool PizzaInstalled;  // TAPS moves downstream as well if the Pizza detector is installed
     bool UseSensitiveChannels; // Use sensitive channels as main integral
 
-    // given from derived class in constructor,
+    // built from the geometry given by the derived class,
     // depending on the base class, the PbWO4_elements might be empty
     std::vector<BaF2_Element_t>  BaF2_elements;
     std::vector<PbWO4_Element_t> PbWO4_elements;
@@ -222,14 +225,14 @@ struct TAPS_2013_11 : TAPS {
             bool cherenkovInstalled,
             bool pizzaInstalled,  // Pizza is only available starting with this configuration
             bool useSensitiveChannels
-            ) :
-        TAPS(cherenkovInstalled, pizzaInstalled, useSensitiveChannels,
-             BaF2_elements_init, PbWO4_elements_init)
-    {}
+            );
 
 private:
-    const static std::vector<BaF2_Element_t>  BaF2_elements_init;
-    const static std::vector<PbWO4_Element_t> PbWO4_elements_init;
+    static const geometry_t& GetGeometry();
+    static const BaF2_row_t  BaF2_table[];
+    static const unsigned    BaF2_neighbours[];
+    static const PbWO4_row_t PbWO4_table[];
+    static const unsigned    PbWO4_neighbours[];
 
 }; // TAPS_2013_11
 
@@ -237,14 +240,14 @@ struct TAPS_2009_03 : TAPS {
     TAPS_2009_03(
             bool cherenkovInstalled,
             bool useSensitiveChannels
-            ) :
-        TAPS(cherenkovInstalled, false, useSensitiveChannels,
-             BaF2_elements_init, PbWO4_elements_init)
-    {}
+            );
 
 private:
-    const static std::vector<BaF2_Element_t>  BaF2_elements_init;
-    const static std::vector<PbWO4_Element_t> PbWO4_elements_init;
+    static const geometry_t& GetGeometry();
+    static const BaF2_row_t  BaF2_table[];
+    static const unsigned    BaF2_neighbours[];
+    static const PbWO4_row_t PbWO4_table[];
+    static const unsigned    PbWO4_neighbours[];
 
 }; // TAPS_2009_03
 
@@ -252,13 +255,12 @@ struct TAPS_2007 : TAPS {
     TAPS_2007(
             bool cherenkovInstalled,
             bool useSensitiveChannels
-            ) :
-        TAPS(cherenkovInstalled, false, useSensitiveChannels,
-             BaF2_elements_init, {})
-    {}
+            );
 
 private:
-    const static std::vector<BaF2_Element_t>  BaF2_elements_init;
+    static const geometry_t& GetGeometry();
+    static const BaF2_row_t  BaF2_table[];
+    static const unsigned    BaF2_neighbours[];
 
 }; // TAPS_2007
 
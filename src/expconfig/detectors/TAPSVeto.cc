@@ -1,5 +1,6 @@
 #include "TAPSVeto.h"
 #include <cassert>
+#include <type_traits>
 
 #include "tree/TID.h"
 
@@ -15,6 +16,43 @@ using namespace std;
 using namespace ant;
 using namespace ant::expconfig::detector;
 
+TAPSVeto::TAPSVeto(bool cherenkovInstalled, bool pizzaInstalled,
+                   const BaF2_row_t* BaF2s, size_t nBaF2s,
+                   const PbWO4_row_t* PbWO4s, size_t nPbWO4s) :
+    Detector_t(Detector_t::Type_t::TAPSVeto),
+    CherenkovInstalled(cherenkovInstalled),
+    PizzaInstalled(pizzaInstalled),
+    BaF2_elements(BaF2s, BaF2s+nBaF2s),
+    PbWO4_elements(PbWO4s, PbWO4s+nPbWO4s)
+{
+    // init clusterelements from given BaF2/PbWO4 elements
+    InitElements();
+}
+
+TAPSVeto_2014::TAPSVeto_2014(bool cherenkovInstalled, bool pizzaInstalled) :
+    TAPSVeto(cherenkovInstalled, pizzaInstalled,
+             BaF2_table, extent<decltype(BaF2_table)>::value,
+             PbWO4_table, extent<decltype(PbWO4_table)>::value)
+{}
+
+TAPSVeto_2013_11::TAPSVeto_2013_11(bool cherenkovInstalled) :
+    TAPSVeto(cherenkovInstalled, false,
+             BaF2_table, extent<decltype(BaF2_table)>::value,
+             PbWO4_table, extent<decltype(PbWO4_table)>::value)
+{}
+
+TAPSVeto_2009_03::TAPSVeto_2009_03(bool cherenkovInstalled) :
+    TAPSVeto(cherenkovInstalled, false,
+             BaF2_table, extent<decltype(BaF2_table)>::value,
+             PbWO4_table, extent<decltype(PbWO4_table)>::value)
+{}
+
+TAPSVeto_2007::TAPSVeto_2007(bool cherenkovInstalled) :
+    TAPSVeto(cherenkovInstalled, false,
+             BaF2_table, extent<decltype(BaF2_table)>::value,
+             nullptr, 0)
+{}
+
 void TAPSVeto::BuildMappings(vector<UnpackerAcquConfig::hit_mapping_t> &hit_mappings,
                              vector<UnpackerAcquConfig::scaler_mapping_t>&) const {
     for(const BaF2_Element_t& element : BaF2_elements)  {
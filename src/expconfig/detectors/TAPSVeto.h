@@ -50,41 +50,46 @@ protected:
 
     using TAPSVeto_Element_t = Detector_t::Element_t;
 
+    // rows of the static geometry tables
+    struct BaF2_row_t {
+        unsigned Channel;
+        vec2 Position;
+        unsigned TAC;
+        unsigned LGS; // only sensitive for BaF2 Veto
+    };
+
+    struct PbWO4_row_t {
+        unsigned Channel;
+        vec2 Position;
+        unsigned TDC;  // timing
+        unsigned QDCH; // integral
+        unsigned QDCL; // integral, sensitive?
+    };
+
     struct BaF2_Element_t : TAPSVeto_Element_t {
-        BaF2_Element_t(
-                unsigned channel,
-                const vec2& pos_xy,
-                unsigned tac,
-                unsigned lgs // only sensitive for BaF2 Veto
-                ) :
+        explicit BaF2_Element_t(const BaF2_row_t& row) :
             TAPSVeto_Element_t(
-                channel,
-                vec3(pos_xy.x, pos_xy.y, // z-component set by InitElements()
+                row.Channel,
+                vec3(row.Position, // z-component set by InitElements()
                      std::numeric_limits<double>::quiet_NaN())
                 ),
-            TAC(tac),
-            LGS(lgs)
+            TAC(row.TAC),
+            LGS(row.LGS)
         {}
         unsigned TAC;
         unsigned LGS;
     };
 
     struct PbWO4_Element_t : TAPSVeto_Element_t {
-      PbWO4_Element_t(
-          unsigned channel,
-          const vec2& pos_xy,
-          unsigned tdc,
-          unsigned qdch,
-          unsigned qdcl
-          ) :
+      explicit PbWO4_Element_t(const PbWO4_row_t& row) :
         TAPSVeto_Element_t(
-          channel,
-          vec3(pos_xy.x, pos_xy.y, // z-component set by InitClusterElements()
+          row.Channel,
+          vec3(row.Position, // z-component set by InitElements()
                std::numeric_limits<double>::quiet_NaN())
           ),
-        TDC(tdc),
-        QDCH(qdch),
-        QDCL(qdcl)
+        TDC(row.TDC),
+        QDCH(row.QDCH),
+        QDCL(row.QDCL)
       {}
       unsigned TDC;  // timing
       unsigned QDCH; // integral
@@ -94,17 +99,8 @@ protected:
     TAPSVeto(
             bool cherenkovInstalled,
             bool pizzaInstalled,
-            const std::vector<BaF2_Element_t>& BaF2s,
-            const std::vector<PbWO4_Element_t>& PbWO4s) :
-        Detector_t(Detector_t::Type_t::TAPSVeto),
-        CherenkovInstalled(cherenkovInstalled),
-        PizzaInstalled(pizzaInstalled),
-        BaF2_elements(BaF2s),
-        PbWO4_elements(PbWO4s)
-    {
-        // init clusterelements from given BaF2/PbWO4 elements
-        InitElements();
-    }
+            const BaF2_row_t* BaF2s, std::size_t nBaF2s,
+            const PbWO4_row_t* PbWO4s, std::size_t nPbWO4s);
 
 
 
@@ -113,7 +109,7 @@ private:
     bool CherenkovInstalled;  // TAPS detectors moves downstream if Cherenkov installed
     bool PizzaInstalled;  // TAPS moves downstream as well if the Pizza detector is installed
 
-    // given from derived class in constructor
+    // built from the tables given by the derived class in constructor
     std::vector<BaF2_Element_t>  BaF2_elements;
     std::vector<PbWO4_Element_t> PbWO4_elements;
 
@@ -127,89 +123,40 @@ struct TAPSVeto_2014 : TAPSVeto {
     TAPSVeto_2014(
             bool cherenkovInstalled,
             bool pizzaInstalled  // Pizza is only available starting with this configuration
-            ) :
-        TAPSVeto(cherenkovInstalled, pizzaInstalled,
-                 BaF2_elements_init, PbWO4_elements_init)
-    {}
-
-protected:
-    TAPSVeto_2014(
-            bool cherenkovInstalled,
-            bool pizzaInstalled,
-            const std::vector<BaF2_Element_t>& BaF2s
-            ) :
-        TAPSVeto(cherenkovInstalled, pizzaInstalled,
-                 BaF2s, PbWO4_elements_init)
-    {}
+            );
 
 private:
-    const static std::vector<BaF2_Element_t>  BaF2_elements_init;
-    const static std::vector<PbWO4_Element_t> PbWO4_elements_init;
+    static const BaF2_row_t  BaF2_table[];
+    static const PbWO4_row_t PbWO4_table[];
 };
 
 struct TAPSVeto_2013_11 : TAPSVeto {
     TAPSVeto_2013_11(
             bool cherenkovInstalled
-            ) :
-        TAPSVeto(cherenkovInstalled, false,
-                 BaF2_elements_init, PbWO4_elements_init)
-    {}
-
-protected:
-    TAPSVeto_2013_11(
-            bool cherenkovInstalled,
-            const std::vector<BaF2_Element_t>& BaF2s
-            ) :
-        TAPSVeto(cherenkovInstalled, false,
-                 BaF2s, PbWO4_elements_init)
-    {}
+            );
 
 private:
-    const static std::vector<BaF2_Element_t>  BaF2_elements_init;
-    const static std::vector<PbWO4_Element_t> PbWO4_elements_init;
+    static const BaF2_row_t  BaF2_table[];
+    static const PbWO4_row_t PbWO4_table[];
 };
 
 struct TAPSVeto_2009_03 : TAPSVeto {
     TAPSVeto_2009_03(
             bool cherenkovInstalled
-            ) :
-        TAPSVeto(cherenkovInstalled, false,
-                 BaF2_elements_init, PbWO4_elements_init)
-    {}
-
-protected:
-    TAPSVeto_2009_03(
-            bool cherenkovInstalled,
-            const std::vector<BaF2_Element_t>& BaF2s
-            ) :
-        TAPSVeto(cherenkovInstalled, false,
-                 BaF2s, PbWO4_elements_init)
-    {}
+            );
 
 private:
-    const static std::vector<BaF2_Element_t>  BaF2_elements_init;
-    const static std::vector<PbWO4_Element_t> PbWO4_elements_init;
+    static const BaF2_row_t  BaF2_table[];
+    static const PbWO4_row_t PbWO4_table[];
 };
 
 struct TAPSVeto_2007: TAPSVeto {
     TAPSVeto_2007(
             bool cherenkovInstalled
-            ) :
-        TAPSVeto(cherenkovInstalled, false,
-                 BaF2_elements_init, {})
-    {}
-
-protected:
-    TAPSVeto_2007(
-            bool cherenkovInstalled,
-            const std::vector<BaF2_Element_t>& BaF2s
-            ) :
-        TAPSVeto(cherenkovInstalled, false,
-                 BaF2s, {})
-    {}
+            );
 
 private:
-    const static std::vector<BaF2_Element_t>  BaF2_elements_init;
+    static const BaF2_row_t  BaF2_table[];
 };
 
 
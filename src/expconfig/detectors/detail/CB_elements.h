@@ -2,727 +2,1450 @@
 // generated with expconfig/tools/convert_acqucfg_cb.pl
 // from acqu_user/data.general/Detector-NaI.dat
 #include "detectors/CB.h"
-const std::vector<ant::expconfig::detector::CB::Element_t>
-ant::expconfig::detector::CB::elements_init = {
-  // element number, {xyz}, ADC, TDC, {neigbours}
-  {  0, {  3.619000,  45.214000,   2.629000}, 3015, 2032, {1,144,576,145,577,432,579,2,3,146,288}},
-  {  1, {  7.322000,  44.510000,   5.320000}, 3014, 2033, {0,2,3,5,6,4,146,145,144,576,577,579}},
-  {  2, {  6.266000,  43.725000,  10.577000}, 3013, 2034, {5,1,579,0,576,580,577,624,8,6,4,3}},
-  {  3, { 11.996000,  43.725000,   2.690000}, 3012, 2035, {4,146,1,149,144,0,2,5,6,48,152,145}},
-  {  4, { 15.678000,  42.290000,   5.346000}, 3011, 2036, {3,6,48,7,50,49,152,149,146,1,2,5}},
-  {  5, {  9.929000,  42.290000,  13.258000}, 3010, 2037, {2,8,6,9,11,7,4,3,1,579,580,624}},
-  {  6, { 14.668000,  41.639000,  10.656000}, 3009, 2038, {7,4,5,3,1,2,8,9,11,50,49,48}},
-  {  7, { 18.449000,  39.214000,  13.403000}, 3008, 2039, {6,11,50,12,56,53,49,48,4,5,8,9}},
-  {  8, {  8.702000,  40.717000,  18.188000}, 3007, 2040, {9,5,624,2,579,625,580,627,10,11,7,6}},
-  {  9, { 12.374000,  38.342000,  20.896000}, 3006, 2041, {8,10,11,13,14,12,7,6,5,624,625,627}},
-  { 10, { 11.018000,  36.086000,  25.316000}, 3005, 2042, {13,9,627,8,624,628,625,672,16,14,12,11}},
-  { 11, { 17.383000,  37.488000,  18.714000}, 3004, 2043, {12,7,9,6,5,8,10,13,14,56,53,50}},
-  { 12, { 21.037000,  34.038000,  21.369000}, 3003, 2044, {11,14,56,15,58,57,53,50,7,9,10,13}},
-  { 13, { 14.607000,  32.935000,  27.654000}, 3002, 2045, {10,16,14,17,19,15,12,11,9,627,628,672}},
-  { 14, { 19.617000,  31.740000,  25.890000}, 3001, 2046, {15,12,13,11,9,10,16,17,19,58,57,56}},
-  { 15, { 22.927000,  27.792000,  27.654000}, 3000, 2047, {14,19,58,20,64,61,57,56,12,13,16,17}},
-  { 16, { 12.987000,  30.283000,  31.262000}, 3031, 2048, {17,13,672,10,627,673,628,675,18,19,15,14}},
-  { 17, { 16.350000,  26.454000,  33.106000}, 3030, 2049, {16,18,19,21,22,20,15,14,13,672,673,675}},
-  { 18, { 14.498000,  23.456000,  36.111000}, 3029, 2050, {21,17,675,16,676,673,20,24,22,672,19}},
-  { 19, { 21.279000,  25.158000,  31.262000}, 3028, 2051, {20,15,17,14,13,16,18,21,22,64,61,58}},
-  { 20, { 23.567000,  20.582000,  32.925000}, 3027, 2052, {19,22,64,23,66,65,61,58,15,17,18,21}},
-  { 21, { 16.733000,  18.985000,  37.736000}, 3026, 2053, {18,24,22,25,23,20,19,17,675,27,676}},
-  { 22, { 20.874000,  17.405000,  36.394000}, 3025, 2054, {23,20,21,19,17,18,24,25,27,66,65,64}},
-  { 23, { 21.983000,  12.290000,  37.799000}, 3024, 2055, {22,27,66,28,72,69,65,64,20,21,24,25}},
-  { 24, { 13.115000,  16.220000,  40.364000}, 3023, 2056, {25,21,676,18,675,678,679,26,27,23,22}},
-  { 25, { 13.553000,  11.811000,  41.713000}, 3022, 2057, {24,26,27,29,30,28,23,22,21,676,678,679}},
-  { 26, {  9.010000,   9.460000,  43.502000}, 3021, 2058, {29,25,679,24,676,678,683,684,32,30,28,27}},
-  { 27, { 18.281000,   9.460000,  40.489000}, 3020, 2059, {28,23,25,22,21,24,26,29,30,72,69,66}},
-  { 28, { 18.526000,   4.758000,  41.194000}, 3019, 2060, {27,30,72,31,74,73,69,66,23,25,26,29}},
-  { 29, {  9.225000,   4.758000,  44.216000}, 3018, 2061, {26,32,30,33,35,31,28,27,25,679,683,684}},
-  { 30, { 14.014000,   2.406000,  43.132000}, 3017, 2062, {31,28,29,27,25,26,32,33,35,74,73,72}},
-  { 31, { 13.990000,  -2.859000,  43.057000}, 3016, 2063, {30,35,74,36,80,77,73,72,28,29,32,33}},
-  { 32, {  4.574000,   2.351000,  45.145000}, 3047, 2064, {33,29,684,26,679,683,686,687,34,35,31,30}},
-  { 33, {  4.518000,  -2.793000,  45.074000}, 3046, 2065, {32,34,35,37,38,36,31,30,29,684,686,687}},
-  { 34, { -0.057000,  -5.144000,  45.145000}, 3045, 2066, {37,33,687,32,684,686,691,692,40,38,36,35}},
-  { 35, {  9.143000,  -5.651000,  44.071000}, 3044, 2067, {36,31,33,30,29,32,34,37,38,80,77,74}},
-  { 36, {  8.814000, -11.234000,  43.057000}, 3043, 2068, {35,38,80,39,82,81,77,74,31,33,34,37}},
-  { 37, { -0.130000, -10.379000,  44.216000}, 3042, 2069, {34,40,38,41,43,39,36,35,33,687,691,692}},
-  { 38, {  4.115000, -13.612000,  43.132000}, 3041, 2070, {39,36,37,35,33,34,40,41,43,82,81,80}},
-  { 39, {  4.030000, -18.699000,  41.194000}, 3040, 2071, {38,43,82,44,88,85,81,80,36,37,40,41}},
-  { 40, { -4.432000, -12.290000,  43.502000}, 3039, 2072, {41,37,692,34,687,691,694,695,42,43,39,38}},
-  { 41, { -4.503000, -17.405000,  41.713000}, 3038, 2073, {40,42,43,45,46,44,39,38,37,692,694,695}},
-  { 42, { -8.643000, -18.985000,  40.364000}, 3037, 2074, {45,41,695,40,694,699,44,700,46,692,43}},
-  { 43, { -0.286000, -20.582000,  40.490000}, 3036, 2075, {44,39,41,38,37,40,42,45,46,88,85,82}},
-  { 44, { -1.160000, -25.158000,  37.799000}, 3035, 2076, {43,46,88,47,90,89,85,82,39,41,42,45}},
-  { 45, { -9.497000, -23.456000,  37.736000}, 3034, 2077, {42,700,46,699,47,44,43,41,695,703,702}},
-  { 46, { -6.231000, -26.454000,  36.394000}, 3033, 2078, {47,44,45,43,41,42,700,702,703,90,89,88}},
-  { 47, { -7.868000, -30.283000,  32.925000}, 3032, 2079, {46,703,90,702,708,93,89,88,44,45,700,707}},
-  { 48, { 19.987000,  40.717000,   2.655000}, 3063, 2080, {49,152,4,153,146,3,6,7,50,51,154,149}},
-  { 49, { 23.697000,  38.342000,   5.311000}, 3062, 2081, {48,50,51,53,54,52,154,153,152,4,6,7}},
-  { 50, { 23.170000,  37.488000,  10.749000}, 3061, 2082, {53,49,7,48,4,6,11,12,56,54,52,51}},
-  { 51, { 27.482000,  36.086000,   2.655000}, 3060, 2083, {52,154,49,157,152,48,50,53,54,96,160,153}},
-  { 52, { 30.814000,  32.935000,   5.346000}, 3059, 2084, {51,54,96,55,98,97,160,157,154,49,50,53}},
-  { 53, { 26.824000,  34.038000,  13.403000}, 3058, 2085, {50,56,54,57,59,55,52,51,49,7,11,12}},
-  { 54, { 30.685000,  31.740000,  10.656000}, 3057, 2086, {55,52,53,51,49,50,56,57,59,98,97,96}},
-  { 55, { 33.386000,  27.792000,  13.259000}, 3056, 2087, {54,59,98,60,104,101,97,96,52,53,56,57}},
-  { 56, { 25.758000,  32.312000,  18.714000}, 3055, 2088, {57,53,12,50,7,11,14,15,58,59,55,54}},
-  { 57, { 28.762000,  28.214000,  20.896000}, 3054, 2089, {56,58,59,61,62,60,55,54,53,12,14,15}},
-  { 58, { 27.350000,  25.992000,  25.315000}, 3053, 2090, {61,57,15,56,12,14,19,20,64,62,60,59}},
-  { 59, { 32.528000,  25.992000,  18.188000}, 3052, 2091, {60,55,57,54,53,56,58,61,62,104,101,98}},
-  { 60, { 34.786000,  21.475000,  19.829000}, 3051, 2092, {59,62,104,63,106,105,101,98,55,57,58,61}},
-  { 61, { 29.608000,  21.475000,  26.957000}, 3050, 2093, {58,64,62,65,67,63,60,59,57,15,19,20}},
-  { 62, { 33.278000,  19.180000,  24.178000}, 3049, 2094, {63,60,61,59,57,58,64,65,67,106,105,104}},
-  { 63, { 34.900000,  14.027000,  25.357000}, 3048, 2095, {62,67,106,68,112,109,105,104,60,61,64,65}},
-  { 64, { 27.473000,  18.699000,  30.958000}, 3079, 2096, {65,61,20,58,15,19,22,23,66,67,63,62}},
-  { 65, { 28.681000,  13.612000,  32.476000}, 3078, 2097, {64,66,67,69,70,68,63,62,61,20,22,23}},
-  { 66, { 25.884000,  10.379000,  35.848000}, 3077, 2098, {69,65,23,64,20,22,27,28,72,70,68,67}},
-  { 67, { 32.438000,  11.234000,  29.653000}, 3076, 2099, {68,63,65,62,61,64,66,69,70,112,109,106}},
-  { 68, { 33.301000,   5.651000,  30.280000}, 3075, 2100, {67,70,112,71,114,113,109,106,63,65,66,69}},
-  { 69, { 26.488000,   5.144000,  36.557000}, 3074, 2101, {66,72,70,73,75,71,68,67,65,23,27,28}},
-  { 70, { 30.148000,   2.793000,  33.810000}, 3073, 2102, {71,68,69,67,65,66,72,73,75,114,113,112}},
-  { 71, { 30.235000,  -2.351000,  33.834000}, 3072, 2103, {70,75,114,76,120,117,113,112,68,69,72,73}},
-  { 72, { 22.835000,   2.351000,  39.211000}, 3071, 2104, {73,69,28,66,23,27,30,31,74,75,71,70}},
-  { 73, { 22.839000,  -2.793000,  39.121000}, 3070, 2105, {72,74,75,77,78,76,71,70,69,28,30,31}},
-  { 74, { 18.507000,  -5.651000,  41.028000}, 3069, 2106, {77,73,31,72,28,30,35,36,80,78,76,75}},
-  { 75, { 26.582000,  -5.144000,  36.489000}, 3068, 2107, {76,71,73,70,69,72,74,77,78,120,117,114}},
-  { 76, { 26.095000, -10.379000,  35.696000}, 3067, 2108, {75,78,120,79,122,121,117,114,71,73,74,77}},
-  { 77, { 18.178000, -11.234000,  40.014000}, 3066, 2109, {74,80,78,81,83,79,76,75,73,31,35,36}},
-  { 78, { 22.023000, -13.612000,  37.313000}, 3065, 2110, {79,76,77,75,73,74,80,81,83,122,121,120}},
-  { 79, { 20.953000, -18.699000,  35.695000}, 3064, 2111, {78,83,122,84,128,125,121,120,76,77,80,81}},
-  { 80, { 13.331000, -14.027000,  41.028000}, 3095, 2112, {81,77,36,74,31,35,38,39,82,83,79,78}},
-  { 81, { 12.711000, -19.180000,  39.121000}, 3094, 2113, {80,82,83,85,86,84,79,78,77,36,38,39}},
-  { 82, {  8.109000, -21.475000,  39.212000}, 3093, 2114, {85,81,39,80,36,38,43,44,88,86,84,83}},
-  { 83, { 16.488000, -21.475000,  36.489000}, 3092, 2115, {84,79,81,78,77,80,82,85,86,128,125,122}},
-  { 84, { 15.625000, -25.992000,  33.834000}, 3091, 2116, {83,86,128,87,130,129,125,122,79,81,82,85}},
-  { 85, {  7.246000, -25.992000,  36.556000}, 3090, 2117, {82,88,86,89,91,87,84,83,81,39,43,44}},
-  { 86, { 10.986000, -28.214000,  33.811000}, 3089, 2118, {87,84,85,83,81,82,88,89,91,130,129,128}},
-  { 87, {  9.839000, -32.312000,  30.280000}, 3088, 2119, {86,91,130,92,136,133,129,128,84,85,88,89}},
-  { 88, {  2.293000, -27.792000,  35.849000}, 3087, 2120, {89,85,44,82,39,43,46,47,90,91,87,86}},
-  { 89, {  0.653000, -31.740000,  32.476000}, 3086, 2121, {88,90,91,93,94,92,87,86,85,44,46,47}},
-  { 90, { -4.437000, -32.935000,  30.958000}, 3085, 2122, {93,89,47,88,44,46,703,707,708,94,92,91}},
-  { 91, {  4.459000, -34.038000,  29.653000}, 3084, 2123, {92,87,89,86,85,88,90,93,94,136,133,130}},
-  { 92, {  3.063000, -37.488000,  25.357000}, 3083, 2124, {91,94,136,95,138,137,133,130,87,89,90,93}},
-  { 93, { -5.967000, -36.086000,  26.957000}, 3082, 2125, {90,708,94,707,711,95,92,91,89,47,703,710}},
-  { 94, { -2.271000, -38.342000,  24.178000}, 3081, 2126, {95,92,93,91,89,90,708,710,711,138,137,136}},
-  { 95, { -3.651000, -40.717000,  19.829000}, 3080, 2127, {94,711,138,710,716,141,137,136,92,93,708,715}},
-  { 96, { 33.745000,  30.283000,   2.691000}, 3111, 2128, {97,160,52,161,154,51,54,55,98,99,162,157}},
-  { 97, { 36.539000,  26.454000,   5.319000}, 3110, 2129, {96,98,99,101,102,100,162,161,160,52,54,55}},
-  { 98, { 36.308000,  25.158000,  10.577000}, 3109, 2130, {101,97,55,96,52,54,59,60,104,102,100,99}},
-  { 99, { 38.824000,  23.456000,   2.629000}, 3108, 2131, {100,162,97,165,96,98,101,102,168,160,161}},
-  {100, { 41.059000,  18.985000,   4.254000}, 3107, 2132, {99,102,168,103,169,165,98,162,97,170,101}},
-  {101, { 38.596000,  20.582000,  12.240000}, 3106, 2133, {98,104,102,105,107,103,100,99,97,55,59,60}},
-  {102, { 41.062000,  17.405000,   8.607000}, 3105, 2134, {103,100,101,99,97,98,104,105,107,170,169,168}},
-  {103, { 42.742000,  12.290000,   9.228000}, 3104, 2135, {102,107,170,108,176,173,169,168,100,101,104,105}},
-  {104, { 37.932000,  18.699000,  16.562000}, 3103, 2136, {105,101,60,98,55,59,62,63,106,107,103,102}},
-  {105, { 39.749000,  13.612000,  17.242000}, 3102, 2137, {104,106,107,109,110,108,103,102,101,60,62,63}},
-  {106, { 38.225000,  11.234000,  21.688000}, 3101, 2138, {109,105,63,104,60,62,67,68,112,110,108,107}},
-  {107, { 42.092000,  10.379000,  13.540000}, 3100, 2139, {108,103,105,102,101,104,106,109,110,176,173,170}},
-  {108, { 42.952000,   5.144000,  13.896000}, 3099, 2140, {107,110,176,111,178,177,173,170,103,105,106,109}},
-  {109, { 39.088000,   5.651000,  22.314000}, 3098, 2141, {106,112,110,113,115,111,108,107,105,63,67,68}},
-  {110, { 41.471000,   2.793000,  18.226000}, 3097, 2142, {111,108,109,107,105,106,112,113,115,178,177,176}},
-  {111, { 41.521000,  -2.351000,  18.301000}, 3096, 2143, {110,115,178,116,184,181,177,176,108,109,112,113}},
-  {112, { 36.626000,   2.859000,  26.611000}, 3127, 2144, {113,109,68,106,63,67,70,71,114,115,111,110}},
-  {113, { 36.690000,  -2.406000,  26.657000}, 3126, 2145, {112,114,115,117,118,116,111,110,109,68,70,71}},
-  {114, { 33.452000,  -4.758000,  30.349000}, 3125, 2146, {117,113,71,112,68,70,75,76,120,118,116,115}},
-  {115, { 39.201000,  -4.758000,  22.437000}, 3124, 2147, {116,111,113,110,109,112,114,117,118,184,181,178}},
-  {116, { 38.588000,  -9.460000,  22.012000}, 3123, 2148, {115,118,184,119,186,185,181,178,111,113,114,117}},
-  {117, { 32.858000,  -9.460000,  29.898000}, 3122, 2149, {114,120,118,121,123,119,116,115,113,71,75,76}},
-  {118, { 35.482000, -11.811000,  25.780000}, 3121, 2150, {119,116,117,115,113,114,120,121,123,186,185,184}},
-  {119, { 34.335000, -16.220000,  24.947000}, 3120, 2151, {118,123,186,124,189,185,184,116,117,120,121}},
-  {120, { 29.155000, -12.290000,  32.589000}, 3119, 2152, {121,117,76,114,71,75,78,79,122,123,119,118}},
-  {121, { 28.162000, -17.405000,  31.100000}, 3118, 2153, {120,122,123,125,126,124,119,118,117,76,78,79}},
-  {122, { 24.031000, -20.582000,  32.589000}, 3117, 2154, {125,121,79,120,76,78,83,84,128,126,124,123}},
-  {123, { 30.718000, -18.985000,  27.575000}, 3116, 2155, {124,119,121,118,120,122,125,126,189,117,186}},
-  {124, { 29.864000, -23.456000,  24.947000}, 3115, 2156, {123,126,189,127,186,190,122,119,121,191,125}},
-  {125, { 23.157000, -25.158000,  29.898000}, 3114, 2157, {122,128,126,129,131,127,124,123,121,79,83,84}},
-  {126, { 26.434000, -26.454000,  25.780000}, 3113, 2158, {127,124,125,123,121,122,128,129,131,191,190,189}},
-  {127, { 25.719000, -30.283000,  22.012000}, 3112, 2159, {126,131,191,132,237,190,234,189,124,125,128,129}},
-  {128, { 19.216000, -27.792000,  30.350000}, 3143, 2160, {129,125,84,122,79,83,86,87,130,131,127,126}},
-  {129, { 18.561000, -31.740000,  26.657000}, 3142, 2161, {128,130,131,133,134,132,127,126,125,84,86,87}},
-  {130, { 13.823000, -34.038000,  26.610000}, 3141, 2162, {133,129,87,128,84,86,91,92,136,134,132,131}},
-  {131, { 21.787000, -32.935000,  22.437000}, 3140, 2163, {132,127,129,126,125,128,130,133,134,237,234,191}},
-  {132, { 20.672000, -36.086000,  18.301000}, 3139, 2164, {131,134,237,135,239,234,238,191,127,129,130,133}},
-  {133, { 12.427000, -37.488000,  22.315000}, 3138, 2165, {130,136,134,137,139,135,132,131,129,87,91,92}},
-  {134, { 16.050000, -38.342000,  18.226000}, 3137, 2166, {135,132,133,131,129,130,136,137,139,239,238,237}},
-  {135, { 14.609000, -40.717000,  13.896000}, 3136, 2167, {134,139,239,140,285,238,282,237,132,133,136,137}},
-  {136, {  7.047000, -39.214000,  21.687000}, 3135, 2168, {137,133,92,130,87,91,94,95,138,139,135,134}},
-  {137, {  5.603000, -41.639000,  17.243000}, 3134, 2169, {136,138,139,141,142,140,135,134,133,92,94,95}},
-  {138, {  0.240000, -42.290000,  16.562000}, 3133, 2170, {141,137,95,136,92,94,711,715,716,142,140,139}},
-  {139, {  9.541000, -42.290000,  13.540000}, 3132, 2171, {140,135,137,134,133,136,138,141,142,285,282,239}},
-  {140, {  8.123000, -43.725000,   9.227000}, 3131, 2172, {139,142,285,143,287,282,286,239,135,137,138,141}},
-  {141, { -1.148000, -43.725000,  12.240000}, 3130, 2173, {138,716,142,715,719,143,140,139,137,95,711,718}},
-  {142, {  2.797000, -44.510000,   8.608000}, 3129, 2174, {143,140,141,139,137,138,716,718,719,287,286,285}},
-  {143, {  1.382000, -45.214000,   4.254000}, 3128, 2175, {142,719,287,718,286,431,285,140,141,716,575}},
-  {144, {  3.619000,  45.214000,  -2.629000}, 3159, 2176, {145,288,0,289,1,576,3,146,147,290,432}},
-  {145, {  7.322000,  44.510000,  -5.320000}, 3158, 2177, {144,146,147,149,150,148,290,289,288,0,1,3}},
-  {146, { 11.996000,  43.725000,  -2.690000}, 3157, 2178, {149,145,3,144,0,4,1,48,152,150,148,147}},
-  {147, {  6.266000,  43.725000, -10.577000}, 3156, 2179, {148,290,145,293,288,144,146,149,150,192,296,289}},
-  {148, {  9.929000,  42.290000, -13.258000}, 3155, 2180, {147,150,192,151,194,193,296,293,290,145,146,149}},
-  {149, { 15.678000,  42.290000,  -5.346000}, 3154, 2181, {146,152,150,153,155,151,148,147,145,3,4,48}},
-  {150, { 14.668000,  41.639000, -10.656000}, 3153, 2182, {151,148,149,147,145,146,152,153,155,194,193,192}},
-  {151, { 18.449000,  39.214000, -13.403000}, 3152, 2183, {150,155,194,156,200,197,193,192,148,149,152,153}},
-  {152, { 19.987000,  40.717000,  -2.655000}, 3151, 2184, {153,149,48,146,3,49,4,51,154,155,151,150}},
-  {153, { 23.697000,  38.342000,  -5.311000}, 3150, 2185, {152,154,155,157,158,156,151,150,149,48,49,51}},
-  {154, { 27.482000,  36.086000,  -2.655000}, 3149, 2186, {157,153,51,152,48,52,49,96,160,158,156,155}},
-  {155, { 23.170000,  37.488000, -10.749000}, 3148, 2187, {156,151,153,150,149,152,154,157,158,200,197,194}},
-  {156, { 26.824000,  34.038000, -13.403000}, 3147, 2188, {155,158,200,159,202,201,197,194,151,153,154,157}},
-  {157, { 30.814000,  32.935000,  -5.346000}, 3146, 2189, {154,160,158,161,163,159,156,155,153,51,52,96}},
-  {158, { 30.685000,  31.740000, -10.656000}, 3145, 2190, {159,156,157,155,153,154,160,161,163,202,201,200}},
-  {159, { 33.386000,  27.792000, -13.259000}, 3144, 2191, {158,163,202,164,208,205,201,200,156,157,160,161}},
-  {160, { 33.745000,  30.283000,  -2.691000}, 3175, 2192, {161,157,96,154,51,97,52,99,162,163,159,158}},
-  {161, { 36.539000,  26.454000,  -5.319000}, 3174, 2193, {160,162,163,165,166,164,159,158,157,96,97,99}},
-  {162, { 38.824000,  23.456000,  -2.629000}, 3173, 2194, {165,161,99,160,100,97,164,168,166,96,163}},
-  {163, { 36.308000,  25.158000, -10.577000}, 3172, 2195, {164,159,161,158,157,160,162,165,166,208,205,202}},
-  {164, { 38.596000,  20.582000, -12.240000}, 3171, 2196, {163,166,208,167,210,209,205,202,159,161,162,165}},
-  {165, { 41.059000,  18.985000,  -4.254000}, 3170, 2197, {162,168,166,169,167,164,163,161,99,171,100}},
-  {166, { 41.062000,  17.405000,  -8.607000}, 3169, 2198, {167,164,165,163,161,162,168,169,171,210,209,208}},
-  {167, { 42.742000,  12.290000,  -9.228000}, 3168, 2199, {166,171,210,172,216,213,209,208,164,165,168,169}},
-  {168, { 42.441000,  16.220000,   0.000000}, 3167, 2200, {169,165,100,162,99,102,103,170,171,167,166}},
-  {169, { 43.859000,  11.811000,   0.000000}, 3166, 2201, {168,170,171,173,174,172,167,166,165,100,102,103}},
-  {170, { 44.156000,   9.460000,   4.874000}, 3165, 2202, {173,169,103,168,100,102,107,108,176,174,172,171}},
-  {171, { 44.156000,   9.460000,  -4.874000}, 3164, 2203, {172,167,169,166,165,168,170,173,174,216,213,210}},
-  {172, { 44.903000,   4.758000,  -4.890000}, 3163, 2204, {171,174,216,175,218,217,213,210,167,169,170,173}},
-  {173, { 44.903000,   4.758000,   4.890000}, 3162, 2205, {170,176,174,177,179,175,172,171,169,103,107,108}},
-  {174, { 45.351000,   2.406000,   0.000000}, 3161, 2206, {175,172,173,171,169,170,176,177,179,218,217,216}},
-  {175, { 45.272000,  -2.859000,   0.000000}, 3160, 2207, {174,179,218,180,224,221,217,216,172,173,176,177}},
-  {176, { 44.348000,   2.351000,   9.600000}, 3191, 2208, {177,173,108,170,103,107,110,111,178,179,175,174}},
-  {177, { 44.264000,  -2.793000,   9.632000}, 3190, 2209, {176,178,179,181,182,180,175,174,173,108,110,111}},
-  {178, { 42.917000,  -5.144000,  14.005000}, 3189, 2210, {181,177,111,176,108,110,115,116,184,182,180,179}},
-  {179, { 44.739000,  -5.651000,   4.923000}, 3188, 2211, {180,175,177,174,173,176,178,181,182,224,221,218}},
-  {180, { 43.673000, -11.234000,   4.923000}, 3187, 2212, {179,182,224,183,226,225,221,218,175,177,178,181}},
-  {181, { 42.012000, -10.379000,  13.787000}, 3186, 2213, {178,184,182,185,187,183,180,179,177,111,115,116}},
-  {182, { 42.292000, -13.612000,   9.415000}, 3185, 2214, {183,180,181,179,177,178,184,185,187,226,225,224}},
-  {183, { 40.423000, -18.699000,   8.897000}, 3184, 2215, {182,187,226,188,232,229,225,224,180,181,184,185}},
-  {184, { 40.003000, -12.290000,  17.658000}, 3183, 2216, {185,181,116,178,111,115,118,119,186,187,183,182}},
-  {185, { 38.279000, -17.405000,  17.173000}, 3182, 2217, {184,186,187,189,190,188,183,182,181,116,118,119}},
-  {186, { 35.718000, -18.985000,  20.693000}, 3181, 2218, {189,185,119,184,118,123,188,124,190,116,187}},
-  {187, { 38.419000, -20.582000,  12.784000}, 3180, 2219, {188,183,185,182,181,184,186,189,190,232,229,226}},
-  {188, { 35.591000, -25.158000,  12.784000}, 3179, 2220, {187,190,232,191,234,233,229,226,183,185,186,189}},
-  {189, { 32.954000, -23.456000,  20.693000}, 3178, 2221, {186,124,190,123,191,188,187,185,119,127,126}},
-  {190, { 32.687000, -26.454000,  17.173000}, 3177, 2222, {191,188,189,187,185,186,124,126,127,234,233,232}},
-  {191, { 28.882000, -30.283000,  17.658000}, 3176, 2223, {190,127,234,126,132,237,233,232,188,189,124,131}},
-  {192, {  8.702000,  40.717000, -18.188000}, 3207, 2224, {193,296,148,297,290,147,150,151,194,195,298,293}},
-  {193, { 12.374000,  38.342000, -20.896000}, 3206, 2225, {192,194,195,197,198,196,298,297,296,148,150,151}},
-  {194, { 17.383000,  37.488000, -18.714000}, 3205, 2226, {197,193,151,192,148,150,155,156,200,198,196,195}},
-  {195, { 11.018000,  36.086000, -25.316000}, 3204, 2227, {196,298,193,301,296,192,194,197,198,240,304,297}},
-  {196, { 14.607000,  32.935000, -27.654000}, 3203, 2228, {195,198,240,199,242,241,304,301,298,193,194,197}},
-  {197, { 21.037000,  34.038000, -21.369000}, 3202, 2229, {194,200,198,201,203,199,196,195,193,151,155,156}},
-  {198, { 19.617000,  31.740000, -25.890000}, 3201, 2230, {199,196,197,195,193,194,200,201,203,242,241,240}},
-  {199, { 22.927000,  27.792000, -27.654000}, 3200, 2231, {198,203,242,204,248,245,241,240,196,197,200,201}},
-  {200, { 25.758000,  32.312000, -18.714000}, 3199, 2232, {201,197,156,194,151,155,158,159,202,203,199,198}},
-  {201, { 28.762000,  28.214000, -20.896000}, 3198, 2233, {200,202,203,205,206,204,199,198,197,156,158,159}},
-  {202, { 32.528000,  25.992000, -18.188000}, 3197, 2234, {205,201,159,200,156,158,163,164,208,206,204,203}},
-  {203, { 27.350000,  25.992000, -25.315000}, 3196, 2235, {204,199,201,198,197,200,202,205,206,248,245,242}},
-  {204, { 29.608000,  21.475000, -26.957000}, 3195, 2236, {203,206,248,207,250,249,245,242,199,201,202,205}},
-  {205, { 34.786000,  21.475000, -19.829000}, 3194, 2237, {202,208,206,209,211,207,204,203,201,159,163,164}},
-  {206, { 33.278000,  19.180000, -24.178000}, 3193, 2238, {207,204,205,203,201,202,208,209,211,250,249,248}},
-  {207, { 34.900000,  14.027000, -25.357000}, 3192, 2239, {206,211,250,212,256,253,249,248,204,205,208,209}},
-  {208, { 37.932000,  18.699000, -16.562000}, 3223, 2240, {209,205,164,202,159,163,166,167,210,211,207,206}},
-  {209, { 39.749000,  13.612000, -17.242000}, 3222, 2241, {208,210,211,213,214,212,207,206,205,164,166,167}},
-  {210, { 42.092000,  10.379000, -13.540000}, 3221, 2242, {213,209,167,208,164,166,171,172,216,214,212,211}},
-  {211, { 38.225000,  11.234000, -21.688000}, 3220, 2243, {212,207,209,206,205,208,210,213,214,256,253,250}},
-  {212, { 39.088000,   5.651000, -22.314000}, 3219, 2244, {211,214,256,215,258,257,253,250,207,209,210,213}},
-  {213, { 42.952000,   5.144000, -13.896000}, 3218, 2245, {210,216,214,217,219,215,212,211,209,167,171,172}},
-  {214, { 41.471000,   2.793000, -18.226000}, 3217, 2246, {215,212,213,211,209,210,216,217,219,258,257,256}},
-  {215, { 41.521000,  -2.351000, -18.301000}, 3216, 2247, {214,219,258,220,264,261,257,256,212,213,216,217}},
-  {216, { 44.348000,   2.351000,  -9.600000}, 3215, 2248, {217,213,172,210,167,171,174,175,218,219,215,214}},
-  {217, { 44.264000,  -2.793000,  -9.632000}, 3214, 2249, {216,218,219,221,222,220,215,214,213,172,174,175}},
-  {218, { 44.739000,  -5.651000,  -4.923000}, 3213, 2250, {221,217,175,216,172,174,179,180,224,222,220,219}},
-  {219, { 42.917000,  -5.144000, -14.005000}, 3212, 2251, {220,215,217,214,213,216,218,221,222,264,261,258}},
-  {220, { 42.012000, -10.379000, -13.787000}, 3211, 2252, {219,222,264,223,266,265,261,258,215,217,218,221}},
-  {221, { 43.673000, -11.234000,  -4.923000}, 3210, 2253, {218,224,222,225,227,223,220,219,217,175,179,180}},
-  {222, { 42.292000, -13.612000,  -9.415000}, 3209, 2254, {223,220,221,219,217,218,224,225,227,266,265,264}},
-  {223, { 40.423000, -18.699000,  -8.897000}, 3208, 2255, {222,227,266,228,272,269,265,264,220,221,224,225}},
-  {224, { 43.139000, -14.027000,   0.000000}, 3239, 2256, {225,221,180,218,175,179,182,183,226,227,223,222}},
-  {225, { 41.134000, -19.180000,   0.000000}, 3238, 2257, {224,226,227,229,230,228,223,222,221,180,182,183}},
-  {226, { 39.798000, -21.475000,   4.405000}, 3237, 2258, {229,225,183,224,180,182,187,188,232,230,228,227}},
-  {227, { 39.798000, -21.475000,  -4.405000}, 3236, 2259, {228,223,225,222,221,224,226,229,230,272,269,266}},
-  {228, { 37.006000, -25.992000,  -4.405000}, 3235, 2260, {227,230,272,231,274,273,269,266,223,225,226,229}},
-  {229, { 37.006000, -25.992000,   4.405000}, 3234, 2261, {226,232,230,233,235,231,228,227,225,183,187,188}},
-  {230, { 35.551000, -28.214000,   0.000000}, 3233, 2262, {231,228,229,227,225,226,232,233,235,274,273,272}},
-  {231, { 31.839000, -32.312000,   0.000000}, 3232, 2263, {230,235,274,236,280,277,273,272,228,229,232,233}},
-  {232, { 34.803000, -27.792000,   8.897000}, 3231, 2264, {233,229,188,226,183,187,190,191,234,235,231,230}},
-  {233, { 31.088000, -31.740000,   9.415000}, 3230, 2265, {232,234,235,237,238,236,231,230,229,188,190,191}},
-  {234, { 28.071000, -32.935000,  13.787000}, 3229, 2266, {237,233,191,232,188,190,127,131,132,238,236,235}},
-  {235, { 29.579000, -34.038000,   4.923000}, 3228, 2267, {236,231,233,230,229,232,234,237,238,280,277,274}},
-  {236, { 25.063000, -37.488000,   4.923000}, 3227, 2268, {235,238,280,239,282,281,277,274,231,233,234,237}},
-  {237, { 23.794000, -36.086000,  14.005000}, 3226, 2269, {234,132,238,131,135,239,236,235,233,191,127,134}},
-  {238, { 22.293000, -38.342000,   9.632000}, 3225, 2270, {239,236,237,235,233,234,132,134,135,282,281,280}},
-  {239, { 17.730000, -40.717000,   9.600000}, 3224, 2271, {238,135,282,134,140,285,281,280,236,237,132,139}},
-  {240, { 12.987000,  30.283000, -31.262000}, 3255, 2272, {241,304,196,305,298,195,198,199,242,243,306,301}},
-  {241, { 16.350000,  26.454000, -33.106000}, 3254, 2273, {240,242,243,245,246,244,306,305,304,196,198,199}},
-  {242, { 21.279000,  25.158000, -31.262000}, 3253, 2274, {245,241,199,240,196,198,203,204,248,246,244,243}},
-  {243, { 14.498000,  23.456000, -36.111000}, 3252, 2275, {244,306,241,309,240,242,245,246,312,304,305}},
-  {244, { 16.733000,  18.985000, -37.736000}, 3251, 2276, {243,246,312,247,313,309,242,306,241,314,245}},
-  {245, { 23.567000,  20.582000, -32.925000}, 3250, 2277, {242,248,246,249,251,247,244,243,241,199,203,204}},
-  {246, { 20.874000,  17.405000, -36.394000}, 3249, 2278, {247,244,245,243,241,242,248,249,251,314,313,312}},
-  {247, { 21.983000,  12.290000, -37.799000}, 3248, 2279, {246,251,314,252,320,317,313,312,244,245,248,249}},
-  {248, { 27.473000,  18.699000, -30.958000}, 3247, 2280, {249,245,204,242,199,203,206,207,250,251,247,246}},
-  {249, { 28.681000,  13.612000, -32.476000}, 3246, 2281, {248,250,251,253,254,252,247,246,245,204,206,207}},
-  {250, { 32.438000,  11.234000, -29.653000}, 3245, 2282, {253,249,207,248,204,206,211,212,256,254,252,251}},
-  {251, { 25.884000,  10.379000, -35.848000}, 3244, 2283, {252,247,249,246,245,248,250,253,254,320,317,314}},
-  {252, { 26.488000,   5.144000, -36.557000}, 3243, 2284, {251,254,320,255,322,321,317,314,247,249,250,253}},
-  {253, { 33.301000,   5.651000, -30.280000}, 3242, 2285, {250,256,254,257,259,255,252,251,249,207,211,212}},
-  {254, { 30.148000,   2.793000, -33.810000}, 3241, 2286, {255,252,253,251,249,250,256,257,259,322,321,320}},
-  {255, { 30.235000,  -2.351000, -33.834000}, 3240, 2287, {254,259,322,260,328,325,321,320,252,253,256,257}},
-  {256, { 36.626000,   2.859000, -26.611000}, 3271, 2288, {257,253,212,250,207,211,214,215,258,259,255,254}},
-  {257, { 36.690000,  -2.406000, -26.657000}, 3270, 2289, {256,258,259,261,262,260,255,254,253,212,214,215}},
-  {258, { 39.201000,  -4.758000, -22.437000}, 3269, 2290, {261,257,215,256,212,214,219,220,264,262,260,259}},
-  {259, { 33.452000,  -4.758000, -30.349000}, 3268, 2291, {260,255,257,254,253,256,258,261,262,328,325,322}},
-  {260, { 32.858000,  -9.460000, -29.898000}, 3267, 2292, {259,262,328,263,330,329,325,322,255,257,258,261}},
-  {261, { 38.588000,  -9.460000, -22.012000}, 3266, 2293, {258,264,262,265,267,263,260,259,257,215,219,220}},
-  {262, { 35.482000, -11.811000, -25.780000}, 3265, 2294, {263,260,261,259,257,258,264,265,267,330,329,328}},
-  {263, { 34.335000, -16.220000, -24.947000}, 3264, 2295, {262,267,330,268,333,329,328,260,261,264,265}},
-  {264, { 40.003000, -12.290000, -17.658000}, 3263, 2296, {265,261,220,258,215,219,222,223,266,267,263,262}},
-  {265, { 38.279000, -17.405000, -17.173000}, 3262, 2297, {264,266,267,269,270,268,263,262,261,220,222,223}},
-  {266, { 38.419000, -20.582000, -12.784000}, 3261, 2298, {269,265,223,264,220,222,227,228,272,270,268,267}},
-  {267, { 35.718000, -18.985000, -20.693000}, 3260, 2299, {268,263,265,262,264,266,269,270,333,261,330}},
-  {268, { 32.954000, -23.456000, -20.693000}, 3259, 2300, {267,270,333,271,330,334,266,263,265,335,269}},
-  {269, { 35.591000, -25.158000, -12.784000}, 3258, 2301, {266,272,270,273,275,271,268,267,265,223,227,228}},
-  {270, { 32.687000, -26.454000, -17.173000}, 3257, 2302, {271,268,269,267,265,266,272,273,275,335,334,333}},
-  {271, { 28.882000, -30.283000, -17.658000}, 3256, 2303, {270,275,335,276,381,334,378,333,268,269,272,273}},
-  {272, { 34.803000, -27.792000,  -8.897000}, 3287, 2304, {273,269,228,266,223,227,230,231,274,275,271,270}},
-  {273, { 31.088000, -31.740000,  -9.415000}, 3286, 2305, {272,274,275,277,278,276,271,270,269,228,230,231}},
-  {274, { 29.579000, -34.038000,  -4.923000}, 3285, 2306, {277,273,231,272,228,230,235,236,280,278,276,275}},
-  {275, { 28.071000, -32.935000, -13.787000}, 3284, 2307, {276,271,273,270,269,272,274,277,278,381,378,335}},
-  {276, { 23.794000, -36.086000, -14.005000}, 3283, 2308, {275,278,381,279,383,378,382,335,271,273,274,277}},
-  {277, { 25.063000, -37.488000,  -4.923000}, 3282, 2309, {274,280,278,281,283,279,276,275,273,231,235,236}},
-  {278, { 22.293000, -38.342000,  -9.632000}, 3281, 2310, {279,276,277,275,273,274,280,281,283,383,382,381}},
-  {279, { 17.730000, -40.717000,  -9.600000}, 3280, 2311, {278,283,383,284,429,382,426,381,276,277,280,281}},
-  {280, { 22.803000, -39.214000,   0.000000}, 3279, 2312, {281,277,236,274,231,235,238,239,282,283,279,278}},
-  {281, { 18.130000, -41.639000,   0.000000}, 3278, 2313, {280,282,283,285,286,284,279,278,277,236,238,239}},
-  {282, { 15.826000, -42.290000,   4.890000}, 3277, 2314, {285,281,239,280,236,238,135,139,140,286,284,283}},
-  {283, { 15.826000, -42.290000,  -4.890000}, 3276, 2315, {284,279,281,278,277,280,282,285,286,429,426,383}},
-  {284, { 11.286000, -43.725000,  -4.874000}, 3275, 2316, {283,286,429,287,431,426,430,383,279,281,282,285}},
-  {285, { 11.286000, -43.725000,   4.874000}, 3274, 2317, {282,140,286,139,143,287,284,283,281,239,135,142}},
-  {286, {  9.051000, -44.510000,   0.000000}, 3273, 2318, {287,284,285,283,281,282,140,142,143,431,430,429}},
-  {287, {  4.473000, -45.214000,   0.000000}, 3272, 2319, {286,143,431,142,430,575,429,284,285,140,719}},
-  {288, { -1.382000,  45.214000,  -4.254000}, 3303, 2320, {289,432,144,433,145,0,147,290,291,434,576}},
-  {289, { -2.797000,  44.510000,  -8.608000}, 3302, 2321, {288,290,291,293,294,292,434,433,432,144,145,147}},
-  {290, {  1.148000,  43.725000, -12.240000}, 3301, 2322, {293,289,147,288,144,148,145,192,296,294,292,291}},
-  {291, { -8.123000,  43.725000,  -9.227000}, 3300, 2323, {292,434,289,437,432,288,290,293,294,336,440,433}},
-  {292, { -9.541000,  42.290000, -13.540000}, 3299, 2324, {291,294,336,295,338,337,440,437,434,289,290,293}},
-  {293, { -0.240000,  42.290000, -16.562000}, 3298, 2325, {290,296,294,297,299,295,292,291,289,147,148,192}},
-  {294, { -5.603000,  41.639000, -17.243000}, 3297, 2326, {295,292,293,291,289,290,296,297,299,338,337,336}},
-  {295, { -7.047000,  39.214000, -21.687000}, 3296, 2327, {294,299,338,300,344,341,337,336,292,293,296,297}},
-  {296, {  3.651000,  40.717000, -19.829000}, 3295, 2328, {297,293,192,290,147,193,148,195,298,299,295,294}},
-  {297, {  2.271000,  38.342000, -24.178000}, 3294, 2329, {296,298,299,301,302,300,295,294,293,192,193,195}},
-  {298, {  5.967000,  36.086000, -26.957000}, 3293, 2330, {301,297,195,296,192,196,193,240,304,302,300,299}},
-  {299, { -3.063000,  37.488000, -25.357000}, 3292, 2331, {300,295,297,294,293,296,298,301,302,344,341,338}},
-  {300, { -4.459000,  34.038000, -29.653000}, 3291, 2332, {299,302,344,303,346,345,341,338,295,297,298,301}},
-  {301, {  4.437000,  32.935000, -30.958000}, 3290, 2333, {298,304,302,305,307,303,300,299,297,195,196,240}},
-  {302, { -0.653000,  31.740000, -32.476000}, 3289, 2334, {303,300,301,299,297,298,304,305,307,346,345,344}},
-  {303, { -2.293000,  27.792000, -35.849000}, 3288, 2335, {302,307,346,308,352,349,345,344,300,301,304,305}},
-  {304, {  7.868000,  30.283000, -32.925000}, 3319, 2336, {305,301,240,298,195,241,196,243,306,307,303,302}},
-  {305, {  6.231000,  26.454000, -36.394000}, 3318, 2337, {304,306,307,309,310,308,303,302,301,240,241,243}},
-  {306, {  9.497000,  23.456000, -37.736000}, 3317, 2338, {309,305,243,304,244,241,308,312,310,240,307}},
-  {307, {  1.160000,  25.158000, -37.799000}, 3316, 2339, {308,303,305,302,301,304,306,309,310,352,349,346}},
-  {308, {  0.286000,  20.582000, -40.490000}, 3315, 2340, {307,310,352,311,354,353,349,346,303,305,306,309}},
-  {309, {  8.643000,  18.985000, -40.364000}, 3314, 2341, {306,312,310,313,311,308,307,305,243,315,244}},
-  {310, {  4.503000,  17.405000, -41.713000}, 3313, 2342, {311,308,309,307,305,306,312,313,315,354,353,352}},
-  {311, {  4.432000,  12.290000, -43.502000}, 3312, 2343, {310,315,354,316,360,357,353,352,308,309,312,313}},
-  {312, { 13.115000,  16.220000, -40.364000}, 3311, 2344, {313,309,244,306,243,246,247,314,315,311,310}},
-  {313, { 13.553000,  11.811000, -41.713000}, 3310, 2345, {312,314,315,317,318,316,311,310,309,244,246,247}},
-  {314, { 18.281000,   9.460000, -40.489000}, 3309, 2346, {317,313,247,312,244,246,251,252,320,318,316,315}},
-  {315, {  9.010000,   9.460000, -43.502000}, 3308, 2347, {316,311,313,310,309,312,314,317,318,360,357,354}},
-  {316, {  9.225000,   4.758000, -44.216000}, 3307, 2348, {315,318,360,319,362,361,357,354,311,313,314,317}},
-  {317, { 18.526000,   4.758000, -41.194000}, 3306, 2349, {314,320,318,321,323,319,316,315,313,247,251,252}},
-  {318, { 14.014000,   2.406000, -43.132000}, 3305, 2350, {319,316,317,315,313,314,320,321,323,362,361,360}},
-  {319, { 13.990000,  -2.859000, -43.057000}, 3304, 2351, {318,323,362,324,368,365,361,360,316,317,320,321}},
-  {320, { 22.835000,   2.351000, -39.211000}, 3335, 2352, {321,317,252,314,247,251,254,255,322,323,319,318}},
-  {321, { 22.839000,  -2.793000, -39.121000}, 3334, 2353, {320,322,323,325,326,324,319,318,317,252,254,255}},
-  {322, { 26.582000,  -5.144000, -36.489000}, 3333, 2354, {325,321,255,320,252,254,259,260,328,326,324,323}},
-  {323, { 18.507000,  -5.651000, -41.028000}, 3332, 2355, {324,319,321,318,317,320,322,325,326,368,365,362}},
-  {324, { 18.178000, -11.234000, -40.014000}, 3331, 2356, {323,326,368,327,370,369,365,362,319,321,322,325}},
-  {325, { 26.095000, -10.379000, -35.696000}, 3330, 2357, {322,328,326,329,331,327,324,323,321,255,259,260}},
-  {326, { 22.023000, -13.612000, -37.313000}, 3329, 2358, {327,324,325,323,321,322,328,329,331,370,369,368}},
-  {327, { 20.953000, -18.699000, -35.695000}, 3328, 2359, {326,331,370,332,376,373,369,368,324,325,328,329}},
-  {328, { 29.155000, -12.290000, -32.589000}, 3327, 2360, {329,325,260,322,255,259,262,263,330,331,327,326}},
-  {329, { 28.162000, -17.405000, -31.100000}, 3326, 2361, {328,330,331,333,334,332,327,326,325,260,262,263}},
-  {330, { 30.718000, -18.985000, -27.575000}, 3325, 2362, {333,329,263,328,262,267,332,268,334,260,331}},
-  {331, { 24.031000, -20.582000, -32.589000}, 3324, 2363, {332,327,329,326,325,328,330,333,334,376,373,370}},
-  {332, { 23.157000, -25.158000, -29.898000}, 3323, 2364, {331,334,376,335,378,377,373,370,327,329,330,333}},
-  {333, { 29.864000, -23.456000, -24.947000}, 3322, 2365, {330,268,334,267,335,332,331,329,263,271,270}},
-  {334, { 26.434000, -26.454000, -25.780000}, 3321, 2366, {335,332,333,331,329,330,268,270,271,378,377,376}},
-  {335, { 25.719000, -30.283000, -22.012000}, 3320, 2367, {334,271,378,270,276,381,377,376,332,333,268,275}},
-  {336, {-14.609000,  40.717000, -13.896000}, 3351, 2368, {337,440,292,441,434,291,294,295,338,339,442,437}},
-  {337, {-16.050000,  38.342000, -18.226000}, 3350, 2369, {336,338,339,341,342,340,442,441,440,292,294,295}},
-  {338, {-12.427000,  37.488000, -22.315000}, 3349, 2370, {341,337,295,336,292,294,299,300,344,342,340,339}},
-  {339, {-20.672000,  36.086000, -18.301000}, 3348, 2371, {340,442,337,445,440,336,338,341,342,384,448,441}},
-  {340, {-21.787000,  32.935000, -22.437000}, 3347, 2372, {339,342,384,343,386,385,448,445,442,337,338,341}},
-  {341, {-13.823000,  34.038000, -26.610000}, 3346, 2373, {338,344,342,345,347,343,340,339,337,295,299,300}},
-  {342, {-18.561000,  31.740000, -26.657000}, 3345, 2374, {343,340,341,339,337,338,344,345,347,386,385,384}},
-  {343, {-19.216000,  27.792000, -30.350000}, 3344, 2375, {342,347,386,348,392,389,385,384,340,341,344,345}},
-  {344, { -9.839000,  32.312000, -30.280000}, 3343, 2376, {345,341,300,338,295,299,302,303,346,347,343,342}},
-  {345, {-10.986000,  28.214000, -33.811000}, 3342, 2377, {344,346,347,349,350,348,343,342,341,300,302,303}},
-  {346, { -7.246000,  25.992000, -36.556000}, 3341, 2378, {349,345,303,344,300,302,307,308,352,350,348,347}},
-  {347, {-15.625000,  25.992000, -33.834000}, 3340, 2379, {348,343,345,342,341,344,346,349,350,392,389,386}},
-  {348, {-16.488000,  21.475000, -36.489000}, 3339, 2380, {347,350,392,351,394,393,389,386,343,345,346,349}},
-  {349, { -8.109000,  21.475000, -39.212000}, 3338, 2381, {346,352,350,353,355,351,348,347,345,303,307,308}},
-  {350, {-12.711000,  19.180000, -39.121000}, 3337, 2382, {351,348,349,347,345,346,352,353,355,394,393,392}},
-  {351, {-13.331000,  14.027000, -41.028000}, 3336, 2383, {350,355,394,356,400,397,393,392,348,349,352,353}},
-  {352, { -4.030000,  18.699000, -41.194000}, 3367, 2384, {353,349,308,346,303,307,310,311,354,355,351,350}},
-  {353, { -4.115000,  13.612000, -43.132000}, 3366, 2385, {352,354,355,357,358,356,351,350,349,308,310,311}},
-  {354, {  0.130000,  10.379000, -44.216000}, 3365, 2386, {357,353,311,352,308,310,315,316,360,358,356,355}},
-  {355, { -8.814000,  11.234000, -43.057000}, 3364, 2387, {356,351,353,350,349,352,354,357,358,400,397,394}},
-  {356, { -9.143000,   5.651000, -44.071000}, 3363, 2388, {355,358,400,359,402,401,397,394,351,353,354,357}},
-  {357, {  0.057000,   5.144000, -45.145000}, 3362, 2389, {354,360,358,361,363,359,356,355,353,311,315,316}},
-  {358, { -4.518000,   2.793000, -45.074000}, 3361, 2390, {359,356,357,355,353,354,360,361,363,402,401,400}},
-  {359, { -4.574000,  -2.351000, -45.145000}, 3360, 2391, {358,363,402,364,408,405,401,400,356,357,360,361}},
-  {360, {  4.574000,   2.351000, -45.145000}, 3359, 2392, {361,357,316,354,311,315,318,319,362,363,359,358}},
-  {361, {  4.518000,  -2.793000, -45.074000}, 3358, 2393, {360,362,363,365,366,364,359,358,357,316,318,319}},
-  {362, {  9.143000,  -5.651000, -44.071000}, 3357, 2394, {365,361,319,360,316,318,323,324,368,366,364,363}},
-  {363, { -0.057000,  -5.144000, -45.145000}, 3356, 2395, {364,359,361,358,357,360,362,365,366,408,405,402}},
-  {364, { -0.130000, -10.379000, -44.216000}, 3355, 2396, {363,366,408,367,410,409,405,402,359,361,362,365}},
-  {365, {  8.814000, -11.234000, -43.057000}, 3354, 2397, {362,368,366,369,371,367,364,363,361,319,323,324}},
-  {366, {  4.115000, -13.612000, -43.132000}, 3353, 2398, {367,364,365,363,361,362,368,369,371,410,409,408}},
-  {367, {  4.030000, -18.699000, -41.194000}, 3352, 2399, {366,371,410,372,416,413,409,408,364,365,368,369}},
-  {368, { 13.331000, -14.027000, -41.028000}, 3383, 2400, {369,365,324,362,319,323,326,327,370,371,367,366}},
-  {369, { 12.711000, -19.180000, -39.121000}, 3382, 2401, {368,370,371,373,374,372,367,366,365,324,326,327}},
-  {370, { 16.488000, -21.475000, -36.489000}, 3381, 2402, {373,369,327,368,324,326,331,332,376,374,372,371}},
-  {371, {  8.109000, -21.475000, -39.212000}, 3380, 2403, {372,367,369,366,365,368,370,373,374,416,413,410}},
-  {372, {  7.246000, -25.992000, -36.556000}, 3379, 2404, {371,374,416,375,418,417,413,410,367,369,370,373}},
-  {373, { 15.625000, -25.992000, -33.834000}, 3378, 2405, {370,376,374,377,379,375,372,371,369,327,331,332}},
-  {374, { 10.986000, -28.214000, -33.811000}, 3377, 2406, {375,372,373,371,369,370,376,377,379,418,417,416}},
-  {375, {  9.839000, -32.312000, -30.280000}, 3376, 2407, {374,379,418,380,424,421,417,416,372,373,376,377}},
-  {376, { 19.216000, -27.792000, -30.350000}, 3375, 2408, {377,373,332,370,327,331,334,335,378,379,375,374}},
-  {377, { 18.561000, -31.740000, -26.657000}, 3374, 2409, {376,378,379,381,382,380,375,374,373,332,334,335}},
-  {378, { 21.787000, -32.935000, -22.437000}, 3373, 2410, {381,377,335,376,332,334,271,275,276,382,380,379}},
-  {379, { 13.823000, -34.038000, -26.610000}, 3372, 2411, {380,375,377,374,373,376,378,381,382,424,421,418}},
-  {380, { 12.427000, -37.488000, -22.315000}, 3371, 2412, {379,382,424,383,426,425,421,418,375,377,378,381}},
-  {381, { 20.672000, -36.086000, -18.301000}, 3370, 2413, {378,276,382,275,279,383,380,379,377,335,271,278}},
-  {382, { 16.050000, -38.342000, -18.226000}, 3369, 2414, {383,380,381,379,377,378,276,278,279,426,425,424}},
-  {383, { 14.609000, -40.717000, -13.896000}, 3368, 2415, {382,279,426,278,284,429,425,424,380,381,276,283}},
-  {384, {-25.719000,  30.283000, -22.012000}, 3399, 2416, {385,448,340,449,442,339,342,343,386,387,450,445}},
-  {385, {-26.434000,  26.454000, -25.780000}, 3398, 2417, {384,386,387,389,390,388,450,449,448,340,342,343}},
-  {386, {-23.157000,  25.158000, -29.898000}, 3397, 2418, {389,385,343,384,340,342,347,348,392,390,388,387}},
-  {387, {-29.864000,  23.456000, -24.947000}, 3396, 2419, {388,450,385,453,384,386,389,390,456,448,449}},
-  {388, {-30.718000,  18.985000, -27.575000}, 3395, 2420, {387,390,456,391,457,453,386,450,385,458,389}},
-  {389, {-24.031000,  20.582000, -32.589000}, 3394, 2421, {386,392,390,393,395,391,388,387,385,343,347,348}},
-  {390, {-28.162000,  17.405000, -31.100000}, 3393, 2422, {391,388,389,387,385,386,392,393,395,458,457,456}},
-  {391, {-29.155000,  12.290000, -32.589000}, 3392, 2423, {390,395,458,396,464,461,457,456,388,389,392,393}},
-  {392, {-20.953000,  18.699000, -35.695000}, 3391, 2424, {393,389,348,386,343,347,350,351,394,395,391,390}},
-  {393, {-22.023000,  13.612000, -37.313000}, 3390, 2425, {392,394,395,397,398,396,391,390,389,348,350,351}},
-  {394, {-18.178000,  11.234000, -40.014000}, 3389, 2426, {397,393,351,392,348,350,355,356,400,398,396,395}},
-  {395, {-26.095000,  10.379000, -35.696000}, 3388, 2427, {396,391,393,390,389,392,394,397,398,464,461,458}},
-  {396, {-26.582000,   5.144000, -36.489000}, 3387, 2428, {395,398,464,399,466,465,461,458,391,393,394,397}},
-  {397, {-18.507000,   5.651000, -41.028000}, 3386, 2429, {394,400,398,401,403,399,396,395,393,351,355,356}},
-  {398, {-22.839000,   2.793000, -39.121000}, 3385, 2430, {399,396,397,395,393,394,400,401,403,466,465,464}},
-  {399, {-22.835000,  -2.351000, -39.211000}, 3384, 2431, {398,403,466,404,472,469,465,464,396,397,400,401}},
-  {400, {-13.990000,   2.859000, -43.057000}, 3415, 2432, {401,397,356,394,351,355,358,359,402,403,399,398}},
-  {401, {-14.014000,  -2.406000, -43.132000}, 3414, 2433, {400,402,403,405,406,404,399,398,397,356,358,359}},
-  {402, { -9.225000,  -4.758000, -44.216000}, 3413, 2434, {405,401,359,400,356,358,363,364,408,406,404,403}},
-  {403, {-18.526000,  -4.758000, -41.194000}, 3412, 2435, {404,399,401,398,397,400,402,405,406,472,469,466}},
-  {404, {-18.281000,  -9.460000, -40.489000}, 3411, 2436, {403,406,472,407,474,473,469,466,399,401,402,405}},
-  {405, { -9.010000,  -9.460000, -43.502000}, 3410, 2437, {402,408,406,409,411,407,404,403,401,359,363,364}},
-  {406, {-13.553000, -11.811000, -41.713000}, 3409, 2438, {407,404,405,403,401,402,408,409,411,474,473,472}},
-  {407, {-13.115000, -16.220000, -40.364000}, 3408, 2439, {406,411,474,412,477,473,472,404,405,408,409}},
-  {408, { -4.432000, -12.290000, -43.502000}, 3407, 2440, {409,405,364,402,359,363,366,367,410,411,407,406}},
-  {409, { -4.503000, -17.405000, -41.713000}, 3406, 2441, {408,410,411,413,414,412,407,406,405,364,366,367}},
-  {410, { -0.286000, -20.582000, -40.490000}, 3405, 2442, {413,409,367,408,364,366,371,372,416,414,412,411}},
-  {411, { -8.643000, -18.985000, -40.364000}, 3404, 2443, {412,407,409,406,408,410,413,414,477,405,474}},
-  {412, { -9.497000, -23.456000, -37.736000}, 3403, 2444, {411,414,477,415,474,478,410,407,409,479,413}},
-  {413, { -1.160000, -25.158000, -37.799000}, 3402, 2445, {410,416,414,417,419,415,412,411,409,367,371,372}},
-  {414, { -6.231000, -26.454000, -36.394000}, 3401, 2446, {415,412,413,411,409,410,416,417,419,479,478,477}},
-  {415, { -7.868000, -30.283000, -32.925000}, 3400, 2447, {414,419,479,420,525,478,522,477,412,413,416,417}},
-  {416, {  2.293000, -27.792000, -35.849000}, 3431, 2448, {417,413,372,410,367,371,374,375,418,419,415,414}},
-  {417, {  0.653000, -31.740000, -32.476000}, 3430, 2449, {416,418,419,421,422,420,415,414,413,372,374,375}},
-  {418, {  4.459000, -34.038000, -29.653000}, 3429, 2450, {421,417,375,416,372,374,379,380,424,422,420,419}},
-  {419, { -4.437000, -32.935000, -30.958000}, 3428, 2451, {420,415,417,414,413,416,418,421,422,525,522,479}},
-  {420, { -5.967000, -36.086000, -26.957000}, 3427, 2452, {419,422,525,423,527,522,526,479,415,417,418,421}},
-  {421, {  3.063000, -37.488000, -25.357000}, 3426, 2453, {418,424,422,425,427,423,420,419,417,375,379,380}},
-  {422, { -2.271000, -38.342000, -24.178000}, 3425, 2454, {423,420,421,419,417,418,424,425,427,527,526,525}},
-  {423, { -3.651000, -40.717000, -19.829000}, 3424, 2455, {422,427,527,428,573,526,570,525,420,421,424,425}},
-  {424, {  7.047000, -39.214000, -21.687000}, 3423, 2456, {425,421,380,418,375,379,382,383,426,427,423,422}},
-  {425, {  5.603000, -41.639000, -17.243000}, 3422, 2457, {424,426,427,429,430,428,423,422,421,380,382,383}},
-  {426, {  9.541000, -42.290000, -13.540000}, 3421, 2458, {429,425,383,424,380,382,279,283,284,430,428,427}},
-  {427, {  0.240000, -42.290000, -16.562000}, 3420, 2459, {428,423,425,422,421,424,426,429,430,573,570,527}},
-  {428, { -1.148000, -43.725000, -12.240000}, 3419, 2460, {427,430,573,431,575,570,574,527,423,425,426,429}},
-  {429, {  8.123000, -43.725000,  -9.227000}, 3418, 2461, {426,284,430,283,287,431,428,427,425,383,279,286}},
-  {430, {  2.797000, -44.510000,  -8.608000}, 3417, 2462, {431,428,429,427,425,426,284,286,287,575,574,573}},
-  {431, {  1.382000, -45.214000,  -4.254000}, 3416, 2463, {430,287,575,286,574,719,573,428,429,284,143}},
-  {432, { -4.473000,  45.214000,   0.000000}, 3447, 2464, {433,576,288,577,289,144,291,434,435,578,0}},
-  {433, { -9.051000,  44.510000,   0.000000}, 3446, 2465, {432,434,435,437,438,436,578,577,576,288,289,291}},
-  {434, {-11.286000,  43.725000,  -4.874000}, 3445, 2466, {437,433,291,432,288,292,289,336,440,438,436,435}},
-  {435, {-11.286000,  43.725000,   4.874000}, 3444, 2467, {436,578,433,581,576,432,434,437,438,480,584,577}},
-  {436, {-15.826000,  42.290000,   4.890000}, 3443, 2468, {435,438,480,439,482,481,584,581,578,433,434,437}},
-  {437, {-15.826000,  42.290000,  -4.890000}, 3442, 2469, {434,440,438,441,443,439,436,435,433,291,292,336}},
-  {438, {-18.130000,  41.639000,   0.000000}, 3441, 2470, {439,436,437,435,433,434,440,441,443,482,481,480}},
-  {439, {-22.803000,  39.214000,   0.000000}, 3440, 2471, {438,443,482,444,488,485,481,480,436,437,440,441}},
-  {440, {-17.730000,  40.717000,  -9.600000}, 3439, 2472, {441,437,336,434,291,337,292,339,442,443,439,438}},
-  {441, {-22.293000,  38.342000,  -9.632000}, 3438, 2473, {440,442,443,445,446,444,439,438,437,336,337,339}},
-  {442, {-23.794000,  36.086000, -14.005000}, 3437, 2474, {445,441,339,440,336,340,337,384,448,446,444,443}},
-  {443, {-25.063000,  37.488000,  -4.923000}, 3436, 2475, {444,439,441,438,437,440,442,445,446,488,485,482}},
-  {444, {-29.579000,  34.038000,  -4.923000}, 3435, 2476, {443,446,488,447,490,489,485,482,439,441,442,445}},
-  {445, {-28.071000,  32.935000, -13.787000}, 3434, 2477, {442,448,446,449,451,447,444,443,441,339,340,384}},
-  {446, {-31.088000,  31.740000,  -9.415000}, 3433, 2478, {447,444,445,443,441,442,448,449,451,490,489,488}},
-  {447, {-34.803000,  27.792000,  -8.897000}, 3432, 2479, {446,451,490,452,496,493,489,488,444,445,448,449}},
-  {448, {-28.882000,  30.283000, -17.658000}, 3463, 2480, {449,445,384,442,339,385,340,387,450,451,447,446}},
-  {449, {-32.687000,  26.454000, -17.173000}, 3462, 2481, {448,450,451,453,454,452,447,446,445,384,385,387}},
-  {450, {-32.954000,  23.456000, -20.693000}, 3461, 2482, {453,449,387,448,388,385,452,456,454,384,451}},
-  {451, {-35.591000,  25.158000, -12.784000}, 3460, 2483, {452,447,449,446,445,448,450,453,454,496,493,490}},
-  {452, {-38.419000,  20.582000, -12.784000}, 3459, 2484, {451,454,496,455,498,497,493,490,447,449,450,453}},
-  {453, {-35.718000,  18.985000, -20.693000}, 3458, 2485, {450,456,454,457,455,452,451,449,387,459,388}},
-  {454, {-38.279000,  17.405000, -17.173000}, 3457, 2486, {455,452,453,451,449,450,456,457,459,498,497,496}},
-  {455, {-40.003000,  12.290000, -17.658000}, 3456, 2487, {454,459,498,460,504,501,497,496,452,453,456,457}},
-  {456, {-34.335000,  16.220000, -24.947000}, 3455, 2488, {457,453,388,450,387,390,391,458,459,455,454}},
-  {457, {-35.482000,  11.811000, -25.780000}, 3454, 2489, {456,458,459,461,462,460,455,454,453,388,390,391}},
-  {458, {-32.858000,   9.460000, -29.898000}, 3453, 2490, {461,457,391,456,388,390,395,396,464,462,460,459}},
-  {459, {-38.588000,   9.460000, -22.012000}, 3452, 2491, {460,455,457,454,453,456,458,461,462,504,501,498}},
-  {460, {-39.201000,   4.758000, -22.437000}, 3451, 2492, {459,462,504,463,506,505,501,498,455,457,458,461}},
-  {461, {-33.452000,   4.758000, -30.349000}, 3450, 2493, {458,464,462,465,467,463,460,459,457,391,395,396}},
-  {462, {-36.690000,   2.406000, -26.657000}, 3449, 2494, {463,460,461,459,457,458,464,465,467,506,505,504}},
-  {463, {-36.626000,  -2.859000, -26.611000}, 3448, 2495, {462,467,506,468,512,509,505,504,460,461,464,465}},
-  {464, {-30.235000,   2.351000, -33.834000}, 3479, 2496, {465,461,396,458,391,395,398,399,466,467,463,462}},
-  {465, {-30.148000,  -2.793000, -33.810000}, 3478, 2497, {464,466,467,469,470,468,463,462,461,396,398,399}},
-  {466, {-26.488000,  -5.144000, -36.557000}, 3477, 2498, {469,465,399,464,396,398,403,404,472,470,468,467}},
-  {467, {-33.301000,  -5.651000, -30.280000}, 3476, 2499, {468,463,465,462,461,464,466,469,470,512,509,506}},
-  {468, {-32.438000, -11.234000, -29.653000}, 3475, 2500, {467,470,512,471,514,513,509,506,463,465,466,469}},
-  {469, {-25.884000, -10.379000, -35.848000}, 3474, 2501, {466,472,470,473,475,471,468,467,465,399,403,404}},
-  {470, {-28.681000, -13.612000, -32.476000}, 3473, 2502, {471,468,469,467,465,466,472,473,475,514,513,512}},
-  {471, {-27.473000, -18.699000, -30.958000}, 3472, 2503, {470,475,514,476,520,517,513,512,468,469,472,473}},
-  {472, {-21.983000, -12.290000, -37.799000}, 3471, 2504, {473,469,404,466,399,403,406,407,474,475,471,470}},
-  {473, {-20.874000, -17.405000, -36.394000}, 3470, 2505, {472,474,475,477,478,476,471,470,469,404,406,407}},
-  {474, {-16.733000, -18.985000, -37.736000}, 3469, 2506, {477,473,407,472,406,411,476,412,478,404,475}},
-  {475, {-23.567000, -20.582000, -32.925000}, 3468, 2507, {476,471,473,470,469,472,474,477,478,520,517,514}},
-  {476, {-21.279000, -25.158000, -31.262000}, 3467, 2508, {475,478,520,479,522,521,517,514,471,473,474,477}},
-  {477, {-14.498000, -23.456000, -36.111000}, 3466, 2509, {474,412,478,411,479,476,475,473,407,415,414}},
-  {478, {-16.350000, -26.454000, -33.106000}, 3465, 2510, {479,476,477,475,473,474,412,414,415,522,521,520}},
-  {479, {-12.987000, -30.283000, -31.262000}, 3464, 2511, {478,415,522,414,420,525,521,520,476,477,412,419}},
-  {480, {-17.730000,  40.717000,   9.600000}, 3495, 2512, {481,584,436,585,578,435,438,439,482,483,586,581}},
-  {481, {-22.293000,  38.342000,   9.632000}, 3494, 2513, {480,482,483,485,486,484,586,585,584,436,438,439}},
-  {482, {-25.063000,  37.488000,   4.923000}, 3493, 2514, {485,481,439,480,436,438,443,444,488,486,484,483}},
-  {483, {-23.794000,  36.086000,  14.005000}, 3492, 2515, {484,586,481,589,584,480,482,485,486,528,592,585}},
-  {484, {-28.071000,  32.935000,  13.787000}, 3491, 2516, {483,486,528,487,530,529,592,589,586,481,482,485}},
-  {485, {-29.579000,  34.038000,   4.923000}, 3490, 2517, {482,488,486,489,491,487,484,483,481,439,443,444}},
-  {486, {-31.088000,  31.740000,   9.415000}, 3489, 2518, {487,484,485,483,481,482,488,489,491,530,529,528}},
-  {487, {-34.803000,  27.792000,   8.897000}, 3488, 2519, {486,491,530,492,536,533,529,528,484,485,488,489}},
-  {488, {-31.839000,  32.312000,   0.000000}, 3487, 2520, {489,485,444,482,439,443,446,447,490,491,487,486}},
-  {489, {-35.551000,  28.214000,   0.000000}, 3486, 2521, {488,490,491,493,494,492,487,486,485,444,446,447}},
-  {490, {-37.006000,  25.992000,  -4.405000}, 3485, 2522, {493,489,447,488,444,446,451,452,496,494,492,491}},
-  {491, {-37.006000,  25.992000,   4.405000}, 3484, 2523, {492,487,489,486,485,488,490,493,494,536,533,530}},
-  {492, {-39.798000,  21.475000,   4.405000}, 3483, 2524, {491,494,536,495,538,537,533,530,487,489,490,493}},
-  {493, {-39.798000,  21.475000,  -4.405000}, 3482, 2525, {490,496,494,497,499,495,492,491,489,447,451,452}},
-  {494, {-41.134000,  19.180000,   0.000000}, 3481, 2526, {495,492,493,491,489,490,496,497,499,538,537,536}},
-  {495, {-43.139000,  14.027000,   0.000000}, 3480, 2527, {494,499,538,500,544,541,537,536,492,493,496,497}},
-  {496, {-40.423000,  18.699000,  -8.897000}, 3511, 2528, {497,493,452,490,447,451,454,455,498,499,495,494}},
-  {497, {-42.292000,  13.612000,  -9.415000}, 3510, 2529, {496,498,499,501,502,500,495,494,493,452,454,455}},
-  {498, {-42.012000,  10.379000, -13.787000}, 3509, 2530, {501,497,455,496,452,454,459,460,504,502,500,499}},
-  {499, {-43.673000,  11.234000,  -4.923000}, 3508, 2531, {500,495,497,494,493,496,498,501,502,544,541,538}},
-  {500, {-44.739000,   5.651000,  -4.923000}, 3507, 2532, {499,502,544,503,546,545,541,538,495,497,498,501}},
-  {501, {-42.917000,   5.144000, -14.005000}, 3506, 2533, {498,504,502,505,507,503,500,499,497,455,459,460}},
-  {502, {-44.264000,   2.793000,  -9.632000}, 3505, 2534, {503,500,501,499,497,498,504,505,507,546,545,544}},
-  {503, {-44.348000,  -2.351000,  -9.600000}, 3504, 2535, {502,507,546,508,552,549,545,544,500,501,504,505}},
-  {504, {-41.521000,   2.351000, -18.301000}, 3503, 2536, {505,501,460,498,455,459,462,463,506,507,503,502}},
-  {505, {-41.471000,  -2.793000, -18.226000}, 3502, 2537, {504,506,507,509,510,508,503,502,501,460,462,463}},
-  {506, {-39.088000,  -5.651000, -22.314000}, 3501, 2538, {509,505,463,504,460,462,467,468,512,510,508,507}},
-  {507, {-42.952000,  -5.144000, -13.896000}, 3500, 2539, {508,503,505,502,501,504,506,509,510,552,549,546}},
-  {508, {-42.092000, -10.379000, -13.540000}, 3499, 2540, {507,510,552,511,554,553,549,546,503,505,506,509}},
-  {509, {-38.225000, -11.234000, -21.688000}, 3498, 2541, {506,512,510,513,515,511,508,507,505,463,467,468}},
-  {510, {-39.749000, -13.612000, -17.242000}, 3497, 2542, {511,508,509,507,505,506,512,513,515,554,553,552}},
-  {511, {-37.932000, -18.699000, -16.562000}, 3496, 2543, {510,515,554,516,560,557,553,552,508,509,512,513}},
-  {512, {-34.900000, -14.027000, -25.357000}, 3527, 2544, {513,509,468,506,463,467,470,471,514,515,511,510}},
-  {513, {-33.278000, -19.180000, -24.178000}, 3526, 2545, {512,514,515,517,518,516,511,510,509,468,470,471}},
-  {514, {-29.608000, -21.475000, -26.957000}, 3525, 2546, {517,513,471,512,468,470,475,476,520,518,516,515}},
-  {515, {-34.786000, -21.475000, -19.829000}, 3524, 2547, {516,511,513,510,509,512,514,517,518,560,557,554}},
-  {516, {-32.528000, -25.992000, -18.188000}, 3523, 2548, {515,518,560,519,562,561,557,554,511,513,514,517}},
-  {517, {-27.350000, -25.992000, -25.315000}, 3522, 2549, {514,520,518,521,523,519,516,515,513,471,475,476}},
-  {518, {-28.762000, -28.214000, -20.896000}, 3521, 2550, {519,516,517,515,513,514,520,521,523,562,561,560}},
-  {519, {-25.758000, -32.312000, -18.714000}, 3520, 2551, {518,523,562,524,568,565,561,560,516,517,520,521}},
-  {520, {-22.927000, -27.792000, -27.654000}, 3519, 2552, {521,517,476,514,471,475,478,479,522,523,519,518}},
-  {521, {-19.617000, -31.740000, -25.890000}, 3518, 2553, {520,522,523,525,526,524,519,518,517,476,478,479}},
-  {522, {-14.607000, -32.935000, -27.654000}, 3517, 2554, {525,521,479,520,476,478,415,419,420,526,524,523}},
-  {523, {-21.037000, -34.038000, -21.369000}, 3516, 2555, {524,519,521,518,517,520,522,525,526,568,565,562}},
-  {524, {-17.383000, -37.488000, -18.714000}, 3515, 2556, {523,526,568,527,570,569,565,562,519,521,522,525}},
-  {525, {-11.018000, -36.086000, -25.316000}, 3514, 2557, {522,420,526,419,423,527,524,523,521,479,415,422}},
-  {526, {-12.374000, -38.342000, -20.896000}, 3513, 2558, {527,524,525,523,521,522,420,422,423,570,569,568}},
-  {527, { -8.702000, -40.717000, -18.188000}, 3512, 2559, {526,423,570,422,428,573,569,568,524,525,420,427}},
-  {528, {-28.882000,  30.283000,  17.658000}, 3543, 2560, {529,592,484,593,586,483,486,487,530,531,594,589}},
-  {529, {-32.687000,  26.454000,  17.173000}, 3542, 2561, {528,530,531,533,534,532,594,593,592,484,486,487}},
-  {530, {-35.591000,  25.158000,  12.784000}, 3541, 2562, {533,529,487,528,484,486,491,492,536,534,532,531}},
-  {531, {-32.954000,  23.456000,  20.693000}, 3540, 2563, {532,594,529,597,528,530,533,534,600,592,593}},
-  {532, {-35.718000,  18.985000,  20.693000}, 3539, 2564, {531,534,600,535,601,597,530,594,529,602,533}},
-  {533, {-38.419000,  20.582000,  12.784000}, 3538, 2565, {530,536,534,537,539,535,532,531,529,487,491,492}},
-  {534, {-38.279000,  17.405000,  17.173000}, 3537, 2566, {535,532,533,531,529,530,536,537,539,602,601,600}},
-  {535, {-40.003000,  12.290000,  17.658000}, 3536, 2567, {534,539,602,540,608,605,601,600,532,533,536,537}},
-  {536, {-40.423000,  18.699000,   8.897000}, 3535, 2568, {537,533,492,530,487,491,494,495,538,539,535,534}},
-  {537, {-42.292000,  13.612000,   9.415000}, 3534, 2569, {536,538,539,541,542,540,535,534,533,492,494,495}},
-  {538, {-43.673000,  11.234000,   4.923000}, 3533, 2570, {541,537,495,536,492,494,499,500,544,542,540,539}},
-  {539, {-42.012000,  10.379000,  13.787000}, 3532, 2571, {540,535,537,534,533,536,538,541,542,608,605,602}},
-  {540, {-42.917000,   5.144000,  14.005000}, 3531, 2572, {539,542,608,543,610,609,605,602,535,537,538,541}},
-  {541, {-44.739000,   5.651000,   4.923000}, 3530, 2573, {538,544,542,545,547,543,540,539,537,495,499,500}},
-  {542, {-44.264000,   2.793000,   9.632000}, 3529, 2574, {543,540,541,539,537,538,544,545,547,610,609,608}},
-  {543, {-44.348000,  -2.351000,   9.600000}, 3528, 2575, {542,547,610,548,616,613,609,608,540,541,544,545}},
-  {544, {-45.272000,   2.859000,   0.000000}, 3559, 2576, {545,541,500,538,495,499,502,503,546,547,543,542}},
-  {545, {-45.351000,  -2.406000,   0.000000}, 3558, 2577, {544,546,547,549,550,548,543,542,541,500,502,503}},
-  {546, {-44.903000,  -4.758000,  -4.890000}, 3557, 2578, {549,545,503,544,500,502,507,508,552,550,548,547}},
-  {547, {-44.903000,  -4.758000,   4.890000}, 3556, 2579, {548,543,545,542,541,544,546,549,550,616,613,610}},
-  {548, {-44.156000,  -9.460000,   4.874000}, 3555, 2580, {547,550,616,551,618,617,613,610,543,545,546,549}},
-  {549, {-44.156000,  -9.460000,  -4.874000}, 3554, 2581, {546,552,550,553,555,551,548,547,545,503,507,508}},
-  {550, {-43.859000, -11.811000,   0.000000}, 3553, 2582, {551,548,549,547,545,546,552,553,555,618,617,616}},
-  {551, {-42.441000, -16.220000,   0.000000}, 3552, 2583, {550,555,618,556,621,617,616,548,549,552,553}},
-  {552, {-42.742000, -12.290000,  -9.228000}, 3551, 2584, {553,549,508,546,503,507,510,511,554,555,551,550}},
-  {553, {-41.062000, -17.405000,  -8.607000}, 3550, 2585, {552,554,555,557,558,556,551,550,549,508,510,511}},
-  {554, {-38.596000, -20.582000, -12.240000}, 3549, 2586, {557,553,511,552,508,510,515,516,560,558,556,555}},
-  {555, {-41.059000, -18.985000,  -4.254000}, 3548, 2587, {556,551,553,550,552,554,557,558,621,549,618}},
-  {556, {-38.824000, -23.456000,  -2.629000}, 3547, 2588, {555,558,621,559,618,622,554,551,553,623,557}},
-  {557, {-36.308000, -25.158000, -10.577000}, 3546, 2589, {554,560,558,561,563,559,556,555,553,511,515,516}},
-  {558, {-36.539000, -26.454000,  -5.319000}, 3545, 2590, {559,556,557,555,553,554,560,561,563,623,622,621}},
-  {559, {-33.745000, -30.283000,  -2.691000}, 3544, 2591, {558,563,623,564,669,622,666,621,556,557,560,561}},
-  {560, {-33.386000, -27.792000, -13.259000}, 3575, 2592, {561,557,516,554,511,515,518,519,562,563,559,558}},
-  {561, {-30.685000, -31.740000, -10.656000}, 3574, 2593, {560,562,563,565,566,564,559,558,557,516,518,519}},
-  {562, {-26.824000, -34.038000, -13.403000}, 3573, 2594, {565,561,519,560,516,518,523,524,568,566,564,563}},
-  {563, {-30.814000, -32.935000,  -5.346000}, 3572, 2595, {564,559,561,558,557,560,562,565,566,669,666,623}},
-  {564, {-27.482000, -36.086000,  -2.655000}, 3571, 2596, {563,566,669,567,671,666,670,623,559,561,562,565}},
-  {565, {-23.170000, -37.488000, -10.749000}, 3570, 2597, {562,568,566,569,571,567,564,563,561,519,523,524}},
-  {566, {-23.697000, -38.342000,  -5.311000}, 3569, 2598, {567,564,565,563,561,562,568,569,571,671,670,669}},
-  {567, {-19.987000, -40.717000,  -2.655000}, 3568, 2599, {566,571,671,572,717,670,714,669,564,565,568,569}},
-  {568, {-18.449000, -39.214000, -13.403000}, 3567, 2600, {569,565,524,562,519,523,526,527,570,571,567,566}},
-  {569, {-14.668000, -41.639000, -10.656000}, 3566, 2601, {568,570,571,573,574,572,567,566,565,524,526,527}},
-  {570, { -9.929000, -42.290000, -13.258000}, 3565, 2602, {573,569,527,568,524,526,423,427,428,574,572,571}},
-  {571, {-15.678000, -42.290000,  -5.346000}, 3564, 2603, {572,567,569,566,565,568,570,573,574,717,714,671}},
-  {572, {-11.996000, -43.725000,  -2.690000}, 3563, 2604, {571,574,717,575,719,714,718,671,567,569,570,573}},
-  {573, { -6.266000, -43.725000, -10.577000}, 3562, 2605, {570,428,574,427,431,575,572,571,569,527,423,430}},
-  {574, { -7.322000, -44.510000,  -5.320000}, 3561, 2606, {575,572,573,571,569,570,428,430,431,719,718,717}},
-  {575, { -3.619000, -45.214000,  -2.629000}, 3560, 2607, {574,431,719,430,718,143,717,572,573,428,287}},
-  {576, { -1.382000,  45.214000,   4.254000}, 3591, 2608, {577,0,432,1,433,288,435,578,579,2,144}},
-  {577, { -2.797000,  44.510000,   8.608000}, 3590, 2609, {576,578,579,581,582,580,2,1,0,432,433,435}},
-  {578, { -8.123000,  43.725000,   9.227000}, 3589, 2610, {581,577,435,576,432,436,433,480,584,582,580,579}},
-  {579, {  1.148000,  43.725000,  12.240000}, 3588, 2611, {580,2,577,5,0,576,578,581,582,624,8,1}},
-  {580, { -0.240000,  42.290000,  16.562000}, 3587, 2612, {579,582,624,583,626,625,8,5,2,577,578,581}},
-  {581, { -9.541000,  42.290000,  13.540000}, 3586, 2613, {578,584,582,585,587,583,580,579,577,435,436,480}},
-  {582, { -5.603000,  41.639000,  17.243000}, 3585, 2614, {583,580,581,579,577,578,584,585,587,626,625,624}},
-  {583, { -7.047000,  39.214000,  21.687000}, 3584, 2615, {582,587,626,588,632,629,625,624,580,581,584,585}},
-  {584, {-14.609000,  40.717000,  13.896000}, 3583, 2616, {585,581,480,578,435,481,436,483,586,587,583,582}},
-  {585, {-16.050000,  38.342000,  18.226000}, 3582, 2617, {584,586,587,589,590,588,583,582,581,480,481,483}},
-  {586, {-20.672000,  36.086000,  18.301000}, 3581, 2618, {589,585,483,584,480,484,481,528,592,590,588,587}},
-  {587, {-12.427000,  37.488000,  22.315000}, 3580, 2619, {588,583,585,582,581,584,586,589,590,632,629,626}},
-  {588, {-13.823000,  34.038000,  26.610000}, 3579, 2620, {587,590,632,591,634,633,629,626,583,585,586,589}},
-  {589, {-21.787000,  32.935000,  22.437000}, 3578, 2621, {586,592,590,593,595,591,588,587,585,483,484,528}},
-  {590, {-18.561000,  31.740000,  26.657000}, 3577, 2622, {591,588,589,587,585,586,592,593,595,634,633,632}},
-  {591, {-19.216000,  27.792000,  30.350000}, 3576, 2623, {590,595,634,596,640,637,633,632,588,589,592,593}},
-  {592, {-25.719000,  30.283000,  22.012000}, 3607, 2624, {593,589,528,586,483,529,484,531,594,595,591,590}},
-  {593, {-26.434000,  26.454000,  25.780000}, 3606, 2625, {592,594,595,597,598,596,591,590,589,528,529,531}},
-  {594, {-29.864000,  23.456000,  24.947000}, 3605, 2626, {597,593,531,592,532,529,596,600,598,528,595}},
-  {595, {-23.157000,  25.158000,  29.898000}, 3604, 2627, {596,591,593,590,589,592,594,597,598,640,637,634}},
-  {596, {-24.031000,  20.582000,  32.589000}, 3603, 2628, {595,598,640,599,642,641,637,634,591,593,594,597}},
-  {597, {-30.718000,  18.985000,  27.575000}, 3602, 2629, {594,600,598,601,599,596,595,593,531,603,532}},
-  {598, {-28.162000,  17.405000,  31.100000}, 3601, 2630, {599,596,597,595,593,594,600,601,603,642,641,640}},
-  {599, {-29.155000,  12.290000,  32.589000}, 3600, 2631, {598,603,642,604,648,645,641,640,596,597,600,601}},
-  {600, {-34.335000,  16.220000,  24.947000}, 3599, 2632, {601,597,532,594,531,534,535,602,603,599,598}},
-  {601, {-35.482000,  11.811000,  25.780000}, 3598, 2633, {600,602,603,605,606,604,599,598,597,532,534,535}},
-  {602, {-38.588000,   9.460000,  22.012000}, 3597, 2634, {605,601,535,600,532,534,539,540,608,606,604,603}},
-  {603, {-32.858000,   9.460000,  29.898000}, 3596, 2635, {604,599,601,598,597,600,602,605,606,648,645,642}},
-  {604, {-33.452000,   4.758000,  30.349000}, 3595, 2636, {603,606,648,607,650,649,645,642,599,601,602,605}},
-  {605, {-39.201000,   4.758000,  22.437000}, 3594, 2637, {602,608,606,609,611,607,604,603,601,535,539,540}},
-  {606, {-36.690000,   2.406000,  26.657000}, 3593, 2638, {607,604,605,603,601,602,608,609,611,650,649,648}},
-  {607, {-36.626000,  -2.859000,  26.611000}, 3592, 2639, {606,611,650,612,656,653,649,648,604,605,608,609}},
-  {608, {-41.521000,   2.351000,  18.301000}, 3623, 2640, {609,605,540,602,535,539,542,543,610,611,607,606}},
-  {609, {-41.471000,  -2.793000,  18.226000}, 3622, 2641, {608,610,611,613,614,612,607,606,605,540,542,543}},
-  {610, {-42.952000,  -5.144000,  13.896000}, 3621, 2642, {613,609,543,608,540,542,547,548,616,614,612,611}},
-  {611, {-39.088000,  -5.651000,  22.314000}, 3620, 2643, {612,607,609,606,605,608,610,613,614,656,653,650}},
-  {612, {-38.225000, -11.234000,  21.688000}, 3619, 2644, {611,614,656,615,658,657,653,650,607,609,610,613}},
-  {613, {-42.092000, -10.379000,  13.540000}, 3618, 2645, {610,616,614,617,619,615,612,611,609,543,547,548}},
-  {614, {-39.749000, -13.612000,  17.242000}, 3617, 2646, {615,612,613,611,609,610,616,617,619,658,657,656}},
-  {615, {-37.932000, -18.699000,  16.562000}, 3616, 2647, {614,619,658,620,664,661,657,656,612,613,616,617}},
-  {616, {-42.742000, -12.290000,   9.228000}, 3615, 2648, {617,613,548,610,543,547,550,551,618,619,615,614}},
-  {617, {-41.062000, -17.405000,   8.607000}, 3614, 2649, {616,618,619,621,622,620,615,614,613,548,550,551}},
-  {618, {-41.059000, -18.985000,   4.254000}, 3613, 2650, {621,617,551,616,550,555,620,556,622,548,619}},
-  {619, {-38.596000, -20.582000,  12.240000}, 3612, 2651, {620,615,617,614,613,616,618,621,622,664,661,658}},
-  {620, {-36.308000, -25.158000,  10.577000}, 3611, 2652, {619,622,664,623,666,665,661,658,615,617,618,621}},
-  {621, {-38.824000, -23.456000,   2.629000}, 3610, 2653, {618,556,622,555,623,620,619,617,551,559,558}},
-  {622, {-36.539000, -26.454000,   5.319000}, 3609, 2654, {623,620,621,619,617,618,556,558,559,666,665,664}},
-  {623, {-33.745000, -30.283000,   2.691000}, 3608, 2655, {622,559,666,558,564,669,665,664,620,621,556,563}},
-  {624, {  3.651000,  40.717000,  19.829000}, 3639, 2656, {625,8,580,9,2,579,582,583,626,627,10,5}},
-  {625, {  2.271000,  38.342000,  24.178000}, 3638, 2657, {624,626,627,629,630,628,10,9,8,580,582,583}},
-  {626, { -3.063000,  37.488000,  25.357000}, 3637, 2658, {629,625,583,624,580,582,587,588,632,630,628,627}},
-  {627, {  5.967000,  36.086000,  26.957000}, 3636, 2659, {628,10,625,13,8,624,626,629,630,672,16,9}},
-  {628, {  4.437000,  32.935000,  30.958000}, 3635, 2660, {627,630,672,631,674,673,16,13,10,625,626,629}},
-  {629, { -4.459000,  34.038000,  29.653000}, 3634, 2661, {626,632,630,633,635,631,628,627,625,583,587,588}},
-  {630, { -0.653000,  31.740000,  32.476000}, 3633, 2662, {631,628,629,627,625,626,632,633,635,674,673,672}},
-  {631, { -2.293000,  27.792000,  35.849000}, 3632, 2663, {630,635,674,636,680,677,673,672,628,629,632,633}},
-  {632, { -9.839000,  32.312000,  30.280000}, 3631, 2664, {633,629,588,626,583,587,590,591,634,635,631,630}},
-  {633, {-10.986000,  28.214000,  33.811000}, 3630, 2665, {632,634,635,637,638,636,631,630,629,588,590,591}},
-  {634, {-15.625000,  25.992000,  33.834000}, 3629, 2666, {637,633,591,632,588,590,595,596,640,638,636,635}},
-  {635, { -7.246000,  25.992000,  36.556000}, 3628, 2667, {636,631,633,630,629,632,634,637,638,680,677,674}},
-  {636, { -8.109000,  21.475000,  39.212000}, 3627, 2668, {635,638,680,639,682,681,677,674,631,633,634,637}},
-  {637, {-16.488000,  21.475000,  36.489000}, 3626, 2669, {634,640,638,641,643,639,636,635,633,591,595,596}},
-  {638, {-12.711000,  19.180000,  39.121000}, 3625, 2670, {639,636,637,635,633,634,640,641,643,682,681,680}},
-  {639, {-13.331000,  14.027000,  41.028000}, 3624, 2671, {638,643,682,644,688,685,681,680,636,637,640,641}},
-  {640, {-20.953000,  18.699000,  35.695000}, 3655, 2672, {641,637,596,634,591,595,598,599,642,643,639,638}},
-  {641, {-22.023000,  13.612000,  37.313000}, 3654, 2673, {640,642,643,645,646,644,639,638,637,596,598,599}},
-  {642, {-26.095000,  10.379000,  35.696000}, 3653, 2674, {645,641,599,640,596,598,603,604,648,646,644,643}},
-  {643, {-18.178000,  11.234000,  40.014000}, 3652, 2675, {644,639,641,638,637,640,642,645,646,688,685,682}},
-  {644, {-18.507000,   5.651000,  41.028000}, 3651, 2676, {643,646,688,647,690,689,685,682,639,641,642,645}},
-  {645, {-26.582000,   5.144000,  36.489000}, 3650, 2677, {642,648,646,649,651,647,644,643,641,599,603,604}},
-  {646, {-22.839000,   2.793000,  39.121000}, 3649, 2678, {647,644,645,643,641,642,648,649,651,690,689,688}},
-  {647, {-22.835000,  -2.351000,  39.211000}, 3648, 2679, {646,651,690,652,696,693,689,688,644,645,648,649}},
-  {648, {-30.235000,   2.351000,  33.834000}, 3647, 2680, {649,645,604,642,599,603,606,607,650,651,647,646}},
-  {649, {-30.148000,  -2.793000,  33.810000}, 3646, 2681, {648,650,651,653,654,652,647,646,645,604,606,607}},
-  {650, {-33.301000,  -5.651000,  30.280000}, 3645, 2682, {653,649,607,648,604,606,611,612,656,654,652,651}},
-  {651, {-26.488000,  -5.144000,  36.557000}, 3644, 2683, {652,647,649,646,645,648,650,653,654,696,693,690}},
-  {652, {-25.884000, -10.379000,  35.848000}, 3643, 2684, {651,654,696,655,698,697,693,690,647,649,650,653}},
-  {653, {-32.438000, -11.234000,  29.653000}, 3642, 2685, {650,656,654,657,659,655,652,651,649,607,611,612}},
-  {654, {-28.681000, -13.612000,  32.476000}, 3641, 2686, {655,652,653,651,649,650,656,657,659,698,697,696}},
-  {655, {-27.473000, -18.699000,  30.958000}, 3640, 2687, {654,659,698,660,704,701,697,696,652,653,656,657}},
-  {656, {-34.900000, -14.027000,  25.357000}, 3671, 2688, {657,653,612,650,607,611,614,615,658,659,655,654}},
-  {657, {-33.278000, -19.180000,  24.178000}, 3670, 2689, {656,658,659,661,662,660,655,654,653,612,614,615}},
-  {658, {-34.786000, -21.475000,  19.829000}, 3669, 2690, {661,657,615,656,612,614,619,620,664,662,660,659}},
-  {659, {-29.608000, -21.475000,  26.957000}, 3668, 2691, {660,655,657,654,653,656,658,661,662,704,701,698}},
-  {660, {-27.350000, -25.992000,  25.315000}, 3667, 2692, {659,662,704,663,706,705,701,698,655,657,658,661}},
-  {661, {-32.528000, -25.992000,  18.188000}, 3666, 2693, {658,664,662,665,667,663,660,659,657,615,619,620}},
-  {662, {-28.762000, -28.214000,  20.896000}, 3665, 2694, {663,660,661,659,657,658,664,665,667,706,705,704}},
-  {663, {-25.758000, -32.312000,  18.714000}, 3664, 2695, {662,667,706,668,712,709,705,704,660,661,664,665}},
-  {664, {-33.386000, -27.792000,  13.259000}, 3663, 2696, {665,661,620,658,615,619,622,623,666,667,663,662}},
-  {665, {-30.685000, -31.740000,  10.656000}, 3662, 2697, {664,666,667,669,670,668,663,662,661,620,622,623}},
-  {666, {-30.814000, -32.935000,   5.346000}, 3661, 2698, {669,665,623,664,620,622,559,563,564,670,668,667}},
-  {667, {-26.824000, -34.038000,  13.403000}, 3660, 2699, {668,663,665,662,661,664,666,669,670,712,709,706}},
-  {668, {-23.170000, -37.488000,  10.749000}, 3659, 2700, {667,670,712,671,714,713,709,706,663,665,666,669}},
-  {669, {-27.482000, -36.086000,   2.655000}, 3658, 2701, {666,564,670,563,567,671,668,667,665,623,559,566}},
-  {670, {-23.697000, -38.342000,   5.311000}, 3657, 2702, {671,668,669,667,665,666,564,566,567,714,713,712}},
-  {671, {-19.987000, -40.717000,   2.655000}, 3656, 2703, {670,567,714,566,572,717,713,712,668,669,564,571}},
-  {672, {  7.868000,  30.283000,  32.925000}, 3687, 2704, {673,16,628,17,10,627,630,631,674,675,18,13}},
-  {673, {  6.231000,  26.454000,  36.394000}, 3686, 2705, {672,674,675,677,678,676,18,17,16,628,630,631}},
-  {674, {  1.160000,  25.158000,  37.799000}, 3685, 2706, {677,673,631,672,628,630,635,636,680,678,676,675}},
-  {675, {  9.497000,  23.456000,  37.736000}, 3684, 2707, {676,18,673,21,672,674,677,678,24,16,17}},
-  {676, {  8.643000,  18.985000,  40.364000}, 3683, 2708, {675,678,24,679,25,21,674,18,673,26,677}},
-  {677, {  0.286000,  20.582000,  40.490000}, 3682, 2709, {674,680,678,681,683,679,676,675,673,631,635,636}},
-  {678, {  4.503000,  17.405000,  41.713000}, 3681, 2710, {679,676,677,675,673,674,680,681,683,26,25,24}},
-  {679, {  4.432000,  12.290000,  43.502000}, 3680, 2711, {678,683,26,684,32,29,25,24,676,677,680,681}},
-  {680, { -4.030000,  18.699000,  41.194000}, 3679, 2712, {681,677,636,674,631,635,638,639,682,683,679,678}},
-  {681, { -4.115000,  13.612000,  43.132000}, 3678, 2713, {680,682,683,685,686,684,679,678,677,636,638,639}},
-  {682, { -8.814000,  11.234000,  43.057000}, 3677, 2714, {685,681,639,680,636,638,643,644,688,686,684,683}},
-  {683, {  0.130000,  10.379000,  44.216000}, 3676, 2715, {684,679,681,678,677,680,682,685,686,32,29,26}},
-  {684, {  0.057000,   5.144000,  45.145000}, 3675, 2716, {683,686,32,687,34,33,29,26,679,681,682,685}},
-  {685, { -9.143000,   5.651000,  44.071000}, 3674, 2717, {682,688,686,689,691,687,684,683,681,639,643,644}},
-  {686, { -4.518000,   2.793000,  45.074000}, 3673, 2718, {687,684,685,683,681,682,688,689,691,34,33,32}},
-  {687, { -4.574000,  -2.351000,  45.145000}, 3672, 2719, {686,691,34,692,40,37,33,32,684,685,688,689}},
-  {688, {-13.990000,   2.859000,  43.057000}, 3703, 2720, {689,685,644,682,639,643,646,647,690,691,687,686}},
-  {689, {-14.014000,  -2.406000,  43.132000}, 3702, 2721, {688,690,691,693,694,692,687,686,685,644,646,647}},
-  {690, {-18.526000,  -4.758000,  41.194000}, 3701, 2722, {693,689,647,688,644,646,651,652,696,694,692,691}},
-  {691, { -9.225000,  -4.758000,  44.216000}, 3700, 2723, {692,687,689,686,685,688,690,693,694,40,37,34}},
-  {692, { -9.010000,  -9.460000,  43.502000}, 3699, 2724, {691,694,40,695,42,41,37,34,687,689,690,693}},
-  {693, {-18.281000,  -9.460000,  40.489000}, 3698, 2725, {690,696,694,697,699,695,692,691,689,647,651,652}},
-  {694, {-13.553000, -11.811000,  41.713000}, 3697, 2726, {695,692,693,691,689,690,696,697,699,42,41,40}},
-  {695, {-13.115000, -16.220000,  40.364000}, 3696, 2727, {694,699,42,700,45,41,40,692,693,696,697}},
-  {696, {-21.983000, -12.290000,  37.799000}, 3695, 2728, {697,693,652,690,647,651,654,655,698,699,695,694}},
-  {697, {-20.874000, -17.405000,  36.394000}, 3694, 2729, {696,698,699,701,702,700,695,694,693,652,654,655}},
-  {698, {-23.567000, -20.582000,  32.925000}, 3693, 2730, {701,697,655,696,652,654,659,660,704,702,700,699}},
-  {699, {-16.733000, -18.985000,  37.736000}, 3692, 2731, {700,695,697,694,696,698,701,702,45,693,42}},
-  {700, {-14.498000, -23.456000,  36.111000}, 3691, 2732, {699,702,45,703,42,46,698,695,697,47,701}},
-  {701, {-21.279000, -25.158000,  31.262000}, 3690, 2733, {698,704,702,705,707,703,700,699,697,655,659,660}},
-  {702, {-16.350000, -26.454000,  33.106000}, 3689, 2734, {703,700,701,699,697,698,704,705,707,47,46,45}},
-  {703, {-12.987000, -30.283000,  31.262000}, 3688, 2735, {702,707,47,708,93,46,90,45,700,701,704,705}},
-  {704, {-22.927000, -27.792000,  27.654000}, 3719, 2736, {705,701,660,698,655,659,662,663,706,707,703,702}},
-  {705, {-19.617000, -31.740000,  25.890000}, 3718, 2737, {704,706,707,709,710,708,703,702,701,660,662,663}},
-  {706, {-21.037000, -34.038000,  21.369000}, 3717, 2738, {709,705,663,704,660,662,667,668,712,710,708,707}},
-  {707, {-14.607000, -32.935000,  27.654000}, 3716, 2739, {708,703,705,702,701,704,706,709,710,93,90,47}},
-  {708, {-11.018000, -36.086000,  25.316000}, 3715, 2740, {707,710,93,711,95,90,94,47,703,705,706,709}},
-  {709, {-17.383000, -37.488000,  18.714000}, 3714, 2741, {706,712,710,713,715,711,708,707,705,663,667,668}},
-  {710, {-12.374000, -38.342000,  20.896000}, 3713, 2742, {711,708,709,707,705,706,712,713,715,95,94,93}},
-  {711, { -8.702000, -40.717000,  18.188000}, 3712, 2743, {710,715,95,716,141,94,138,93,708,709,712,713}},
-  {712, {-18.449000, -39.214000,  13.403000}, 3711, 2744, {713,709,668,706,663,667,670,671,714,715,711,710}},
-  {713, {-14.668000, -41.639000,  10.656000}, 3710, 2745, {712,714,715,717,718,716,711,710,709,668,670,671}},
-  {714, {-15.678000, -42.290000,   5.346000}, 3709, 2746, {717,713,671,712,668,670,567,571,572,718,716,715}},
-  {715, { -9.929000, -42.290000,  13.258000}, 3708, 2747, {716,711,713,710,709,712,714,717,718,141,138,95}},
-  {716, { -6.266000, -43.725000,  10.577000}, 3707, 2748, {715,718,141,719,143,138,142,95,711,713,714,717}},
-  {717, {-11.996000, -43.725000,   2.690000}, 3706, 2749, {714,572,718,571,575,719,716,715,713,671,567,574}},
-  {718, { -7.322000, -44.510000,   5.320000}, 3705, 2750, {719,716,717,715,713,714,572,574,575,143,142,141}},
-  {719, { -3.619000, -45.214000,   2.629000}, 3704, 2751, {718,575,143,574,142,287,141,716,717,572,431}},
+constexpr ant::expconfig::detector::CB::row_t
+ant::expconfig::detector::CB::elements_table[] = {
+  // element number, {xyz}, ADC, TDC, neighbours begin/end in neighbours_table
+  {  0, {  3.619000,  45.214000,   2.629000}, 3015, 2032,    0,   11},
+  {  1, {  7.322000,  44.510000,   5.320000}, 3014, 2033,   11,   23},
+  {  2, {  6.266000,  43.725000,  10.577000}, 3013, 2034,   23,   35},
+  {  3, { 11.996000,  43.725000,   2.690000}, 3012, 2035,   35,   47},
+  {  4, { 15.678000,  42.290000,   5.346000}, 3011, 2036,   47,   59},
+  {  5, {  9.929000,  42.290000,  13.258000}, 3010, 2037,   59,   71},
+  {  6, { 14.668000,  41.639000,  10.656000}, 3009, 2038,   71,   83},
+  {  7, { 18.449000,  39.214000,  13.403000}, 3008, 2039,   83,   95},
+  {  8, {  8.702000,  40.717000,  18.188000}, 3007, 2040,   95,  107},
+  {  9, { 12.374000,  38.342000,  20.896000}, 3006, 2041,  107,  119},
+  { 10, { 11.018000,  36.086000,  25.316000}, 3005, 2042,  119,  131},
+  { 11, { 17.383000,  37.488000,  18.714000}, 3004, 2043,  131,  143},
+  { 12, { 21.037000,  34.038000,  21.369000}, 3003, 2044,  143,  155},
+  { 13, { 14.607000,  32.935000,  27.654000}, 3002, 2045,  155,  167},
+  { 14, { 19.617000,  31.740000,  25.890000}, 3001, 2046,  167,  179},
+  { 15, { 22.927000,  27.792000,  27.654000}, 3000, 2047,  179,  191},
+  { 16, { 12.987000,  30.283000,  31.262000}, 3031, 2048,  191,  203},
+  { 17, { 16.350000,  26.454000,  33.106000}, 3030, 2049,  203,  215},
+  { 18, { 14.498000,  23.456000,  36.111000}, 3029, 2050,  215,  226},
+  { 19, { 21.279000,  25.158000,  31.262000}, 3028, 2051,  226,  238},
+  { 20, { 23.567000,  20.582000,  32.925000}, 3027, 2052,  238,  250},
+  { 21, { 16.733000,  18.985000,  37.736000}, 3026, 2053,  250,  261},
+  { 22, { 20.874000,  17.405000,  36.394000}, 3025, 2054,  261,  273},
+  { 23, { 21.983000,  12.290000,  37.799000}, 3024, 2055,  273,  285},
+  { 24, { 13.115000,  16.220000,  40.364000}, 3023, 2056,  285,  296},
+  { 25, { 13.553000,  11.811000,  41.713000}, 3022, 2057,  296,  308},
+  { 26, {  9.010000,   9.460000,  43.502000}, 3021, 2058,  308,  320},
+  { 27, { 18.281000,   9.460000,  40.489000}, 3020, 2059,  320,  332},
+  { 28, { 18.526000,   4.758000,  41.194000}, 3019, 2060,  332,  344},
+  { 29, {  9.225000,   4.758000,  44.216000}, 3018, 2061,  344,  356},
+  { 30, { 14.014000,   2.406000,  43.132000}, 3017, 2062,  356,  368},
+  { 31, { 13.990000,  -2.859000,  43.057000}, 3016, 2063,  368,  380},
+  { 32, {  4.574000,   2.351000,  45.145000}, 3047, 2064,  380,  392},
+  { 33, {  4.518000,  -2.793000,  45.074000}, 3046, 2065,  392,  404},
+  { 34, { -0.057000,  -5.144000,  45.145000}, 3045, 2066,  404,  416},
+  { 35, {  9.143000,  -5.651000,  44.071000}, 3044, 2067,  416,  428},
+  { 36, {  8.814000, -11.234000,  43.057000}, 3043, 2068,  428,  440},
+  { 37, { -0.130000, -10.379000,  44.216000}, 3042, 2069,  440,  452},
+  { 38, {  4.115000, -13.612000,  43.132000}, 3041, 2070,  452,  464},
+  { 39, {  4.030000, -18.699000,  41.194000}, 3040, 2071,  464,  476},
+  { 40, { -4.432000, -12.290000,  43.502000}, 3039, 2072,  476,  488},
+  { 41, { -4.503000, -17.405000,  41.713000}, 3038, 2073,  488,  500},
+  { 42, { -8.643000, -18.985000,  40.364000}, 3037, 2074,  500,  511},
+  { 43, { -0.286000, -20.582000,  40.490000}, 3036, 2075,  511,  523},
+  { 44, { -1.160000, -25.158000,  37.799000}, 3035, 2076,  523,  535},
+  { 45, { -9.497000, -23.456000,  37.736000}, 3034, 2077,  535,  546},
+  { 46, { -6.231000, -26.454000,  36.394000}, 3033, 2078,  546,  558},
+  { 47, { -7.868000, -30.283000,  32.925000}, 3032, 2079,  558,  570},
+  { 48, { 19.987000,  40.717000,   2.655000}, 3063, 2080,  570,  582},
+  { 49, { 23.697000,  38.342000,   5.311000}, 3062, 2081,  582,  594},
+  { 50, { 23.170000,  37.488000,  10.749000}, 3061, 2082,  594,  606},
+  { 51, { 27.482000,  36.086000,   2.655000}, 3060, 2083,  606,  618},
+  { 52, { 30.814000,  32.935000,   5.346000}, 3059, 2084,  618,  630},
+  { 53, { 26.824000,  34.038000,  13.403000}, 3058, 2085,  630,  642},
+  { 54, { 30.685000,  31.740000,  10.656000}, 3057, 2086,  642,  654},
+  { 55, { 33.386000,  27.792000,  13.259000}, 3056, 2087,  654,  666},
+  { 56, { 25.758000,  32.312000,  18.714000}, 3055, 2088,  666,  678},
+  { 57, { 28.762000,  28.214000,  20.896000}, 3054, 2089,  678,  690},
+  { 58, { 27.350000,  25.992000,  25.315000}, 3053, 2090,  690,  702},
+  { 59, { 32.528000,  25.992000,  18.188000}, 3052, 2091,  702,  714},
+  { 60, { 34.786000,  21.475000,  19.829000}, 3051, 2092,  714,  726},
+  { 61, { 29.608000,  21.475000,  26.957000}, 3050, 2093,  726,  738},
+  { 62, { 33.278000,  19.180000,  24.178000}, 3049, 2094,  738,  750},
+  { 63, { 34.900000,  14.027000,  25.357000}, 3048, 2095,  750,  762},
+  { 64, { 27.473000,  18.699000,  30.958000}, 3079, 2096,  762,  774},
+  { 65, { 28.681000,  13.612000,  32.476000}, 3078, 2097,  774,  786},
+  { 66, { 25.884000,  10.379000,  35.848000}, 3077, 2098,  786,  798},
+  { 67, { 32.438000,  11.234000,  29.653000}, 3076, 2099,  798,  810},
+  { 68, { 33.301000,   5.651000,  30.280000}, 3075, 2100,  810,  822},
+  { 69, { 26.488000,   5.144000,  36.557000}, 3074, 2101,  822,  834},
+  { 70, { 30.148000,   2.793000,  33.810000}, 3073, 2102,  834,  846},
+  { 71, { 30.235000,  -2.351000,  33.834000}, 3072, 2103,  846,  858},
+  { 72, { 22.835000,   2.351000,  39.211000}, 3071, 2104,  858,  870},
+  { 73, { 22.839000,  -2.793000,  39.121000}, 3070, 2105,  870,  882},
+  { 74, { 18.507000,  -5.651000,  41.028000}, 3069, 2106,  882,  894},
+  { 75, { 26.582000,  -5.144000,  36.489000}, 3068, 2107,  894,  906},
+  { 76, { 26.095000, -10.379000,  35.696000}, 3067, 2108,  906,  918},
+  { 77, { 18.178000, -11.234000,  40.014000}, 3066, 2109,  918,  930},
+  { 78, { 22.023000, -13.612000,  37.313000}, 3065, 2110,  930,  942},
+  { 79, { 20.953000, -18.699000,  35.695000}, 3064, 2111,  942,  954},
+  { 80, { 13.331000, -14.027000,  41.028000}, 3095, 2112,  954,  966},
+  { 81, { 12.711000, -19.180000,  39.121000}, 3094, 2113,  966,  978},
+  { 82, {  8.109000, -21.475000,  39.212000}, 3093, 2114,  978,  990},
+  { 83, { 16.488000, -21.475000,  36.489000}, 3092, 2115,  990, 1002},
+  { 84, { 15.625000, -25.992000,  33.834000}, 3091, 2116, 1002, 1014},
+  { 85, {  7.246000, -25.992000,  36.556000}, 3090, 2117, 1014, 1026},
+  { 86, { 10.986000, -28.214000,  33.811000}, 3089, 2118, 1026, 1038},
+  { 87, {  9.839000, -32.312000,  30.280000}, 3088, 2119, 1038, 1050},
+  { 88, {  2.293000, -27.792000,  35.849000}, 3087, 2120, 1050, 1062},
+  { 89, {  0.653000, -31.740000,  32.476000}, 3086, 2121, 1062, 1074},
+  { 90, { -4.437000, -32.935000,  30.958000}, 3085, 2122, 1074, 1086},
+  { 91, {  4.459000, -34.038000,  29.653000}, 3084, 2123, 1086, 1098},
+  { 92, {  3.063000, -37.488000,  25.357000}, 3083, 2124, 1098, 1110},
+  { 93, { -5.967000, -36.086000,  26.957000}, 3082, 2125, 1110, 1122},
+  { 94, { -2.271000, -38.342000,  24.178000}, 3081, 2126, 1122, 1134},
+  { 95, { -3.651000, -40.717000,  19.829000}, 3080, 2127, 1134, 1146},
+  { 96, { 33.745000,  30.283000,   2.691000}, 3111, 2128, 1146, 1158},
+  { 97, { 36.539000,  26.454000,   5.319000}, 3110, 2129, 1158, 1170},
+  { 98, { 36.308000,  25.158000,  10.577000}, 3109, 2130, 1170, 1182},
+  { 99, { 38.824000,  23.456000,   2.629000}, 3108, 2131, 1182, 1193},
+  {100, { 41.059000,  18.985000,   4.254000}, 3107, 2132, 1193, 1204},
+  {101, { 38.596000,  20.582000,  12.240000}, 3106, 2133, 1204, 1216},
+  {102, { 41.062000,  17.405000,   8.607000}, 3105, 2134, 1216, 1228},
+  {103, { 42.742000,  12.290000,   9.228000}, 3104, 2135, 1228, 1240},
+  {104, { 37.932000,  18.699000,  16.562000}, 3103, 2136, 1240, 1252},
+  {105, { 39.749000,  13.612000,  17.242000}, 3102, 2137, 1252, 1264},
+  {106, { 38.225000,  11.234000,  21.688000}, 3101, 2138, 1264, 1276},
+  {107, { 42.092000,  10.379000,  13.540000}, 3100, 2139, 1276, 1288},
+  {108, { 42.952000,   5.144000,  13.896000}, 3099, 2140, 1288, 1300},
+  {109, { 39.088000,   5.651000,  22.314000}, 3098, 2141, 1300, 1312},
+  {110, { 41.471000,   2.793000,  18.226000}, 3097, 2142, 1312, 1324},
+  {111, { 41.521000,  -2.351000,  18.301000}, 3096, 2143, 1324, 1336},
+  {112, { 36.626000,   2.859000,  26.611000}, 3127, 2144, 1336, 1348},
+  {113, { 36.690000,  -2.406000,  26.657000}, 3126, 2145, 1348, 1360},
+  {114, { 33.452000,  -4.758000,  30.349000}, 3125, 2146, 1360, 1372},
+  {115, { 39.201000,  -4.758000,  22.437000}, 3124, 2147, 1372, 1384},
+  {116, { 38.588000,  -9.460000,  22.012000}, 3123, 2148, 1384, 1396},
+  {117, { 32.858000,  -9.460000,  29.898000}, 3122, 2149, 1396, 1408},
+  {118, { 35.482000, -11.811000,  25.780000}, 3121, 2150, 1408, 1420},
+  {119, { 34.335000, -16.220000,  24.947000}, 3120, 2151, 1420, 1431},
+  {120, { 29.155000, -12.290000,  32.589000}, 3119, 2152, 1431, 1443},
+  {121, { 28.162000, -17.405000,  31.100000}, 3118, 2153, 1443, 1455},
+  {122, { 24.031000, -20.582000,  32.589000}, 3117, 2154, 1455, 1467},
+  {123, { 30.718000, -18.985000,  27.575000}, 3116, 2155, 1467, 1478},
+  {124, { 29.864000, -23.456000,  24.947000}, 3115, 2156, 1478, 1489},
+  {125, { 23.157000, -25.158000,  29.898000}, 3114, 2157, 1489, 1501},
+  {126, { 26.434000, -26.454000,  25.780000}, 3113, 2158, 1501, 1513},
+  {127, { 25.719000, -30.283000,  22.012000}, 3112, 2159, 1513, 1525},
+  {128, { 19.216000, -27.792000,  30.350000}, 3143, 2160, 1525, 1537},
+  {129, { 18.561000, -31.740000,  26.657000}, 3142, 2161, 1537, 1549},
+  {130, { 13.823000, -34.038000,  26.610000}, 3141, 2162, 1549, 1561},
+  {131, { 21.787000, -32.935000,  22.437000}, 3140, 2163, 1561, 1573},
+  {132, { 20.672000, -36.086000,  18.301000}, 3139, 2164, 1573, 1585},
+  {133, { 12.427000, -37.488000,  22.315000}, 3138, 2165, 1585, 1597},
+  {134, { 16.050000, -38.342000,  18.226000}, 3137, 2166, 1597, 1609},
+  {135, { 14.609000, -40.717000,  13.896000}, 3136, 2167, 1609, 1621},
+  {136, {  7.047000, -39.214000,  21.687000}, 3135, 2168, 1621, 1633},
+  {137, {  5.603000, -41.639000,  17.243000}, 3134, 2169, 1633, 1645},
+  {138, {  0.240000, -42.290000,  16.562000}, 3133, 2170, 1645, 1657},
+  {139, {  9.541000, -42.290000,  13.540000}, 3132, 2171, 1657, 1669},
+  {140, {  8.123000, -43.725000,   9.227000}, 3131, 2172, 1669, 1681},
+  {141, { -1.148000, -43.725000,  12.240000}, 3130, 2173, 1681, 1693},
+  {142, {  2.797000, -44.510000,   8.608000}, 3129, 2174, 1693, 1705},
+  {143, {  1.382000, -45.214000,   4.254000}, 3128, 2175, 1705, 1716},
+  {144, {  3.619000,  45.214000,  -2.629000}, 3159, 2176, 1716, 1727},
+  {145, {  7.322000,  44.510000,  -5.320000}, 3158, 2177, 1727, 1739},
+  {146, { 11.996000,  43.725000,  -2.690000}, 3157, 2178, 1739, 1751},
+  {147, {  6.266000,  43.725000, -10.577000}, 3156, 2179, 1751, 1763},
+  {148, {  9.929000,  42.290000, -13.258000}, 3155, 2180, 1763, 1775},
+  {149, { 15.678000,  42.290000,  -5.346000}, 3154, 2181, 1775, 1787},
+  {150, { 14.668000,  41.639000, -10.656000}, 3153, 2182, 1787, 1799},
+  {151, { 18.449000,  39.214000, -13.403000}, 3152, 2183, 1799, 1811},
+  {152, { 19.987000,  40.717000,  -2.655000}, 3151, 2184, 1811, 1823},
+  {153, { 23.697000,  38.342000,  -5.311000}, 3150, 2185, 1823, 1835},
+  {154, { 27.482000,  36.086000,  -2.655000}, 3149, 2186, 1835, 1847},
+  {155, { 23.170000,  37.488000, -10.749000}, 3148, 2187, 1847, 1859},
+  {156, { 26.824000,  34.038000, -13.403000}, 3147, 2188, 1859, 1871},
+  {157, { 30.814000,  32.935000,  -5.346000}, 3146, 2189, 1871, 1883},
+  {158, { 30.685000,  31.740000, -10.656000}, 3145, 2190, 1883, 1895},
+  {159, { 33.386000,  27.792000, -13.259000}, 3144, 2191, 1895, 1907},
+  {160, { 33.745000,  30.283000,  -2.691000}, 3175, 2192, 1907, 1919},
+  {161, { 36.539000,  26.454000,  -5.319000}, 3174, 2193, 1919, 1931},
+  {162, { 38.824000,  23.456000,  -2.629000}, 3173, 2194, 1931, 1942},
+  {163, { 36.308000,  25.158000, -10.577000}, 3172, 2195, 1942, 1954},
+  {164, { 38.596000,  20.582000, -12.240000}, 3171, 2196, 1954, 1966},
+  {165, { 41.059000,  18.985000,  -4.254000}, 3170, 2197, 1966, 1977},
+  {166, { 41.062000,  17.405000,  -8.607000}, 3169, 2198, 1977, 1989},
+  {167, { 42.742000,  12.290000,  -9.228000}, 3168, 2199, 1989, 2001},
+  {168, { 42.441000,  16.220000,   0.000000}, 3167, 2200, 2001, 2012},
+  {169, { 43.859000,  11.811000,   0.000000}, 3166, 2201, 2012, 2024},
+  {170, { 44.156000,   9.460000,   4.874000}, 3165, 2202, 2024, 2036},
+  {171, { 44.156000,   9.460000,  -4.874000}, 3164, 2203, 2036, 2048},
+  {172, { 44.903000,   4.758000,  -4.890000}, 3163, 2204, 2048, 2060},
+  {173, { 44.903000,   4.758000,   4.890000}, 3162, 2205, 2060, 2072},
+  {174, { 45.351000,   2.406000,   0.000000}, 3161, 2206, 2072, 2084},
+  {175, { 45.272000,  -2.859000,   0.000000}, 3160, 2207, 2084, 2096},
+  {176, { 44.348000,   2.351000,   9.600000}, 3191, 2208, 2096, 2108},
+  {177, { 44.264000,  -2.793000,   9.632000}, 3190, 2209, 2108, 2120},
+  {178, { 42.917000,  -5.144000,  14.005000}, 3189, 2210, 2120, 2132},
+  {179, { 44.739000,  -5.651000,   4.923000}, 3188, 2211, 2132, 2144},
+  {180, { 43.673000, -11.234000,   4.923000}, 3187, 2212, 2144, 2156},
+  {181, { 42.012000, -10.379000,  13.787000}, 3186, 2213, 2156, 2168},
+  {182, { 42.292000, -13.612000,   9.415000}, 3185, 2214, 2168, 2180},
+  {183, { 40.423000, -18.699000,   8.897000}, 3184, 2215, 2180, 2192},
+  {184, { 40.003000, -12.290000,  17.658000}, 3183, 2216, 2192, 2204},
+  {185, { 38.279000, -17.405000,  17.173000}, 3182, 2217, 2204, 2216},
+  {186, { 35.718000, -18.985000,  20.693000}, 3181, 2218, 2216, 2227},
+  {187, { 38.419000, -20.582000,  12.784000}, 3180, 2219, 2227, 2239},
+  {188, { 35.591000, -25.158000,  12.784000}, 3179, 2220, 2239, 2251},
+  {189, { 32.954000, -23.456000,  20.693000}, 3178, 2221, 2251, 2262},
+  {190, { 32.687000, -26.454000,  17.173000}, 3177, 2222, 2262, 2274},
+  {191, { 28.882000, -30.283000,  17.658000}, 3176, 2223, 2274, 2286},
+  {192, {  8.702000,  40.717000, -18.188000}, 3207, 2224, 2286, 2298},
+  {193, { 12.374000,  38.342000, -20.896000}, 3206, 2225, 2298, 2310},
+  {194, { 17.383000,  37.488000, -18.714000}, 3205, 2226, 2310, 2322},
+  {195, { 11.018000,  36.086000, -25.316000}, 3204, 2227, 2322, 2334},
+  {196, { 14.607000,  32.935000, -27.654000}, 3203, 2228, 2334, 2346},
+  {197, { 21.037000,  34.038000, -21.369000}, 3202, 2229, 2346, 2358},
+  {198, { 19.617000,  31.740000, -25.890000}, 3201, 2230, 2358, 2370},
+  {199, { 22.927000,  27.792000, -27.654000}, 3200, 2231, 2370, 2382},
+  {200, { 25.758000,  32.312000, -18.714000}, 3199, 2232, 2382, 2394},
+  {201, { 28.762000,  28.214000, -20.896000}, 3198, 2233, 2394, 2406},
+  {202, { 32.528000,  25.992000, -18.188000}, 3197, 2234, 2406, 2418},
+  {203, { 27.350000,  25.992000, -25.315000}, 3196, 2235, 2418, 2430},
+  {204, { 29.608000,  21.475000, -26.957000}, 3195, 2236, 2430, 2442},
+  {205, { 34.786000,  21.475000, -19.829000}, 3194, 2237, 2442, 2454},
+  {206, { 33.278000,  19.180000, -24.178000}, 3193, 2238, 2454, 2466},
+  {207, { 34.900000,  14.027000, -25.357000}, 3192, 2239, 2466, 2478},
+  {208, { 37.932000,  18.699000, -16.562000}, 3223, 2240, 2478, 2490},
+  {209, { 39.749000,  13.612000, -17.242000}, 3222, 2241, 2490, 2502},
+  {210, { 42.092000,  10.379000, -13.540000}, 3221, 2242, 2502, 2514},
+  {211, { 38.225000,  11.234000, -21.688000}, 3220, 2243, 2514, 2526},
+  {212, { 39.088000,   5.651000, -22.314000}, 3219, 2244, 2526, 2538},
+  {213, { 42.952000,   5.144000, -13.896000}, 3218, 2245, 2538, 2550},
+  {214, { 41.471000,   2.793000, -18.226000}, 3217, 2246, 2550, 2562},
+  {215, { 41.521000,  -2.351000, -18.301000}, 3216, 2247, 2562, 2574},
+  {216, { 44.348000,   2.351000,  -9.600000}, 3215, 2248, 2574, 2586},
+  {217, { 44.264000,  -2.793000,  -9.632000}, 3214, 2249, 2586, 2598},
+  {218, { 44.739000,  -5.651000,  -4.923000}, 3213, 2250, 2598, 2610},
+  {219, { 42.917000,  -5.144000, -14.005000}, 3212, 2251, 2610, 2622},
+  {220, { 42.012000, -10.379000, -13.787000}, 3211, 2252, 2622, 2634},
+  {221, { 43.673000, -11.234000,  -4.923000}, 3210, 2253, 2634, 2646},
+  {222, { 42.292000, -13.612000,  -9.415000}, 3209, 2254, 2646, 2658},
+  {223, { 40.423000, -18.699000,  -8.897000}, 3208, 2255, 2658, 2670},
+  {224, { 43.139000, -14.027000,   0.000000}, 3239, 2256, 2670, 2682},
+  {225, { 41.134000, -19.180000,   0.000000}, 3238, 2257, 2682, 2694},
+  {226, { 39.798000, -21.475000,   4.405000}, 3237, 2258, 2694, 2706},
+  {227, { 39.798000, -21.475000,  -4.405000}, 3236, 2259, 2706, 2718},
+  {228, { 37.006000, -25.992000,  -4.405000}, 3235, 2260, 2718, 2730},
+  {229, { 37.006000, -25.992000,   4.405000}, 3234, 2261, 2730, 2742},
+  {230, { 35.551000, -28.214000,   0.000000}, 3233, 2262, 2742, 2754},
+  {231, { 31.839000, -32.312000,   0.000000}, 3232, 2263, 2754, 2766},
+  {232, { 34.803000, -27.792000,   8.897000}, 3231, 2264, 2766, 2778},
+  {233, { 31.088000, -31.740000,   9.415000}, 3230, 2265, 2778, 2790},
+  {234, { 28.071000, -32.935000,  13.787000}, 3229, 2266, 2790, 2802},
+  {235, { 29.579000, -34.038000,   4.923000}, 3228, 2267, 2802, 2814},
+  {236, { 25.063000, -37.488000,   4.923000}, 3227, 2268, 2814, 2826},
+  {237, { 23.794000, -36.086000,  14.005000}, 3226, 2269, 2826, 2838},
+  {238, { 22.293000, -38.342000,   9.632000}, 3225, 2270, 2838, 2850},
+  {239, { 17.730000, -40.717000,   9.600000}, 3224, 2271, 2850, 2862},
+  {240, { 12.987000,  30.283000, -31.262000}, 3255, 2272, 2862, 2874},
+  {241, { 16.350000,  26.454000, -33.106000}, 3254, 2273, 2874, 2886},
+  {242, { 21.279000,  25.158000, -31.262000}, 3253, 2274, 2886, 2898},
+  {243, { 14.498000,  23.456000, -36.111000}, 3252, 2275, 2898, 2909},
+  {244, { 16.733000,  18.985000, -37.736000}, 3251, 2276, 2909, 2920},
+  {245, { 23.567000,  20.582000, -32.925000}, 3250, 2277, 2920, 2932},
+  {246, { 20.874000,  17.405000, -36.394000}, 3249, 2278, 2932, 2944},
+  {247, { 21.983000,  12.290000, -37.799000}, 3248, 2279, 2944, 2956},
+  {248, { 27.473000,  18.699000, -30.958000}, 3247, 2280, 2956, 2968},
+  {249, { 28.681000,  13.612000, -32.476000}, 3246, 2281, 2968, 2980},
+  {250, { 32.438000,  11.234000, -29.653000}, 3245, 2282, 2980, 2992},
+  {251, { 25.884000,  10.379000, -35.848000}, 3244, 2283, 2992, 3004},
+  {252, { 26.488000,   5.144000, -36.557000}, 3243, 2284, 3004, 3016},
+  {253, { 33.301000,   5.651000, -30.280000}, 3242, 2285, 3016, 3028},
+  {254, { 30.148000,   2.793000, -33.810000}, 3241, 2286, 3028, 3040},
+  {255, { 30.235000,  -2.351000, -33.834000}, 3240, 2287, 3040, 3052},
+  {256, { 36.626000,   2.859000, -26.611000}, 3271, 2288, 3052, 3064},
+  {257, { 36.690000,  -2.406000, -26.657000}, 3270, 2289, 3064, 3076},
+  {258, { 39.201000,  -4.758000, -22.437000}, 3269, 2290, 3076, 3088},
+  {259, { 33.452000,  -4.758000, -30.349000}, 3268, 2291, 3088, 3100},
+  {260, { 32.858000,  -9.460000, -29.898000}, 3267, 2292, 3100, 3112},
+  {261, { 38.588000,  -9.460000, -22.012000}, 3266, 2293, 3112, 3124},
+  {262, { 35.482000, -11.811000, -25.780000}, 3265, 2294, 3124, 3136},
+  {263, { 34.335000, -16.220000, -24.947000}, 3264, 2295, 3136, 3147},
+  {264, { 40.003000, -12.290000, -17.658000}, 3263, 2296, 3147, 3159},
+  {265, { 38.279000, -17.405000, -17.173000}, 3262, 2297, 3159, 3171},
+  {266, { 38.419000, -20.582000, -12.784000}, 3261, 2298, 3171, 3183},
+  {267, { 35.718000, -18.985000, -20.693000}, 3260, 2299, 3183, 3194},
+  {268, { 32.954000, -23.456000, -20.693000}, 3259, 2300, 3194, 3205},
+  {269, { 35.591000, -25.158000, -12.784000}, 3258, 2301, 3205, 3217},
+  {270, { 32.687000, -26.454000, -17.173000}, 3257, 2302, 3217, 3229},
+  {271, { 28.882000, -30.283000, -17.658000}, 3256, 2303, 3229, 3241},
+  {272, { 34.803000, -27.792000,  -8.897000}, 3287, 2304, 3241, 3253},
+  {273, { 31.088000, -31.740000,  -9.415000}, 3286, 2305, 3253, 3265},
+  {274, { 29.579000, -34.038000,  -4.923000}, 3285, 2306, 3265, 3277},
+  {275, { 28.071000, -32.935000, -13.787000}, 3284, 2307, 3277, 3289},
+  {276, { 23.794000, -36.086000, -14.005000}, 3283, 2308, 3289, 3301},
+  {277, { 25.063000, -37.488000,  -4.923000}, 3282, 2309, 3301, 3313},
+  {278, { 22.293000, -38.342000,  -9.632000}, 3281, 2310, 3313, 3325},
+  {279, { 17.730000, -40.717000,  -9.600000}, 3280, 2311, 3325, 3337},
+  {280, { 22.803000, -39.214000,   0.000000}, 3279, 2312, 3337, 3349},
+  {281, { 18.130000, -41.639000,   0.000000}, 3278, 2313, 3349, 3361},
+  {282, { 15.826000, -42.290000,   4.890000}, 3277, 2314, 3361, 3373},
+  {283, { 15.826000, -42.290000,  -4.890000}, 3276, 2315, 3373, 3385},
+  {284, { 11.286000, -43.725000,  -4.874000}, 3275, 2316, 3385, 3397},
+  {285, { 11.286000, -43.725000,   4.874000}, 3274, 2317, 3397, 3409},
+  {286, {  9.051000, -44.510000,   0.000000}, 3273, 2318, 3409, 3421},
+  {287, {  4.473000, -45.214000,   0.000000}, 3272, 2319, 3421, 3432},
+  {288, { -1.382000,  45.214000,  -4.254000}, 3303, 2320, 3432, 3443},
+  {289, { -2.797000,  44.510000,  -8.608000}, 3302, 2321, 3443, 3455},
+  {290, {  1.148000,  43.725000, -12.240000}, 3301, 2322, 3455, 3467},
+  {291, { -8.123000,  43.725000,  -9.227000}, 3300, 2323, 3467, 3479},
+  {292, { -9.541000,  42.290000, -13.540000}, 3299, 2324, 3479, 3491},
+  {293, { -0.240000,  42.290000, -16.562000}, 3298, 2325, 3491, 3503},
+  {294, { -5.603000,  41.639000, -17.243000}, 3297, 2326, 3503, 3515},
+  {295, { -7.047000,  39.214000, -21.687000}, 3296, 2327, 3515, 3527},
+  {296, {  3.651000,  40.717000, -19.829000}, 3295, 2328, 3527, 3539},
+  {297, {  2.271000,  38.342000, -24.178000}, 3294, 2329, 3539, 3551},
+  {298, {  5.967000,  36.086000, -26.957000}, 3293, 2330, 3551, 3563},
+  {299, { -3.063000,  37.488000, -25.357000}, 3292, 2331, 3563, 3575},
+  {300, { -4.459000,  34.038000, -29.653000}, 3291, 2332, 3575, 3587},
+  {301, {  4.437000,  32.935000, -30.958000}, 3290, 2333, 3587, 3599},
+  {302, { -0.653000,  31.740000, -32.476000}, 3289, 2334, 3599, 3611},
+  {303, { -2.293000,  27.792000, -35.849000}, 3288, 2335, 3611, 3623},
+  {304, {  7.868000,  30.283000, -32.925000}, 3319, 2336, 3623, 3635},
+  {305, {  6.231000,  26.454000, -36.394000}, 3318, 2337, 3635, 3647},
+  {306, {  9.497000,  23.456000, -37.736000}, 3317, 2338, 3647, 3658},
+  {307, {  1.160000,  25.158000, -37.799000}, 3316, 2339, 3658, 3670},
+  {308, {  0.286000,  20.582000, -40.490000}, 3315, 2340, 3670, 3682},
+  {309, {  8.643000,  18.985000, -40.364000}, 3314, 2341, 3682, 3693},
+  {310, {  4.503000,  17.405000, -41.713000}, 3313, 2342, 3693, 3705},
+  {311, {  4.432000,  12.290000, -43.502000}, 3312, 2343, 3705, 3717},
+  {312, { 13.115000,  16.220000, -40.364000}, 3311, 2344, 3717, 3728},
+  {313, { 13.553000,  11.811000, -41.713000}, 3310, 2345, 3728, 3740},
+  {314, { 18.281000,   9.460000, -40.489000}, 3309, 2346, 3740, 3752},
+  {315, {  9.010000,   9.460000, -43.502000}, 3308, 2347, 3752, 3764},
+  {316, {  9.225000,   4.758000, -44.216000}, 3307, 2348, 3764, 3776},
+  {317, { 18.526000,   4.758000, -41.194000}, 3306, 2349, 3776, 3788},
+  {318, { 14.014000,   2.406000, -43.132000}, 3305, 2350, 3788, 3800},
+  {319, { 13.990000,  -2.859000, -43.057000}, 3304, 2351, 3800, 3812},
+  {320, { 22.835000,   2.351000, -39.211000}, 3335, 2352, 3812, 3824},
+  {321, { 22.839000,  -2.793000, -39.121000}, 3334, 2353, 3824, 3836},
+  {322, { 26.582000,  -5.144000, -36.489000}, 3333, 2354, 3836, 3848},
+  {323, { 18.507000,  -5.651000, -41.028000}, 3332, 2355, 3848, 3860},
+  {324, { 18.178000, -11.234000, -40.014000}, 3331, 2356, 3860, 3872},
+  {325, { 26.095000, -10.379000, -35.696000}, 3330, 2357, 3872, 3884},
+  {326, { 22.023000, -13.612000, -37.313000}, 3329, 2358, 3884, 3896},
+  {327, { 20.953000, -18.699000, -35.695000}, 3328, 2359, 3896, 3908},
+  {328, { 29.155000, -12.290000, -32.589000}, 3327, 2360, 3908, 3920},
+  {329, { 28.162000, -17.405000, -31.100000}, 3326, 2361, 3920, 3932},
+  {330, { 30.718000, -18.985000, -27.575000}, 3325, 2362, 3932, 3943},
+  {331, { 24.031000, -20.582000, -32.589000}, 3324, 2363, 3943, 3955},
+  {332, { 23.157000, -25.158000, -29.898000}, 3323, 2364, 3955, 3967},
+  {333, { 29.864000, -23.456000, -24.947000}, 3322, 2365, 3967, 3978},
+  {334, { 26.434000, -26.454000, -25.780000}, 3321, 2366, 3978, 3990},
+  {335, { 25.719000, -30.283000, -22.012000}, 3320, 2367, 3990, 4002},
+  {336, {-14.609000,  40.717000, -13.896000}, 3351, 2368, 4002, 4014},
+  {337, {-16.050000,  38.342000, -18.226000}, 3350, 2369, 4014, 4026},
+  {338, {-12.427000,  37.488000, -22.315000}, 3349, 2370, 4026, 4038},
+  {339, {-20.672000,  36.086000, -18.301000}, 3348, 2371, 4038, 4050},
+  {340, {-21.787000,  32.935000, -22.437000}, 3347, 2372, 4050, 4062},
+  {341, {-13.823000,  34.038000, -26.610000}, 3346, 2373, 4062, 4074},
+  {342, {-18.561000,  31.740000, -26.657000}, 3345, 2374, 4074, 4086},
+  {343, {-19.216000,  27.792000, -30.350000}, 3344, 2375, 4086, 4098},
+  {344, { -9.839000,  32.312000, -30.280000}, 3343, 2376, 4098, 4110},
+  {345, {-10.986000,  28.214000, -33.811000}, 3342, 2377, 4110, 4122},
+  {346, { -7.246000,  25.992000, -36.556000}, 3341, 2378, 4122, 4134},
+  {347, {-15.625000,  25.992000, -33.834000}, 3340, 2379, 4134, 4146},
+  {348, {-16.488000,  21.475000, -36.489000}, 3339, 2380, 4146, 4158},
+  {349, { -8.109000,  21.475000, -39.212000}, 3338, 2381, 4158, 4170},
+  {350, {-12.711000,  19.180000, -39.121000}, 3337, 2382, 4170, 4182},
+  {351, {-13.331000,  14.027000, -41.028000}, 3336, 2383, 4182, 4194},
+  {352, { -4.030000,  18.699000, -41.194000}, 3367, 2384, 4194, 4206},
+  {353, { -4.115000,  13.612000, -43.132000}, 3366, 2385, 4206, 4218},
+  {354, {  0.130000,  10.379000, -44.216000}, 3365, 2386, 4218, 4230},
+  {355, { -8.814000,  11.234000, -43.057000}, 3364, 2387, 4230, 4242},
+  {356, { -9.143000,   5.651000, -44.071000}, 3363, 2388, 4242, 4254},
+  {357, {  0.057000,   5.144000, -45.145000}, 3362, 2389, 4254, 4266},
+  {358, { -4.518000,   2.793000, -45.074000}, 3361, 2390, 4266, 4278},
+  {359, { -4.574000,  -2.351000, -45.145000}, 3360, 2391, 4278, 4290},
+  {360, {  4.574000,   2.351000, -45.145000}, 3359, 2392, 4290, 4302},
+  {361, {  4.518000,  -2.793000, -45.074000}, 3358, 2393, 4302, 4314},
+  {362, {  9.143000,  -5.651000, -44.071000}, 3357, 2394, 4314, 4326},
+  {363, { -0.057000,  -5.144000, -45.145000}, 3356, 2395, 4326, 4338},
+  {364, { -0.130000, -10.379000, -44.216000}, 3355, 2396, 4338, 4350},
+  {365, {  8.814000, -11.234000, -43.057000}, 3354, 2397, 4350, 4362},
+  {366, {  4.115000, -13.612000, -43.132000}, 3353, 2398, 4362, 4374},
+  {367, {  4.030000, -18.699000, -41.194000}, 3352, 2399, 4374, 4386},
+  {368, { 13.331000, -14.027000, -41.028000}, 3383, 2400, 4386, 4398},
+  {369, { 12.711000, -19.180000, -39.121000}, 3382, 2401, 4398, 4410},
+  {370, { 16.488000, -21.475000, -36.489000}, 3381, 2402, 4410, 4422},
+  {371, {  8.109000, -21.475000, -39.212000}, 3380, 2403, 4422, 4434},
+  {372, {  7.246000, -25.992000, -36.556000}, 3379, 2404, 4434, 4446},
+  {373, { 15.625000, -25.992000, -33.834000}, 3378, 2405, 4446, 4458},
+  {374, { 10.986000, -28.214000, -33.811000}, 3377, 2406, 4458, 4470},
+  {375, {  9.839000, -32.312000, -30.280000}, 3376, 2407, 4470, 4482},
+  {376, { 19.216000, -27.792000, -30.350000}, 3375, 2408, 4482, 4494},
+  {377, { 18.561000, -31.740000, -26.657000}, 3374, 2409, 4494, 4506},
+  {378, { 21.787000, -32.935000, -22.437000}, 3373, 2410, 4506, 4518},
+  {379, { 13.823000, -34.038000, -26.610000}, 3372, 2411, 4518, 4530},
+  {380, { 12.427000, -37.488000, -22.315000}, 3371, 2412, 4530, 4542},
+  {381, { 20.672000, -36.086000, -18.301000}, 3370, 2413, 4542, 4554},
+  {382, { 16.050000, -38.342000, -18.226000}, 3369, 2414, 4554, 4566},
+  {383, { 14.609000, -40.717000, -13.896000}, 3368, 2415, 4566, 4578},
+  {384, {-25.719000,  30.283000, -22.012000}, 3399, 2416, 4578, 4590},
+  {385, {-26.434000,  26.454000, -25.780000}, 3398, 2417, 4590, 4602},
+  {386, {-23.157000,  25.158000, -29.898000}, 3397, 2418, 4602, 4614},
+  {387, {-29.864000,  23.456000, -24.947000}, 3396, 2419, 4614, 4625},
+  {388, {-30.718000,  18.985000, -27.575000}, 3395, 2420, 4625, 4636},
+  {389, {-24.031000,  20.582000, -32.589000}, 3394, 2421, 4636, 4648},
+  {390, {-28.162000,  17.405000, -31.100000}, 3393, 2422, 4648, 4660},
+  {391, {-29.155000,  12.290000, -32.589000}, 3392, 2423, 4660, 4672},
+  {392, {-20.953000,  18.699000, -35.695000}, 3391, 2424, 4672, 4684},
+  {393, {-22.023000,  13.612000, -37.313000}, 3390, 2425, 4684, 4696},
+  {394, {-18.178000,  11.234000, -40.014000}, 3389, 2426, 4696, 4708},
+  {395, {-26.095000,  10.379000, -35.696000}, 3388, 2427, 4708, 4720},
+  {396, {-26.582000,   5.144000, -36.489000}, 3387, 2428, 4720, 4732},
+  {397, {-18.507000,   5.651000, -41.028000}, 3386, 2429, 4732, 4744},
+  {398, {-22.839000,   2.793000, -39.121000}, 3385, 2430, 4744, 4756},
+  {399, {-22.835000,  -2.351000, -39.211000}, 3384, 2431, 4756, 4768},
+  {400, {-13.990000,   2.859000, -43.057000}, 3415, 2432, 4768, 4780},
+  {401, {-14.014000,  -2.406000, -43.132000}, 3414, 2433, 4780, 4792},
+  {402, { -9.225000,  -4.758000, -44.216000}, 3413, 2434, 4792, 4804},
+  {403, {-18.526000,  -4.758000, -41.194000}, 3412, 2435, 4804, 4816},
+  {404, {-18.281000,  -9.460000, -40.489000}, 3411, 2436, 4816, 4828},
+  {405, { -9.010000,  -9.460000, -43.502000}, 3410, 2437, 4828, 4840},
+  {406, {-13.553000, -11.811000, -41.713000}, 3409, 2438, 4840, 4852},
+  {407, {-13.115000, -16.220000, -40.364000}, 3408, 2439, 4852, 4863},
+  {408, { -4.432000, -12.290000, -43.502000}, 3407, 2440, 4863, 4875},
+  {409, { -4.503000, -17.405000, -41.713000}, 3406, 2441, 4875, 4887},
+  {410, { -0.286000, -20.582000, -40.490000}, 3405, 2442, 4887, 4899},
+  {411, { -8.643000, -18.985000, -40.364000}, 3404, 2443, 4899, 4910},
+  {412, { -9.497000, -23.456000, -37.736000}, 3403, 2444, 4910, 4921},
+  {413, { -1.160000, -25.158000, -37.799000}, 3402, 2445, 4921, 4933},
+  {414, { -6.231000, -26.454000, -36.394000}, 3401, 2446, 4933, 4945},
+  {415, { -7.868000, -30.283000, -32.925000}, 3400, 2447, 4945, 4957},
+  {416, {  2.293000, -27.792000, -35.849000}, 3431, 2448, 4957, 4969},
+  {417, {  0.653000, -31.740000, -32.476000}, 3430, 2449, 4969, 4981},
+  {418, {  4.459000, -34.038000, -29.653000}, 3429, 2450, 4981, 4993},
+  {419, { -4.437000, -32.935000, -30.958000}, 3428, 2451, 4993, 5005},
+  {420, { -5.967000, -36.086000, -26.957000}, 3427, 2452, 5005, 5017},
+  {421, {  3.063000, -37.488000, -25.357000}, 3426, 2453, 5017, 5029},
+  {422, { -2.271000, -38.342000, -24.178000}, 3425, 2454, 5029, 5041},
+  {423, { -3.651000, -40.717000, -19.829000}, 3424, 2455, 5041, 5053},
+  {424, {  7.047000, -39.214000, -21.687000}, 3423, 2456, 5053, 5065},
+  {425, {  5.603000, -41.639000, -17.243000}, 3422, 2457, 5065, 5077},
+  {426, {  9.541000, -42.290000, -13.540000}, 3421, 2458, 5077, 5089},
+  {427, {  0.240000, -42.290000, -16.562000}, 3420, 2459, 5089, 5101},
+  {428, { -1.148000, -43.725000, -12.240000}, 3419, 2460, 5101, 5113},
+  {429, {  8.123000, -43.725000,  -9.227000}, 3418, 2461, 5113, 5125},
+  {430, {  2.797000, -44.510000,  -8.608000}, 3417, 2462, 5125, 5137},
+  {431, {  1.382000, -45.214000,  -4.254000}, 3416, 2463, 5137, 5148},
+  {432, { -4.473000,  45.214000,   0.000000}, 3447, 2464, 5148, 5159},
+  {433, { -9.051000,  44.510000,   0.000000}, 3446, 2465, 5159, 5171},
+  {434, {-11.286000,  43.725000,  -4.874000}, 3445, 2466, 5171, 5183},
+  {435, {-11.286000,  43.725000,   4.874000}, 3444, 2467, 5183, 5195},
+  {436, {-15.826000,  42.290000,   4.890000}, 3443, 2468, 5195, 5207},
+  {437, {-15.826000,  42.290000,  -4.890000}, 3442, 2469, 5207, 5219},
+  {438, {-18.130000,  41.639000,   0.000000}, 3441, 2470, 5219, 5231},
+  {439, {-22.803000,  39.214000,   0.000000}, 3440, 2471, 5231, 5243},
+  {440, {-17.730000,  40.717000,  -9.600000}, 3439, 2472, 5243, 5255},
+  {441, {-22.293000,  38.342000,  -9.632000}, 3438, 2473, 5255, 5267},
+  {442, {-23.794000,  36.086000, -14.005000}, 3437, 2474, 5267, 5279},
+  {443, {-25.063000,  37.488000,  -4.923000}, 3436, 2475, 5279, 5291},
+  {444, {-29.579000,  34.038000,  -4.923000}, 3435, 2476, 5291, 5303},
+  {445, {-28.071000,  32.935000, -13.787000}, 3434, 2477, 5303, 5315},
+  {446, {-31.088000,  31.740000,  -9.415000}, 3433, 2478, 5315, 5327},
+  {447, {-34.803000,  27.792000,  -8.897000}, 3432, 2479, 5327, 5339},
+  {448, {-28.882000,  30.283000, -17.658000}, 3463, 2480, 5339, 5351},
+  {449, {-32.687000,  26.454000, -17.173000}, 3462, 2481, 5351, 5363},
+  {450, {-32.954000,  23.456000, -20.693000}, 3461, 2482, 5363, 5374},
+  {451, {-35.591000,  25.158000, -12.784000}, 3460, 2483, 5374, 5386},
+  {452, {-38.419000,  20.582000, -12.784000}, 3459, 2484, 5386, 5398},
+  {453, {-35.718000,  18.985000, -20.693000}, 3458, 2485, 5398, 5409},
+  {454, {-38.279000,  17.405000, -17.173000}, 3457, 2486, 5409, 5421},
+  {455, {-40.003000,  12.290000, -17.658000}, 3456, 2487, 5421, 5433},
+  {456, {-34.335000,  16.220000, -24.947000}, 3455, 2488, 5433, 5444},
+  {457, {-35.482000,  11.811000, -25.780000}, 3454, 2489, 5444, 5456},
+  {458, {-32.858000,   9.460000, -29.898000}, 3453, 2490, 5456, 5468},
+  {459, {-38.588000,   9.460000, -22.012000}, 3452, 2491, 5468, 5480},
+  {460, {-39.201000,   4.758000, -22.437000}, 3451, 2492, 5480, 5492},
+  {461, {-33.452000,   4.758000, -30.349000}, 3450, 2493, 5492, 5504},
+  {462, {-36.690000,   2.406000, -26.657000}, 3449, 2494, 5504, 5516},
+  {463, {-36.626000,  -2.859000, -26.611000}, 3448, 2495, 5516, 5528},
+  {464, {-30.235000,   2.351000, -33.834000}, 3479, 2496, 5528, 5540},
+  {465, {-30.148000,  -2.793000, -33.810000}, 3478, 2497, 5540, 5552},
+  {466, {-26.488000,  -5.144000, -36.557000}, 3477, 2498, 5552, 5564},
+  {467, {-33.301000,  -5.651000, -30.280000}, 3476, 2499, 5564, 5576},
+  {468, {-32.438000, -11.234000, -29.653000}, 3475, 2500, 5576, 5588},
+  {469, {-25.884000, -10.379000, -35.848000}, 3474, 2501, 5588, 5600},
+  {470, {-28.681000, -13.612000, -32.476000}, 3473, 2502, 5600, 5612},
+  {471, {-27.473000, -18.699000, -30.958000}, 3472, 2503, 5612, 5624},
+  {472, {-21.983000, -12.290000, -37.799000}, 3471, 2504, 5624, 5636},
+  {473, {-20.874000, -17.405000, -36.394000}, 3470, 2505, 5636, 5648},
+  {474, {-16.733000, -18.985000, -37.736000}, 3469, 2506, 5648, 5659},
+  {475, {-23.567000, -20.582000, -32.925000}, 3468, 2507, 5659, 5671},
+  {476, {-21.279000, -25.158000, -31.262000}, 3467, 2508, 5671, 5683},
+  {477, {-14.498000, -23.456000, -36.111000}, 3466, 2509, 5683, 5694},
+  {478, {-16.350000, -26.454000, -33.106000}, 3465, 2510, 5694, 5706},
+  {479, {-12.987000, -30.283000, -31.262000}, 3464, 2511, 5706, 5718},
+  {480, {-17.730000,  40.717000,   9.600000}, 3495, 2512, 5718, 5730},
+  {481, {-22.293000,  38.342000,   9.632000}, 3494, 2513, 5730, 5742},
+  {482, {-25.063000,  37.488000,   4.923000}, 3493, 2514, 5742, 5754},
+  {483, {-23.794000,  36.086000,  14.005000}, 3492, 2515, 5754, 5766},
+  {484, {-28.071000,  32.935000,  13.787000}, 3491, 2516, 5766, 5778},
+  {485, {-29.579000,  34.038000,   4.923000}, 3490, 2517, 5778, 5790},
+  {486, {-31.088000,  31.740000,   9.415000}, 3489, 2518, 5790, 5802},
+  {487, {-34.803000,  27.792000,   8.897000}, 3488, 2519, 5802, 5814},
+  {488, {-31.839000,  32.312000,   0.000000}, 3487, 2520, 5814, 5826},
+  {489, {-35.551000,  28.214000,   0.000000}, 3486, 2521, 5826, 5838},
+  {490, {-37.006000,  25.992000,  -4.405000}, 3485, 2522, 5838, 5850},
+  {491, {-37.006000,  25.992000,   4.405000}, 3484, 2523, 5850, 5862},
+  {492, {-39.798000,  21.475000,   4.405000}, 3483, 2524, 5862, 5874},
+  {493, {-39.798000,  21.475000,  -4.405000}, 3482, 2525, 5874, 5886},
+  {494, {-41.134000,  19.180000,   0.000000}, 3481, 2526, 5886, 5898},
+  {495, {-43.139000,  14.027000,   0.000000}, 3480, 2527, 5898, 5910},
+  {496, {-40.423000,  18.699000,  -8.897000}, 3511, 2528, 5910, 5922},
+  {497, {-42.292000,  13.612000,  -9.415000}, 3510, 2529, 5922, 5934},
+  {498, {-42.012000,  10.379000, -13.787000}, 3509, 2530, 5934, 5946},
+  {499, {-43.673000,  11.234000,  -4.923000}, 3508, 2531, 5946, 5958},
+  {500, {-44.739000,   5.651000,  -4.923000}, 3507, 2532, 5958, 5970},
+  {501, {-42.917000,   5.144000, -14.005000}, 3506, 2533, 5970, 5982},
+  {502, {-44.264000,   2.793000,  -9.632000}, 3505, 2534, 5982, 5994},
+  {503, {-44.348000,  -2.351000,  -9.600000}, 3504, 2535, 5994, 6006},
+  {504, {-41.521000,   2.351000, -18.301000}, 3503, 2536, 6006, 6018},
+  {505, {-41.471000,  -2.793000, -18.226000}, 3502, 2537, 6018, 6030},
+  {506, {-39.088000,  -5.651000, -22.314000}, 3501, 2538, 6030, 6042},
+  {507, {-42.952000,  -5.144000, -13.896000}, 3500, 2539, 6042, 6054},
+  {508, {-42.092000, -10.379000, -13.540000}, 3499, 2540, 6054, 6066},
+  {509, {-38.225000, -11.234000, -21.688000}, 3498, 2541, 6066, 6078},
+  {510, {-39.749000, -13.612000, -17.242000}, 3497, 2542, 6078, 6090},
+  {511, {-37.932000, -18.699000, -16.562000}, 3496, 2543, 6090, 6102},
+  {512, {-34.900000, -14.027000, -25.357000}, 3527, 2544, 6102, 6114},
+  {513, {-33.278000, -19.180000, -24.178000}, 3526, 2545, 6114, 6126},
+  {514, {-29.608000, -21.475000, -26.957000}, 3525, 2546, 6126, 6138},
+  {515, {-34.786000, -21.475000, -19.829000}, 3524, 2547, 6138, 6150},
+  {516, {-32.528000, -25.992000, -18.188000}, 3523, 2548, 6150, 6162},
+  {517, {-27.350000, -25.992000, -25.315000}, 3522, 2549, 6162, 6174},
+  {518, {-28.762000, -28.214000, -20.896000}, 3521, 2550, 6174, 6186},
+  {519, {-25.758000, -32.312000, -18.714000}, 3520, 2551, 6186, 6198},
+  {520, {-22.927000, -27.792000, -27.654000}, 3519, 2552, 6198, 6210},
+  {521, {-19.617000, -31.740000, -25.890000}, 3518, 2553, 6210, 6222},
+  {522, {-14.607000, -32.935000, -27.654000}, 3517, 2554, 6222, 6234},
+  {523, {-21.037000, -34.038000, -21.369000}, 3516, 2555, 6234, 6246},
+  {524, {-17.383000, -37.488000, -18.714000}, 3515, 2556, 6246, 6258},
+  {525, {-11.018000, -36.086000, -25.316000}, 3514, 2557, 6258, 6270},
+  {526, {-12.374000, -38.342000, -20.896000}, 3513, 2558, 6270, 6282},
+  {527, { -8.702000, -40.717000, -18.188000}, 3512, 2559, 6282, 6294},
+  {528, {-28.882000,  30.283000,  17.658000}, 3543, 2560, 6294, 6306},
+  {529, {-32.687000,  26.454000,  17.173000}, 3542, 2561, 6306, 6318},
+  {530, {-35.591000,  25.158000,  12.784000}, 3541, 2562, 6318, 6330},
+  {531, {-32.954000,  23.456000,  20.693000}, 3540, 2563, 6330, 6341},
+  {532, {-35.718000,  18.985000,  20.693000}, 3539, 2564, 6341, 6352},
+  {533, {-38.419000,  20.582000,  12.784000}, 3538, 2565, 6352, 6364},
+  {534, {-38.279000,  17.405000,  17.173000}, 3537, 2566, 6364, 6376},
+  {535, {-40.003000,  12.290000,  17.658000}, 3536, 2567, 6376, 6388},
+  {536, {-40.423000,  18.699000,   8.897000}, 3535, 2568, 6388, 6400},
+  {537, {-42.292000,  13.612000,   9.415000}, 3534, 2569, 6400, 6412},
+  {538, {-43.673000,  11.234000,   4.923000}, 3533, 2570, 6412, 6424},
+  {539, {-42.012000,  10.379000,  13.787000}, 3532, 2571, 6424, 6436},
+  {540, {-42.917000,   5.144000,  14.005000}, 3531, 2572, 6436, 6448},
+  {541, {-44.739000,   5.651000,   4.923000}, 3530, 2573, 6448, 6460},
+  {542, {-44.264000,   2.793000,   9.632000}, 3529, 2574, 6460, 6472},
+  {543, {-44.348000,  -2.351000,   9.600000}, 3528, 2575, 6472, 6484},
+  {544, {-45.272000,   2.859000,   0.000000}, 3559, 2576, 6484, 6496},
+  {545, {-45.351000,  -2.406000,   0.000000}, 3558, 2577, 6496, 6508},
+  {546, {-44.903000,  -4.758000,  -4.890000}, 3557, 2578, 6508, 6520},
+  {547, {-44.903000,  -4.758000,   4.890000}, 3556, 2579, 6520, 6532},
+  {548, {-44.156000,  -9.460000,   4.874000}, 3555, 2580, 6532, 6544},
+  {549, {-44.156000,  -9.460000,  -4.874000}, 3554, 2581, 6544, 6556},
+  {550, {-43.859000, -11.811000,   0.000000}, 3553, 2582, 6556, 6568},
+  {551, {-42.441000, -16.220000,   0.000000}, 3552, 2583, 6568, 6579},
+  {552, {-42.742000, -12.290000,  -9.228000}, 3551, 2584, 6579, 6591},
+  {553, {-41.062000, -17.405000,  -8.607000}, 3550, 2585, 6591, 6603},
+  {554, {-38.596000, -20.582000, -12.240000}, 3549, 2586, 6603, 6615},
+  {555, {-41.059000, -18.985000,  -4.254000}, 3548, 2587, 6615, 6626},
+  {556, {-38.824000, -23.456000,  -2.629000}, 3547, 2588, 6626, 6637},
+  {557, {-36.308000, -25.158000, -10.577000}, 3546, 2589, 6637, 6649},
+  {558, {-36.539000, -26.454000,  -5.319000}, 3545, 2590, 6649, 6661},
+  {559, {-33.745000, -30.283000,  -2.691000}, 3544, 2591, 6661, 6673},
+  {560, {-33.386000, -27.792000, -13.259000}, 3575, 2592, 6673, 6685},
+  {561, {-30.685000, -31.740000, -10.656000}, 3574, 2593, 6685, 6697},
+  {562, {-26.824000, -34.038000, -13.403000}, 3573, 2594, 6697, 6709},
+  {563, {-30.814000, -32.935000,  -5.346000}, 3572, 2595, 6709, 6721},
+  {564, {-27.482000, -36.086000,  -2.655000}, 3571, 2596, 6721, 6733},
+  {565, {-23.170000, -37.488000, -10.749000}, 3570, 2597, 6733, 6745},
+  {566, {-23.697000, -38.342000,  -5.311000}, 3569, 2598, 6745, 6757},
+  {567, {-19.987000, -40.717000,  -2.655000}, 3568, 2599, 6757, 6769},
+  {568, {-18.449000, -39.214000, -13.403000}, 3567, 2600, 6769, 6781},
+  {569, {-14.668000, -41.639000, -10.656000}, 3566, 2601, 6781, 6793},
+  {570, { -9.929000, -42.290000, -13.258000}, 3565, 2602, 6793, 6805},
+  {571, {-15.678000, -42.290000,  -5.346000}, 3564, 2603, 6805, 6817},
+  {572, {-11.996000, -43.725000,  -2.690000}, 3563, 2604, 6817, 6829},
+  {573, { -6.266000, -43.725000, -10.577000}, 3562, 2605, 6829, 6841},
+  {574, { -7.322000, -44.510000,  -5.320000}, 3561, 2606, 6841, 6853},
+  {575, { -3.619000, -45.214000,  -2.629000}, 3560, 2607, 6853, 6864},
+  {576, { -1.382000,  45.214000,   4.254000}, 3591, 2608, 6864, 6875},
+  {577, { -2.797000,  44.510000,   8.608000}, 3590, 2609, 6875, 6887},
+  {578, { -8.123000,  43.725000,   9.227000}, 3589, 2610, 6887, 6899},
+  {579, {  1.148000,  43.725000,  12.240000}, 3588, 2611, 6899, 6911},
+  {580, { -0.240000,  42.290000,  16.562000}, 3587, 2612, 6911, 6923},
+  {581, { -9.541000,  42.290000,  13.540000}, 3586, 2613, 6923, 6935},
+  {582, { -5.603000,  41.639000,  17.243000}, 3585, 2614, 6935, 6947},
+  {583, { -7.047000,  39.214000,  21.687000}, 3584, 2615, 6947, 6959},
+  {584, {-14.609000,  40.717000,  13.896000}, 3583, 2616, 6959, 6971},
+  {585, {-16.050000,  38.342000,  18.226000}, 3582, 2617, 6971, 6983},
+  {586, {-20.672000,  36.086000,  18.301000}, 3581, 2618, 6983, 6995},
+  {587, {-12.427000,  37.488000,  22.315000}, 3580, 2619, 6995, 7007},
+  {588, {-13.823000,  34.038000,  26.610000}, 3579, 2620, 7007, 7019},
+  {589, {-21.787000,  32.935000,  22.437000}, 3578, 2621, 7019, 7031},
+  {590, {-18.561000,  31.740000,  26.657000}, 3577, 2622, 7031, 7043},
+  {591, {-19.216000,  27.792000,  30.350000}, 3576, 2623, 7043, 7055},
+  {592, {-25.719000,  30.283000,  22.012000}, 3607, 2624, 7055, 7067},
+  {593, {-26.434000,  26.454000,  25.780000}, 3606, 2625, 7067, 7079},
+  {594, {-29.864000,  23.456000,  24.947000}, 3605, 2626, 7079, 7090},
+  {595, {-23.157000,  25.158000,  29.898000}, 3604, 2627, 7090, 7102},
+  {596, {-24.031000,  20.582000,  32.589000}, 3603, 2628, 7102, 7114},
+  {597, {-30.718000,  18.985000,  27.575000}, 3602, 2629, 7114, 7125},
+  {598, {-28.162000,  17.405000,  31.100000}, 3601, 2630, 7125, 7137},
+  {599, {-29.155000,  12.290000,  32.589000}, 3600, 2631, 7137, 7149},
+  {600, {-34.335000,  16.220000,  24.947000}, 3599, 2632, 7149, 7160},
+  {601, {-35.482000,  11.811000,  25.780000}, 3598, 2633, 7160, 7172},
+  {602, {-38.588000,   9.460000,  22.012000}, 3597, 2634, 7172, 7184},
+  {603, {-32.858000,   9.460000,  29.898000}, 3596, 2635, 7184, 7196},
+  {604, {-33.452000,   4.758000,  30.349000}, 3595, 2636, 7196, 7208},
+  {605, {-39.201000,   4.758000,  22.437000}, 3594, 2637, 7208, 7220},
+  {606, {-36.690000,   2.406000,  26.657000}, 3593, 2638, 7220, 7232},
+  {607, {-36.626000,  -2.859000,  26.611000}, 3592, 2639, 7232, 7244},
+  {608, {-41.521000,   2.351000,  18.301000}, 3623, 2640, 7244, 7256},
+  {609, {-41.471000,  -2.793000,  18.226000}, 3622, 2641, 7256, 7268},
+  {610, {-42.952000,  -5.144000,  13.896000}, 3621, 2642, 7268, 7280},
+  {611, {-39.088000,  -5.651000,  22.314000}, 3620, 2643, 7280, 7292},
+  {612, {-38.225000, -11.234000,  21.688000}, 3619, 2644, 7292, 7304},
+  {613, {-42.092000, -10.379000,  13.540000}, 3618, 2645, 7304, 7316},
+  {614, {-39.749000, -13.612000,  17.242000}, 3617, 2646, 7316, 7328},
+  {615, {-37.932000, -18.699000,  16.562000}, 3616, 2647, 7328, 7340},
+  {616, {-42.742000, -12.290000,   9.228000}, 3615, 2648, 7340, 7352},
+  {617, {-41.062000, -17.405000,   8.607000}, 3614, 2649, 7352, 7364},
+  {618, {-41.059000, -18.985000,   4.254000}, 3613, 2650, 7364, 7375},
+  {619, {-38.596000, -20.582000,  12.240000}, 3612, 2651, 7375, 7387},
+  {620, {-36.308000, -25.158000,  10.577000}, 3611, 2652, 7387, 7399},
+  {621, {-38.824000, -23.456000,   2.629000}, 3610, 2653, 7399, 7410},
+  {622, {-36.539000, -26.454000,   5.319000}, 3609, 2654, 7410, 7422},
+  {623, {-33.745000, -30.283000,   2.691000}, 3608, 2655, 7422, 7434},
+  {624, {  3.651000,  40.717000,  19.829000}, 3639, 2656, 7434, 7446},
+  {625, {  2.271000,  38.342000,  24.178000}, 3638, 2657, 7446, 7458},
+  {626, { -3.063000,  37.488000,  25.357000}, 3637, 2658, 7458, 7470},
+  {627, {  5.967000,  36.086000,  26.957000}, 3636, 2659, 7470, 7482},
+  {628, {  4.437000,  32.935000,  30.958000}, 3635, 2660, 7482, 7494},
+  {629, { -4.459000,  34.038000,  29.653000}, 3634, 2661, 7494, 7506},
+  {630, { -0.653000,  31.740000,  32.476000}, 3633, 2662, 7506, 7518},
+  {631, { -2.293000,  27.792000,  35.849000}, 3632, 2663, 7518, 7530},
+  {632, { -9.839000,  32.312000,  30.280000}, 3631, 2664, 7530, 7542},
+  {633, {-10.986000,  28.214000,  33.811000}, 3630, 2665, 7542, 7554},
+  {634, {-15.625000,  25.992000,  33.834000}, 3629, 2666, 7554, 7566},
+  {635, { -7.246000,  25.992000,  36.556000}, 3628, 2667, 7566, 7578},
+  {636, { -8.109000,  21.475000,  39.212000}, 3627, 2668, 7578, 7590},
+  {637, {-16.488000,  21.475000,  36.489000}, 3626, 2669, 7590, 7602},
+  {638, {-12.711000,  19.180000,  39.121000}, 3625, 2670, 7602, 7614},
+  {639, {-13.331000,  14.027000,  41.028000}, 3624, 2671, 7614, 7626},
+  {640, {-20.953000,  18.699000,  35.695000}, 3655, 2672, 7626, 7638},
+  {641, {-22.023000,  13.612000,  37.313000}, 3654, 2673, 7638, 7650},
+  {642, {-26.095000,  10.379000,  35.696000}, 3653, 2674, 7650, 7662},
+  {643, {-18.178000,  11.234000,  40.014000}, 3652, 2675, 7662, 7674},
+  {644, {-18.507000,   5.651000,  41.028000}, 3651, 2676, 7674, 7686},
+  {645, {-26.582000,   5.144000,  36.489000}, 3650, 2677, 7686, 7698},
+  {646, {-22.839000,   2.793000,  39.121000}, 3649, 2678, 7698, 7710},
+  {647, {-22.835000,  -2.351000,  39.211000}, 3648, 2679, 7710, 7722},
+  {648, {-30.235000,   2.351000,  33.834000}, 3647, 2680, 7722, 7734},
+  {649, {-30.148000,  -2.793000,  33.810000}, 3646, 2681, 7734, 7746},
+  {650, {-33.301000,  -5.651000,  30.280000}, 3645, 2682, 7746, 7758},
+  {651, {-26.488000,  -5.144000,  36.557000}, 3644, 2683, 7758, 7770},
+  {652, {-25.884000, -10.379000,  35.848000}, 3643, 2684, 7770, 7782},
+  {653, {-32.438000, -11.234000,  29.653000}, 3642, 2685, 7782, 7794},
+  {654, {-28.681000, -13.612000,  32.476000}, 3641, 2686, 7794, 7806},
+  {655, {-27.473000, -18.699000,  30.958000}, 3640, 2687, 7806, 7818},
+  {656, {-34.900000, -14.027000,  25.357000}, 3671, 2688, 7818, 7830},
+  {657, {-33.278000, -19.180000,  24.178000}, 3670, 2689, 7830, 7842},
+  {658, {-34.786000, -21.475000,  19.829000}, 3669, 2690, 7842, 7854},
+  {659, {-29.608000, -21.475000,  26.957000}, 3668, 2691, 7854, 7866},
+  {660, {-27.350000, -25.992000,  25.315000}, 3667, 2692, 7866, 7878},
+  {661, {-32.528000, -25.992000,  18.188000}, 3666, 2693, 7878, 7890},
+  {662, {-28.762000, -28.214000,  20.896000}, 3665, 2694, 7890, 7902},
+  {663, {-25.758000, -32.312000,  18.714000}, 3664, 2695, 7902, 7914},
+  {664, {-33.386000, -27.792000,  13.259000}, 3663, 2696, 7914, 7926},
+  {665, {-30.685000, -31.740000,  10.656000}, 3662, 2697, 7926, 7938},
+  {666, {-30.814000, -32.935000,   5.346000}, 3661, 2698, 7938, 7950},
+  {667, {-26.824000, -34.038000,  13.403000}, 3660, 2699, 7950, 7962},
+  {668, {-23.170000, -37.488000,  10.749000}, 3659, 2700, 7962, 7974},
+  {669, {-27.482000, -36.086000,   2.655000}, 3658, 2701, 7974, 7986},
+  {670, {-23.697000, -38.342000,   5.311000}, 3657, 2702, 7986, 7998},
+  {671, {-19.987000, -40.717000,   2.655000}, 3656, 2703, 7998, 8010},
+  {672, {  7.868000,  30.283000,  32.925000}, 3687, 2704, 8010, 8022},
+  {673, {  6.231000,  26.454000,  36.394000}, 3686, 2705, 8022, 8034},
+  {674, {  1.160000,  25.158000,  37.799000}, 3685, 2706, 8034, 8046},
+  {675, {  9.497000,  23.456000,  37.736000}, 3684, 2707, 8046, 8057},
+  {676, {  8.643000,  18.985000,  40.364000}, 3683, 2708, 8057, 8068},
+  {677, {  0.286000,  20.582000,  40.490000}, 3682, 2709, 8068, 8080},
+  {678, {  4.503000,  17.405000,  41.713000}, 3681, 2710, 8080, 8092},
+  {679, {  4.432000,  12.290000,  43.502000}, 3680, 2711, 8092, 8104},
+  {680, { -4.030000,  18.699000,  41.194000}, 3679, 2712, 8104, 8116},
+  {681, { -4.115000,  13.612000,  43.132000}, 3678, 2713, 8116, 8128},
+  {682, { -8.814000,  11.234000,  43.057000}, 3677, 2714, 8128, 8140},
+  {683, {  0.130000,  10.379000,  44.216000}, 3676, 2715, 8140, 8152},
+  {684, {  0.057000,   5.144000,  45.145000}, 3675, 2716, 8152, 8164},
+  {685, { -9.143000,   5.651000,  44.071000}, 3674, 2717, 8164, 8176},
+  {686, { -4.518000,   2.793000,  45.074000}, 3673, 2718, 8176, 8188},
+  {687, { -4.574000,  -2.351000,  45.145000}, 3672, 2719, 8188, 8200},
+  {688, {-13.990000,   2.859000,  43.057000}, 3703, 2720, 8200, 8212},
+  {689, {-14.014000,  -2.406000,  43.132000}, 3702, 2721, 8212, 8224},
+  {690, {-18.526000,  -4.758000,  41.194000}, 3701, 2722, 8224, 8236},
+  {691, { -9.225000,  -4.758000,  44.216000}, 3700, 2723, 8236, 8248},
+  {692, { -9.010000,  -9.460000,  43.502000}, 3699, 2724, 8248, 8260},
+  {693, {-18.281000,  -9.460000,  40.489000}, 3698, 2725, 8260, 8272},
+  {694, {-13.553000, -11.811000,  41.713000}, 3697, 2726, 8272, 8284},
+  {695, {-13.115000, -16.220000,  40.364000}, 3696, 2727, 8284, 8295},
+  {696, {-21.983000, -12.290000,  37.799000}, 3695, 2728, 8295, 8307},
+  {697, {-20.874000, -17.405000,  36.394000}, 3694, 2729, 8307, 8319},
+  {698, {-23.567000, -20.582000,  32.925000}, 3693, 2730, 8319, 8331},
+  {699, {-16.733000, -18.985000,  37.736000}, 3692, 2731, 8331, 8342},
+  {700, {-14.498000, -23.456000,  36.111000}, 3691, 2732, 8342, 8353},
+  {701, {-21.279000, -25.158000,  31.262000}, 3690, 2733, 8353, 8365},
+  {702, {-16.350000, -26.454000,  33.106000}, 3689, 2734, 8365, 8377},
+  {703, {-12.987000, -30.283000,  31.262000}, 3688, 2735, 8377, 8389},
+  {704, {-22.927000, -27.792000,  27.654000}, 3719, 2736, 8389, 8401},
+  {705, {-19.617000, -31.740000,  25.890000}, 3718, 2737, 8401, 8413},
+  {706, {-21.037000, -34.038000,  21.369000}, 3717, 2738, 8413, 8425},
+  {707, {-14.607000, -32.935000,  27.654000}, 3716, 2739, 8425, 8437},
+  {708, {-11.018000, -36.086000,  25.316000}, 3715, 2740, 8437, 8449},
+  {709, {-17.383000, -37.488000,  18.714000}, 3714, 2741, 8449, 8461},
+  {710, {-12.374000, -38.342000,  20.896000}, 3713, 2742, 8461, 8473},
+  {711, { -8.702000, -40.717000,  18.188000}, 3712, 2743, 8473, 8485},
+  {712, {-18.449000, -39.214000,  13.403000}, 3711, 2744, 8485, 8497},
+  {713, {-14.668000, -41.639000,  10.656000}, 3710, 2745, 8497, 8509},
+  {714, {-15.678000, -42.290000,   5.346000}, 3709, 2746, 8509, 8521},
+  {715, { -9.929000, -42.290000,  13.258000}, 3708, 2747, 8521, 8533},
+  {716, { -6.266000, -43.725000,  10.577000}, 3707, 2748, 8533, 8545},
+  {717, {-11.996000, -43.725000,   2.690000}, 3706, 2749, 8545, 8557},
+  {718, { -7.322000, -44.510000,   5.320000}, 3705, 2750, 8557, 8569},
+  {719, { -3.619000, -45.214000,   2.629000}, 3704, 2751, 8569, 8580},
+};
+constexpr unsigned
+ant::expconfig::detector::CB::neighbours_table[] = {
+  /*   0 */ 1,144,576,145,577,432,579,2,3,146,288,
+  /*   1 */ 0,2,3,5,6,4,146,145,144,576,577,579,
+  /*   2 */ 5,1,579,0,576,580,577,624,8,6,4,3,
+  /*   3 */ 4,146,1,149,144,0,2,5,6,48,152,145,
+  /*   4 */ 3,6,48,7,50,49,152,149,146,1,2,5,
+  /*   5 */ 2,8,6,9,11,7,4,3,1,579,580,624,
+  /*   6 */ 7,4,5,3,1,2,8,9,11,50,49,48,
+  /*   7 */ 6,11,50,12,56,53,49,48,4,5,8,9,
+  /*   8 */ 9,5,624,2,579,625,580,627,10,11,7,6,
+  /*   9 */ 8,10,11,13,14,12,7,6,5,624,625,627,
+  /*  10 */ 13,9,627,8,624,628,625,672,16,14,12,11,
+  /*  11 */ 12,7,9,6,5,8,10,13,14,56,53,50,
+  /*  12 */ 11,14,56,15,58,57,53,50,7,9,10,13,
+  /*  13 */ 10,16,14,17,19,15,12,11,9,627,628,672,
+  /*  14 */ 15,12,13,11,9,10,16,17,19,58,57,56,
+  /*  15 */ 14,19,58,20,64,61,57,56,12,13,16,17,
+  /*  16 */ 17,13,672,10,627,673,628,675,18,19,15,14,
+  /*  17 */ 16,18,19,21,22,20,15,14,13,672,673,675,
+  /*  18 */ 21,17,675,16,676,673,20,24,22,672,19,
+  /*  19 */ 20,15,17,14,13,16,18,21,22,64,61,58,
+  /*  20 */ 19,22,64,23,66,65,61,58,15,17,18,21,
+  /*  21 */ 18,24,22,25,23,20,19,17,675,27,676,
+  /*  22 */ 23,20,21,19,17,18,24,25,27,66,65,64,
+  /*  23 */ 22,27,66,28,72,69,65,64,20,21,24,25,
+  /*  24 */ 25,21,676,18,675,678,679,26,27,23,22,
+  /*  25 */ 24,26,27,29,30,28,23,22,21,676,678,679,
+  /*  26 */ 29,25,679,24,676,678,683,684,32,30,28,27,
+  /*  27 */ 28,23,25,22,21,24,26,29,30,72,69,66,
+  /*  28 */ 27,30,72,31,74,73,69,66,23,25,26,29,
+  /*  29 */ 26,32,30,33,35,31,28,27,25,679,683,684,
+  /*  30 */ 31,28,29,27,25,26,32,33,35,74,73,72,
+  /*  31 */ 30,35,74,36,80,77,73,72,28,29,32,33,
+  /*  32 */ 33,29,684,26,679,683,686,687,34,35,31,30,
+  /*  33 */ 32,34,35,37,38,36,31,30,29,684,686,687,
+  /*  34 */ 37,33,687,32,684,686,691,692,40,38,36,35,
+  /*  35 */ 36,31,33,30,29,32,34,37,38,80,77,74,
+  /*  36 */ 35,38,80,39,82,81,77,74,31,33,34,37,
+  /*  37 */ 34,40,38,41,43,39,36,35,33,687,691,692,
+  /*  38 */ 39,36,37,35,33,34,40,41,43,82,81,80,
+  /*  39 */ 38,43,82,44,88,85,81,80,36,37,40,41,
+  /*  40 */ 41,37,692,34,687,691,694,695,42,43,39,38,
+  /*  41 */ 40,42,43,45,46,44,39,38,37,692,694,695,
+  /*  42 */ 45,41,695,40,694,699,44,700,46,692,43,
+  /*  43 */ 44,39,41,38,37,40,42,45,46,88,85,82,
+  /*  44 */ 43,46,88,47,90,89,85,82,39,41,42,45,
+  /*  45 */ 42,700,46,699,47,44,43,41,695,703,702,
+  /*  46 */ 47,44,45,43,41,42,700,702,703,90,89,88,
+  /*  47 */ 46,703,90,702,708,93,89,88,44,45,700,707,
+  /*  48 */ 49,152,4,153,146,3,6,7,50,51,154,149,
+  /*  49 */ 48,50,51,53,54,52,154,153,152,4,6,7,
+  /*  50 */ 53,49,7,48,4,6,11,12,56,54,52,51,
+  /*  51 */ 52,154,49,157,152,48,50,53,54,96,160,153,
+  /*  52 */ 51,54,96,55,98,97,160,157,154,49,50,53,
+  /*  53 */ 50,56,54,57,59,55,52,51,49,7,11,12,
+  /*  54 */ 55,52,53,51,49,50,56,57,59,98,97,96,
+  /*  55 */ 54,59,98,60,104,101,97,96,52,53,56,57,
+  /*  56 */ 57,53,12,50,7,11,14,15,58,59,55,54,
+  /*  57 */ 56,58,59,61,62,60,55,54,53,12,14,15,
+  /*  58 */ 61,57,15,56,12,14,19,20,64,62,60,59,
+  /*  59 */ 60,55,57,54,53,56,58,61,62,104,101,98,
+  /*  60 */ 59,62,104,63,106,105,101,98,55,57,58,61,
+  /*  61 */ 58,64,62,65,67,63,60,59,57,15,19,20,
+  /*  62 */ 63,60,61,59,57,58,64,65,67,106,105,104,
+  /*  63 */ 62,67,106,68,112,109,105,104,60,61,64,65,
+  /*  64 */ 65,61,20,58,15,19,22,23,66,67,63,62,
+  /*  65 */ 64,66,67,69,70,68,63,62,61,20,22,23,
+  /*  66 */ 69,65,23,64,20,22,27,28,72,70,68,67,
+  /*  67 */ 68,63,65,62,61,64,66,69,70,112,109,106,
+  /*  68 */ 67,70,112,71,114,113,109,106,63,65,66,69,
+  /*  69 */ 66,72,70,73,75,71,68,67,65,23,27,28,
+  /*  70 */ 71,68,69,67,65,66,72,73,75,114,113,112,
+  /*  71 */ 70,75,114,76,120,117,113,112,68,69,72,73,
+  /*  72 */ 73,69,28,66,23,27,30,31,74,75,71,70,
+  /*  73 */ 72,74,75,77,78,76,71,70,69,28,30,31,
+  /*  74 */ 77,73,31,72,28,30,35,36,80,78,76,75,
+  /*  75 */ 76,71,73,70,69,72,74,77,78,120,117,114,
+  /*  76 */ 75,78,120,79,122,121,117,114,71,73,74,77,
+  /*  77 */ 74,80,78,81,83,79,76,75,73,31,35,36,
+  /*  78 */ 79,76,77,75,73,74,80,81,83,122,121,120,
+  /*  79 */ 78,83,122,84,128,125,121,120,76,77,80,81,
+  /*  80 */ 81,77,36,74,31,35,38,39,82,83,79,78,
+  /*  81 */ 80,82,83,85,86,84,79,78,77,36,38,39,
+  /*  82 */ 85,81,39,80,36,38,43,44,88,86,84,83,
+  /*  83 */ 84,79,81,78,77,80,82,85,86,128,125,122,
+  /*  84 */ 83,86,128,87,130,129,125,122,79,81,82,85,
+  /*  85 */ 82,88,86,89,91,87,84,83,81,39,43,44,
+  /*  86 */ 87,84,85,83,81,82,88,89,91,130,129,128,
+  /*  87 */ 86,91,130,92,136,133,129,128,84,85,88,89,
+  /*  88 */ 89,85,44,82,39,43,46,47,90,91,87,86,
+  /*  89 */ 88,90,91,93,94,92,87,86,85,44,46,47,
+  /*  90 */ 93,89,47,88,44,46,703,707,708,94,92,91,
+  /*  91 */ 92,87,89,86,85,88,90,93,94,136,133,130,
+  /*  92 */ 91,94,136,95,138,137,133,130,87,89,90,93,
+  /*  93 */ 90,708,94,707,711,95,92,91,89,47,703,710,
+  /*  94 */ 95,92,93,91,89,90,708,710,711,138,137,136,
+  /*  95 */ 94,711,138,710,716,141,137,136,92,93,708,715,
+  /*  96 */ 97,160,52,161,154,51,54,55,98,99,162,157,
+  /*  97 */ 96,98,99,101,102,100,162,161,160,52,54,55,
+  /*  98 */ 101,97,55,96,52,54,59,60,104,102,100,99,
+  /*  99 */ 100,162,97,165,96,98,101,102,168,160,161,
+  /* 100 */ 99,102,168,103,169,165,98,162,97,170,101,
+  /* 101 */ 98,104,102,105,107,103,100,99,97,55,59,60,
+  /* 102 */ 103,100,101,99,97,98,104,105,107,170,169,168,
+  /* 103 */ 102,107,170,108,176,173,169,168,100,101,104,105,
+  /* 104 */ 105,101,60,98,55,59,62,63,106,107,103,102,
+  /* 105 */ 104,106,107,109,110,108,103,102,101,60,62,63,
+  /* 106 */ 109,105,63,104,60,62,67,68,112,110,108,107,
+  /* 107 */ 108,103,105,102,101,104,106,109,110,176,173,170,
+  /* 108 */ 107,110,176,111,178,177,173,170,103,105,106,109,
+  /* 109 */ 106,112,110,113,115,111,108,107,105,63,67,68,
+  /* 110 */ 111,108,109,107,105,106,112,113,115,178,177,176,
+  /* 111 */ 110,115,178,116,184,181,177,176,108,109,112,113,
+  /* 112 */ 113,109,68,106,63,67,70,71,114,115,111,110,
+  /* 113 */ 112,114,115,117,118,116,111,110,109,68,70,71,
+  /* 114 */ 117,113,71,112,68,70,75,76,120,118,116,115,
+  /* 115 */ 116,111,113,110,109,112,114,117,118,184,181,178,
+  /* 116 */ 115,118,184,119,186,185,181,178,111,113,114,117,
+  /* 117 */ 114,120,118,121,123,119,116,115,113,71,75,76,
+  /* 118 */ 119,116,117,115,113,114,120,121,123,186,185,184,
+  /* 119 */ 118,123,186,124,189,185,184,116,117,120,121,
+  /* 120 */ 121,117,76,114,71,75,78,79,122,123,119,118,
+  /* 121 */ 120,122,123,125,126,124,119,118,117,76,78,79,
+  /* 122 */ 125,121,79,120,76,78,83,84,128,126,124,123,
+  /* 123 */ 124,119,121,118,120,122,125,126,189,117,186,
+  /* 124 */ 123,126,189,127,186,190,122,119,121,191,125,
+  /* 125 */ 122,128,126,129,131,127,124,123,121,79,83,84,
+  /* 126 */ 127,124,125,123,121,122,128,129,131,191,190,189,
+  /* 127 */ 126,131,191,132,237,190,234,189,124,125,128,129,
+  /* 128 */ 129,125,84,122,79,83,86,87,130,131,127,126,
+  /* 129 */ 128,130,131,133,134,132,127,126,125,84,86,87,
+  /* 130 */ 133,129,87,128,84,86,91,92,136,134,132,131,
+  /* 131 */ 132,127,129,126,125,128,130,133,134,237,234,191,
+  /* 132 */ 131,134,237,135,239,234,238,191,127,129,130,133,
+  /* 133 */ 130,136,134,137,139,135,132,131,129,87,91,92,
+  /* 134 */ 135,132,133,131,129,130,136,137,139,239,238,237,
+  /* 135 */ 134,139,239,140,285,238,282,237,132,133,136,137,
+  /* 136 */ 137,133,92,130,87,91,94,95,138,139,135,134,
+  /* 137 */ 136,138,139,141,142,140,135,134,133,92,94,95,
+  /* 138 */ 141,137,95,136,92,94,711,715,716,142,140,139,
+  /* 139 */ 140,135,137,134,133,136,138,141,142,285,282,239,
+  /* 140 */ 139,142,285,143,287,282,286,239,135,137,138,141,
+  /* 141 */ 138,716,142,715,719,143,140,139,137,95,711,718,
+  /* 142 */ 143,140,141,139,137,138,716,718,719,287,286,285,
+  /* 143 */ 142,719,287,718,286,431,285,140,141,716,575,
+  /* 144 */ 145,288,0,289,1,576,3,146,147,290,432,
+  /* 145 */ 144,146,147,149,150,148,290,289,288,0,1,3,
+  /* 146 */ 149,145,3,144,0,4,1,48,152,150,148,147,
+  /* 147 */ 148,290,145,293,288,144,146,149,150,192,296,289,
+  /* 148 */ 147,150,192,151,194,193,296,293,290,145,146,149,
+  /* 149 */ 146,152,150,153,155,151,148,147,145,3,4,48,
+  /* 150 */ 151,148,149,147,145,146,152,153,155,194,193,192,
+  /* 151 */ 150,155,194,156,200,197,193,192,148,149,152,153,
+  /* 152 */ 153,149,48,146,3,49,4,51,154,155,151,150,
+  /* 153 */ 152,154,155,157,158,156,151,150,149,48,49,51,
+  /* 154 */ 157,153,51,152,48,52,49,96,160,158,156,155,
+  /* 155 */ 156,151,153,150,149,152,154,157,158,200,197,194,
+  /* 156 */ 155,158,200,159,202,201,197,194,151,153,154,157,
+  /* 157 */ 154,160,158,161,163,159,156,155,153,51,52,96,
+  /* 158 */ 159,156,157,155,153,154,160,161,163,202,201,200,
+  /* 159 */ 158,163,202,164,208,205,201,200,156,157,160,161,
+  /* 160 */ 161,157,96,154,51,97,52,99,162,163,159,158,
+  /* 161 */ 160,162,163,165,166,164,159,158,157,96,97,99,
+  /* 162 */ 165,161,99,160,100,97,164,168,166,96,163,
+  /* 163 */ 164,159,161,158,157,160,162,165,166,208,205,202,
+  /* 164 */ 163,166,208,167,210,209,205,202,159,161,162,165,
+  /* 165 */ 162,168,166,169,167,164,163,161,99,171,100,
+  /* 166 */ 167,164,165,163,161,162,168,169,171,210,209,208,
+  /* 167 */ 166,171,210,172,216,213,209,208,164,165,168,169,
+  /* 168 */ 169,165,100,162,99,102,103,170,171,167,166,
+  /* 169 */ 168,170,171,173,174,172,167,166,165,100,102,103,
+  /* 170 */ 173,169,103,168,100,102,107,108,176,174,172,171,
+  /* 171 */ 172,167,169,166,165,168,170,173,174,216,213,210,
+  /* 172 */ 171,174,216,175,218,217,213,210,167,169,170,173,
+  /* 173 */ 170,176,174,177,179,175,172,171,169,103,107,108,
+  /* 174 */ 175,172,173,171,169,170,176,177,179,218,217,216,
+  /* 175 */ 174,179,218,180,224,221,217,216,172,173,176,177,
+  /* 176 */ 177,173,108,170,103,107,110,111,178,179,175,174,
+  /* 177 */ 176,178,179,181,182,180,175,174,173,108,110,111,
+  /* 178 */ 181,177,111,176,108,110,115,116,184,182,180,179,
+  /* 179 */ 180,175,177,174,173,176,178,181,182,224,221,218,
+  /* 180 */ 179,182,224,183,226,225,221,218,175,177,178,181,
+  /* 181 */ 178,184,182,185,187,183,180,179,177,111,115,116,
+  /* 182 */ 183,180,181,179,177,178,184,185,187,226,225,224,
+  /* 183 */ 182,187,226,188,232,229,225,224,180,181,184,185,
+  /* 184 */ 185,181,116,178,111,115,118,119,186,187,183,182,
+  /* 185 */ 184,186,187,189,190,188,183,182,181,116,118,119,
+  /* 186 */ 189,185,119,184,118,123,188,124,190,116,187,
+  /* 187 */ 188,183,185,182,181,184,186,189,190,232,229,226,
+  /* 188 */ 187,190,232,191,234,233,229,226,183,185,186,189,
+  /* 189 */ 186,124,190,123,191,188,187,185,119,127,126,
+  /* 190 */ 191,188,189,187,185,186,124,126,127,234,233,232,
+  /* 191 */ 190,127,234,126,132,237,233,232,188,189,124,131,
+  /* 192 */ 193,296,148,297,290,147,150,151,194,195,298,293,
+  /* 193 */ 192,194,195,197,198,196,298,297,296,148,150,151,
+  /* 194 */ 197,193,151,192,148,150,155,156,200,198,196,195,
+  /* 195 */ 196,298,193,301,296,192,194,197,198,240,304,297,
+  /* 196 */ 195,198,240,199,242,241,304,301,298,193,194,197,
+  /* 197 */ 194,200,198,201,203,199,196,195,193,151,155,156,
+  /* 198 */ 199,196,197,195,193,194,200,201,203,242,241,240,
+  /* 199 */ 198,203,242,204,248,245,241,240,196,197,200,201,
+  /* 200 */ 201,197,156,194,151,155,158,159,202,203,199,198,
+  /* 201 */ 200,202,203,205,206,204,199,198,197,156,158,159,
+  /* 202 */ 205,201,159,200,156,158,163,164,208,206,204,203,
+  /* 203 */ 204,199,201,198,197,200,202,205,206,248,245,242,
+  /* 204 */ 203,206,248,207,250,249,245,242,199,201,202,205,
+  /* 205 */ 202,208,206,209,211,207,204,203,201,159,163,164,
+  /* 206 */ 207,204,205,203,201,202,208,209,211,250,249,248,
+  /* 207 */ 206,211,250,212,256,253,249,248,204,205,208,209,
+  /* 208 */ 209,205,164,202,159,163,166,167,210,211,207,206,
+  /* 209 */ 208,210,211,213,214,212,207,206,205,164,166,167,
+  /* 210 */ 213,209,167,208,164,166,171,172,216,214,212,211,
+  /* 211 */ 212,207,209,206,205,208,210,213,214,256,253,250,
+  /* 212 */ 211,214,256,215,258,257,253,250,207,209,210,213,
+  /* 213 */ 210,216,214,217,219,215,212,211,209,167,171,172,
+  /* 214 */ 215,212,213,211,209,210,216,217,219,258,257,256,
+  /* 215 */ 214,219,258,220,264,261,257,256,212,213,216,217,
+  /* 216 */ 217,213,172,210,167,171,174,175,218,219,215,214,
+  /* 217 */ 216,218,219,221,222,220,215,214,213,172,174,175,
+  /* 218 */ 221,217,175,216,172,174,179,180,224,222,220,219,
+  /* 219 */ 220,215,217,214,213,216,218,221,222,264,261,258,
+  /* 220 */ 219,222,264,223,266,265,261,258,215,217,218,221,
+  /* 221 */ 218,224,222,225,227,223,220,219,217,175,179,180,
+  /* 222 */ 223,220,221,219,217,218,224,225,227,266,265,264,
+  /* 223 */ 222,227,266,228,272,269,265,264,220,221,224,225,
+  /* 224 */ 225,221,180,218,175,179,182,183,226,227,223,222,
+  /* 225 */ 224,226,227,229,230,228,223,222,221,180,182,183,
+  /* 226 */ 229,225,183,224,180,182,187,188,232,230,228,227,
+  /* 227 */ 228,223,225,222,221,224,226,229,230,272,269,266,
+  /* 228 */ 227,230,272,231,274,273,269,266,223,225,226,229,
+  /* 229 */ 226,232,230,233,235,231,228,227,225,183,187,188,
+  /* 230 */ 231,228,229,227,225,226,232,233,235,274,273,272,
+  /* 231 */ 230,235,274,236,280,277,273,272,228,229,232,233,
+  /* 232 */ 233,229,188,226,183,187,190,191,234,235,231,230,
+  /* 233 */ 232,234,235,237,238,236,231,230,229,188,190,191,
+  /* 234 */ 237,233,191,232,188,190,127,131,132,238,236,235,
+  /* 235 */ 236,231,233,230,229,232,234,237,238,280,277,274,
+  /* 236 */ 235,238,280,239,282,281,277,274,231,233,234,237,
+  /* 237 */ 234,132,238,131,135,239,236,235,233,191,127,134,
+  /* 238 */ 239,236,237,235,233,234,132,134,135,282,281,280,
+  /* 239 */ 238,135,282,134,140,285,281,280,236,237,132,139,
+  /* 240 */ 241,304,196,305,298,195,198,199,242,243,306,301,
+  /* 241 */ 240,242,243,245,246,244,306,305,304,196,198,199,
+  /* 242 */ 245,241,199,240,196,198,203,204,248,246,244,243,
+  /* 243 */ 244,306,241,309,240,242,245,246,312,304,305,
+  /* 244 */ 243,246,312,247,313,309,242,306,241,314,245,
+  /* 245 */ 242,248,246,249,251,247,244,243,241,199,203,204,
+  /* 246 */ 247,244,245,243,241,242,248,249,251,314,313,312,
+  /* 247 */ 246,251,314,252,320,317,313,312,244,245,248,249,
+  /* 248 */ 249,245,204,242,199,203,206,207,250,251,247,246,
+  /* 249 */ 248,250,251,253,254,252,247,246,245,204,206,207,
+  /* 250 */ 253,249,207,248,204,206,211,212,256,254,252,251,
+  /* 251 */ 252,247,249,246,245,248,250,253,254,320,317,314,
+  /* 252 */ 251,254,320,255,322,321,317,314,247,249,250,253,
+  /* 253 */ 250,256,254,257,259,255,252,251,249,207,211,212,
+  /* 254 */ 255,252,253,251,249,250,256,257,259,322,321,320,
+  /* 255 */ 254,259,322,260,328,325,321,320,252,253,256,257,
+  /* 256 */ 257,253,212,250,207,211,214,215,258,259,255,254,
+  /* 257 */ 256,258,259,261,262,260,255,254,253,212,214,215,
+  /* 258 */ 261,257,215,256,212,214,219,220,264,262,260,259,
+  /* 259 */ 260,255,257,254,253,256,258,261,262,328,325,322,
+  /* 260 */ 259,262,328,263,330,329,325,322,255,257,258,261,
+  /* 261 */ 258,264,262,265,267,263,260,259,257,215,219,220,
+  /* 262 */ 263,260,261,259,257,258,264,265,267,330,329,328,
+  /* 263 */ 262,267,330,268,333,329,328,260,261,264,265,
+  /* 264 */ 265,261,220,258,215,219,222,223,266,267,263,262,
+  /* 265 */ 264,266,267,269,270,268,263,262,261,220,222,223,
+  /* 266 */ 269,265,223,264,220,222,227,228,272,270,268,267,
+  /* 267 */ 268,263,265,262,264,266,269,270,333,261,330,
+  /* 268 */ 267,270,333,271,330,334,266,263,265,335,269,
+  /* 269 */ 266,272,270,273,275,271,268,267,265,223,227,228,
+  /* 270 */ 271,268,269,267,265,266,272,273,275,335,334,333,
+  /* 271 */ 270,275,335,276,381,334,378,333,268,269,272,273,
+  /* 272 */ 273,269,228,266,223,227,230,231,274,275,271,270,
+  /* 273 */ 272,274,275,277,278,276,271,270,269,228,230,231,
+  /* 274 */ 277,273,231,272,228,230,235,236,280,278,276,275,
+  /* 275 */ 276,271,273,270,269,272,274,277,278,381,378,335,
+  /* 276 */ 275,278,381,279,383,378,382,335,271,273,274,277,
+  /* 277 */ 274,280,278,281,283,279,276,275,273,231,235,236,
+  /* 278 */ 279,276,277,275,273,274,280,281,283,383,382,381,
+  /* 279 */ 278,283,383,284,429,382,426,381,276,277,280,281,
+  /* 280 */ 281,277,236,274,231,235,238,239,282,283,279,278,
+  /* 281 */ 280,282,283,285,286,284,279,278,277,236,238,239,
+  /* 282 */ 285,281,239,280,236,238,135,139,140,286,284,283,
+  /* 283 */ 284,279,281,278,277,280,282,285,286,429,426,383,
+  /* 284 */ 283,286,429,287,431,426,430,383,279,281,282,285,
+  /* 285 */ 282,140,286,139,143,287,284,283,281,239,135,142,
+  /* 286 */ 287,284,285,283,281,282,140,142,143,431,430,429,
+  /* 287 */ 286,143,431,142,430,575,429,284,285,140,719,
+  /* 288 */ 289,432,144,433,145,0,147,290,291,434,576,
+  /* 289 */ 288,290,291,293,294,292,434,433,432,144,145,147,
+  /* 290 */ 293,289,147,288,144,148,145,192,296,294,292,291,
+  /* 291 */ 292,434,289,437,432,288,290,293,294,336,440,433,
+  /* 292 */ 291,294,336,295,338,337,440,437,434,289,290,293,
+  /* 293 */ 290,296,294,297,299,295,292,291,289,147,148,192,
+  /* 294 */ 295,292,293,291,289,290,296,297,299,338,337,336,
+  /* 295 */ 294,299,338,300,344,341,337,336,292,293,296,297,
+  /* 296 */ 297,293,192,290,147,193,148,195,298,299,295,294,
+  /* 297 */ 296,298,299,301,302,300,295,294,293,192,193,195,
+  /* 298 */ 301,297,195,296,192,196,193,240,304,302,300,299,
+  /* 299 */ 300,295,297,294,293,296,298,301,302,344,341,338,
+  /* 300 */ 299,302,344,303,346,345,341,338,295,297,298,301,
+  /* 301 */ 298,304,302,305,307,303,300,299,297,195,196,240,
+  /* 302 */ 303,300,301,299,297,298,304,305,307,346,345,344,
+  /* 303 */ 302,307,346,308,352,349,345,344,300,301,304,305,
+  /* 304 */ 305,301,240,298,195,241,196,243,306,307,303,302,
+  /* 305 */ 304,306,307,309,310,308,303,302,301,240,241,243,
+  /* 306 */ 309,305,243,304,244,241,308,312,310,240,307,
+  /* 307 */ 308,303,305,302,301,304,306,309,310,352,349,346,
+  /* 308 */ 307,310,352,311,354,353,349,346,303,305,306,309,
+  /* 309 */ 306,312,310,313,311,308,307,305,243,315,244,
+  /* 310 */ 311,308,309,307,305,306,312,313,315,354,353,352,
+  /* 311 */ 310,315,354,316,360,357,353,352,308,309,312,313,
+  /* 312 */ 313,309,244,306,243,246,247,314,315,311,310,
+  /* 313 */ 312,314,315,317,318,316,311,310,309,244,246,247,
+  /* 314 */ 317,313,247,312,244,246,251,252,320,318,316,315,
+  /* 315 */ 316,311,313,310,309,312,314,317,318,360,357,354,
+  /* 316 */ 315,318,360,319,362,361,357,354,311,313,314,317,
+  /* 317 */ 314,320,318,321,323,319,316,315,313,247,251,252,
+  /* 318 */ 319,316,317,315,313,314,320,321,323,362,361,360,
+  /* 319 */ 318,323,362,324,368,365,361,360,316,317,320,321,
+  /* 320 */ 321,317,252,314,247,251,254,255,322,323,319,318,
+  /* 321 */ 320,322,323,325,326,324,319,318,317,252,254,255,
+  /* 322 */ 325,321,255,320,252,254,259,260,328,326,324,323,
+  /* 323 */ 324,319,321,318,317,320,322,325,326,368,365,362,
+  /* 324 */ 323,326,368,327,370,369,365,362,319,321,322,325,
+  /* 325 */ 322,328,326,329,331,327,324,323,321,255,259,260,
+  /* 326 */ 327,324,325,323,321,322,328,329,331,370,369,368,
+  /* 327 */ 326,331,370,332,376,373,369,368,324,325,328,329,
+  /* 328 */ 329,325,260,322,255,259,262,263,330,331,327,326,
+  /* 329 */ 328,330,331,333,334,332,327,326,325,260,262,263,
+  /* 330 */ 333,329,263,328,262,267,332,268,334,260,331,
+  /* 331 */ 332,327,329,326,325,328,330,333,334,376,373,370,
+  /* 332 */ 331,334,376,335,378,377,373,370,327,329,330,333,
+  /* 333 */ 330,268,334,267,335,332,331,329,263,271,270,
+  /* 334 */ 335,332,333,331,329,330,268,270,271,378,377,376,
+  /* 335 */ 334,271,378,270,276,381,377,376,332,333,268,275,
+  /* 336 */ 337,440,292,441,434,291,294,295,338,339,442,437,
+  /* 337 */ 336,338,339,341,342,340,442,441,440,292,294,295,
+  /* 338 */ 341,337,295,336,292,294,299,300,344,342,340,339,
+  /* 339 */ 340,442,337,445,440,336,338,341,342,384,448,441,
+  /* 340 */ 339,342,384,343,386,385,448,445,442,337,338,341,
+  /* 341 */ 338,344,342,345,347,343,340,339,337,295,299,300,
+  /* 342 */ 343,340,341,339,337,338,344,345,347,386,385,384,
+  /* 343 */ 342,347,386,348,392,389,385,384,340,341,344,345,
+  /* 344 */ 345,341,300,338,295,299,302,303,346,347,343,342,
+  /* 345 */ 344,346,347,349,350,348,343,342,341,300,302,303,
+  /* 346 */ 349,345,303,344,300,302,307,308,352,350,348,347,
+  /* 347 */ 348,343,345,342,341,344,346,349,350,392,389,386,
+  /* 348 */ 347,350,392,351,394,393,389,386,343,345,346,349,
+  /* 349 */ 346,352,350,353,355,351,348,347,345,303,307,308,
+  /* 350 */ 351,348,349,347,345,346,352,353,355,394,393,392,
+  /* 351 */ 350,355,394,356,400,397,393,392,348,349,352,353,
+  /* 352 */ 353,349,308,346,303,307,310,311,354,355,351,350,
+  /* 353 */ 352,354,355,357,358,356,351,350,349,308,310,311,
+  /* 354 */ 357,353,311,352,308,310,315,316,360,358,356,355,
+  /* 355 */ 356,351,353,350,349,352,354,357,358,400,397,394,
+  /* 356 */ 355,358,400,359,402,401,397,394,351,353,354,357,
+  /* 357 */ 354,360,358,361,363,359,356,355,353,311,315,316,
+  /* 358 */ 359,356,357,355,353,354,360,361,363,402,401,400,
+  /* 359 */ 358,363,402,364,408,405,401,400,356,357,360,361,
+  /* 360 */ 361,357,316,354,311,315,318,319,362,363,359,358,
+  /* 361 */ 360,362,363,365,366,364,359,358,357,316,318,319,
+  /* 362 */ 365,361,319,360,316,318,323,324,368,366,364,363,
+  /* 363 */ 364,359,361,358,357,360,362,365,366,408,405,402,
+  /* 364 */ 363,366,408,367,410,409,405,402,359,361,362,365,
+  /* 365 */ 362,368,366,369,371,367,364,363,361,319,323,324,
+  /* 366 */ 367,364,365,363,361,362,368,369,371,410,409,408,
+  /* 367 */ 366,371,410,372,416,413,409,408,364,365,368,369,
+  /* 368 */ 369,365,324,362,319,323,326,327,370,371,367,366,
+  /* 369 */ 368,370,371,373,374,372,367,366,365,324,326,327,
+  /* 370 */ 373,369,327,368,324,326,331,332,376,374,372,371,
+  /* 371 */ 372,367,369,366,365,368,370,373,374,416,413,410,
+  /* 372 */ 371,374,416,375,418,417,413,410,367,369,370,373,
+  /* 373 */ 370,376,374,377,379,375,372,371,369,327,331,332,
+  /* 374 */ 375,372,373,371,369,370,376,377,379,418,417,416,
+  /* 375 */ 374,379,418,380,424,421,417,416,372,373,376,377,
+  /* 376 */ 377,373,332,370,327,331,334,335,378,379,375,374,
+  /* 377 */ 376,378,379,381,382,380,375,374,373,332,334,335,
+  /* 378 */ 381,377,335,376,332,334,271,275,276,382,380,379,
+  /* 379 */ 380,375,377,374,373,376,378,381,382,424,421,418,
+  /* 380 */ 379,382,424,383,426,425,421,418,375,377,378,381,
+  /* 381 */ 378,276,382,275,279,383,380,379,377,335,271,278,
+  /* 382 */ 383,380,381,379,377,378,276,278,279,426,425,424,
+  /* 383 */ 382,279,426,278,284,429,425,424,380,381,276,283,
+  /* 384 */ 385,448,340,449,442,339,342,343,386,387,450,445,
+  /* 385 */ 384,386,387,389,390,388,450,449,448,340,342,343,
+  /* 386 */ 389,385,343,384,340,342,347,348,392,390,388,387,
+  /* 387 */ 388,450,385,453,384,386,389,390,456,448,449,
+  /* 388 */ 387,390,456,391,457,453,386,450,385,458,389,
+  /* 389 */ 386,392,390,393,395,391,388,387,385,343,347,348,
+  /* 390 */ 391,388,389,387,385,386,392,393,395,458,457,456,
+  /* 391 */ 390,395,458,396,464,461,457,456,388,389,392,393,
+  /* 392 */ 393,389,348,386,343,347,350,351,394,395,391,390,
+  /* 393 */ 392,394,395,397,398,396,391,390,389,348,350,351,
+  /* 394 */ 397,393,351,392,348,350,355,356,400,398,396,395,
+  /* 395 */ 396,391,393,390,389,392,394,397,398,464,461,458,
+  /* 396 */ 395,398,464,399,466,465,461,458,391,393,394,397,
+  /* 397 */ 394,400,398,401,403,399,396,395,393,351,355,356,
+  /* 398 */ 399,396,397,395,393,394,400,401,403,466,465,464,
+  /* 399 */ 398,403,466,404,472,469,465,464,396,397,400,401,
+  /* 400 */ 401,397,356,394,351,355,358,359,402,403,399,398,
+  /* 401 */ 400,402,403,405,406,404,399,398,397,356,358,359,
+  /* 402 */ 405,401,359,400,356,358,363,364,408,406,404,403,
+  /* 403 */ 404,399,401,398,397,400,402,405,406,472,469,466,
+  /* 404 */ 403,406,472,407,474,473,469,466,399,401,402,405,
+  /* 405 */ 402,408,406,409,411,407,404,403,401,359,363,364,
+  /* 406 */ 407,404,405,403,401,402,408,409,411,474,473,472,
+  /* 407 */ 406,411,474,412,477,473,472,404,405,408,409,
+  /* 408 */ 409,405,364,402,359,363,366,367,410,411,407,406,
+  /* 409 */ 408,410,411,413,414,412,407,406,405,364,366,367,
+  /* 410 */ 413,409,367,408,364,366,371,372,416,414,412,411,
+  /* 411 */ 412,407,409,406,408,410,413,414,477,405,474,
+  /* 412 */ 411,414,477,415,474,478,410,407,409,479,413,
+  /* 413 */ 410,416,414,417,419,415,412,411,409,367,371,372,
+  /* 414 */ 415,412,413,411,409,410,416,417,419,479,478,477,
+  /* 415 */ 414,419,479,420,525,478,522,477,412,413,416,417,
+  /* 416 */ 417,413,372,410,367,371,374,375,418,419,415,414,
+  /* 417 */ 416,418,419,421,422,420,415,414,413,372,374,375,
+  /* 418 */ 421,417,375,416,372,374,379,380,424,422,420,419,
+  /* 419 */ 420,415,417,414,413,416,418,421,422,525,522,479,
+  /* 420 */ 419,422,525,423,527,522,526,479,415,417,418,421,
+  /* 421 */ 418,424,422,425,427,423,420,419,417,375,379,380,
+  /* 422 */ 423,420,421,419,417,418,424,425,427,527,526,525,
+  /* 423 */ 422,427,527,428,573,526,570,525,420,421,424,425,
+  /* 424 */ 425,421,380,418,375,379,382,383,426,427,423,422,
+  /* 425 */ 424,426,427,429,430,428,423,422,421,380,382,383,
+  /* 426 */ 429,425,383,424,380,382,279,283,284,430,428,427,
+  /* 427 */ 428,423,425,422,421,424,426,429,430,573,570,527,
+  /* 428 */ 427,430,573,431,575,570,574,527,423,425,426,429,
+  /* 429 */ 426,284,430,283,287,431,428,427,425,383,279,286,
+  /* 430 */ 431,428,429,427,425,426,284,286,287,575,574,573,
+  /* 431 */ 430,287,575,286,574,719,573,428,429,284,143,
+  /* 432 */ 433,576,288,577,289,144,291,434,435,578,0,
+  /* 433 */ 432,434,435,437,438,436,578,577,576,288,289,291,
+  /* 434 */ 437,433,291,432,288,292,289,336,440,438,436,435,
+  /* 435 */ 436,578,433,581,576,432,434,437,438,480,584,577,
+  /* 436 */ 435,438,480,439,482,481,584,581,578,433,434,437,
+  /* 437 */ 434,440,438,441,443,439,436,435,433,291,292,336,
+  /* 438 */ 439,436,437,435,433,434,440,441,443,482,481,480,
+  /* 439 */ 438,443,482,444,488,485,481,480,436,437,440,441,
+  /* 440 */ 441,437,336,434,291,337,292,339,442,443,439,438,
+  /* 441 */ 440,442,443,445,446,444,439,438,437,336,337,339,
+  /* 442 */ 445,441,339,440,336,340,337,384,448,446,444,443,
+  /* 443 */ 444,439,441,438,437,440,442,445,446,488,485,482,
+  /* 444 */ 443,446,488,447,490,489,485,482,439,441,442,445,
+  /* 445 */ 442,448,446,449,451,447,444,443,441,339,340,384,
+  /* 446 */ 447,444,445,443,441,442,448,449,451,490,489,488,
+  /* 447 */ 446,451,490,452,496,493,489,488,444,445,448,449,
+  /* 448 */ 449,445,384,442,339,385,340,387,450,451,447,446,
+  /* 449 */ 448,450,451,453,454,452,447,446,445,384,385,387,
+  /* 450 */ 453,449,387,448,388,385,452,456,454,384,451,
+  /* 451 */ 452,447,449,446,445,448,450,453,454,496,493,490,
+  /* 452 */ 451,454,496,455,498,497,493,490,447,449,450,453,
+  /* 453 */ 450,456,454,457,455,452,451,449,387,459,388,
+  /* 454 */ 455,452,453,451,449,450,456,457,459,498,497,496,
+  /* 455 */ 454,459,498,460,504,501,497,496,452,453,456,457,
+  /* 456 */ 457,453,388,450,387,390,391,458,459,455,454,
+  /* 457 */ 456,458,459,461,462,460,455,454,453,388,390,391,
+  /* 458 */ 461,457,391,456,388,390,395,396,464,462,460,459,
+  /* 459 */ 460,455,457,454,453,456,458,461,462,504,501,498,
+  /* 460 */ 459,462,504,463,506,505,501,498,455,457,458,461,
+  /* 461 */ 458,464,462,465,467,463,460,459,457,391,395,396,
+  /* 462 */ 463,460,461,459,457,458,464,465,467,506,505,504,
+  /* 463 */ 462,467,506,468,512,509,505,504,460,461,464,465,
+  /* 464 */ 465,461,396,458,391,395,398,399,466,467,463,462,
+  /* 465 */ 464,466,467,469,470,468,463,462,461,396,398,399,
+  /* 466 */ 469,465,399,464,396,398,403,404,472,470,468,467,
+  /* 467 */ 468,463,465,462,461,464,466,469,470,512,509,506,
+  /* 468 */ 467,470,512,471,514,513,509,506,463,465,466,469,
+  /* 469 */ 466,472,470,473,475,471,468,467,465,399,403,404,
+  /* 470 */ 471,468,469,467,465,466,472,473,475,514,513,512,
+  /* 471 */ 470,475,514,476,520,517,513,512,468,469,472,473,
+  /* 472 */ 473,469,404,466,399,403,406,407,474,475,471,470,
+  /* 473 */ 472,474,475,477,478,476,471,470,469,404,406,407,
+  /* 474 */ 477,473,407,472,406,411,476,412,478,404,475,
+  /* 475 */ 476,471,473,470,469,472,474,477,478,520,517,514,
+  /* 476 */ 475,478,520,479,522,521,517,514,471,473,474,477,
+  /* 477 */ 474,412,478,411,479,476,475,473,407,415,414,
+  /* 478 */ 479,476,477,475,473,474,412,414,415,522,521,520,
+  /* 479 */ 478,415,522,414,420,525,521,520,476,477,412,419,
+  /* 480 */ 481,584,436,585,578,435,438,439,482,483,586,581,
+  /* 481 */ 480,482,483,485,486,484,586,585,584,436,438,439,
+  /* 482 */ 485,481,439,480,436,438,443,444,488,486,484,483,
+  /* 483 */ 484,586,481,589,584,480,482,485,486,528,592,585,
+  /* 484 */ 483,486,528,487,530,529,592,589,586,481,482,485,
+  /* 485 */ 482,488,486,489,491,487,484,483,481,439,443,444,
+  /* 486 */ 487,484,485,483,481,482,488,489,491,530,529,528,
+  /* 487 */ 486,491,530,492,536,533,529,528,484,485,488,489,
+  /* 488 */ 489,485,444,482,439,443,446,447,490,491,487,486,
+  /* 489 */ 488,490,491,493,494,492,487,486,485,444,446,447,
+  /* 490 */ 493,489,447,488,444,446,451,452,496,494,492,491,
+  /* 491 */ 492,487,489,486,485,488,490,493,494,536,533,530,
+  /* 492 */ 491,494,536,495,538,537,533,530,487,489,490,493,
+  /* 493 */ 490,496,494,497,499,495,492,491,489,447,451,452,
+  /* 494 */ 495,492,493,491,489,490,496,497,499,538,537,536,
+  /* 495 */ 494,499,538,500,544,541,537,536,492,493,496,497,
+  /* 496 */ 497,493,452,490,447,451,454,455,498,499,495,494,
+  /* 497 */ 496,498,499,501,502,500,495,494,493,452,454,455,
+  /* 498 */ 501,497,455,496,452,454,459,460,504,502,500,499,
+  /* 499 */ 500,495,497,494,493,496,498,501,502,544,541,538,
+  /* 500 */ 499,502,544,503,546,545,541,538,495,497,498,501,
+  /* 501 */ 498,504,502,505,507,503,500,499,497,455,459,460,
+  /* 502 */ 503,500,501,499,497,498,504,505,507,546,545,544,
+  /* 503 */ 502,507,546,508,552,549,545,544,500,501,504,505,
+  /* 504 */ 505,501,460,498,455,459,462,463,506,507,503,502,
+  /* 505 */ 504,506,507,509,510,508,503,502,501,460,462,463,
+  /* 506 */ 509,505,463,504,460,462,467,468,512,510,508,507,
+  /* 507 */ 508,503,505,502,501,504,506,509,510,552,549,546,
+  /* 508 */ 507,510,552,511,554,553,549,546,503,505,506,509,
+  /* 509 */ 506,512,510,513,515,511,508,507,505,463,467,468,
+  /* 510 */ 511,508,509,507,505,506,512,513,515,554,553,552,
+  /* 511 */ 510,515,554,516,560,557,553,552,508,509,512,513,
+  /* 512 */ 513,509,468,506,463,467,470,471,514,515,511,510,
+  /* 513 */ 512,514,515,517,518,516,511,510,509,468,470,471,
+  /* 514 */ 517,513,471,512,468,470,475,476,520,518,516,515,
+  /* 515 */ 516,511,513,510,509,512,514,517,518,560,557,554,
+  /* 516 */ 515,518,560,519,562,561,557,554,511,513,514,517,
+  /* 517 */ 514,520,518,521,523,519,516,515,513,471,475,476,
+  /* 518 */ 519,516,517,515,513,514,520,521,523,562,561,560,
+  /* 519 */ 518,523,562,524,568,565,561,560,516,517,520,521,
+  /* 520 */ 521,517,476,514,471,475,478,479,522,523,519,518,
+  /* 521 */ 520,522,523,525,526,524,519,518,517,476,478,479,
+  /* 522 */ 525,521,479,520,476,478,415,419,420,526,524,523,
+  /* 523 */ 524,519,521,518,517,520,522,525,526,568,565,562,
+  /* 524 */ 523,526,568,527,570,569,565,562,519,521,522,525,
+  /* 525 */ 522,420,526,419,423,527,524,523,521,479,415,422,
+  /* 526 */ 527,524,525,523,521,522,420,422,423,570,569,568,
+  /* 527 */ 526,423,570,422,428,573,569,568,524,525,420,427,
+  /* 528 */ 529,592,484,593,586,483,486,487,530,531,594,589,
+  /* 529 */ 528,530,531,533,534,532,594,593,592,484,486,487,
+  /* 530 */ 533,529,487,528,484,486,491,492,536,534,532,531,
+  /* 531 */ 532,594,529,597,528,530,533,534,600,592,593,
+  /* 532 */ 531,534,600,535,601,597,530,594,529,602,533,
+  /* 533 */ 530,536,534,537,539,535,532,531,529,487,491,492,
+  /* 534 */ 535,532,533,531,529,530,536,537,539,602,601,600,
+  /* 535 */ 534,539,602,540,608,605,601,600,532,533,536,537,
+  /* 536 */ 537,533,492,530,487,491,494,495,538,539,535,534,
+  /* 537 */ 536,538,539,541,542,540,535,534,533,492,494,495,
+  /* 538 */ 541,537,495,536,492,494,499,500,544,542,540,539,
+  /* 539 */ 540,535,537,534,533,536,538,541,542,608,605,602,
+  /* 540 */ 539,542,608,543,610,609,605,602,535,537,538,541,
+  /* 541 */ 538,544,542,545,547,543,540,539,537,495,499,500,
+  /* 542 */ 543,540,541,539,537,538,544,545,547,610,609,608,
+  /* 543 */ 542,547,610,548,616,613,609,608,540,541,544,545,
+  /* 544 */ 545,541,500,538,495,499,502,503,546,547,543,542,
+  /* 545 */ 544,546,547,549,550,548,543,542,541,500,502,503,
+  /* 546 */ 549,545,503,544,500,502,507,508,552,550,548,547,
+  /* 547 */ 548,543,545,542,541,544,546,549,550,616,613,610,
+  /* 548 */ 547,550,616,551,618,617,613,610,543,545,546,549,
+  /* 549 */ 546,552,550,553,555,551,548,547,545,503,507,508,
+  /* 550 */ 551,548,549,547,545,546,552,553,555,618,617,616,
+  /* 551 */ 550,555,618,556,621,617,616,548,549,552,553,
+  /* 552 */ 553,549,508,546,503,507,510,511,554,555,551,550,
+  /* 553 */ 552,554,555,557,558,556,551,550,549,508,510,511,
+  /* 554 */ 557,553,511,552,508,510,515,516,560,558,556,555,
+  /* 555 */ 556,551,553,550,552,554,557,558,621,549,618,
+  /* 556 */ 555,558,621,559,618,622,554,551,553,623,557,
+  /* 557 */ 554,560,558,561,563,559,556,555,553,511,515,516,
+  /* 558 */ 559,556,557,555,553,554,560,561,563,623,622,621,
+  /* 559 */ 558,563,623,564,669,622,666,621,556,557,560,561,
+  /* 560 */ 561,557,516,554,511,515,518,519,562,563,559,558,
+  /* 561 */ 560,562,563,565,566,564,559,558,557,516,518,519,
+  /* 562 */ 565,561,519,560,516,518,523,524,568,566,564,563,
+  /* 563 */ 564,559,561,558,557,560,562,565,566,669,666,623,
+  /* 564 */ 563,566,669,567,671,666,670,623,559,561,562,565,
+  /* 565 */ 562,568,566,569,571,567,564,563,561,519,523,524,
+  /* 566 */ 567,564,565,563,561,562,568,569,571,671,670,669,
+  /* 567 */ 566,571,671,572,717,670,714,669,564,565,568,569,
+  /* 568 */ 569,565,524,562,519,523,526,527,570,571,567,566,
+  /* 569 */ 568,570,571,573,574,572,567,566,565,524,526,527,
+  /* 570 */ 573,569,527,568,524,526,423,427,428,574,572,571,
+  /* 571 */ 572,567,569,566,565,568,570,573,574,717,714,671,
+  /* 572 */ 571,574,717,575,719,714,718,671,567,569,570,573,
+  /* 573 */ 570,428,574,427,431,575,572,571,569,527,423,430,
+  /* 574 */ 575,572,573,571,569,570,428,430,431,719,718,717,
+  /* 575 */ 574,431,719,430,718,143,717,572,573,428,287,
+  /* 576 */ 577,0,432,1,433,288,435,578,579,2,144,
+  /* 577 */ 576,578,579,581,582,580,2,1,0,432,433,435,
+  /* 578 */ 581,577,435,576,432,436,433,480,584,582,580,579,
+  /* 579 */ 580,2,577,5,0,576,578,581,582,624,8,1,
+  /* 580 */ 579,582,624,583,626,625,8,5,2,577,578,581,
+  /* 581 */ 578,584,582,585,587,583,580,579,577,435,436,480,
+  /* 582 */ 583,580,581,579,577,578,584,585,587,626,625,624,
+  /* 583 */ 582,587,626,588,632,629,625,624,580,581,584,585,
+  /* 584 */ 585,581,480,578,435,481,436,483,586,587,583,582,
+  /* 585 */ 584,586,587,589,590,588,583,582,581,480,481,483,
+  /* 586 */ 589,585,483,584,480,484,481,528,592,590,588,587,
+  /* 587 */ 588,583,585,582,581,584,586,589,590,632,629,626,
+  /* 588 */ 587,590,632,591,634,633,629,626,583,585,586,589,
+  /* 589 */ 586,592,590,593,595,591,588,587,585,483,484,528,
+  /* 590 */ 591,588,589,587,585,586,592,593,595,634,633,632,
+  /* 591 */ 590,595,634,596,640,637,633,632,588,589,592,593,
+  /* 592 */ 593,589,528,586,483,529,484,531,594,595,591,590,
+  /* 593 */ 592,594,595,597,598,596,591,590,589,528,529,531,
+  /* 594 */ 597,593,531,592,532,529,596,600,598,528,595,
+  /* 595 */ 596,591,593,590,589,592,594,597,598,640,637,634,
+  /* 596 */ 595,598,640,599,642,641,637,634,591,593,594,597,
+  /* 597 */ 594,600,598,601,599,596,595,593,531,603,532,
+  /* 598 */ 599,596,597,595,593,594,600,601,603,642,641,640,
+  /* 599 */ 598,603,642,604,648,645,641,640,596,597,600,601,
+  /* 600 */ 601,597,532,594,531,534,535,602,603,599,598,
+  /* 601 */ 600,602,603,605,606,604,599,598,597,532,534,535,
+  /* 602 */ 605,601,535,600,532,534,539,540,608,606,604,603,
+  /* 603 */ 604,599,601,598,597,600,602,605,606,648,645,642,
+  /* 604 */ 603,606,648,607,650,649,645,642,599,601,602,605,
+  /* 605 */ 602,608,606,609,611,607,604,603,601,535,539,540,
+  /* 606 */ 607,604,605,603,601,602,608,609,611,650,649,648,
+  /* 607 */ 606,611,650,612,656,653,649,648,604,605,608,609,
+  /* 608 */ 609,605,540,602,535,539,542,543,610,611,607,606,
+  /* 609 */ 608,610,611,613,614,612,607,606,605,540,542,543,
+  /* 610 */ 613,609,543,608,540,542,547,548,616,614,612,611,
+  /* 611 */ 612,607,609,606,605,608,610,613,614,656,653,650,
+  /* 612 */ 611,614,656,615,658,657,653,650,607,609,610,613,
+  /* 613 */ 610,616,614,617,619,615,612,611,609,543,547,548,
+  /* 614 */ 615,612,613,611,609,610,616,617,619,658,657,656,
+  /* 615 */ 614,619,658,620,664,661,657,656,612,613,616,617,
+  /* 616 */ 617,613,548,610,543,547,550,551,618,619,615,614,
+  /* 617 */ 616,618,619,621,622,620,615,614,613,548,550,551,
+  /* 618 */ 621,617,551,616,550,555,620,556,622,548,619,
+  /* 619 */ 620,615,617,614,613,616,618,621,622,664,661,658,
+  /* 620 */ 619,622,664,623,666,665,661,658,615,617,618,621,
+  /* 621 */ 618,556,622,555,623,620,619,617,551,559,558,
+  /* 622 */ 623,620,621,619,617,618,556,558,559,666,665,664,
+  /* 623 */ 622,559,666,558,564,669,665,664,620,621,556,563,
+  /* 624 */ 625,8,580,9,2,579,582,583,626,627,10,5,
+  /* 625 */ 624,626,627,629,630,628,10,9,8,580,582,583,
+  /* 626 */ 629,625,583,624,580,582,587,588,632,630,628,627,
+  /* 627 */ 628,10,625,13,8,624,626,629,630,672,16,9,
+  /* 628 */ 627,630,672,631,674,673,16,13,10,625,626,629,
+  /* 629 */ 626,632,630,633,635,631,628,627,625,583,587,588,
+  /* 630 */ 631,628,629,627,625,626,632,633,635,674,673,672,
+  /* 631 */ 630,635,674,636,680,677,673,672,628,629,632,633,
+  /* 632 */ 633,629,588,626,583,587,590,591,634,635,631,630,
+  /* 633 */ 632,634,635,637,638,636,631,630,629,588,590,591,
+  /* 634 */ 637,633,591,632,588,590,595,596,640,638,636,635,
+  /* 635 */ 636,631,633,630,629,632,634,637,638,680,677,674,
+  /* 636 */ 635,638,680,639,682,681,677,674,631,633,634,637,
+  /* 637 */ 634,640,638,641,643,639,636,635,633,591,595,596,
+  /* 638 */ 639,636,637,635,633,634,640,641,643,682,681,680,
+  /* 639 */ 638,643,682,644,688,685,681,680,636,637,640,641,
+  /* 640 */ 641,637,596,634,591,595,598,599,642,643,639,638,
+  /* 641 */ 640,642,643,645,646,644,639,638,637,596,598,599,
+  /* 642 */ 645,641,599,640,596,598,603,604,648,646,644,643,
+  /* 643 */ 644,639,641,638,637,640,642,645,646,688,685,682,
+  /* 644 */ 643,646,688,647,690,689,685,682,639,641,642,645,
+  /* 645 */ 642,648,646,649,651,647,644,643,641,599,603,604,
+  /* 646 */ 647,644,645,643,641,642,648,649,651,690,689,688,
+  /* 647 */ 646,651,690,652,696,693,689,688,644,645,648,649,
+  /* 648 */ 649,645,604,642,599,603,606,607,650,651,647,646,
+  /* 649 */ 648,650,651,653,654,652,647,646,645,604,606,607,
+  /* 650 */ 653,649,607,648,604,606,611,612,656,654,652,651,
+  /* 651 */ 652,647,649,646,645,648,650,653,654,696,693,690,
+  /* 652 */ 651,654,696,655,698,697,693,690,647,649,650,653,
+  /* 653 */ 650,656,654,657,659,655,652,651,649,607,611,612,
+  /* 654 */ 655,652,653,651,649,650,656,657,659,698,697,696,
+  /* 655 */ 654,659,698,660,704,701,697,696,652,653,656,657,
+  /* 656 */ 657,653,612,650,607,611,614,615,658,659,655,654,
+  /* 657 */ 656,658,659,661,662,660,655,654,653,612,614,615,
+  /* 658 */ 661,657,615,656,612,614,619,620,664,662,660,659,
+  /* 659 */ 660,655,657,654,653,656,658,661,662,704,701,698,
+  /* 660 */ 659,662,704,663,706,705,701,698,655,657,658,661,
+  /* 661 */ 658,664,662,665,667,663,660,659,657,615,619,620,
+  /* 662 */ 663,660,661,659,657,658,664,665,667,706,705,704,
+  /* 663 */ 662,667,706,668,712,709,705,704,660,661,664,665,
+  /* 664 */ 665,661,620,658,615,619,622,623,666,667,663,662,
+  /* 665 */ 664,666,667,669,670,668,663,662,661,620,622,623,
+  /* 666 */ 669,665,623,664,620,622,559,563,564,670,668,667,
+  /* 667 */ 668,663,665,662,661,664,666,669,670,712,709,706,
+  /* 668 */ 667,670,712,671,714,713,709,706,663,665,666,669,
+  /* 669 */ 666,564,670,563,567,671,668,667,665,623,559,566,
+  /* 670 */ 671,668,669,667,665,666,564,566,567,714,713,712,
+  /* 671 */ 670,567,714,566,572,717,713,712,668,669,564,571,
+  /* 672 */ 673,16,628,17,10,627,630,631,674,675,18,13,
+  /* 673 */ 672,674,675,677,678,676,18,17,16,628,630,631,
+  /* 674 */ 677,673,631,672,628,630,635,636,680,678,676,675,
+  /* 675 */ 676,18,673,21,672,674,677,678,24,16,17,
+  /* 676 */ 675,678,24,679,25,21,674,18,673,26,677,
+  /* 677 */ 674,680,678,681,683,679,676,675,673,631,635,636,
+  /* 678 */ 679,676,677,675,673,674,680,681,683,26,25,24,
+  /* 679 */ 678,683,26,684,32,29,25,24,676,677,680,681,
+  /* 680 */ 681,677,636,674,631,635,638,639,682,683,679,678,
+  /* 681 */ 680,682,683,685,686,684,679,678,677,636,638,639,
+  /* 682 */ 685,681,639,680,636,638,643,644,688,686,684,683,
+  /* 683 */ 684,679,681,678,677,680,682,685,686,32,29,26,
+  /* 684 */ 683,686,32,687,34,33,29,26,679,681,682,685,
+  /* 685 */ 682,688,686,689,691,687,684,683,681,639,643,644,
+  /* 686 */ 687,684,685,683,681,682,688,689,691,34,33,32,
+  /* 687 */ 686,691,34,692,40,37,33,32,684,685,688,689,
+  /* 688 */ 689,685,644,682,639,643,646,647,690,691,687,686,
+  /* 689 */ 688,690,691,693,694,692,687,686,685,644,646,647,
+  /* 690 */ 693,689,647,688,644,646,651,652,696,694,692,691,
+  /* 691 */ 692,687,689,686,685,688,690,693,694,40,37,34,
+  /* 692 */ 691,694,40,695,42,41,37,34,687,689,690,693,
+  /* 693 */ 690,696,694,697,699,695,692,691,689,647,651,652,
+  /* 694 */ 695,692,693,691,689,690,696,697,699,42,41,40,
+  /* 695 */ 694,699,42,700,45,41,40,692,693,696,697,
+  /* 696 */ 697,693,652,690,647,651,654,655,698,699,695,694,
+  /* 697 */ 696,698,699,701,702,700,695,694,693,652,654,655,
+  /* 698 */ 701,697,655,696,652,654,659,660,704,702,700,699,
+  /* 699 */ 700,695,697,694,696,698,701,702,45,693,42,
+  /* 700 */ 699,702,45,703,42,46,698,695,697,47,701,
+  /* 701 */ 698,704,702,705,707,703,700,699,697,655,659,660,
+  /* 702 */ 703,700,701,699,697,698,704,705,707,47,46,45,
+  /* 703 */ 702,707,47,708,93,46,90,45,700,701,704,705,
+  /* 704 */ 705,701,660,698,655,659,662,663,706,707,703,702,
+  /* 705 */ 704,706,707,709,710,708,703,702,701,660,662,663,
+  /* 706 */ 709,705,663,704,660,662,667,668,712,710,708,707,
+  /* 707 */ 708,703,705,702,701,704,706,709,710,93,90,47,
+  /* 708 */ 707,710,93,711,95,90,94,47,703,705,706,709,
+  /* 709 */ 706,712,710,713,715,711,708,707,705,663,667,668,
+  /* 710 */ 711,708,709,707,705,706,712,713,715,95,94,93,
+  /* 711 */ 710,715,95,716,141,94,138,93,708,709,712,713,
+  /* 712 */ 713,709,668,706,663,667,670,671,714,715,711,710,
+  /* 713 */ 712,714,715,717,718,716,711,710,709,668,670,671,
+  /* 714 */ 717,713,671,712,668,670,567,571,572,718,716,715,
+  /* 715 */ 716,711,713,710,709,712,714,717,718,141,138,95,
+  /* 716 */ 715,718,141,719,143,138,142,95,711,713,714,717,
+  /* 717 */ 714,572,718,571,575,719,716,715,713,671,567,574,
+  /* 718 */ 719,716,717,715,713,714,572,574,575,143,142,141,
+  /* 719 */ 718,575,143,574,142,287,141,716,717,572,431,
 };
@@ -1,6 +1,6 @@
 #include "detectors/TAPSVeto.h"
-const std::vector<ant::expconfig::detector::TAPSVeto_2007::BaF2_Element_t>
-ant::expconfig::detector::TAPSVeto_2007::BaF2_elements_init = {
+constexpr ant::expconfig::detector::TAPSVeto::BaF2_row_t
+ant::expconfig::detector::TAPSVeto_2007::BaF2_table[] = {
     {  0, { -5.196,   3.000}, 26301, 26001},
     {  1, {-10.392,   6.000}, 26302, 26002},
     {  2, {-10.392,   0.000}, 26303, 26003},
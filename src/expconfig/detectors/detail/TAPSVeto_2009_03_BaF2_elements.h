@@ -1,6 +1,6 @@
 #include "detectors/TAPSVeto.h"
-const std::vector<ant::expconfig::detector::TAPSVeto_2009_03::BaF2_Element_t>
-ant::expconfig::detector::TAPSVeto_2009_03::BaF2_elements_init = {
+constexpr ant::expconfig::detector::TAPSVeto::BaF2_row_t
+ant::expconfig::detector::TAPSVeto_2009_03::BaF2_table[] = {
     {  3, {-15.588,   9.000}, 26304, 26004},
     {  4, {-15.588,   3.000}, 26305, 26005},
     {  5, {-15.588,  -3.000}, 26306, 26006},
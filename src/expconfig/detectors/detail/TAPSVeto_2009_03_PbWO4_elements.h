@@ -1,6 +1,6 @@
 #include "detectors/TAPSVeto.h"
-const std::vector<ant::expconfig::detector::TAPSVeto_2009_03::PbWO4_Element_t>
-ant::expconfig::detector::TAPSVeto_2009_03::PbWO4_elements_init = {
+constexpr ant::expconfig::detector::TAPSVeto::PbWO4_row_t
+ant::expconfig::detector::TAPSVeto_2009_03::PbWO4_table[] = {
     {  0, { -5.196,   3.000}, 30601, 30401, 30501},
     {  1, {-10.392,   6.000}, 30602, 30402, 30502},
     {  2, {-10.392,   0.000}, 30603, 30403, 30503},
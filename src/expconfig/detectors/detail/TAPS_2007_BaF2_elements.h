@@ -1,389 +1,776 @@
 #include "detectors/TAPS.h"
-const std::vector<ant::expconfig::detector::TAPS_2007::BaF2_Element_t>
-ant::expconfig::detector::TAPS_2007::BaF2_elements_init = {
-  // element, {xy}, TAC, LG, SG, LGS, SGS, {neigbours}
-    {  0, { -5.196,   3.000}, 20401, 20201, 20301, 20001, 20101, {1,2,64,320,322}},
-    {  1, {-10.392,   6.000}, 20402, 20202, 20302, 20002, 20102, {0,2,4,3,325,322}},
-    {  2, {-10.392,   0.000}, 20403, 20203, 20303, 20003, 20103, {0,1,4,5,65,64}},
-    {  3, {-15.588,   9.000}, 20404, 20204, 20304, 20004, 20104, {1,325,329,6,7,4}},
-    {  4, {-15.588,   3.000}, 20405, 20205, 20305, 20005, 20105, {1,2,5,8,7,3}},
-    {  5, {-15.588,  -3.000}, 20406, 20206, 20306, 20006, 20106, {2,4,8,9,67,65}},
-    {  6, {-20.785,  12.000}, 20407, 20207, 20307, 20007, 20107, {3,329,334,10,11,7}},
-    {  7, {-20.785,   6.000}, 20408, 20208, 20308, 20008, 20108, {4,3,6,11,12,8}},
-    {  8, {-20.785,   0.000}, 20409, 20209, 20309, 20009, 20109, {4,7,12,13,9,5}},
-    {  9, {-20.785,  -6.000}, 20410, 20210, 20310, 20010, 20110, {70,67,5,8,13,14}},
-    { 10, {-25.981,  15.000}, 20411, 20211, 20311, 20011, 20111, {11,6,334,340,15,16}},
-    { 11, {-25.981,   9.000}, 20412, 20212, 20312, 20012, 20112, {12,7,6,10,16,17}},
-    { 12, {-25.981,   3.000}, 20413, 20213, 20313, 20013, 20113, {13,8,7,11,17,18}},
-    { 13, {-25.981,  -3.000}, 20414, 20214, 20314, 20014, 20114, {14,9,8,12,18,19}},
-    { 14, {-25.981,  -9.000}, 20415, 20215, 20315, 20015, 20115, {74,70,9,13,19,20}},
-    { 15, {-31.177,  18.000}, 20416, 20216, 20316, 20016, 20116, {16,10,340,347,21,22}},
-    { 16, {-31.177,  12.000}, 20417, 20217, 20317, 20017, 20117, {17,11,10,15,22,23}},
-    { 17, {-31.177,   6.000}, 20418, 20218, 20318, 20018, 20118, {18,12,11,16,23,24}},
-    { 18, {-31.177,   0.000}, 20419, 20219, 20319, 20019, 20119, {19,13,12,17,24,25}},
-    { 19, {-31.177,  -6.000}, 20420, 20220, 20320, 20020, 20120, {20,14,13,18,25,26}},
-    { 20, {-31.177, -12.000}, 20421, 20221, 20321, 20021, 20121, {79,74,14,19,26,27}},
-    { 21, {-36.373,  21.000}, 20422, 20222, 20322, 20022, 20122, {22,15,347,355,28,29}},
-    { 22, {-36.373,  15.000}, 20423, 20223, 20323, 20023, 20123, {23,16,15,21,29,30}},
-    { 23, {-36.373,   9.000}, 20424, 20224, 20324, 20024, 20124, {24,17,16,22,30,31}},
-    { 24, {-36.373,   3.000}, 20425, 20225, 20325, 20025, 20125, {25,18,17,23,31,32}},
-    { 25, {-36.373,  -3.000}, 20426, 20226, 20326, 20026, 20126, {26,19,18,24,32,33}},
-    { 26, {-36.373,  -9.000}, 20427, 20227, 20327, 20027, 20127, {27,20,19,25,33,34}},
-    { 27, {-36.373, -15.000}, 20428, 20228, 20328, 20028, 20128, {85,79,20,26,34,35}},
-    { 28, {-41.569,  24.000}, 20429, 20229, 20329, 20029, 20129, {29,21,355,364,36,37}},
-    { 29, {-41.569,  18.000}, 20430, 20230, 20330, 20030, 20130, {30,22,21,28,37,38}},
-    { 30, {-41.569,  12.000}, 20431, 20231, 20331, 20031, 20131, {31,23,22,29,38,39}},
-    { 31, {-41.569,   6.000}, 20432, 20232, 20332, 20032, 20132, {32,24,23,30,39,40}},
-    { 32, {-41.569,   0.000}, 20433, 20233, 20333, 20033, 20133, {33,25,24,31,40,41}},
-    { 33, {-41.569,  -6.000}, 20434, 20234, 20334, 20034, 20134, {34,26,25,32,41,42}},
-    { 34, {-41.569, -12.000}, 20435, 20235, 20335, 20035, 20135, {35,27,26,33,42,43}},
-    { 35, {-41.569, -18.000}, 20436, 20236, 20336, 20036, 20136, {92,85,27,34,43,44}},
-    { 36, {-46.765,  27.000}, 20437, 20237, 20337, 20037, 20137, {37,28,364,374,45,46}},
-    { 37, {-46.765,  21.000}, 20438, 20238, 20338, 20038, 20138, {38,29,28,36,46,47}},
-    { 38, {-46.765,  15.000}, 20439, 20239, 20339, 20039, 20139, {39,30,29,37,47,48}},
-    { 39, {-46.765,   9.000}, 20440, 20240, 20340, 20040, 20140, {40,31,30,38,48,49}},
-    { 40, {-46.765,   3.000}, 20441, 20241, 20341, 20041, 20141, {41,32,31,39,49,50}},
-    { 41, {-46.765,  -3.000}, 20442, 20242, 20342, 20042, 20142, {42,33,32,40,50,51}},
-    { 42, {-46.765,  -9.000}, 20443, 20243, 20343, 20043, 20143, {43,34,33,41,51,52}},
-    { 43, {-46.765, -15.000}, 20444, 20244, 20344, 20044, 20144, {44,35,34,42,52,53}},
-    { 44, {-46.765, -21.000}, 20445, 20245, 20345, 20045, 20145, {100,92,35,43,53,54}},
-    { 45, {-51.962,  30.000}, 20446, 20246, 20346, 20046, 20146, {46,36,374,383,55}},
-    { 46, {-51.962,  24.000}, 20447, 20247, 20347, 20047, 20147, {47,37,36,45,55,46}},
-    { 47, {-51.962,  18.000}, 20448, 20248, 20348, 20048, 20148, {48,38,37,46,56,47}},
-    { 48, {-51.962,  12.000}, 20449, 20249, 20349, 20049, 20149, {49,39,38,47,57,48}},
-    { 49, {-51.962,   6.000}, 20450, 20250, 20350, 20050, 20150, {50,40,39,46,58,49}},
-    { 50, {-51.962,   0.000}, 20451, 20251, 20351, 20051, 20151, {51,41,40,47,59,50}},
-    { 51, {-51.962,  -6.000}, 20452, 20252, 20352, 20052, 20152, {52,42,41,48,60,51}},
-    { 52, {-51.962, -12.000}, 20453, 20253, 20353, 20053, 20153, {53,43,42,49,59,52}},
-    { 53, {-51.962, -18.000}, 20454, 20254, 20354, 20054, 20154, {54,44,43,50,60,53}},
-    { 54, {-51.962, -24.000}, 20455, 20255, 20355, 20055, 20155, {109,100,44,53,63}},
-    { 55, {-57.158,  27.000}, 20456, 20256, 20356, 20056, 20156, {56,46,45}},
-    { 56, {-57.158,  21.000}, 20457, 20257, 20357, 20057, 20157, {57,47,46,55}},
-    { 57, {-57.158,  15.000}, 20458, 20258, 20358, 20058, 20158, {58,48,47,56}},
-    { 58, {-57.158,   9.000}, 20459, 20259, 20359, 20059, 20159, {59,49,48,57}},
-    { 59, {-57.158,   3.000}, 20460, 20260, 20360, 20060, 20160, {60,50,49,58}},
-    { 60, {-57.158,  -3.000}, 20461, 20261, 20361, 20061, 20161, {61,51,50,59}},
-    { 61, {-57.158,  -9.000}, 20462, 20262, 20362, 20062, 20162, {62,52,51,60}},
-    { 62, {-57.158, -15.000}, 20463, 20263, 20363, 20063, 20163, {63,53,52,61}},
-    { 63, {-57.158, -21.000}, 20464, 20264, 20364, 20064, 20164, {54,53,62}},
-    { 64, { -5.196,  -3.000}, 21401, 21201, 21301, 21001, 21101, {66,128,0,2,65}},
-    { 65, {-10.392,  -6.000}, 21402, 21202, 21302, 21002, 21102, {68,66,64,2,5,67}},
-    { 66, { -5.196,  -9.000}, 21403, 21203, 21303, 21003, 21103, {69,129,128,64,65,68}},
-    { 67, {-15.588,  -9.000}, 21404, 21204, 21304, 21004, 21104, {71,68,65,5,9,70}},
-    { 68, {-10.392, -12.000}, 21405, 21205, 21305, 21005, 21105, {72,69,66,65,67,71}},
-    { 69, { -5.196, -15.000}, 21406, 21206, 21306, 21006, 21106, {73,131,129,66,68,72}},
-    { 70, {-20.785, -12.000}, 21407, 21207, 21307, 21007, 21107, {75,71,67,9,14,74}},
-    { 71, {-15.588, -15.000}, 21408, 21208, 21308, 21008, 21108, {76,72,68,67,70,75}},
-    { 72, {-10.392, -18.000}, 21409, 21209, 21309, 21009, 21109, {77,73,69,68,71,76}},
-    { 73, { -5.196, -21.000}, 21410, 21210, 21310, 21010, 21110, {78,134,131,69,72,77}},
-    { 74, {-25.981, -15.000}, 21411, 21211, 21311, 21011, 21111, {80,75,70,14,20,79}},
-    { 75, {-20.785, -18.000}, 21412, 21212, 21312, 21012, 21112, {81,76,71,70,74,80}},
-    { 76, {-15.588, -21.000}, 21413, 21213, 21313, 21013, 21113, {82,77,72,71,75,81}},
-    { 77, {-10.392, -24.000}, 21414, 21214, 21314, 21014, 21114, {83,78,73,72,76,82}},
-    { 78, { -5.196, -27.000}, 21415, 21215, 21315, 21015, 21115, {84,138,134,73,77,83}},
-    { 79, {-31.177, -18.000}, 21416, 21216, 21316, 21016, 21116, {86,80,74,20,27,85}},
-    { 80, {-25.981, -21.000}, 21417, 21217, 21317, 21017, 21117, {87,81,75,74,79,86}},
-    { 81, {-20.785, -24.000}, 21418, 21218, 21318, 21018, 21118, {88,82,76,75,80,87}},
-    { 82, {-15.588, -27.000}, 21419, 21219, 21319, 21019, 21119, {89,83,77,76,81,88}},
-    { 83, {-10.392, -30.000}, 21420, 21220, 21320, 21020, 21120, {90,84,78,77,82,89}},
-    { 84, { -5.196, -33.000}, 21421, 21221, 21321, 21021, 21121, {91,143,138,78,83,90}},
-    { 85, {-36.373, -21.000}, 21422, 21222, 21322, 21022, 21122, {93,86,79,27,35,92}},
-    { 86, {-31.177, -24.000}, 21423, 21223, 21323, 21023, 21123, {94,87,80,79,85,93}},
-    { 87, {-25.981, -27.000}, 21424, 21224, 21324, 21024, 21124, {95,88,81,80,86,94}},
-    { 88, {-20.785, -30.000}, 21425, 21225, 21325, 21025, 21125, {96,89,82,81,87,95}},
-    { 89, {-15.588, -33.000}, 21426, 21226, 21326, 21026, 21126, {97,90,83,82,88,96}},
-    { 90, {-10.392, -36.000}, 21427, 21227, 21327, 21027, 21127, {98,91,84,83,89,97}},
-    { 91, { -5.196, -39.000}, 21428, 21228, 21328, 21028, 21128, {99,149,143,84,90,98}},
-    { 92, {-41.569, -24.000}, 21429, 21229, 21329, 21029, 21129, {101,93,85,35,44,100}},
-    { 93, {-36.373, -27.000}, 21430, 21230, 21330, 21030, 21130, {102,94,86,85,92,101}},
-    { 94, {-31.177, -30.000}, 21431, 21231, 21331, 21031, 21131, {103,95,87,86,93,102}},
-    { 95, {-25.981, -33.000}, 21432, 21232, 21332, 21032, 21132, {104,96,88,87,94,103}},
-    { 96, {-20.785, -36.000}, 21433, 21233, 21333, 21033, 21133, {105,97,89,88,95,104}},
-    { 97, {-15.588, -39.000}, 21434, 21234, 21334, 21034, 21134, {106,98,90,89,96,105}},
-    { 98, {-10.392, -42.000}, 21435, 21235, 21335, 21035, 21135, {107,99,91,90,97,106}},
-    { 99, { -5.196, -45.000}, 21436, 21236, 21336, 21036, 21136, {108,156,149,91,98,107}},
-    {100, {-46.765, -27.000}, 21437, 21237, 21337, 21037, 21137, {110,101,92,44,54,109}},
-    {101, {-41.569, -30.000}, 21438, 21238, 21338, 21038, 21138, {111,102,93,92,100,110}},
-    {102, {-36.373, -33.000}, 21439, 21239, 21339, 21039, 21139, {112,103,94,93,101,111}},
-    {103, {-31.177, -36.000}, 21440, 21240, 21340, 21040, 21140, {113,104,95,94,102,112}},
-    {104, {-25.981, -39.000}, 21441, 21241, 21341, 21041, 21141, {114,105,96,95,103,113}},
-    {105, {-20.785, -42.000}, 21442, 21242, 21342, 21042, 21142, {115,106,97,96,104,114}},
-    {106, {-15.588, -45.000}, 21443, 21243, 21343, 21043, 21143, {116,107,98,97,105,115}},
-    {107, {-10.392, -48.000}, 21444, 21244, 21344, 21044, 21144, {117,108,99,98,106,116}},
-    {108, { -5.196, -51.000}, 21445, 21245, 21345, 21045, 21145, {118,164,156,99,107,117}},
-    {109, {-51.962, -30.000}, 21446, 21246, 21346, 21046, 21146, {119,110,100,54}},
-    {110, {-46.765, -33.000}, 21447, 21247, 21347, 21047, 21147, {120,111,101,100,109,119}},
-    {111, {-41.569, -36.000}, 21448, 21248, 21348, 21048, 21148, {121,112,102,101,110,120}},
-    {112, {-36.373, -39.000}, 21449, 21249, 21349, 21049, 21149, {122,113,103,102,111,121}},
-    {113, {-31.177, -42.000}, 21450, 21250, 21350, 21050, 21150, {123,114,104,103,112,122}},
-    {114, {-25.981, -45.000}, 21451, 21251, 21351, 21051, 21151, {124,115,105,104,113,123}},
-    {115, {-20.785, -48.000}, 21452, 21252, 21352, 21052, 21152, {125,116,106,105,114,124}},
-    {116, {-15.588, -51.000}, 21453, 21253, 21353, 21053, 21153, {126,117,107,106,115,125}},
-    {117, {-10.392, -54.000}, 21454, 21254, 21354, 21054, 21154, {127,118,108,107,116,126}},
-    {118, { -5.196, -57.000}, 21455, 21255, 21355, 21055, 21155, {173,164,108,117,127}},
-    {119, {-51.962, -36.000}, 21456, 21256, 21356, 21056, 21156, {120,110,109}},
-    {120, {-46.765, -39.000}, 21457, 21257, 21357, 21057, 21157, {121,111,110,119}},
-    {121, {-41.569, -42.000}, 21458, 21258, 21358, 21058, 21158, {122,112,111,120}},
-    {122, {-36.373, -45.000}, 21459, 21259, 21359, 21059, 21159, {123,113,112,121}},
-    {123, {-31.177, -48.000}, 21460, 21260, 21360, 21060, 21160, {124,114,113,122}},
-    {124, {-25.981, -51.000}, 21461, 21261, 21361, 21061, 21161, {125,115,114,123}},
-    {125, {-20.785, -54.000}, 21462, 21262, 21362, 21062, 21162, {126,116,115,124}},
-    {126, {-15.588, -57.000}, 21463, 21263, 21363, 21063, 21163, {127,117,116,125}},
-    {127, {-10.392, -60.000}, 21464, 21264, 21364, 21064, 21164, {118,117,126}},
-    {128, {  0.000,  -6.000}, 22401, 22201, 22301, 22001, 22101, {129,130,192,64,66}},
-    {129, {  0.000, -12.000}, 22402, 22202, 22302, 22002, 22102, {131,132,130,128,66,69}},
-    {130, {  5.196,  -9.000}, 22403, 22203, 22303, 22003, 22103, {132,133,193,192,128,129}},
-    {131, {  0.000, -18.000}, 22404, 22204, 22304, 22004, 22104, {134,135,132,129,69,73}},
-    {132, {  5.196, -15.000}, 22405, 22205, 22305, 22005, 22105, {135,136,133,130,129,131}},
-    {133, { 10.392, -12.000}, 22406, 22206, 22306, 22006, 22106, {136,137,195,193,130,132}},
-    {134, {  0.000, -24.000}, 22407, 22207, 22307, 22007, 22107, {138,139,135,131,73,78}},
-    {135, {  5.196, -21.000}, 22408, 22208, 22308, 22008, 22108, {139,140,136,132,131,134}},
-    {136, { 10.392, -18.000}, 22409, 22209, 22309, 22009, 22109, {140,141,137,133,132,135}},
-    {137, { 15.588, -15.000}, 22410, 22210, 22310, 22010, 22110, {141,142,198,195,133,136}},
-    {138, {  0.000, -30.000}, 22411, 22211, 22311, 22011, 22111, {143,144,139,134,78,84}},
-    {139, {  5.196, -27.000}, 22412, 22212, 22312, 22012, 22112, {144,145,140,135,134,138}},
-    {140, { 10.392, -24.000}, 22413, 22213, 22313, 22013, 22113, {145,146,141,136,135,139}},
-    {141, { 15.588, -21.000}, 22414, 22214, 22314, 22014, 22114, {146,147,142,137,136,140}},
-    {142, { 20.785, -18.000}, 22415, 22215, 22315, 22015, 22115, {147,148,202,198,137,141}},
-    {143, {  0.000, -36.000}, 22416, 22216, 22316, 22016, 22116, {149,150,144,138,84,91}},
-    {144, {  5.196, -33.000}, 22417, 22217, 22317, 22017, 22117, {150,151,145,139,138,143}},
-    {145, { 10.392, -30.000}, 22418, 22218, 22318, 22018, 22118, {151,152,146,140,144,139}},
-    {146, { 15.588, -27.000}, 22419, 22219, 22319, 22019, 22119, {152,153,147,141,145,140}},
-    {147, { 20.785, -24.000}, 22420, 22220, 22320, 22020, 22120, {153,154,148,142,146,141}},
-    {148, { 25.981, -21.000}, 22421, 22221, 22321, 22021, 22121, {154,155,207,202,142,147}},
-    {149, {  0.000, -42.000}, 22422, 22222, 22322, 22022, 22122, {156,157,150,143,91,99}},
-    {150, {  5.196, -39.000}, 22423, 22223, 22323, 22023, 22123, {157,158,151,144,143,149}},
-    {151, { 10.392, -36.000}, 22424, 22224, 22324, 22024, 22124, {158,159,152,145,144,150}},
-    {152, { 15.588, -33.000}, 22425, 22225, 22325, 22025, 22125, {159,160,153,146,145,151}},
-    {153, { 20.785, -30.000}, 22426, 22226, 22326, 22026, 22126, {160,161,154,147,146,152}},
-    {154, { 25.981, -27.000}, 22427, 22227, 22327, 22027, 22127, {161,162,155,148,147,153}},
-    {155, { 31.177, -24.000}, 22428, 22228, 22328, 22028, 22128, {162,163,213,207,148,154}},
-    {156, {  0.000, -48.000}, 22429, 22229, 22329, 22029, 22129, {164,165,157,149,99,108}},
-    {157, {  5.196, -45.000}, 22430, 22230, 22330, 22030, 22130, {165,166,158,150,149,156}},
-    {158, { 10.392, -42.000}, 22431, 22231, 22331, 22031, 22131, {166,167,159,151,150,157}},
-    {159, { 15.588, -39.000}, 22432, 22232, 22332, 22032, 22132, {167,168,160,152,151,158}},
-    {160, { 20.785, -36.000}, 22433, 22233, 22333, 22033, 22133, {168,169,161,153,152,159}},
-    {161, { 25.981, -33.000}, 22434, 22234, 22334, 22034, 22134, {169,170,171,154,153,160}},
-    {162, { 31.177, -30.000}, 22435, 22235, 22335, 22035, 22135, {170,171,172,155,154,161}},
-    {163, { 36.373, -27.000}, 22436, 22236, 22336, 22036, 22136, {171,172,220,213,155,162}},
-    {164, {  0.000, -54.000}, 22437, 22237, 22337, 22037, 22137, {173,174,165,156,108,118}},
-    {165, {  5.196, -51.000}, 22438, 22238, 22338, 22038, 22138, {174,175,166,157,156,164}},
-    {166, { 10.392, -48.000}, 22439, 22239, 22339, 22039, 22139, {175,176,167,158,157,165}},
-    {167, { 15.588, -45.000}, 22440, 22240, 22340, 22040, 22140, {176,177,168,159,158,166}},
-    {168, { 20.785, -42.000}, 22441, 22241, 22341, 22041, 22141, {177,178,169,160,159,167}},
-    {169, { 25.981, -39.000}, 22442, 22242, 22342, 22042, 22142, {178,179,170,161,160,168}},
-    {170, { 31.177, -36.000}, 22443, 22243, 22343, 22043, 22143, {179,180,171,162,161,169}},
-    {171, { 36.373, -33.000}, 22444, 22244, 22344, 22044, 22144, {180,181,172,163,162,170}},
-    {172, { 41.569, -30.000}, 22445, 22245, 22345, 22045, 22145, {181,182,228,220,163,171}},
-    {173, {  0.000, -60.000}, 22446, 22246, 22346, 22046, 22146, {174,164,118}},
-    {174, {  5.196, -57.000}, 22447, 22247, 22347, 22047, 22147, {183,175,165,164,173}},
-    {175, { 10.392, -54.000}, 22448, 22248, 22348, 22048, 22148, {183,184,176,166,165,174}},
-    {176, { 15.588, -51.000}, 22449, 22249, 22349, 22049, 22149, {184,185,177,167,166,175}},
-    {177, { 20.785, -48.000}, 22450, 22250, 22350, 22050, 22150, {185,186,178,168,167,176}},
-    {178, { 25.981, -45.000}, 22451, 22251, 22351, 22051, 22151, {186,187,179,169,168,177}},
-    {179, { 31.177, -42.000}, 22452, 22252, 22352, 22052, 22152, {187,188,180,170,169,178}},
-    {180, { 36.373, -39.000}, 22453, 22253, 22353, 22053, 22153, {188,189,181,171,170,179}},
-    {181, { 41.569, -36.000}, 22454, 22254, 22354, 22054, 22154, {189,190,182,172,171,180}},
-    {182, { 46.765, -33.000}, 22455, 22255, 22355, 22055, 22155, {190,191,237,228,172,181}},
-    {183, { 10.392, -60.000}, 22456, 22256, 22356, 22056, 22156, {184,175,174}},
-    {184, { 15.588, -57.000}, 22457, 22257, 22357, 22057, 22157, {185,176,175,183}},
-    {185, { 20.785, -54.000}, 22458, 22258, 22358, 22058, 22158, {186,177,176,184}},
-    {186, { 25.981, -51.000}, 22459, 22259, 22359, 22059, 22159, {187,178,177,185}},
-    {187, { 31.177, -48.000}, 22460, 22260, 22360, 22060, 22160, {188,179,178,186}},
-    {188, { 36.373, -45.000}, 22461, 22261, 22361, 22061, 22161, {189,180,179,187}},
-    {189, { 41.569, -42.000}, 22462, 22262, 22362, 22062, 22162, {190,181,180,188}},
-    {190, { 46.765, -39.000}, 22463, 22263, 22363, 22063, 22163, {191,182,181,189}},
-    {191, { 51.962, -36.000}, 22464, 22264, 22364, 22064, 22164, {237,182,190}},
-    {192, {  5.196,  -3.000}, 23401, 23201, 23301, 23001, 23101, {128,130,193,194,256}},
-    {193, { 10.392,  -6.000}, 23402, 23202, 23302, 23002, 23102, {133,195,196,194,192,130}},
-    {194, { 10.392,   0.000}, 23403, 23203, 23303, 23003, 23103, {193,196,197,257,256,192}},
-    {195, { 15.588,  -9.000}, 23404, 23204, 23304, 23004, 23104, {137,198,199,196,193,133}},
-    {196, { 15.588,  -3.000}, 23405, 23205, 23305, 23005, 23105, {195,199,200,197,194,193}},
-    {197, { 15.588,   3.000}, 23406, 23206, 23306, 23006, 23106, {196,200,201,259,257,194}},
-    {198, { 20.785, -12.000}, 23407, 23207, 23307, 23007, 23107, {142,202,203,199,195,137}},
-    {199, { 20.785,  -6.000}, 23408, 23208, 23308, 23008, 23108, {198,203,204,200,196,195}},
-    {200, { 20.785,   0.000}, 23409, 23209, 23309, 23009, 23109, {199,204,205,201,197,196}},
-    {201, { 20.785,   6.000}, 23410, 23210, 23310, 23010, 23110, {200,205,206,262,259,197}},
-    {202, { 25.981, -15.000}, 23411, 23211, 23311, 23011, 23111, {148,207,208,203,198,142}},
-    {203, { 25.981,  -9.000}, 23412, 23212, 23312, 23012, 23112, {202,208,209,204,199,198}},
-    {204, { 25.981,  -3.000}, 23413, 23213, 23313, 23013, 23113, {203,209,210,205,200,199}},
-    {205, { 25.981,   3.000}, 23414, 23214, 23314, 23014, 23114, {204,210,211,206,201,200}},
-    {206, { 25.981,   9.000}, 23415, 23215, 23315, 23015, 23115, {205,211,212,266,262,201}},
-    {207, { 31.177, -18.000}, 23416, 23216, 23316, 23016, 23116, {155,213,214,208,202,148}},
-    {208, { 31.177, -12.000}, 23417, 23217, 23317, 23017, 23117, {207,214,215,209,203,202}},
-    {209, { 31.177,  -6.000}, 23418, 23218, 23318, 23018, 23118, {208,215,216,210,204,203}},
-    {210, { 31.177,   0.000}, 23419, 23219, 23319, 23019, 23119, {209,216,217,211,205,204}},
-    {211, { 31.177,   6.000}, 23420, 23220, 23320, 23020, 23120, {210,217,218,212,206,205}},
-    {212, { 31.177,  12.000}, 23421, 23221, 23321, 23021, 23121, {211,218,219,271,266,206}},
-    {213, { 36.373, -21.000}, 23422, 23222, 23322, 23022, 23122, {163,220,221,214,207,155}},
-    {214, { 36.373, -15.000}, 23423, 23223, 23323, 23023, 23123, {213,221,222,215,208,207}},
-    {215, { 36.373,  -9.000}, 23424, 23224, 23324, 23024, 23124, {214,222,223,216,209,208}},
-    {216, { 36.373,  -3.000}, 23425, 23225, 23325, 23025, 23125, {215,223,224,217,210,209}},
-    {217, { 36.373,   3.000}, 23426, 23226, 23326, 23026, 23126, {216,224,225,218,211,210}},
-    {218, { 36.373,   9.000}, 23427, 23227, 23327, 23027, 23127, {217,225,226,219,212,211}},
-    {219, { 36.373,  15.000}, 23428, 23228, 23328, 23028, 23128, {218,226,227,277,271,212}},
-    {220, { 41.569, -24.000}, 23429, 23229, 23329, 23029, 23129, {172,228,229,221,213,163}},
-    {221, { 41.569, -18.000}, 23430, 23230, 23330, 23030, 23130, {220,229,230,222,214,213}},
-    {222, { 41.569, -12.000}, 23431, 23231, 23331, 23031, 23131, {221,230,231,223,215,214}},
-    {223, { 41.569,  -6.000}, 23432, 23232, 23332, 23032, 23132, {222,231,232,224,216,215}},
-    {224, { 41.569,   0.000}, 23433, 23233, 23333, 23033, 23133, {223,232,233,225,217,216}},
-    {225, { 41.569,   6.000}, 23434, 23234, 23334, 23034, 23134, {224,233,234,226,218,217}},
-    {226, { 41.569,  12.000}, 23435, 23235, 23335, 23035, 23135, {225,234,235,227,219,218}},
-    {227, { 41.569,  18.000}, 23436, 23236, 23336, 23036, 23136, {226,235,236,284,277,219}},
-    {228, { 46.765, -27.000}, 23437, 23237, 23337, 23037, 23137, {182,237,238,229,220,172}},
-    {229, { 46.765, -21.000}, 23438, 23238, 23338, 23038, 23138, {228,238,239,230,221,220}},
-    {230, { 46.765, -15.000}, 23439, 23239, 23339, 23039, 23139, {229,239,240,231,222,221}},
-    {231, { 46.765,  -9.000}, 23440, 23240, 23340, 23040, 23140, {230,240,241,232,223,222}},
-    {232, { 46.765,  -3.000}, 23441, 23241, 23341, 23041, 23141, {231,241,242,233,224,223}},
-    {233, { 46.765,   3.000}, 23442, 23242, 23342, 23042, 23142, {232,242,243,234,225,224}},
-    {234, { 46.765,   9.000}, 23443, 23243, 23343, 23043, 23143, {233,243,244,235,226,225}},
-    {235, { 46.765,  15.000}, 23444, 23244, 23344, 23044, 23144, {234,244,245,236,227,226}},
-    {236, { 46.765,  21.000}, 23445, 23245, 23345, 23045, 23145, {235,245,246,292,284,227}},
-    {237, { 51.962, -30.000}, 23446, 23246, 23346, 23046, 23146, {247,238,228,182,191}},
-    {238, { 51.962, -24.000}, 23447, 23247, 23347, 23047, 23147, {237,247,248,239,229,228}},
-    {239, { 51.962, -18.000}, 23448, 23248, 23348, 23048, 23148, {238,248,249,240,230,229}},
-    {240, { 51.962, -12.000}, 23449, 23249, 23349, 23049, 23149, {239,249,250,241,231,230}},
-    {241, { 51.962,  -6.000}, 23450, 23250, 23350, 23050, 23150, {240,250,251,242,232,231}},
-    {242, { 51.962,   0.000}, 23451, 23251, 23351, 23051, 23151, {241,251,252,243,233,232}},
-    {243, { 51.962,   6.000}, 23452, 23252, 23352, 23052, 23152, {242,252,253,244,234,233}},
-    {244, { 51.962,  12.000}, 23453, 23253, 23353, 23053, 23153, {243,253,254,245,235,234}},
-    {245, { 51.962,  18.000}, 23454, 23254, 23354, 23054, 23154, {244,254,255,246,236,235}},
-    {246, { 51.962,  24.000}, 23455, 23255, 23355, 23055, 23155, {245,255,301,292,236}},
-    {247, { 57.158, -27.000}, 23456, 23256, 23356, 23056, 23156, {237,238,248}},
-    {248, { 57.158, -21.000}, 23457, 23257, 23357, 23057, 23157, {247,249,239,238}},
-    {249, { 57.158, -15.000}, 23458, 23258, 23358, 23058, 23158, {248,250,240,239}},
-    {250, { 57.158,  -9.000}, 23459, 23259, 23359, 23059, 23159, {249,251,241,240}},
-    {251, { 57.158,  -3.000}, 23460, 23260, 23360, 23060, 23160, {250,252,242,241}},
-    {252, { 57.158,   3.000}, 23461, 23261, 23361, 23061, 23161, {251,253,243,242}},
-    {253, { 57.158,   9.000}, 23462, 23262, 23362, 23062, 23162, {252,254,244,243}},
-    {254, { 57.158,  15.000}, 23463, 23263, 23363, 23063, 23163, {253,255,245,244}},
-    {255, { 57.158,  21.000}, 23464, 23264, 23364, 23064, 23164, {254,246,245}},
-    {256, {  5.196,   3.000}, 24401, 24201, 24301, 24001, 24101, {192,194,257,258,320}},
-    {257, { 10.392,   6.000}, 24402, 24202, 24302, 24002, 24102, {194,197,259,260,258,256}},
-    {258, {  5.196,   9.000}, 24403, 24203, 24303, 24003, 24103, {256,257,260,261,321,320}},
-    {259, { 15.588,   9.000}, 24404, 24204, 24304, 24004, 24104, {197,201,262,263,260,257}},
-    {260, { 10.392,  12.000}, 24405, 24205, 24305, 24005, 24105, {257,259,263,264,261,258}},
-    {261, {  5.196,  15.000}, 24406, 24206, 24306, 24006, 24106, {258,260,264,265,323,321}},
-    {262, { 20.785,  12.000}, 24407, 24207, 24307, 24007, 24107, {201,206,266,267,263,259}},
-    {263, { 15.588,  15.000}, 24408, 24208, 24308, 24008, 24108, {259,262,267,268,264,260}},
-    {264, { 10.392,  18.000}, 24409, 24209, 24309, 24009, 24109, {260,263,268,269,265,261}},
-    {265, {  5.196,  21.000}, 24410, 24210, 24310, 24010, 24110, {261,264,269,270,326,323}},
-    {266, { 25.981,  15.000}, 24411, 24211, 24311, 24011, 24111, {206,212,271,272,267,262}},
-    {267, { 20.785,  18.000}, 24412, 24212, 24312, 24012, 24112, {262,266,272,273,268,263}},
-    {268, { 15.588,  21.000}, 24413, 24213, 24313, 24013, 24113, {263,267,273,274,269,264}},
-    {269, { 10.392,  24.000}, 24414, 24214, 24314, 24014, 24114, {264,268,274,275,270,265}},
-    {270, {  5.196,  27.000}, 24415, 24215, 24315, 24015, 24115, {265,269,275,276,330,326}},
-    {271, { 31.177,  18.000}, 24416, 24216, 24316, 24016, 24116, {212,219,277,278,272,266}},
-    {272, { 25.981,  21.000}, 24417, 24217, 24317, 24017, 24117, {266,271,278,279,273,267}},
-    {273, { 20.785,  24.000}, 24418, 24218, 24318, 24018, 24118, {267,272,279,280,274,268}},
-    {274, { 15.588,  27.000}, 24419, 24219, 24319, 24019, 24119, {268,273,280,281,275,269}},
-    {275, { 10.392,  30.000}, 24420, 24220, 24320, 24020, 24120, {269,274,281,282,276,270}},
-    {276, {  5.196,  33.000}, 24421, 24221, 24321, 24021, 24121, {270,275,282,283,335,330}},
-    {277, { 36.373,  21.000}, 24422, 24222, 24322, 24022, 24122, {219,227,284,285,278,271}},
-    {278, { 31.177,  24.000}, 24423, 24223, 24323, 24023, 24123, {271,277,285,286,279,272}},
-    {279, { 25.981,  27.000}, 24424, 24224, 24324, 24024, 24124, {272,278,286,287,280,273}},
-    {280, { 20.785,  30.000}, 24425, 24225, 24325, 24025, 24125, {273,279,287,288,281,274}},
-    {281, { 15.588,  33.000}, 24426, 24226, 24326, 24026, 24126, {274,280,288,289,282,275}},
-    {282, { 10.392,  36.000}, 24427, 24227, 24327, 24027, 24127, {275,281,289,290,283,276}},
-    {283, {  5.196,  39.000}, 24428, 24228, 24328, 24028, 24128, {276,282,290,291,341,335}},
-    {284, { 41.569,  24.000}, 24429, 24229, 24329, 24029, 24129, {227,236,292,293,285,277}},
-    {285, { 36.373,  27.000}, 24430, 24230, 24330, 24030, 24130, {277,284,293,294,286,278}},
-    {286, { 31.177,  30.000}, 24431, 24231, 24331, 24031, 24131, {278,285,294,295,287,279}},
-    {287, { 25.981,  33.000}, 24432, 24232, 24332, 24032, 24132, {279,286,295,296,288,280}},
-    {288, { 20.785,  36.000}, 24433, 24233, 24333, 24033, 24133, {280,287,296,297,289,281}},
-    {289, { 15.588,  39.000}, 24434, 24234, 24334, 24034, 24134, {281,288,297,298,290,282}},
-    {290, { 10.392,  42.000}, 24435, 24235, 24335, 24035, 24135, {282,289,298,299,291,283}},
-    {291, {  5.196,  45.000}, 24436, 24236, 24336, 24036, 24136, {283,290,299,300,348,341}},
-    {292, { 46.765,  27.000}, 24437, 24237, 24337, 24037, 24137, {236,246,301,302,293,284}},
-    {293, { 41.569,  30.000}, 24438, 24238, 24338, 24038, 24138, {284,292,302,303,294,285}},
-    {294, { 36.373,  33.000}, 24439, 24239, 24339, 24039, 24139, {285,293,303,304,295,286}},
-    {295, { 31.177,  36.000}, 24440, 24240, 24340, 24040, 24140, {286,294,304,305,296,287}},
-    {296, { 25.981,  39.000}, 24441, 24241, 24341, 24041, 24141, {287,295,305,306,297,288}},
-    {297, { 20.785,  42.000}, 24442, 24242, 24342, 24042, 24142, {288,296,306,307,298,289}},
-    {298, { 15.588,  45.000}, 24443, 24243, 24343, 24043, 24143, {289,297,307,308,299,290}},
-    {299, { 10.392,  48.000}, 24444, 24244, 24344, 24044, 24144, {290,298,308,309,300,291}},
-    {300, {  5.196,  51.000}, 24445, 24245, 24345, 24045, 24145, {291,299,309,310,356,348}},
-    {301, { 51.962,  30.000}, 24446, 24246, 24346, 24046, 24146, {246,311,302,292}},
-    {302, { 46.765,  33.000}, 24447, 24247, 24347, 24047, 24147, {292,301,311,312,303,293}},
-    {303, { 41.569,  36.000}, 24448, 24248, 24348, 24048, 24148, {293,302,312,313,304,294}},
-    {304, { 36.373,  39.000}, 24449, 24249, 24349, 24049, 24149, {294,303,313,314,305,295}},
-    {305, { 31.177,  42.000}, 24450, 24250, 24350, 24050, 24150, {295,304,314,315,306,296}},
-    {306, { 25.981,  45.000}, 24451, 24251, 24351, 24051, 24151, {296,305,315,316,307,297}},
-    {307, { 20.785,  48.000}, 24452, 24252, 24352, 24052, 24152, {297,306,316,317,308,298}},
-    {308, { 15.588,  51.000}, 24453, 24253, 24353, 24053, 24153, {298,307,317,318,309,299}},
-    {309, { 10.392,  54.000}, 24454, 24254, 24354, 24054, 24154, {299,308,318,319,310,300}},
-    {310, {  5.196,  57.000}, 24455, 24255, 24355, 24055, 24155, {300,309,319,365,356}},
-    {311, { 51.962,  36.000}, 24456, 24256, 24356, 24056, 24156, {301,312,302}},
-    {312, { 46.765,  39.000}, 24457, 24257, 24357, 24057, 24157, {311,302,303,313}},
-    {313, { 41.569,  42.000}, 24458, 24258, 24358, 24058, 24158, {312,303,304,314}},
-    {314, { 36.373,  45.000}, 24459, 24259, 24359, 24059, 24159, {313,304,305,315}},
-    {315, { 31.177,  48.000}, 24460, 24260, 24360, 24060, 24160, {314,305,306,316}},
-    {316, { 25.981,  51.000}, 24461, 24261, 24361, 24061, 24161, {315,306,307,317}},
-    {317, { 20.785,  54.000}, 24462, 24262, 24362, 24062, 24162, {316,307,308,318}},
-    {318, { 15.588,  57.000}, 24463, 24263, 24363, 24063, 24163, {317,308,309,319}},
-    {319, { 10.392,  60.000}, 24464, 24264, 24364, 24064, 24164, {318,309,310}},
-    {320, {  0.000,   6.000}, 25401, 25201, 25301, 25001, 25101, {256,258,321,322,0}},
-    {321, {  0.000,  12.000}, 25402, 25202, 25302, 25002, 25102, {320,258,261,323,324,322}},
-    {322, { -5.196,   9.000}, 25403, 25203, 25303, 25003, 25103, {0,320,321,324,325,1}},
-    {323, {  0.000,  18.000}, 25404, 25204, 25304, 25004, 25104, {321,261,265,326,327,324}},
-    {324, { -5.196,  15.000}, 25405, 25205, 25305, 25005, 25105, {322,321,323,327,328,325}},
-    {325, {-10.392,  12.000}, 25406, 25206, 25306, 25006, 25106, {1,322,324,328,329,3}},
-    {326, {  0.000,  24.000}, 25407, 25207, 25307, 25007, 25107, {323,265,270,330,331,327}},
-    {327, { -5.196,  21.000}, 25408, 25208, 25308, 25008, 25108, {324,323,326,331,332,328}},
-    {328, {-10.392,  18.000}, 25409, 25209, 25309, 25009, 25109, {325,324,327,332,333,329}},
-    {329, {-15.588,  15.000}, 25410, 25210, 25310, 25010, 25110, {3,325,328,333,334,6}},
-    {330, {  0.000,  30.000}, 25411, 25211, 25311, 25011, 25111, {326,270,276,335,336,331}},
-    {331, { -5.196,  27.000}, 25412, 25212, 25312, 25012, 25112, {327,326,330,336,337,332}},
-    {332, {-10.392,  24.000}, 25413, 25213, 25313, 25013, 25113, {328,327,331,337,338,333}},
-    {333, {-15.588,  21.000}, 25414, 25214, 25314, 25014, 25114, {329,328,332,338,339,334}},
-    {334, {-20.785,  18.000}, 25415, 25215, 25315, 25015, 25115, {6,329,333,339,340,10}},
-    {335, {  0.000,  36.000}, 25416, 25216, 25316, 25016, 25116, {330,276,283,341,342,336}},
-    {336, { -5.196,  33.000}, 25417, 25217, 25317, 25017, 25117, {331,330,335,342,343,337}},
-    {337, {-10.392,  30.000}, 25418, 25218, 25318, 25018, 25118, {332,331,336,343,344,338}},
-    {338, {-15.588,  27.000}, 25419, 25219, 25319, 25019, 25119, {333,332,337,344,345,339}},
-    {339, {-20.785,  24.000}, 25420, 25220, 25320, 25020, 25120, {334,333,338,345,346,340}},
-    {340, {-25.981,  21.000}, 25421, 25221, 25321, 25021, 25121, {10,334,339,346,347,15}},
-    {341, {  0.000,  42.000}, 25422, 25222, 25322, 25022, 25122, {335,283,291,348,349,342}},
-    {342, { -5.196,  39.000}, 25423, 25223, 25323, 25023, 25123, {336,335,341,349,350,343}},
-    {343, {-10.392,  36.000}, 25424, 25224, 25324, 25024, 25124, {337,336,342,350,351,344}},
-    {344, {-15.588,  33.000}, 25425, 25225, 25325, 25025, 25125, {338,337,343,351,352,345}},
-    {345, {-20.785,  30.000}, 25426, 25226, 25326, 25026, 25126, {339,338,344,352,353,346}},
-    {346, {-25.981,  27.000}, 25427, 25227, 25327, 25027, 25127, {340,339,345,353,354,347}},
-    {347, {-31.177,  24.000}, 25428, 25228, 25328, 25028, 25128, {15,340,346,354,355,21}},
-    {348, {  0.000,  48.000}, 25429, 25229, 25329, 25029, 25129, {341,291,300,356,357,349}},
-    {349, { -5.196,  45.000}, 25430, 25230, 25330, 25030, 25130, {342,341,348,357,358,350}},
-    {350, {-10.392,  42.000}, 25431, 25231, 25331, 25031, 25131, {343,342,349,358,359,351}},
-    {351, {-15.588,  39.000}, 25432, 25232, 25332, 25032, 25132, {344,343,350,359,360,352}},
-    {352, {-20.785,  36.000}, 25433, 25233, 25333, 25033, 25133, {345,344,351,360,361,353}},
-    {353, {-25.981,  33.000}, 25434, 25234, 25334, 25034, 25134, {346,345,352,361,362,354}},
-    {354, {-31.177,  30.000}, 25435, 25235, 25335, 25035, 25135, {347,346,353,362,363,355}},
-    {355, {-36.373,  27.000}, 25436, 25236, 25336, 25036, 25136, {21,347,354,363,364,28}},
-    {356, {  0.000,  54.000}, 25437, 25237, 25337, 25037, 25137, {348,300,310,365,366,357}},
-    {357, { -5.196,  51.000}, 25438, 25238, 25338, 25038, 25138, {349,348,356,366,367,358}},
-    {358, {-10.392,  48.000}, 25439, 25239, 25339, 25039, 25139, {350,349,357,367,368,359}},
-    {359, {-15.588,  45.000}, 25440, 25240, 25340, 25040, 25140, {351,350,358,368,369,360}},
-    {360, {-20.785,  42.000}, 25441, 25241, 25341, 25041, 25141, {352,351,359,369,370,361}},
-    {361, {-25.981,  39.000}, 25442, 25242, 25342, 25042, 25142, {353,352,360,370,371,362}},
-    {362, {-31.177,  36.000}, 25443, 25243, 25343, 25043, 25143, {354,353,361,371,372,363}},
-    {363, {-36.373,  33.000}, 25444, 25244, 25344, 25044, 25144, {355,354,362,372,373,364}},
-    {364, {-41.569,  30.000}, 25445, 25245, 25345, 25045, 25145, {28,355,363,373,374,36}},
-    {365, {  0.000,  60.000}, 25446, 25246, 25346, 25046, 25146, {310,356,366}},
-    {366, { -5.196,  57.000}, 25447, 25247, 25347, 25047, 25147, {365,356,357,367,375}},
-    {367, {-10.392,  54.000}, 25448, 25248, 25348, 25048, 25148, {358,357,366,375,376,368}},
-    {368, {-15.588,  51.000}, 25449, 25249, 25349, 25049, 25149, {359,358,367,376,377,369}},
-    {369, {-20.785,  48.000}, 25450, 25250, 25350, 25050, 25150, {360,359,368,377,378,370}},
-    {370, {-25.981,  45.000}, 25451, 25251, 25351, 25051, 25151, {361,360,369,378,379,371}},
-    {371, {-31.177,  42.000}, 25452, 25252, 25352, 25052, 25152, {362,361,370,379,380,372}},
-    {372, {-36.373,  39.000}, 25453, 25253, 25353, 25053, 25153, {363,362,371,380,381,373}},
-    {373, {-41.569,  36.000}, 25454, 25254, 25354, 25054, 25154, {364,363,372,381,382,374}},
-    {374, {-46.765,  33.000}, 25455, 25255, 25355, 25055, 25155, {36,364,373,382,383,45}},
-    {375, {-10.392,  60.000}, 25456, 25256, 25356, 25056, 25156, {366,367,376}},
-    {376, {-15.588,  57.000}, 25457, 25257, 25357, 25057, 25157, {375,367,368,377}},
-    {377, {-20.785,  54.000}, 25458, 25258, 25358, 25058, 25158, {376,368,369,378}},
-    {378, {-25.981,  51.000}, 25459, 25259, 25359, 25059, 25159, {377,369,370,379}},
-    {379, {-31.177,  48.000}, 25460, 25260, 25360, 25060, 25160, {378,370,371,380}},
-    {380, {-36.373,  45.000}, 25461, 25261, 25361, 25061, 25161, {379,371,372,381}},
-    {381, {-41.569,  42.000}, 25462, 25262, 25362, 25062, 25162, {380,372,373,382}},
-    {382, {-46.765,  39.000}, 25463, 25263, 25363, 25063, 25163, {381,373,374,383}},
-    {383, {-51.962,  36.000}, 25464, 25264, 25364, 25064, 25164, {382,374,45}},
+constexpr ant::expconfig::detector::TAPS::BaF2_row_t
+ant::expconfig::detector::TAPS_2007::BaF2_table[] = {
+  // element, {xy}, TAC, LG, SG, LGS, SGS, neighbours begin/end in BaF2_neighbours
+    {  0, { -5.196,   3.000}, 20401, 20201, 20301, 20001, 20101,    0,    5},
+    {  1, {-10.392,   6.000}, 20402, 20202, 20302, 20002, 20102,    5,   11},
+    {  2, {-10.392,   0.000}, 20403, 20203, 20303, 20003, 20103,   11,   17},
+    {  3, {-15.588,   9.000}, 20404, 20204, 20304, 20004, 20104,   17,   23},
+    {  4, {-15.588,   3.000}, 20405, 20205, 20305, 20005, 20105,   23,   29},
+    {  5, {-15.588,  -3.000}, 20406, 20206, 20306, 20006, 20106,   29,   35},
+    {  6, {-20.785,  12.000}, 20407, 20207, 20307, 20007, 20107,   35,   41},
+    {  7, {-20.785,   6.000}, 20408, 20208, 20308, 20008, 20108,   41,   47},
+    {  8, {-20.785,   0.000}, 20409, 20209, 20309, 20009, 20109,   47,   53},
+    {  9, {-20.785,  -6.000}, 20410, 20210, 20310, 20010, 20110,   53,   59},
+    { 10, {-25.981,  15.000}, 20411, 20211, 20311, 20011, 20111,   59,   65},
+    { 11, {-25.981,   9.000}, 20412, 20212, 20312, 20012, 20112,   65,   71},
+    { 12, {-25.981,   3.000}, 20413, 20213, 20313, 20013, 20113,   71,   77},
+    { 13, {-25.981,  -3.000}, 20414, 20214, 20314, 20014, 20114,   77,   83},
+    { 14, {-25.981,  -9.000}, 20415, 20215, 20315, 20015, 20115,   83,   89},
+    { 15, {-31.177,  18.000}, 20416, 20216, 20316, 20016, 20116,   89,   95},
+    { 16, {-31.177,  12.000}, 20417, 20217, 20317, 20017, 20117,   95,  101},
+    { 17, {-31.177,   6.000}, 20418, 20218, 20318, 20018, 20118,  101,  107},
+    { 18, {-31.177,   0.000}, 20419, 20219, 20319, 20019, 20119,  107,  113},
+    { 19, {-31.177,  -6.000}, 20420, 20220, 20320, 20020, 20120,  113,  119},
+    { 20, {-31.177, -12.000}, 20421, 20221, 20321, 20021, 20121,  119,  125},
+    { 21, {-36.373,  21.000}, 20422, 20222, 20322, 20022, 20122,  125,  131},
+    { 22, {-36.373,  15.000}, 20423, 20223, 20323, 20023, 20123,  131,  137},
+    { 23, {-36.373,   9.000}, 20424, 20224, 20324, 20024, 20124,  137,  143},
+    { 24, {-36.373,   3.000}, 20425, 20225, 20325, 20025, 20125,  143,  149},
+    { 25, {-36.373,  -3.000}, 20426, 20226, 20326, 20026, 20126,  149,  155},
+    { 26, {-36.373,  -9.000}, 20427, 20227, 20327, 20027, 20127,  155,  161},
+    { 27, {-36.373, -15.000}, 20428, 20228, 20328, 20028, 20128,  161,  167},
+    { 28, {-41.569,  24.000}, 20429, 20229, 20329, 20029, 20129,  167,  173},
+    { 29, {-41.569,  18.000}, 20430, 20230, 20330, 20030, 20130,  173,  179},
+    { 30, {-41.569,  12.000}, 20431, 20231, 20331, 20031, 20131,  179,  185},
+    { 31, {-41.569,   6.000}, 20432, 20232, 20332, 20032, 20132,  185,  191},
+    { 32, {-41.569,   0.000}, 20433, 20233, 20333, 20033, 20133,  191,  197},
+    { 33, {-41.569,  -6.000}, 20434, 20234, 20334, 20034, 20134,  197,  203},
+    { 34, {-41.569, -12.000}, 20435, 20235, 20335, 20035, 20135,  203,  209},
+    { 35, {-41.569, -18.000}, 20436, 20236, 20336, 20036, 20136,  209,  215},
+    { 36, {-46.765,  27.000}, 20437, 20237, 20337, 20037, 20137,  215,  221},
+    { 37, {-46.765,  21.000}, 20438, 20238, 20338, 20038, 20138,  221,  227},
+    { 38, {-46.765,  15.000}, 20439, 20239, 20339, 20039, 20139,  227,  233},
+    { 39, {-46.765,   9.000}, 20440, 20240, 20340, 20040, 20140,  233,  239},
+    { 40, {-46.765,   3.000}, 20441, 20241, 20341, 20041, 20141,  239,  245},
+    { 41, {-46.765,  -3.000}, 20442, 20242, 20342, 20042, 20142,  245,  251},
+    { 42, {-46.765,  -9.000}, 20443, 20243, 20343, 20043, 20143,  251,  257},
+    { 43, {-46.765, -15.000}, 20444, 20244, 20344, 20044, 20144,  257,  263},
+    { 44, {-46.765, -21.000}, 20445, 20245, 20345, 20045, 20145,  263,  269},
+    { 45, {-51.962,  30.000}, 20446, 20246, 20346, 20046, 20146,  269,  274},
+    { 46, {-51.962,  24.000}, 20447, 20247, 20347, 20047, 20147,  274,  280},
+    { 47, {-51.962,  18.000}, 20448, 20248, 20348, 20048, 20148,  280,  286},
+    { 48, {-51.962,  12.000}, 20449, 20249, 20349, 20049, 20149,  286,  292},
+    { 49, {-51.962,   6.000}, 20450, 20250, 20350, 20050, 20150,  292,  298},
+    { 50, {-51.962,   0.000}, 20451, 20251, 20351, 20051, 20151,  298,  304},
+    { 51, {-51.962,  -6.000}, 20452, 20252, 20352, 20052, 20152,  304,  310},
+    { 52, {-51.962, -12.000}, 20453, 20253, 20353, 20053, 20153,  310,  316},
+    { 53, {-51.962, -18.000}, 20454, 20254, 20354, 20054, 20154,  316,  322},
+    { 54, {-51.962, -24.000}, 20455, 20255, 20355, 20055, 20155,  322,  327},
+    { 55, {-57.158,  27.000}, 20456, 20256, 20356, 20056, 20156,  327,  330},
+    { 56, {-57.158,  21.000}, 20457, 20257, 20357, 20057, 20157,  330,  334},
+    { 57, {-57.158,  15.000}, 20458, 20258, 20358, 20058, 20158,  334,  338},
+    { 58, {-57.158,   9.000}, 20459, 20259, 20359, 20059, 20159,  338,  342},
+    { 59, {-57.158,   3.000}, 20460, 20260, 20360, 20060, 20160,  342,  346},
+    { 60, {-57.158,  -3.000}, 20461, 20261, 20361, 20061, 20161,  346,  350},
+    { 61, {-57.158,  -9.000}, 20462, 20262, 20362, 20062, 20162,  350,  354},
+    { 62, {-57.158, -15.000}, 20463, 20263, 20363, 20063, 20163,  354,  358},
+    { 63, {-57.158, -21.000}, 20464, 20264, 20364, 20064, 20164,  358,  361},
+    { 64, { -5.196,  -3.000}, 21401, 21201, 21301, 21001, 21101,  361,  366},
+    { 65, {-10.392,  -6.000}, 21402, 21202, 21302, 21002, 21102,  366,  372},
+    { 66, { -5.196,  -9.000}, 21403, 21203, 21303, 21003, 21103,  372,  378},
+    { 67, {-15.588,  -9.000}, 21404, 21204, 21304, 21004, 21104,  378,  384},
+    { 68, {-10.392, -12.000}, 21405, 21205, 21305, 21005, 21105,  384,  390},
+    { 69, { -5.196, -15.000}, 21406, 21206, 21306, 21006, 21106,  390,  396},
+    { 70, {-20.785, -12.000}, 21407, 21207, 21307, 21007, 21107,  396,  402},
+    { 71, {-15.588, -15.000}, 21408, 21208, 21308, 21008, 21108,  402,  408},
+    { 72, {-10.392, -18.000}, 21409, 21209, 21309, 21009, 21109,  408,  414},
+    { 73, { -5.196, -21.000}, 21410, 21210, 21310, 21010, 21110,  414,  420},
+    { 74, {-25.981, -15.000}, 21411, 21211, 21311, 21011, 21111,  420,  426},
+    { 75, {-20.785, -18.000}, 21412, 21212, 21312, 21012, 21112,  426,  432},
+    { 76, {-15.588, -21.000}, 21413, 21213, 21313, 21013, 21113,  432,  438},
+    { 77, {-10.392, -24.000}, 21414, 21214, 21314, 21014, 21114,  438,  444},
+    { 78, { -5.196, -27.000}, 21415, 21215, 21315, 21015, 21115,  444,  450},
+    { 79, {-31.177, -18.000}, 21416, 21216, 21316, 21016, 21116,  450,  456},
+    { 80, {-25.981, -21.000}, 21417, 21217, 21317, 21017, 21117,  456,  462},
+    { 81, {-20.785, -24.000}, 21418, 21218, 21318, 21018, 21118,  462,  468},
+    { 82, {-15.588, -27.000}, 21419, 21219, 21319, 21019, 21119,  468,  474},
+    { 83, {-10.392, -30.000}, 21420, 21220, 21320, 21020, 21120,  474,  480},
+    { 84, { -5.196, -33.000}, 21421, 21221, 21321, 21021, 21121,  480,  486},
+    { 85, {-36.373, -21.000}, 21422, 21222, 21322, 21022, 21122,  486,  492},
+    { 86, {-31.177, -24.000}, 21423, 21223, 21323, 21023, 21123,  492,  498},
+    { 87, {-25.981, -27.000}, 21424, 21224, 21324, 21024, 21124,  498,  504},
+    { 88, {-20.785, -30.000}, 21425, 21225, 21325, 21025, 21125,  504,  510},
+    { 89, {-15.588, -33.000}, 21426, 21226, 21326, 21026, 21126,  510,  516},
+    { 90, {-10.392, -36.000}, 21427, 21227, 21327, 21027, 21127,  516,  522},
+    { 91, { -5.196, -39.000}, 21428, 21228, 21328, 21028, 21128,  522,  528},
+    { 92, {-41.569, -24.000}, 21429, 21229, 21329, 21029, 21129,  528,  534},
+    { 93, {-36.373, -27.000}, 21430, 21230, 21330, 21030, 21130,  534,  540},
+    { 94, {-31.177, -30.000}, 21431, 21231, 21331, 21031, 21131,  540,  546},
+    { 95, {-25.981, -33.000}, 21432, 21232, 21332, 21032, 21132,  546,  552},
+    { 96, {-20.785, -36.000}, 21433, 21233, 21333, 21033, 21133,  552,  558},
+    { 97, {-15.588, -39.000}, 21434, 21234, 21334, 21034, 21134,  558,  564},
+    { 98, {-10.392, -42.000}, 21435, 21235, 21335, 21035, 21135,  564,  570},
+    { 99, { -5.196, -45.000}, 21436, 21236, 21336, 21036, 21136,  570,  576},
+    {100, {-46.765, -27.000}, 21437, 21237, 21337, 21037, 21137,  576,  582},
+    {101, {-41.569, -30.000}, 21438, 21238, 21338, 21038, 21138,  582,  588},
+    {102, {-36.373, -33.000}, 21439, 21239, 21339, 21039, 21139,  588,  594},
+    {103, {-31.177, -36.000}, 21440, 21240, 21340, 21040, 21140,  594,  600},
+    {104, {-25.981, -39.000}, 21441, 21241, 21341, 21041, 21141,  600,  606},
+    {105, {-20.785, -42.000}, 21442, 21242, 21342, 21042, 21142,  606,  612},
+    {106, {-15.588, -45.000}, 21443, 21243, 21343, 21043, 21143,  612,  618},
+    {107, {-10.392, -48.000}, 21444, 21244, 21344, 21044, 21144,  618,  624},
+    {108, { -5.196, -51.000}, 21445, 21245, 21345, 21045, 21145,  624,  630},
+    {109, {-51.962, -30.000}, 21446, 21246, 21346, 21046, 21146,  630,  634},
+    {110, {-46.765, -33.000}, 21447, 21247, 21347, 21047, 21147,  634,  640},
+    {111, {-41.569, -36.000}, 21448, 21248, 21348, 21048, 21148,  640,  646},
+    {112, {-36.373, -39.000}, 21449, 21249, 21349, 21049, 21149,  646,  652},
+    {113, {-31.177, -42.000}, 21450, 21250, 21350, 21050, 21150,  652,  658},
+    {114, {-25.981, -45.000}, 21451, 21251, 21351, 21051, 21151,  658,  664},
+    {115, {-20.785, -48.000}, 21452, 21252, 21352, 21052, 21152,  664,  670},
+    {116, {-15.588, -51.000}, 21453, 21253, 21353, 21053, 21153,  670,  676},
+    {117, {-10.392, -54.000}, 21454, 21254, 21354, 21054, 21154,  676,  682},
+    {118, { -5.196, -57.000}, 21455, 21255, 21355, 21055, 21155,  682,  687},
+    {119, {-51.962, -36.000}, 21456, 21256, 21356, 21056, 21156,  687,  690},
+    {120, {-46.765, -39.000}, 21457, 21257, 21357, 21057, 21157,  690,  694},
+    {121, {-41.569, -42.000}, 21458, 21258, 21358, 21058, 21158,  694,  698},
+    {122, {-36.373, -45.000}, 21459, 21259, 21359, 21059, 21159,  698,  702},
+    {123, {-31.177, -48.000}, 21460, 21260, 21360, 21060, 21160,  702,  706},
+    {124, {-25.981, -51.000}, 21461, 21261, 21361, 21061, 21161,  706,  710},
+    {125, {-20.785, -54.000}, 21462, 21262, 21362, 21062, 21162,  710,  714},
+    {126, {-15.588, -57.000}, 21463, 21263, 21363, 21063, 21163,  714,  718},
+    {127, {-10.392, -60.000}, 21464, 21264, 21364, 21064, 21164,  718,  721},
+    {128, {  0.000,  -6.000}, 22401, 22201, 22301, 22001, 22101,  721,  726},
+    {129, {  0.000, -12.000}, 22402, 22202, 22302, 22002, 22102,  726,  732},
+    {130, {  5.196,  -9.000}, 22403, 22203, 22303, 22003, 22103,  732,  738},
+    {131, {  0.000, -18.000}, 22404, 22204, 22304, 22004, 22104,  738,  744},
+    {132, {  5.196, -15.000}, 22405, 22205, 22305, 22005, 22105,  744,  750},
+    {133, { 10.392, -12.000}, 22406, 22206, 22306, 22006, 22106,  750,  756},
+    {134, {  0.000, -24.000}, 22407, 22207, 22307, 22007, 22107,  756,  762},
+    {135, {  5.196, -21.000}, 22408, 22208, 22308, 22008, 22108,  762,  768},
+    {136, { 10.392, -18.000}, 22409, 22209, 22309, 22009, 22109,  768,  774},
+    {137, { 15.588, -15.000}, 22410, 22210, 22310, 22010, 22110,  774,  780},
+    {138, {  0.000, -30.000}, 22411, 22211, 22311, 22011, 22111,  780,  786},
+    {139, {  5.196, -27.000}, 22412, 22212, 22312, 22012, 22112,  786,  792},
+    {140, { 10.392, -24.000}, 22413, 22213, 22313, 22013, 22113,  792,  798},
+    {141, { 15.588, -21.000}, 22414, 22214, 22314, 22014, 22114,  798,  804},
+    {142, { 20.785, -18.000}, 22415, 22215, 22315, 22015, 22115,  804,  810},
+    {143, {  0.000, -36.000}, 22416, 22216, 22316, 22016, 22116,  810,  816},
+    {144, {  5.196, -33.000}, 22417, 22217, 22317, 22017, 22117,  816,  822},
+    {145, { 10.392, -30.000}, 22418, 22218, 22318, 22018, 22118,  822,  828},
+    {146, { 15.588, -27.000}, 22419, 22219, 22319, 22019, 22119,  828,  834},
+    {147, { 20.785, -24.000}, 22420, 22220, 22320, 22020, 22120,  834,  840},
+    {148, { 25.981, -21.000}, 22421, 22221, 22321, 22021, 22121,  840,  846},
+    {149, {  0.000, -42.000}, 22422, 22222, 22322, 22022, 22122,  846,  852},
+    {150, {  5.196, -39.000}, 22423, 22223, 22323, 22023, 22123,  852,  858},
+    {151, { 10.392, -36.000}, 22424, 22224, 22324, 22024, 22124,  858,  864},
+    {152, { 15.588, -33.000}, 22425, 22225, 22325, 22025, 22125,  864,  870},
+    {153, { 20.785, -30.000}, 22426, 22226, 22326, 22026, 22126,  870,  876},
+    {154, { 25.981, -27.000}, 22427, 22227, 22327, 22027, 22127,  876,  882},
+    {155, { 31.177, -24.000}, 22428, 22228, 22328, 22028, 22128,  882,  888},
+    {156, {  0.000, -48.000}, 22429, 22229, 22329, 22029, 22129,  888,  894},
+    {157, {  5.196, -45.000}, 22430, 22230, 22330, 22030, 22130,  894,  900},
+    {158, { 10.392, -42.000}, 22431, 22231, 22331, 22031, 22131,  900,  906},
+    {159, { 15.588, -39.000}, 22432, 22232, 22332, 22032, 22132,  906,  912},
+    {160, { 20.785, -36.000}, 22433, 22233, 22333, 22033, 22133,  912,  918},
+    {161, { 25.981, -33.000}, 22434, 22234, 22334, 22034, 22134,  918,  924},
+    {162, { 31.177, -30.000}, 22435, 22235, 22335, 22035, 22135,  924,  930},
+    {163, { 36.373, -27.000}, 22436, 22236, 22336, 22036, 22136,  930,  936},
+    {164, {  0.000, -54.000}, 22437, 22237, 22337, 22037, 22137,  936,  942},
+    {165, {  5.196, -51.000}, 22438, 22238, 22338, 22038, 22138,  942,  948},
+    {166, { 10.392, -48.000}, 22439, 22239, 22339, 22039, 22139,  948,  954},
+    {167, { 15.588, -45.000}, 22440, 22240, 22340, 22040, 22140,  954,  960},
+    {168, { 20.785, -42.000}, 22441, 22241, 22341, 22041, 22141,  960,  966},
+    {169, { 25.981, -39.000}, 22442, 22242, 22342, 22042, 22142,  966,  972},
+    {170, { 31.177, -36.000}, 22443, 22243, 22343, 22043, 22143,  972,  978},
+    {171, { 36.373, -33.000}, 22444, 22244, 22344, 22044, 22144,  978,  984},
+    {172, { 41.569, -30.000}, 22445, 22245, 22345, 22045, 22145,  984,  990},
+    {173, {  0.000, -60.000}, 22446, 22246, 22346, 22046, 22146,  990,  993},
+    {174, {  5.196, -57.000}, 22447, 22247, 22347, 22047, 22147,  993,  998},
+    {175, { 10.392, -54.000}, 22448, 22248, 22348, 22048, 22148,  998, 1004},
+    {176, { 15.588, -51.000}, 22449, 22249, 22349, 22049, 22149, 1004, 1010},
+    {177, { 20.785, -48.000}, 22450, 22250, 22350, 22050, 22150, 1010, 1016},
+    {178, { 25.981, -45.000}, 22451, 22251, 22351, 22051, 22151, 1016, 1022},
+    {179, { 31.177, -42.000}, 22452, 22252, 22352, 22052, 22152, 1022, 1028},
+    {180, { 36.373, -39.000}, 22453, 22253, 22353, 22053, 22153, 1028, 1034},
+    {181, { 41.569, -36.000}, 22454, 22254, 22354, 22054, 22154, 1034, 1040},
+    {182, { 46.765, -33.000}, 22455, 22255, 22355, 22055, 22155, 1040, 1046},
+    {183, { 10.392, -60.000}, 22456, 22256, 22356, 22056, 22156, 1046, 1049},
+    {184, { 15.588, -57.000}, 22457, 22257, 22357, 22057, 22157, 1049, 1053},
+    {185, { 20.785, -54.000}, 22458, 22258, 22358, 22058, 22158, 1053, 1057},
+    {186, { 25.981, -51.000}, 22459, 22259, 22359, 22059, 22159, 1057, 1061},
+    {187, { 31.177, -48.000}, 22460, 22260, 22360, 22060, 22160, 1061, 1065},
+    {188, { 36.373, -45.000}, 22461, 22261, 22361, 22061, 22161, 1065, 1069},
+    {189, { 41.569, -42.000}, 22462, 22262, 22362, 22062, 22162, 1069, 1073},
+    {190, { 46.765, -39.000}, 22463, 22263, 22363, 22063, 22163, 1073, 1077},
+    {191, { 51.962, -36.000}, 22464, 22264, 22364, 22064, 22164, 1077, 1080},
+    {192, {  5.196,  -3.000}, 23401, 23201, 23301, 23001, 23101, 1080, 1085},
+    {193, { 10.392,  -6.000}, 23402, 23202, 23302, 23002, 23102, 1085, 1091},
+    {194, { 10.392,   0.000}, 23403, 23203, 23303, 23003, 23103, 1091, 1097},
+    {195, { 15.588,  -9.000}, 23404, 23204, 23304, 23004, 23104, 1097, 1103},
+    {196, { 15.588,  -3.000}, 23405, 23205, 23305, 23005, 23105, 1103, 1109},
+    {197, { 15.588,   3.000}, 23406, 23206, 23306, 23006, 23106, 1109, 1115},
+    {198, { 20.785, -12.000}, 23407, 23207, 23307, 23007, 23107, 1115, 1121},
+    {199, { 20.785,  -6.000}, 23408, 23208, 23308, 23008, 23108, 1121, 1127},
+    {200, { 20.785,   0.000}, 23409, 23209, 23309, 23009, 23109, 1127, 1133},
+    {201, { 20.785,   6.000}, 23410, 23210, 23310, 23010, 23110, 1133, 1139},
+    {202, { 25.981, -15.000}, 23411, 23211, 23311, 23011, 23111, 1139, 1145},
+    {203, { 25.981,  -9.000}, 23412, 23212, 23312, 23012, 23112, 1145, 1151},
+    {204, { 25.981,  -3.000}, 23413, 23213, 23313, 23013, 23113, 1151, 1157},
+    {205, { 25.981,   3.000}, 23414, 23214, 23314, 23014, 23114, 1157, 1163},
+    {206, { 25.981,   9.000}, 23415, 23215, 23315, 23015, 23115, 1163, 1169},
+    {207, { 31.177, -18.000}, 23416, 23216, 23316, 23016, 23116, 1169, 1175},
+    {208, { 31.177, -12.000}, 23417, 23217, 23317, 23017, 23117, 1175, 1181},
+    {209, { 31.177,  -6.000}, 23418, 23218, 23318, 23018, 23118, 1181, 1187},
+    {210, { 31.177,   0.000}, 23419, 23219, 23319, 23019, 23119, 1187, 1193},
+    {211, { 31.177,   6.000}, 23420, 23220, 23320, 23020, 23120, 1193, 1199},
+    {212, { 31.177,  12.000}, 23421, 23221, 23321, 23021, 23121, 1199, 1205},
+    {213, { 36.373, -21.000}, 23422, 23222, 23322, 23022, 23122, 1205, 1211},
+    {214, { 36.373, -15.000}, 23423, 23223, 23323, 23023, 23123, 1211, 1217},
+    {215, { 36.373,  -9.000}, 23424, 23224, 23324, 23024, 23124, 1217, 1223},
+    {216, { 36.373,  -3.000}, 23425, 23225, 23325, 23025, 23125, 1223, 1229},
+    {217, { 36.373,   3.000}, 23426, 23226, 23326, 23026, 23126, 1229, 1235},
+    {218, { 36.373,   9.000}, 23427, 23227, 23327, 23027, 23127, 1235, 1241},
+    {219, { 36.373,  15.000}, 23428, 23228, 23328, 23028, 23128, 1241, 1247},
+    {220, { 41.569, -24.000}, 23429, 23229, 23329, 23029, 23129, 1247, 1253},
+    {221, { 41.569, -18.000}, 23430, 23230, 23330, 23030, 23130, 1253, 1259},
+    {222, { 41.569, -12.000}, 23431, 23231, 23331, 23031, 23131, 1259, 1265},
+    {223, { 41.569,  -6.000}, 23432, 23232, 23332, 23032, 23132, 1265, 1271},
+    {224, { 41.569,   0.000}, 23433, 23233, 23333, 23033, 23133, 1271, 1277},
+    {225, { 41.569,   6.000}, 23434, 23234, 23334, 23034, 23134, 1277, 1283},
+    {226, { 41.569,  12.000}, 23435, 23235, 23335, 23035, 23135, 1283, 1289},
+    {227, { 41.569,  18.000}, 23436, 23236, 23336, 23036, 23136, 1289, 1295},
+    {228, { 46.765, -27.000}, 23437, 23237, 23337, 23037, 23137, 1295, 1301},
+    {229, { 46.765, -21.000}, 23438, 23238, 23338, 23038, 23138, 1301, 1307},
+    {230, { 46.765, -15.000}, 23439, 23239, 23339, 23039, 23139, 1307, 1313},
+    {231, { 46.765,  -9.000}, 23440, 23240, 23340, 23040, 23140, 1313, 1319},
+    {232, { 46.765,  -3.000}, 23441, 23241, 23341, 23041, 23141, 1319, 1325},
+    {233, { 46.765,   3.000}, 23442, 23242, 23342, 23042, 23142, 1325, 1331},
+    {234, { 46.765,   9.000}, 23443, 23243, 23343, 23043, 23143, 1331, 1337},
+    {235, { 46.765,  15.000}, 23444, 23244, 23344, 23044, 23144, 1337, 1343},
+    {236, { 46.765,  21.000}, 23445, 23245, 23345, 23045, 23145, 1343, 1349},
+    {237, { 51.962, -30.000}, 23446, 23246, 23346, 23046, 23146, 1349, 1354},
+    {238, { 51.962, -24.000}, 23447, 23247, 23347, 23047, 23147, 1354, 1360},
+    {239, { 51.962, -18.000}, 23448, 23248, 23348, 23048, 23148, 1360, 1366},
+    {240, { 51.962, -12.000}, 23449, 23249, 23349, 23049, 23149, 1366, 1372},
+    {241, { 51.962,  -6.000}, 23450, 23250, 23350, 23050, 23150, 1372, 1378},
+    {242, { 51.962,   0.000}, 23451, 23251, 23351, 23051, 23151, 1378, 1384},
+    {243, { 51.962,   6.000}, 23452, 23252, 23352, 23052, 23152, 1384, 1390},
+    {244, { 51.962,  12.000}, 23453, 23253, 23353, 23053, 23153, 1390, 1396},
+    {245, { 51.962,  18.000}, 23454, 23254, 23354, 23054, 23154, 1396, 1402},
+    {246, { 51.962,  24.000}, 23455, 23255, 23355, 23055, 23155, 1402, 1407},
+    {247, { 57.158, -27.000}, 23456, 23256, 23356, 23056, 23156, 1407, 1410},
+    {248, { 57.158, -21.000}, 23457, 23257, 23357, 23057, 23157, 1410, 1414},
+    {249, { 57.158, -15.000}, 23458, 23258, 23358, 23058, 23158, 1414, 1418},
+    {250, { 57.158,  -9.000}, 23459, 23259, 23359, 23059, 23159, 1418, 1422},
+    {251, { 57.158,  -3.000}, 23460, 23260, 23360, 23060, 23160, 1422, 1426},
+    {252, { 57.158,   3.000}, 23461, 23261, 23361, 23061, 23161, 1426, 1430},
+    {253, { 57.158,   9.000}, 23462, 23262, 23362, 23062, 23162, 1430, 1434},
+    {254, { 57.158,  15.000}, 23463, 23263, 23363, 23063, 23163, 1434, 1438},
+    {255, { 57.158,  21.000}, 23464, 23264, 23364, 23064, 23164, 1438, 1441},
+    {256, {  5.196,   3.000}, 24401, 24201, 24301, 24001, 24101, 1441, 1446},
+    {257, { 10.392,   6.000}, 24402, 24202, 24302, 24002, 24102, 1446, 1452},
+    {258, {  5.196,   9.000}, 24403, 24203, 24303, 24003, 24103, 1452, 1458},
+    {259, { 15.588,   9.000}, 24404, 24204, 24304, 24004, 24104, 1458, 1464},
+    {260, { 10.392,  12.000}, 24405, 24205, 24305, 24005, 24105, 1464, 1470},
+    {261, {  5.196,  15.000}, 24406, 24206, 24306, 24006, 24106, 1470, 1476},
+    {262, { 20.785,  12.000}, 24407, 24207, 24307, 24007, 24107, 1476, 1482},
+    {263, { 15.588,  15.000}, 24408, 24208, 24308, 24008, 24108, 1482, 1488},
+    {264, { 10.392,  18.000}, 24409, 24209, 24309, 24009, 24109, 1488, 1494},
+    {265, {  5.196,  21.000}, 24410, 24210, 24310, 24010, 24110, 1494, 1500},
+    {266, { 25.981,  15.000}, 24411, 24211, 24311, 24011, 24111, 1500, 1506},
+    {267, { 20.785,  18.000}, 24412, 24212, 24312, 24012, 24112, 1506, 1512},
+    {268, { 15.588,  21.000}, 24413, 24213, 24313, 24013, 24113, 1512, 1518},
+    {269, { 10.392,  24.000}, 24414, 24214, 24314, 24014, 24114, 1518, 1524},
+    {270, {  5.196,  27.000}, 24415, 24215, 24315, 24015, 24115, 1524, 1530},
+    {271, { 31.177,  18.000}, 24416, 24216, 24316, 24016, 24116, 1530, 1536},
+    {272, { 25.981,  21.000}, 24417, 24217, 24317, 24017, 24117, 1536, 1542},
+    {273, { 20.785,  24.000}, 24418, 24218, 24318, 24018, 24118, 1542, 1548},
+    {274, { 15.588,  27.000}, 24419, 24219, 24319, 24019, 24119, 1548, 1554},
+    {275, { 10.392,  30.000}, 24420, 24220, 24320, 24020, 24120, 1554, 1560},
+    {276, {  5.196,  33.000}, 24421, 24221, 24321, 24021, 24121, 1560, 1566},
+    {277, { 36.373,  21.000}, 24422, 24222, 24322, 24022, 24122, 1566, 1572},
+    {278, { 31.177,  24.000}, 24423, 24223, 24323, 24023, 24123, 1572, 1578},
+    {279, { 25.981,  27.000}, 24424, 24224, 24324, 24024, 24124, 1578, 1584},
+    {280, { 20.785,  30.000}, 24425, 24225, 24325, 24025, 24125, 1584, 1590},
+    {281, { 15.588,  33.000}, 24426, 24226, 24326, 24026, 24126, 1590, 1596},
+    {282, { 10.392,  36.000}, 24427, 24227, 24327, 24027, 24127, 1596, 1602},
+    {283, {  5.196,  39.000}, 24428, 24228, 24328, 24028, 24128, 1602, 1608},
+    {284, { 41.569,  24.000}, 24429, 24229, 24329, 24029, 24129, 1608, 1614},
+    {285, { 36.373,  27.000}, 24430, 24230, 24330, 24030, 24130, 1614, 1620},
+    {286, { 31.177,  30.000}, 24431, 24231, 24331, 24031, 24131, 1620, 1626},
+    {287, { 25.981,  33.000}, 24432, 24232, 24332, 24032, 24132, 1626, 1632},
+    {288, { 20.785,  36.000}, 24433, 24233, 24333, 24033, 24133, 1632, 1638},
+    {289, { 15.588,  39.000}, 24434, 24234, 24334, 24034, 24134, 1638, 1644},
+    {290, { 10.392,  42.000}, 24435, 24235, 24335, 24035, 24135, 1644, 1650},
+    {291, {  5.196,  45.000}, 24436, 24236, 24336, 24036, 24136, 1650, 1656},
+    {292, { 46.765,  27.000}, 24437, 24237, 24337, 24037, 24137, 1656, 1662},
+    {293, { 41.569,  30.000}, 24438, 24238, 24338, 24038, 24138, 1662, 1668},
+    {294, { 36.373,  33.000}, 24439, 24239, 24339, 24039, 24139, 1668, 1674},
+    {295, { 31.177,  36.000}, 24440, 24240, 24340, 24040, 24140, 1674, 1680},
+    {296, { 25.981,  39.000}, 24441, 24241, 24341, 24041, 24141, 1680, 1686},
+    {297, { 20.785,  42.000}, 24442, 24242, 24342, 24042, 24142, 1686, 1692},
+    {298, { 15.588,  45.000}, 24443, 24243, 24343, 24043, 24143, 1692, 1698},
+    {299, { 10.392,  48.000}, 24444, 24244, 24344, 24044, 24144, 1698, 1704},
+    {300, {  5.196,  51.000}, 24445, 24245, 24345, 24045, 24145, 1704, 1710},
+    {301, { 51.962,  30.000}, 24446, 24246, 24346, 24046, 24146, 1710, 1714},
+    {302, { 46.765,  33.000}, 24447, 24247, 24347, 24047, 24147, 1714, 1720},
+    {303, { 41.569,  36.000}, 24448, 24248, 24348, 24048, 24148, 1720, 1726},
+    {304, { 36.373,  39.000}, 24449, 24249, 24349, 24049, 24149, 1726, 1732},
+    {305, { 31.177,  42.000}, 24450, 24250, 24350, 24050, 24150, 1732, 1738},
+    {306, { 25.981,  45.000}, 24451, 24251, 24351, 24051, 24151, 1738, 1744},
+    {307, { 20.785,  48.000}, 24452, 24252, 24352, 24052, 24152, 1744, 1750},
+    {308, { 15.588,  51.000}, 24453, 24253, 24353, 24053, 24153, 1750, 1756},
+    {309, { 10.392,  54.000}, 24454, 24254, 24354, 24054, 24154, 1756, 1762},
+    {310, {  5.196,  57.000}, 24455, 24255, 24355, 24055, 24155, 1762, 1767},
+    {311, { 51.962,  36.000}, 24456, 24256, 24356, 24056, 24156, 1767, 1770},
+    {312, { 46.765,  39.000}, 24457, 24257, 24357, 24057, 24157, 1770, 1774},
+    {313, { 41.569,  42.000}, 24458, 24258, 24358, 24058, 24158, 1774, 1778},
+    {314, { 36.373,  45.000}, 24459, 24259, 24359, 24059, 24159, 1778, 1782},
+    {315, { 31.177,  48.000}, 24460, 24260, 24360, 24060, 24160, 1782, 1786},
+    {316, { 25.981,  51.000}, 24461, 24261, 24361, 24061, 24161, 1786, 1790},
+    {317, { 20.785,  54.000}, 24462, 24262, 24362, 24062, 24162, 1790, 1794},
+    {318, { 15.588,  57.000}, 24463, 24263, 24363, 24063, 24163, 1794, 1798},
+    {319, { 10.392,  60.000}, 24464, 24264, 24364, 24064, 24164, 1798, 1801},
+    {320, {  0.000,   6.000}, 25401, 25201, 25301, 25001, 25101, 1801, 1806},
+    {321, {  0.000,  12.000}, 25402, 25202, 25302, 25002, 25102, 1806, 1812},
+    {322, { -5.196,   9.000}, 25403, 25203, 25303, 25003, 25103, 1812, 1818},
+    {323, {  0.000,  18.000}, 25404, 25204, 25304, 25004, 25104, 1818, 1824},
+    {324, { -5.196,  15.000}, 25405, 25205, 25305, 25005, 25105, 1824, 1830},
+    {325, {-10.392,  12.000}, 25406, 25206, 25306, 25006, 25106, 1830, 1836},
+    {326, {  0.000,  24.000}, 25407, 25207, 25307, 25007, 25107, 1836, 1842},
+    {327, { -5.196,  21.000}, 25408, 25208, 25308, 25008, 25108, 1842, 1848},
+    {328, {-10.392,  18.000}, 25409, 25209, 25309, 25009, 25109, 1848, 1854},
+    {329, {-15.588,  15.000}, 25410, 25210, 25310, 25010, 25110, 1854, 1860},
+    {330, {  0.000,  30.000}, 25411, 25211, 25311, 25011, 25111, 1860, 1866},
+    {331, { -5.196,  27.000}, 25412, 25212, 25312, 25012, 25112, 1866, 1872},
+    {332, {-10.392,  24.000}, 25413, 25213, 25313, 25013, 25113, 1872, 1878},
+    {333, {-15.588,  21.000}, 25414, 25214, 25314, 25014, 25114, 1878, 1884},
+    {334, {-20.785,  18.000}, 25415, 25215, 25315, 25015, 25115, 1884, 1890},
+    {335, {  0.000,  36.000}, 25416, 25216, 25316, 25016, 25116, 1890, 1896},
+    {336, { -5.196,  33.000}, 25417, 25217, 25317, 25017, 25117, 1896, 1902},
+    {337, {-10.392,  30.000}, 25418, 25218, 25318, 25018, 25118, 1902, 1908},
+    {338, {-15.588,  27.000}, 25419, 25219, 25319, 25019, 25119, 1908, 1914},
+    {339, {-20.785,  24.000}, 25420, 25220, 25320, 25020, 25120, 1914, 1920},
+    {340, {-25.981,  21.000}, 25421, 25221, 25321, 25021, 25121, 1920, 1926},
+    {341, {  0.000,  42.000}, 25422, 25222, 25322, 25022, 25122, 1926, 1932},
+    {342, { -5.196,  39.000}, 25423, 25223, 25323, 25023, 25123, 1932, 1938},
+    {343, {-10.392,  36.000}, 25424, 25224, 25324, 25024, 25124, 1938, 1944},
+    {344, {-15.588,  33.000}, 25425, 25225, 25325, 25025, 25125, 1944, 1950},
+    {345, {-20.785,  30.000}, 25426, 25226, 25326, 25026, 25126, 1950, 1956},
+    {346, {-25.981,  27.000}, 25427, 25227, 25327, 25027, 25127, 1956, 1962},
+    {347, {-31.177,  24.000}, 25428, 25228, 25328, 25028, 25128, 1962, 1968},
+    {348, {  0.000,  48.000}, 25429, 25229, 25329, 25029, 25129, 1968, 1974},
+    {349, { -5.196,  45.000}, 25430, 25230, 25330, 25030, 25130, 1974, 1980},
+    {350, {-10.392,  42.000}, 25431, 25231, 25331, 25031, 25131, 1980, 1986},
+    {351, {-15.588,  39.000}, 25432, 25232, 25332, 25032, 25132, 1986, 1992},
+    {352, {-20.785,  36.000}, 25433, 25233, 25333, 25033, 25133, 1992, 1998},
+    {353, {-25.981,  33.000}, 25434, 25234, 25334, 25034, 25134, 1998, 2004},
+    {354, {-31.177,  30.000}, 25435, 25235, 25335, 25035, 25135, 2004, 2010},
+    {355, {-36.373,  27.000}, 25436, 25236, 25336, 25036, 25136, 2010, 2016},
+    {356, {  0.000,  54.000}, 25437, 25237, 25337, 25037, 25137, 2016, 2022},
+    {357, { -5.196,  51.000}, 25438, 25238, 25338, 25038, 25138, 2022, 2028},
+    {358, {-10.392,  48.000}, 25439, 25239, 25339, 25039, 25139, 2028, 2034},
+    {359, {-15.588,  45.000}, 25440, 25240, 25340, 25040, 25140, 2034, 2040},
+    {360, {-20.785,  42.000}, 25441, 25241, 25341, 25041, 25141, 2040, 2046},
+    {361, {-25.981,  39.000}, 25442, 25242, 25342, 25042, 25142, 2046, 2052},
+    {362, {-31.177,  36.000}, 25443, 25243, 25343, 25043, 25143, 2052, 2058},
+    {363, {-36.373,  33.000}, 25444, 25244, 25344, 25044, 25144, 2058, 2064},
+    {364, {-41.569,  30.000}, 25445, 25245, 25345, 25045, 25145, 2064, 2070},
+    {365, {  0.000,  60.000}, 25446, 25246, 25346, 25046, 25146, 2070, 2073},
+    {366, { -5.196,  57.000}, 25447, 25247, 25347, 25047, 25147, 2073, 2078},
+    {367, {-10.392,  54.000}, 25448, 25248, 25348, 25048, 25148, 2078, 2084},
+    {368, {-15.588,  51.000}, 25449, 25249, 25349, 25049, 25149, 2084, 2090},
+    {369, {-20.785,  48.000}, 25450, 25250, 25350, 25050, 25150, 2090, 2096},
+    {370, {-25.981,  45.000}, 25451, 25251, 25351, 25051, 25151, 2096, 2102},
+    {371, {-31.177,  42.000}, 25452, 25252, 25352, 25052, 25152, 2102, 2108},
+    {372, {-36.373,  39.000}, 25453, 25253, 25353, 25053, 25153, 2108, 2114},
+    {373, {-41.569,  36.000}, 25454, 25254, 25354, 25054, 25154, 2114, 2120},
+    {374, {-46.765,  33.000}, 25455, 25255, 25355, 25055, 25155, 2120, 2126},
+    {375, {-10.392,  60.000}, 25456, 25256, 25356, 25056, 25156, 2126, 2129},
+    {376, {-15.588,  57.000}, 25457, 25257, 25357, 25057, 25157, 2129, 2133},
+    {377, {-20.785,  54.000}, 25458, 25258, 25358, 25058, 25158, 2133, 2137},
+    {378, {-25.981,  51.000}, 25459, 25259, 25359, 25059, 25159, 2137, 2141},
+    {379, {-31.177,  48.000}, 25460, 25260, 25360, 25060, 25160, 2141, 2145},
+    {380, {-36.373,  45.000}, 25461, 25261, 25361, 25061, 25161, 2145, 2149},
+    {381, {-41.569,  42.000}, 25462, 25262, 25362, 25062, 25162, 2149, 2153},
+    {382, {-46.765,  39.000}, 25463, 25263, 25363, 25063, 25163, 2153, 2157},
+    {383, {-51.962,  36.000}, 25464, 25264, 25364, 25064, 25164, 2157, 2160},
+};
+constexpr unsigned
+ant::expconfig::detector::TAPS_2007::BaF2_neighbours[] = {
+  /*   0 */ 1,2,64,320,322,
+  /*   1 */ 0,2,4,3,325,322,
+  /*   2 */ 0,1,4,5,65,64,
+  /*   3 */ 1,325,329,6,7,4,
+  /*   4 */ 1,2,5,8,7,3,
+  /*   5 */ 2,4,8,9,67,65,
+  /*   6 */ 3,329,334,10,11,7,
+  /*   7 */ 4,3,6,11,12,8,
+  /*   8 */ 4,7,12,13,9,5,
+  /*   9 */ 70,67,5,8,13,14,
+  /*  10 */ 11,6,334,340,15,16,
+  /*  11 */ 12,7,6,10,16,17,
+  /*  12 */ 13,8,7,11,17,18,
+  /*  13 */ 14,9,8,12,18,19,
+  /*  14 */ 74,70,9,13,19,20,
+  /*  15 */ 16,10,340,347,21,22,
+  /*  16 */ 17,11,10,15,22,23,
+  /*  17 */ 18,12,11,16,23,24,
+  /*  18 */ 19,13,12,17,24,25,
+  /*  19 */ 20,14,13,18,25,26,
+  /*  20 */ 79,74,14,19,26,27,
+  /*  21 */ 22,15,347,355,28,29,
+  /*  22 */ 23,16,15,21,29,30,
+  /*  23 */ 24,17,16,22,30,31,
+  /*  24 */ 25,18,17,23,31,32,
+  /*  25 */ 26,19,18,24,32,33,
+  /*  26 */ 27,20,19,25,33,34,
+  /*  27 */ 85,79,20,26,34,35,
+  /*  28 */ 29,21,355,364,36,37,
+  /*  29 */ 30,22,21,28,37,38,
+  /*  30 */ 31,23,22,29,38,39,
+  /*  31 */ 32,24,23,30,39,40,
+  /*  32 */ 33,25,24,31,40,41,
+  /*  33 */ 34,26,25,32,41,42,
+  /*  34 */ 35,27,26,33,42,43,
+  /*  35 */ 92,85,27,34,43,44,
+  /*  36 */ 37,28,364,374,45,46,
+  /*  37 */ 38,29,28,36,46,47,
+  /*  38 */ 39,30,29,37,47,48,
+  /*  39 */ 40,31,30,38,48,49,
+  /*  40 */ 41,32,31,39,49,50,
+  /*  41 */ 42,33,32,40,50,51,
+  /*  42 */ 43,34,33,41,51,52,
+  /*  43 */ 44,35,34,42,52,53,
+  /*  44 */ 100,92,35,43,53,54,
+  /*  45 */ 46,36,374,383,55,
+  /*  46 */ 47,37,36,45,55,46,
+  /*  47 */ 48,38,37,46,56,47,
+  /*  48 */ 49,39,38,47,57,48,
+  /*  49 */ 50,40,39,46,58,49,
+  /*  50 */ 51,41,40,47,59,50,
+  /*  51 */ 52,42,41,48,60,51,
+  /*  52 */ 53,43,42,49,59,52,
+  /*  53 */ 54,44,43,50,60,53,
+  /*  54 */ 109,100,44,53,63,
+  /*  55 */ 56,46,45,
+  /*  56 */ 57,47,46,55,
+  /*  57 */ 58,48,47,56,
+  /*  58 */ 59,49,48,57,
+  /*  59 */ 60,50,49,58,
+  /*  60 */ 61,51,50,59,
+  /*  61 */ 62,52,51,60,
+  /*  62 */ 63,53,52,61,
+  /*  63 */ 54,53,62,
+  /*  64 */ 66,128,0,2,65,
+  /*  65 */ 68,66,64,2,5,67,
+  /*  66 */ 69,129,128,64,65,68,
+  /*  67 */ 71,68,65,5,9,70,
+  /*  68 */ 72,69,66,65,67,71,
+  /*  69 */ 73,131,129,66,68,72,
+  /*  70 */ 75,71,67,9,14,74,
+  /*  71 */ 76,72,68,67,70,75,
+  /*  72 */ 77,73,69,68,71,76,
+  /*  73 */ 78,134,131,69,72,77,
+  /*  74 */ 80,75,70,14,20,79,
+  /*  75 */ 81,76,71,70,74,80,
+  /*  76 */ 82,77,72,71,75,81,
+  /*  77 */ 83,78,73,72,76,82,
+  /*  78 */ 84,138,134,73,77,83,
+  /*  79 */ 86,80,74,20,27,85,
+  /*  80 */ 87,81,75,74,79,86,
+  /*  81 */ 88,82,76,75,80,87,
+  /*  82 */ 89,83,77,76,81,88,
+  /*  83 */ 90,84,78,77,82,89,
+  /*  84 */ 91,143,138,78,83,90,
+  /*  85 */ 93,86,79,27,35,92,
+  /*  86 */ 94,87,80,79,85,93,
+  /*  87 */ 95,88,81,80,86,94,
+  /*  88 */ 96,89,82,81,87,95,
+  /*  89 */ 97,90,83,82,88,96,
+  /*  90 */ 98,91,84,83,89,97,
+  /*  91 */ 99,149,143,84,90,98,
+  /*  92 */ 101,93,85,35,44,100,
+  /*  93 */ 102,94,86,85,92,101,
+  /*  94 */ 103,95,87,86,93,102,
+  /*  95 */ 104,96,88,87,94,103,
+  /*  96 */ 105,97,89,88,95,104,
+  /*  97 */ 106,98,90,89,96,105,
+  /*  98 */ 107,99,91,90,97,106,
+  /*  99 */ 108,156,149,91,98,107,
+  /* 100 */ 110,101,92,44,54,109,
+  /* 101 */ 111,102,93,92,100,110,
+  /* 102 */ 112,103,94,93,101,111,
+  /* 103 */ 113,104,95,94,102,112,
+  /* 104 */ 114,105,96,95,103,113,
+  /* 105 */ 115,106,97,96,104,114,
+  /* 106 */ 116,107,98,97,105,115,
+  /* 107 */ 117,108,99,98,106,116,
+  /* 108 */ 118,164,156,99,107,117,
+  /* 109 */ 119,110,100,54,
+  /* 110 */ 120,111,101,100,109,119,
+  /* 111 */ 121,112,102,101,110,120,
+  /* 112 */ 122,113,103,102,111,121,
+  /* 113 */ 123,114,104,103,112,122,
+  /* 114 */ 124,115,105,104,113,123,
+  /* 115 */ 125,116,106,105,114,124,
+  /* 116 */ 126,117,107,106,115,125,
+  /* 117 */ 127,118,108,107,116,126,
+  /* 118 */ 173,164,108,117,127,
+  /* 119 */ 120,110,109,
+  /* 120 */ 121,111,110,119,
+  /* 121 */ 122,112,111,120,
+  /* 122 */ 123,113,112,121,
+  /* 123 */ 124,114,113,122,
+  /* 124 */ 125,115,114,123,
+  /* 125 */ 126,116,115,124,
+  /* 126 */ 127,117,116,125,
+  /* 127 */ 118,117,126,
+  /* 128 */ 129,130,192,64,66,
+  /* 129 */ 131,132,130,128,66,69,
+  /* 130 */ 132,133,193,192,128,129,
+  /* 131 */ 134,135,132,129,69,73,
+  /* 132 */ 135,136,133,130,129,131,
+  /* 133 */ 136,137,195,193,130,132,
+  /* 134 */ 138,139,135,131,73,78,
+  /* 135 */ 139,140,136,132,131,134,
+  /* 136 */ 140,141,137,133,132,135,
+  /* 137 */ 141,142,198,195,133,136,
+  /* 138 */ 143,144,139,134,78,84,
+  /* 139 */ 144,145,140,135,134,138,
+  /* 140 */ 145,146,141,136,135,139,
+  /* 141 */ 146,147,142,137,136,140,
+  /* 142 */ 147,148,202,198,137,141,
+  /* 143 */ 149,150,144,138,84,91,
+  /* 144 */ 150,151,145,139,138,143,
+  /* 145 */ 151,152,146,140,144,139,
+  /* 146 */ 152,153,147,141,145,140,
+  /* 147 */ 153,154,148,142,146,141,
+  /* 148 */ 154,155,207,202,142,147,
+  /* 149 */ 156,157,150,143,91,99,
+  /* 150 */ 157,158,151,144,143,149,
+  /* 151 */ 158,159,152,145,144,150,
+  /* 152 */ 159,160,153,146,145,151,
+  /* 153 */ 160,161,154,147,146,152,
+  /* 154 */ 161,162,155,148,147,153,
+  /* 155 */ 162,163,213,207,148,154,
+  /* 156 */ 164,165,157,149,99,108,
+  /* 157 */ 165,166,158,150,149,156,
+  /* 158 */ 166,167,159,151,150,157,
+  /* 159 */ 167,168,160,152,151,158,
+  /* 160 */ 168,169,161,153,152,159,
+  /* 161 */ 169,170,171,154,153,160,
+  /* 162 */ 170,171,172,155,154,161,
+  /* 163 */ 171,172,220,213,155,162,
+  /* 164 */ 173,174,165,156,108,118,
+  /* 165 */ 174,175,166,157,156,164,
+  /* 166 */ 175,176,167,158,157,165,
+  /* 167 */ 176,177,168,159,158,166,
+  /* 168 */ 177,178,169,160,159,167,
+  /* 169 */ 178,179,170,161,160,168,
+  /* 170 */ 179,180,171,162,161,169,
+  /* 171 */ 180,181,172,163,162,170,
+  /* 172 */ 181,182,228,220,163,171,
+  /* 173 */ 174,164,118,
+  /* 174 */ 183,175,165,164,173,
+  /* 175 */ 183,184,176,166,165,174,
+  /* 176 */ 184,185,177,167,166,175,
+  /* 177 */ 185,186,178,168,167,176,
+  /* 178 */ 186,187,179,169,168,177,
+  /* 179 */ 187,188,180,170,169,178,
+  /* 180 */ 188,189,181,171,170,179,
+  /* 181 */ 189,190,182,172,171,180,
+  /* 182 */ 190,191,237,228,172,181,
+  /* 183 */ 184,175,174,
+  /* 184 */ 185,176,175,183,
+  /* 185 */ 186,177,176,184,
+  /* 186 */ 187,178,177,185,
+  /* 187 */ 188,179,178,186,
+  /* 188 */ 189,180,179,187,
+  /* 189 */ 190,181,180,188,
+  /* 190 */ 191,182,181,189,
+  /* 191 */ 237,182,190,
+  /* 192 */ 128,130,193,194,256,
+  /* 193 */ 133,195,196,194,192,130,
+  /* 194 */ 193,196,197,257,256,192,
+  /* 195 */ 137,198,199,196,193,133,
+  /* 196 */ 195,199,200,197,194,193,
+  /* 197 */ 196,200,201,259,257,194,
+  /* 198 */ 142,202,203,199,195,137,
+  /* 199 */ 198,203,204,200,196,195,
+  /* 200 */ 199,204,205,201,197,196,
+  /* 201 */ 200,205,206,262,259,197,
+  /* 202 */ 148,207,208,203,198,142,
+  /* 203 */ 202,208,209,204,199,198,
+  /* 204 */ 203,209,210,205,200,199,
+  /* 205 */ 204,210,211,206,201,200,
+  /* 206 */ 205,211,212,266,262,201,
+  /* 207 */ 155,213,214,208,202,148,
+  /* 208 */ 207,214,215,209,203,202,
+  /* 209 */ 208,215,216,210,204,203,
+  /* 210 */ 209,216,217,211,205,204,
+  /* 211 */ 210,217,218,212,206,205,
+  /* 212 */ 211,218,219,271,266,206,
+  /* 213 */ 163,220,221,214,207,155,
+  /* 214 */ 213,221,222,215,208,207,
+  /* 215 */ 214,222,223,216,209,208,
+  /* 216 */ 215,223,224,217,210,209,
+  /* 217 */ 216,224,225,218,211,210,
+  /* 218 */ 217,225,226,219,212,211,
+  /* 219 */ 218,226,227,277,271,212,
+  /* 220 */ 172,228,229,221,213,163,
+  /* 221 */ 220,229,230,222,214,213,
+  /* 222 */ 221,230,231,223,215,214,
+  /* 223 */ 222,231,232,224,216,215,
+  /* 224 */ 223,232,233,225,217,216,
+  /* 225 */ 224,233,234,226,218,217,
+  /* 226 */ 225,234,235,227,219,218,
+  /* 227 */ 226,235,236,284,277,219,
+  /* 228 */ 182,237,238,229,220,172,
+  /* 229 */ 228,238,239,230,221,220,
+  /* 230 */ 229,239,240,231,222,221,
+  /* 231 */ 230,240,241,232,223,222,
+  /* 232 */ 231,241,242,233,224,223,
+  /* 233 */ 232,242,243,234,225,224,
+  /* 234 */ 233,243,244,235,226,225,
+  /* 235 */ 234,244,245,236,227,226,
+  /* 236 */ 235,245,246,292,284,227,
+  /* 237 */ 247,238,228,182,191,
+  /* 238 */ 237,247,248,239,229,228,
+  /* 239 */ 238,248,249,240,230,229,
+  /* 240 */ 239,249,250,241,231,230,
+  /* 241 */ 240,250,251,242,232,231,
+  /* 242 */ 241,251,252,243,233,232,
+  /* 243 */ 242,252,253,244,234,233,
+  /* 244 */ 243,253,254,245,235,234,
+  /* 245 */ 244,254,255,246,236,235,
+  /* 246 */ 245,255,301,292,236,
+  /* 247 */ 237,238,248,
+  /* 248 */ 247,249,239,238,
+  /* 249 */ 248,250,240,239,
+  /* 250 */ 249,251,241,240,
+  /* 251 */ 250,252,242,241,
+  /* 252 */ 251,253,243,242,
+  /* 253 */ 252,254,244,243,
+  /* 254 */ 253,255,245,244,
+  /* 255 */ 254,246,245,
+  /* 256 */ 192,194,257,258,320,
+  /* 257 */ 194,197,259,260,258,256,
+  /* 258 */ 256,257,260,261,321,320,
+  /* 259 */ 197,201,262,263,260,257,
+  /* 260 */ 257,259,263,264,261,258,
+  /* 261 */ 258,260,264,265,323,321,
+  /* 262 */ 201,206,266,267,263,259,
+  /* 263 */ 259,262,267,268,264,260,
+  /* 264 */ 260,263,268,269,265,261,
+  /* 265 */ 261,264,269,270,326,323,
+  /* 266 */ 206,212,271,272,267,262,
+  /* 267 */ 262,266,272,273,268,263,
+  /* 268 */ 263,267,273,274,269,264,
+  /* 269 */ 264,268,274,275,270,265,
+  /* 270 */ 265,269,275,276,330,326,
+  /* 271 */ 212,219,277,278,272,266,
+  /* 272 */ 266,271,278,279,273,267,
+  /* 273 */ 267,272,279,280,274,268,
+  /* 274 */ 268,273,280,281,275,269,
+  /* 275 */ 269,274,281,282,276,270,
+  /* 276 */ 270,275,282,283,335,330,
+  /* 277 */ 219,227,284,285,278,271,
+  /* 278 */ 271,277,285,286,279,272,
+  /* 279 */ 272,278,286,287,280,273,
+  /* 280 */ 273,279,287,288,281,274,
+  /* 281 */ 274,280,288,289,282,275,
+  /* 282 */ 275,281,289,290,283,276,
+  /* 283 */ 276,282,290,291,341,335,
+  /* 284 */ 227,236,292,293,285,277,
+  /* 285 */ 277,284,293,294,286,278,
+  /* 286 */ 278,285,294,295,287,279,
+  /* 287 */ 279,286,295,296,288,280,
+  /* 288 */ 280,287,296,297,289,281,
+  /* 289 */ 281,288,297,298,290,282,
+  /* 290 */ 282,289,298,299,291,283,
+  /* 291 */ 283,290,299,300,348,341,
+  /* 292 */ 236,246,301,302,293,284,
+  /* 293 */ 284,292,302,303,294,285,
+  /* 294 */ 285,293,303,304,295,286,
+  /* 295 */ 286,294,304,305,296,287,
+  /* 296 */ 287,295,305,306,297,288,
+  /* 297 */ 288,296,306,307,298,289,
+  /* 298 */ 289,297,307,308,299,290,
+  /* 299 */ 290,298,308,309,300,291,
+  /* 300 */ 291,299,309,310,356,348,
+  /* 301 */ 246,311,302,292,
+  /* 302 */ 292,301,311,312,303,293,
+  /* 303 */ 293,302,312,313,304,294,
+  /* 304 */ 294,303,313,314,305,295,
+  /* 305 */ 295,304,314,315,306,296,
+  /* 306 */ 296,305,315,316,307,297,
+  /* 307 */ 297,306,316,317,308,298,
+  /* 308 */ 298,307,317,318,309,299,
+  /* 309 */ 299,308,318,319,310,300,
+  /* 310 */ 300,309,319,365,356,
+  /* 311 */ 301,312,302,
+  /* 312 */ 311,302,303,313,
+  /* 313 */ 312,303,304,314,
+  /* 314 */ 313,304,305,315,
+  /* 315 */ 314,305,306,316,
+  /* 316 */ 315,306,307,317,
+  /* 317 */ 316,307,308,318,
+  /* 318 */ 317,308,309,319,
+  /* 319 */ 318,309,310,
+  /* 320 */ 256,258,321,322,0,
+  /* 321 */ 320,258,261,323,324,322,
+  /* 322 */ 0,320,321,324,325,1,
+  /* 323 */ 321,261,265,326,327,324,
+  /* 324 */ 322,321,323,327,328,325,
+  /* 325 */ 1,322,324,328,329,3,
+  /* 326 */ 323,265,270,330,331,327,
+  /* 327 */ 324,323,326,331,332,328,
+  /* 328 */ 325,324,327,332,333,329,
+  /* 329 */ 3,325,328,333,334,6,
+  /* 330 */ 326,270,276,335,336,331,
+  /* 331 */ 327,326,330,336,337,332,
+  /* 332 */ 328,327,331,337,338,333,
+  /* 333 */ 329,328,332,338,339,334,
+  /* 334 */ 6,329,333,339,340,10,
+  /* 335 */ 330,276,283,341,342,336,
+  /* 336 */ 331,330,335,342,343,337,
+  /* 337 */ 332,331,336,343,344,338,
+  /* 338 */ 333,332,337,344,345,339,
+  /* 339 */ 334,333,338,345,346,340,
+  /* 340 */ 10,334,339,346,347,15,
+  /* 341 */ 335,283,291,348,349,342,
+  /* 342 */ 336,335,341,349,350,343,
+  /* 343 */ 337,336,342,350,351,344,
+  /* 344 */ 338,337,343,351,352,345,
+  /* 345 */ 339,338,344,352,353,346,
+  /* 346 */ 340,339,345,353,354,347,
+  /* 347 */ 15,340,346,354,355,21,
+  /* 348 */ 341,291,300,356,357,349,
+  /* 349 */ 342,341,348,357,358,350,
+  /* 350 */ 343,342,349,358,359,351,
+  /* 351 */ 344,343,350,359,360,352,
+  /* 352 */ 345,344,351,360,361,353,
+  /* 353 */ 346,345,352,361,362,354,
+  /* 354 */ 347,346,353,362,363,355,
+  /* 355 */ 21,347,354,363,364,28,
+  /* 356 */ 348,300,310,365,366,357,
+  /* 357 */ 349,348,356,366,367,358,
+  /* 358 */ 350,349,357,367,368,359,
+  /* 359 */ 351,350,358,368,369,360,
+  /* 360 */ 352,351,359,369,370,361,
+  /* 361 */ 353,352,360,370,371,362,
+  /* 362 */ 354,353,361,371,372,363,
+  /* 363 */ 355,354,362,372,373,364,
+  /* 364 */ 28,355,363,373,374,36,
+  /* 365 */ 310,356,366,
+  /* 366 */ 365,356,357,367,375,
+  /* 367 */ 358,357,366,375,376,368,
+  /* 368 */ 359,358,367,376,377,369,
+  /* 369 */ 360,359,368,377,378,370,
+  /* 370 */ 361,360,369,378,379,371,
+  /* 371 */ 362,361,370,379,380,372,
+  /* 372 */ 363,362,371,380,381,373,
+  /* 373 */ 364,363,372,381,382,374,
+  /* 374 */ 36,364,373,382,383,45,
+  /* 375 */ 366,367,376,
+  /* 376 */ 375,367,368,377,
+  /* 377 */ 376,368,369,378,
+  /* 378 */ 377,369,370,379,
+  /* 379 */ 378,370,371,380,
+  /* 380 */ 379,371,372,381,
+  /* 381 */ 380,372,373,382,
+  /* 382 */ 381,373,374,383,
+  /* 383 */ 382,374,45,
 };
@@ -1,371 +1,740 @@
 #include "detectors/TAPS.h"
-const std::vector<ant::expconfig::detector::TAPS_2009_03::BaF2_Element_t>
-ant::expconfig::detector::TAPS_2009_03::BaF2_elements_init = {
-  // element, {xy}, TAC, LG, SG, LGS, SGS, {neigbours}
-  { 12, {-15.588,   9.000}, 20404, 20204, 20304, 20004, 20104, {5,379,383,15,16,13,7}},
-  { 13, {-15.588,   3.000}, 20405, 20205, 20305, 20005, 20105, {9,7,5,12,16,17,14,11}},
-  { 14, {-15.588,  -3.000}, 20406, 20206, 20306, 20006, 20106, {78,11,9,13,17,18,85,80}},
-  { 15, {-20.785,  12.000}, 20407, 20207, 20307, 20007, 20107, {12,383,388,19,20,16}},
-  { 16, {-20.785,   6.000}, 20408, 20208, 20308, 20008, 20108, {13,12,15,20,21,17}},
-  { 17, {-20.785,   0.000}, 20409, 20209, 20309, 20009, 20109, {13,16,21,22,18,14}},
-  { 18, {-20.785,  -6.000}, 20410, 20210, 20310, 20010, 20110, {88,85,14,17,22,23}},
-  { 19, {-25.981,  15.000}, 20411, 20211, 20311, 20011, 20111, {20,15,388,394,24,25}},
-  { 20, {-25.981,   9.000}, 20412, 20212, 20312, 20012, 20112, {21,16,15,19,25,26}},
-  { 21, {-25.981,   3.000}, 20413, 20213, 20313, 20013, 20113, {22,17,16,20,26,27}},
-  { 22, {-25.981,  -3.000}, 20414, 20214, 20314, 20014, 20114, {23,18,17,21,27,28}},
-  { 23, {-25.981,  -9.000}, 20415, 20215, 20315, 20015, 20115, {92,88,18,22,28,29}},
-  { 24, {-31.177,  18.000}, 20416, 20216, 20316, 20016, 20116, {25,19,394,401,30,31}},
-  { 25, {-31.177,  12.000}, 20417, 20217, 20317, 20017, 20117, {26,20,19,24,31,32}},
-  { 26, {-31.177,   6.000}, 20418, 20218, 20318, 20018, 20118, {27,21,20,25,32,33}},
-  { 27, {-31.177,   0.000}, 20419, 20219, 20319, 20019, 20119, {28,22,21,26,33,34}},
-  { 28, {-31.177,  -6.000}, 20420, 20220, 20320, 20020, 20120, {29,23,22,27,34,35}},
-  { 29, {-31.177, -12.000}, 20421, 20221, 20321, 20021, 20121, {97,92,23,28,35,36}},
-  { 30, {-36.373,  21.000}, 20422, 20222, 20322, 20022, 20122, {31,24,401,409,37,38}},
-  { 31, {-36.373,  15.000}, 20423, 20223, 20323, 20023, 20123, {32,25,24,30,38,39}},
-  { 32, {-36.373,   9.000}, 20424, 20224, 20324, 20024, 20124, {33,26,25,31,39,40}},
-  { 33, {-36.373,   3.000}, 20425, 20225, 20325, 20025, 20125, {34,27,26,32,40,41}},
-  { 34, {-36.373,  -3.000}, 20426, 20226, 20326, 20026, 20126, {35,28,27,33,41,42}},
-  { 35, {-36.373,  -9.000}, 20427, 20227, 20327, 20027, 20127, {36,29,28,34,42,43}},
-  { 36, {-36.373, -15.000}, 20428, 20228, 20328, 20028, 20128, {103,97,29,35,43,44}},
-  { 37, {-41.569,  24.000}, 20429, 20229, 20329, 20029, 20129, {38,30,409,418,45,46}},
-  { 38, {-41.569,  18.000}, 20430, 20230, 20330, 20030, 20130, {39,31,30,37,46,47}},
-  { 39, {-41.569,  12.000}, 20431, 20231, 20331, 20031, 20131, {40,32,31,38,47,48}},
-  { 40, {-41.569,   6.000}, 20432, 20232, 20332, 20032, 20132, {41,33,32,39,48,49}},
-  { 41, {-41.569,   0.000}, 20433, 20233, 20333, 20033, 20133, {42,34,33,40,49,50}},
-  { 42, {-41.569,  -6.000}, 20434, 20234, 20334, 20034, 20134, {43,35,34,41,50,51}},
-  { 43, {-41.569, -12.000}, 20435, 20235, 20335, 20035, 20135, {44,36,35,42,51,52}},
-  { 44, {-41.569, -18.000}, 20436, 20236, 20336, 20036, 20136, {110,103,36,43,52,53}},
-  { 45, {-46.765,  27.000}, 20437, 20237, 20337, 20037, 20137, {46,37,418,428,54,55}},
-  { 46, {-46.765,  21.000}, 20438, 20238, 20338, 20038, 20138, {47,38,37,45,55,56}},
-  { 47, {-46.765,  15.000}, 20439, 20239, 20339, 20039, 20139, {48,39,38,46,56,57}},
-  { 48, {-46.765,   9.000}, 20440, 20240, 20340, 20040, 20140, {49,40,39,47,57,58}},
-  { 49, {-46.765,   3.000}, 20441, 20241, 20341, 20041, 20141, {50,41,40,48,58,59}},
-  { 50, {-46.765,  -3.000}, 20442, 20242, 20342, 20042, 20142, {51,42,41,49,59,60}},
-  { 51, {-46.765,  -9.000}, 20443, 20243, 20343, 20043, 20143, {52,43,42,50,60,61}},
-  { 52, {-46.765, -15.000}, 20444, 20244, 20344, 20044, 20144, {53,44,43,51,61,62}},
-  { 53, {-46.765, -21.000}, 20445, 20245, 20345, 20045, 20145, {118,110,44,52,62,63}},
-  { 54, {-51.962,  30.000}, 20446, 20246, 20346, 20046, 20146, {55,45,428,437,64}},
-  { 55, {-51.962,  24.000}, 20447, 20247, 20347, 20047, 20147, {56,46,45,54,64,65}},
-  { 56, {-51.962,  18.000}, 20448, 20248, 20348, 20048, 20148, {57,47,46,55,65,66}},
-  { 57, {-51.962,  12.000}, 20449, 20249, 20349, 20049, 20149, {58,48,47,56,66,67}},
-  { 58, {-51.962,   6.000}, 20450, 20250, 20350, 20050, 20150, {59,49,48,57,67,68}},
-  { 59, {-51.962,   0.000}, 20451, 20251, 20351, 20051, 20151, {60,50,49,58,68,69}},
-  { 60, {-51.962,  -6.000}, 20452, 20252, 20352, 20052, 20152, {61,51,50,59,69,70}},
-  { 61, {-51.962, -12.000}, 20453, 20253, 20353, 20053, 20153, {62,52,51,60,70,71}},
-  { 62, {-51.962, -18.000}, 20454, 20254, 20354, 20054, 20154, {63,53,52,61,71,72}},
-  { 63, {-51.962, -24.000}, 20455, 20255, 20355, 20055, 20155, {127,118,53,62,72}},
-  { 64, {-57.158,  27.000}, 20456, 20256, 20356, 20056, 20156, {65,55,54}},
-  { 65, {-57.158,  21.000}, 20457, 20257, 20357, 20057, 20157, {66,56,55,64}},
-  { 66, {-57.158,  15.000}, 20458, 20258, 20358, 20058, 20158, {67,57,56,65}},
-  { 67, {-57.158,   9.000}, 20459, 20259, 20359, 20059, 20159, {68,58,57,66}},
-  { 68, {-57.158,   3.000}, 20460, 20260, 20360, 20060, 20160, {69,59,58,67}},
-  { 69, {-57.158,  -3.000}, 20461, 20261, 20361, 20061, 20161, {70,60,59,68}},
-  { 70, {-57.158,  -9.000}, 20462, 20262, 20362, 20062, 20162, {71,61,60,69}},
-  { 71, {-57.158, -15.000}, 20463, 20263, 20363, 20063, 20163, {72,62,61,70}},
-  { 72, {-57.158, -21.000}, 20464, 20264, 20364, 20064, 20164, {63,62,71}},
-  { 85, {-15.588,  -9.000}, 21404, 21204, 21304, 21004, 21104, {80,78,14,18,88,89,86}},
-  { 86, {-10.392, -12.000}, 21405, 21205, 21305, 21005, 21105, {84,82,79,80,85,89,90,87}},
-  { 87, { -5.196, -15.000}, 21406, 21206, 21306, 21006, 21106, {153,151,83,84,86,90,91,158}},
-  { 88, {-20.785, -12.000}, 21407, 21207, 21307, 21007, 21107, {93,89,85,18,23,92}},
-  { 89, {-15.588, -15.000}, 21408, 21208, 21308, 21008, 21108, {94,90,86,85,88,93}},
-  { 90, {-10.392, -18.000}, 21409, 21209, 21309, 21009, 21109, {95,91,87,86,89,94}},
-  { 91, { -5.196, -21.000}, 21410, 21210, 21310, 21010, 21110, {96,161,158,87,90,95}},
-  { 92, {-25.981, -15.000}, 21411, 21211, 21311, 21011, 21111, {98,93,88,23,29,97}},
-  { 93, {-20.785, -18.000}, 21412, 21212, 21312, 21012, 21112, {99,94,89,88,92,98}},
-  { 94, {-15.588, -21.000}, 21413, 21213, 21313, 21013, 21113, {100,95,90,89,93,99}},
-  { 95, {-10.392, -24.000}, 21414, 21214, 21314, 21014, 21114, {101,96,91,90,94,100}},
-  { 96, { -5.196, -27.000}, 21415, 21215, 21315, 21015, 21115, {102,165,161,91,95,101}},
-  { 97, {-31.177, -18.000}, 21416, 21216, 21316, 21016, 21116, {104,98,92,29,36,103}},
-  { 98, {-25.981, -21.000}, 21417, 21217, 21317, 21017, 21117, {105,99,93,92,97,104}},
-  { 99, {-20.785, -24.000}, 21418, 21218, 21318, 21018, 21118, {106,100,94,93,98,105}},
-  {100, {-15.588, -27.000}, 21419, 21219, 21319, 21019, 21119, {107,101,95,94,99,106}},
-  {101, {-10.392, -30.000}, 21420, 21220, 21320, 21020, 21120, {108,102,96,95,100,107}},
-  {102, { -5.196, -33.000}, 21421, 21221, 21321, 21021, 21121, {109,170,165,96,101,108}},
-  {103, {-36.373, -21.000}, 21422, 21222, 21322, 21022, 21122, {111,104,97,36,44,110}},
-  {104, {-31.177, -24.000}, 21423, 21223, 21323, 21023, 21123, {112,105,98,97,103,111}},
-  {105, {-25.981, -27.000}, 21424, 21224, 21324, 21024, 21124, {113,106,99,98,104,112}},
-  {106, {-20.785, -30.000}, 21425, 21225, 21325, 21025, 21125, {114,107,100,99,105,113}},
-  {107, {-15.588, -33.000}, 21426, 21226, 21326, 21026, 21126, {115,108,101,100,106,114}},
-  {108, {-10.392, -36.000}, 21427, 21227, 21327, 21027, 21127, {116,109,102,101,107,115}},
-  {109, { -5.196, -39.000}, 21428, 21228, 21328, 21028, 21128, {117,176,170,102,108,116}},
-  {110, {-41.569, -24.000}, 21429, 21229, 21329, 21029, 21129, {119,111,103,44,53,118}},
-  {111, {-36.373, -27.000}, 21430, 21230, 21330, 21030, 21130, {120,112,104,103,110,119}},
-  {112, {-31.177, -30.000}, 21431, 21231, 21331, 21031, 21131, {121,113,105,104,111,120}},
-  {113, {-25.981, -33.000}, 21432, 21232, 21332, 21032, 21132, {122,114,106,105,112,121}},
-  {114, {-20.785, -36.000}, 21433, 21233, 21333, 21033, 21133, {123,115,107,106,113,122}},
-  {115, {-15.588, -39.000}, 21434, 21234, 21334, 21034, 21134, {124,116,108,107,114,123}},
-  {116, {-10.392, -42.000}, 21435, 21235, 21335, 21035, 21135, {125,117,109,108,115,124}},
-  {117, { -5.196, -45.000}, 21436, 21236, 21336, 21036, 21136, {126,183,176,109,116,125}},
-  {118, {-46.765, -27.000}, 21437, 21237, 21337, 21037, 21137, {128,119,110,53,63,127}},
-  {119, {-41.569, -30.000}, 21438, 21238, 21338, 21038, 21138, {129,120,111,110,118,128}},
-  {120, {-36.373, -33.000}, 21439, 21239, 21339, 21039, 21139, {130,121,112,111,119,129}},
-  {121, {-31.177, -36.000}, 21440, 21240, 21340, 21040, 21140, {131,122,113,112,120,130}},
-  {122, {-25.981, -39.000}, 21441, 21241, 21341, 21041, 21141, {132,123,114,113,121,131}},
-  {123, {-20.785, -42.000}, 21442, 21242, 21342, 21042, 21142, {133,124,115,114,122,132}},
-  {124, {-15.588, -45.000}, 21443, 21243, 21343, 21043, 21143, {134,125,116,115,123,133}},
-  {125, {-10.392, -48.000}, 21444, 21244, 21344, 21044, 21144, {135,126,117,116,124,134}},
-  {126, { -5.196, -51.000}, 21445, 21245, 21345, 21045, 21145, {136,191,183,117,125,135}},
-  {127, {-51.962, -30.000}, 21446, 21246, 21346, 21046, 21146, {137,128,118,63}},
-  {128, {-46.765, -33.000}, 21447, 21247, 21347, 21047, 21147, {138,129,119,118,127,137}},
-  {129, {-41.569, -36.000}, 21448, 21248, 21348, 21048, 21148, {139,130,120,119,128,138}},
-  {130, {-36.373, -39.000}, 21449, 21249, 21349, 21049, 21149, {140,131,121,120,129,139}},
-  {131, {-31.177, -42.000}, 21450, 21250, 21350, 21050, 21150, {141,132,122,121,130,140}},
-  {132, {-25.981, -45.000}, 21451, 21251, 21351, 21051, 21151, {142,133,123,122,131,141}},
-  {133, {-20.785, -48.000}, 21452, 21252, 21352, 21052, 21152, {143,134,124,123,132,142}},
-  {134, {-15.588, -51.000}, 21453, 21253, 21353, 21053, 21153, {144,135,125,124,133,143}},
-  {135, {-10.392, -54.000}, 21454, 21254, 21354, 21054, 21154, {145,136,126,125,134,144}},
-  {136, { -5.196, -57.000}, 21455, 21255, 21355, 21055, 21155, {200,191,126,135,145}},
-  {137, {-51.962, -36.000}, 21456, 21256, 21356, 21056, 21156, {138,128,127}},
-  {138, {-46.765, -39.000}, 21457, 21257, 21357, 21057, 21157, {139,129,128,137}},
-  {139, {-41.569, -42.000}, 21458, 21258, 21358, 21058, 21158, {140,130,129,138}},
-  {140, {-36.373, -45.000}, 21459, 21259, 21359, 21059, 21159, {141,131,130,139}},
-  {141, {-31.177, -48.000}, 21460, 21260, 21360, 21060, 21160, {142,132,131,140}},
-  {142, {-25.981, -51.000}, 21461, 21261, 21361, 21061, 21161, {143,133,132,141}},
-  {143, {-20.785, -54.000}, 21462, 21262, 21362, 21062, 21162, {144,134,133,142}},
-  {144, {-15.588, -57.000}, 21463, 21263, 21363, 21063, 21163, {145,135,134,143}},
-  {145, {-10.392, -60.000}, 21464, 21264, 21364, 21064, 21164, {136,135,144}},
-  {158, {  0.000, -18.000}, 22404, 22204, 22304, 22004, 22104, {159,152,153,87,91,161,162}},
-  {159, {  5.196, -15.000}, 22405, 22205, 22305, 22005, 22105, {160,156,157,150,152,158,162,163}},
-  {160, { 10.392, -12.000}, 22406, 22206, 22306, 22006, 22106, {231,225,226,154,156,159,163,164}},
-  {161, {  0.000, -24.000}, 22407, 22207, 22307, 22007, 22107, {165,166,162,158,91,96}},
-  {162, {  5.196, -21.000}, 22408, 22208, 22308, 22008, 22108, {166,167,163,159,158,161}},
-  {163, { 10.392, -18.000}, 22409, 22209, 22309, 22009, 22109, {167,168,164,160,159,162}},
-  {164, { 15.588, -15.000}, 22410, 22210, 22310, 22010, 22110, {168,169,234,231,160,163}},
-  {165, {  0.000, -30.000}, 22411, 22211, 22311, 22011, 22111, {170,171,166,161,96,102}},
-  {166, {  5.196, -27.000}, 22412, 22212, 22312, 22012, 22112, {171,172,167,162,161,165}},
-  {167, { 10.392, -24.000}, 22413, 22213, 22313, 22013, 22113, {172,173,168,163,162,166}},
-  {168, { 15.588, -21.000}, 22414, 22214, 22314, 22014, 22114, {173,174,169,164,163,167}},
-  {169, { 20.785, -18.000}, 22415, 22215, 22315, 22015, 22115, {174,175,238,234,164,168}},
-  {170, {  0.000, -36.000}, 22416, 22216, 22316, 22016, 22116, {176,177,171,165,102,109}},
-  {171, {  5.196, -33.000}, 22417, 22217, 22317, 22017, 22117, {177,178,172,166,165,170}},
-  {172, { 10.392, -30.000}, 22418, 22218, 22318, 22018, 22118, {178,179,173,167,171,166}},
-  {173, { 15.588, -27.000}, 22419, 22219, 22319, 22019, 22119, {179,180,174,168,172,167}},
-  {174, { 20.785, -24.000}, 22420, 22220, 22320, 22020, 22120, {180,181,175,169,173,168}},
-  {175, { 25.981, -21.000}, 22421, 22221, 22321, 22021, 22121, {181,182,243,238,169,174}},
-  {176, {  0.000, -42.000}, 22422, 22222, 22322, 22022, 22122, {183,184,177,170,109,117}},
-  {177, {  5.196, -39.000}, 22423, 22223, 22323, 22023, 22123, {184,185,178,171,170,176}},
-  {178, { 10.392, -36.000}, 22424, 22224, 22324, 22024, 22124, {185,186,179,172,171,177}},
-  {179, { 15.588, -33.000}, 22425, 22225, 22325, 22025, 22125, {186,187,180,173,172,178}},
-  {180, { 20.785, -30.000}, 22426, 22226, 22326, 22026, 22126, {187,188,181,174,173,179}},
-  {181, { 25.981, -27.000}, 22427, 22227, 22327, 22027, 22127, {188,189,182,175,174,180}},
-  {182, { 31.177, -24.000}, 22428, 22228, 22328, 22028, 22128, {189,190,249,243,175,181}},
-  {183, {  0.000, -48.000}, 22429, 22229, 22329, 22029, 22129, {191,192,184,176,117,126}},
-  {184, {  5.196, -45.000}, 22430, 22230, 22330, 22030, 22130, {192,193,185,177,176,183}},
-  {185, { 10.392, -42.000}, 22431, 22231, 22331, 22031, 22131, {193,194,186,178,177,184}},
-  {186, { 15.588, -39.000}, 22432, 22232, 22332, 22032, 22132, {194,195,187,179,178,185}},
-  {187, { 20.785, -36.000}, 22433, 22233, 22333, 22033, 22133, {195,196,188,180,179,186}},
-  {188, { 25.981, -33.000}, 22434, 22234, 22334, 22034, 22134, {196,197,189,181,180,187}},
-  {189, { 31.177, -30.000}, 22435, 22235, 22335, 22035, 22135, {197,198,190,182,181,188}},
-  {190, { 36.373, -27.000}, 22436, 22236, 22336, 22036, 22136, {198,199,256,249,182,189}},
-  {191, {  0.000, -54.000}, 22437, 22237, 22337, 22037, 22137, {200,201,192,183,126,136}},
-  {192, {  5.196, -51.000}, 22438, 22238, 22338, 22038, 22138, {201,202,193,184,183,191}},
-  {193, { 10.392, -48.000}, 22439, 22239, 22339, 22039, 22139, {202,203,194,185,184,192}},
-  {194, { 15.588, -45.000}, 22440, 22240, 22340, 22040, 22140, {203,204,195,186,185,193}},
-  {195, { 20.785, -42.000}, 22441, 22241, 22341, 22041, 22141, {204,205,196,187,186,194}},
-  {196, { 25.981, -39.000}, 22442, 22242, 22342, 22042, 22142, {205,206,197,188,187,195}},
-  {197, { 31.177, -36.000}, 22443, 22243, 22343, 22043, 22143, {206,207,198,189,188,196}},
-  {198, { 36.373, -33.000}, 22444, 22244, 22344, 22044, 22144, {207,208,199,190,189,197}},
-  {199, { 41.569, -30.000}, 22445, 22245, 22345, 22045, 22145, {208,209,264,256,190,198}},
-  {200, {  0.000, -60.000}, 22446, 22246, 22346, 22046, 22146, {201,191,136}},
-  {201, {  5.196, -57.000}, 22447, 22247, 22347, 22047, 22147, {210,202,192,191,200}},
-  {202, { 10.392, -54.000}, 22448, 22248, 22348, 22048, 22148, {210,211,203,193,192,201}},
-  {203, { 15.588, -51.000}, 22449, 22249, 22349, 22049, 22149, {211,212,204,194,193,202}},
-  {204, { 20.785, -48.000}, 22450, 22250, 22350, 22050, 22150, {212,213,205,195,194,203}},
-  {205, { 25.981, -45.000}, 22451, 22251, 22351, 22051, 22151, {213,214,206,196,195,204}},
-  {206, { 31.177, -42.000}, 22452, 22252, 22352, 22052, 22152, {214,215,207,197,196,205}},
-  {207, { 36.373, -39.000}, 22453, 22253, 22353, 22053, 22153, {215,216,208,198,197,206}},
-  {208, { 41.569, -36.000}, 22454, 22254, 22354, 22054, 22154, {216,217,209,199,198,207}},
-  {209, { 46.765, -33.000}, 22455, 22255, 22355, 22055, 22155, {217,218,273,264,199,208}},
-  {210, { 10.392, -60.000}, 22456, 22256, 22356, 22056, 22156, {211,202,201}},
-  {211, { 15.588, -57.000}, 22457, 22257, 22357, 22057, 22157, {212,203,202,210}},
-  {212, { 20.785, -54.000}, 22458, 22258, 22358, 22058, 22158, {213,204,203,211}},
-  {213, { 25.981, -51.000}, 22459, 22259, 22359, 22059, 22159, {214,205,204,212}},
-  {214, { 31.177, -48.000}, 22460, 22260, 22360, 22060, 22160, {215,206,205,213}},
-  {215, { 36.373, -45.000}, 22461, 22261, 22361, 22061, 22161, {216,207,206,214}},
-  {216, { 41.569, -42.000}, 22462, 22262, 22362, 22062, 22162, {217,208,207,215}},
-  {217, { 46.765, -39.000}, 22463, 22263, 22363, 22063, 22163, {218,209,208,216}},
-  {218, { 51.962, -36.000}, 22464, 22264, 22364, 22064, 22164, {273,209,217}},
-  {231, { 15.588,  -9.000}, 23404, 23204, 23304, 23004, 23104, {234,235,232,223,225,160,164}},
-  {232, { 15.588,  -3.000}, 23405, 23205, 23305, 23005, 23105, {235,236,233,227,229,223,225,231}},
-  {233, { 15.588,   3.000}, 23406, 23206, 23306, 23006, 23106, {236,237,304,296,298,227,229,232}},
-  {234, { 20.785, -12.000}, 23407, 23207, 23307, 23007, 23107, {169,238,239,235,231,164}},
-  {235, { 20.785,  -6.000}, 23408, 23208, 23308, 23008, 23108, {234,239,240,236,232,231}},
-  {236, { 20.785,   0.000}, 23409, 23209, 23309, 23009, 23109, {235,240,241,237,233,232}},
-  {237, { 20.785,   6.000}, 23410, 23210, 23310, 23010, 23110, {236,241,242,307,304,233}},
-  {238, { 25.981, -15.000}, 23411, 23211, 23311, 23011, 23111, {175,243,244,239,234,169}},
-  {239, { 25.981,  -9.000}, 23412, 23212, 23312, 23012, 23112, {238,244,245,240,235,234}},
-  {240, { 25.981,  -3.000}, 23413, 23213, 23313, 23013, 23113, {239,245,246,241,236,235}},
-  {241, { 25.981,   3.000}, 23414, 23214, 23314, 23014, 23114, {240,246,247,242,237,236}},
-  {242, { 25.981,   9.000}, 23415, 23215, 23315, 23015, 23115, {241,247,248,311,307,237}},
-  {243, { 31.177, -18.000}, 23416, 23216, 23316, 23016, 23116, {182,249,250,244,238,175}},
-  {244, { 31.177, -12.000}, 23417, 23217, 23317, 23017, 23117, {243,250,251,245,239,238}},
-  {245, { 31.177,  -6.000}, 23418, 23218, 23318, 23018, 23118, {244,251,252,246,240,239}},
-  {246, { 31.177,   0.000}, 23419, 23219, 23319, 23019, 23119, {245,252,253,247,241,240}},
-  {247, { 31.177,   6.000}, 23420, 23220, 23320, 23020, 23120, {246,253,254,248,242,241}},
-  {248, { 31.177,  12.000}, 23421, 23221, 23321, 23021, 23121, {247,254,255,316,311,242}},
-  {249, { 36.373, -21.000}, 23422, 23222, 23322, 23022, 23122, {190,256,257,250,243,182}},
-  {250, { 36.373, -15.000}, 23423, 23223, 23323, 23023, 23123, {249,257,258,251,244,243}},
-  {251, { 36.373,  -9.000}, 23424, 23224, 23324, 23024, 23124, {250,258,259,252,245,244}},
-  {252, { 36.373,  -3.000}, 23425, 23225, 23325, 23025, 23125, {251,259,260,253,246,245}},
-  {253, { 36.373,   3.000}, 23426, 23226, 23326, 23026, 23126, {252,260,261,254,247,246}},
-  {254, { 36.373,   9.000}, 23427, 23227, 23327, 23027, 23127, {253,261,262,255,248,247}},
-  {255, { 36.373,  15.000}, 23428, 23228, 23328, 23028, 23128, {254,262,263,322,316,248}},
-  {256, { 41.569, -24.000}, 23429, 23229, 23329, 23029, 23129, {199,264,265,257,249,190}},
-  {257, { 41.569, -18.000}, 23430, 23230, 23330, 23030, 23130, {256,265,266,258,250,249}},
-  {258, { 41.569, -12.000}, 23431, 23231, 23331, 23031, 23131, {257,266,267,259,251,250}},
-  {259, { 41.569,  -6.000}, 23432, 23232, 23332, 23032, 23132, {258,267,268,260,252,251}},
-  {260, { 41.569,   0.000}, 23433, 23233, 23333, 23033, 23133, {259,268,269,261,253,252}},
-  {261, { 41.569,   6.000}, 23434, 23234, 23334, 23034, 23134, {260,269,270,262,254,253}},
-  {262, { 41.569,  12.000}, 23435, 23235, 23335, 23035, 23135, {261,270,271,263,255,254}},
-  {263, { 41.569,  18.000}, 23436, 23236, 23336, 23036, 23136, {262,271,272,329,322,255}},
-  {264, { 46.765, -27.000}, 23437, 23237, 23337, 23037, 23137, {209,273,274,265,256,199}},
-  {265, { 46.765, -21.000}, 23438, 23238, 23338, 23038, 23138, {264,274,275,266,257,256}},
-  {266, { 46.765, -15.000}, 23439, 23239, 23339, 23039, 23139, {265,275,276,267,258,257}},
-  {267, { 46.765,  -9.000}, 23440, 23240, 23340, 23040, 23140, {266,276,277,268,259,258}},
-  {268, { 46.765,  -3.000}, 23441, 23241, 23341, 23041, 23141, {267,277,278,269,260,259}},
-  {269, { 46.765,   3.000}, 23442, 23242, 23342, 23042, 23142, {268,278,279,270,261,260}},
-  {270, { 46.765,   9.000}, 23443, 23243, 23343, 23043, 23143, {269,279,280,271,262,261}},
-  {271, { 46.765,  15.000}, 23444, 23244, 23344, 23044, 23144, {270,280,281,272,263,262}},
-  {272, { 46.765,  21.000}, 23445, 23245, 23345, 23045, 23145, {271,281,282,337,329,263}},
-  {273, { 51.962, -30.000}, 23446, 23246, 23346, 23046, 23146, {283,274,264,209,218}},
-  {274, { 51.962, -24.000}, 23447, 23247, 23347, 23047, 23147, {273,283,284,275,265,264}},
-  {275, { 51.962, -18.000}, 23448, 23248, 23348, 23048, 23148, {274,284,285,276,266,265}},
-  {276, { 51.962, -12.000}, 23449, 23249, 23349, 23049, 23149, {275,285,286,277,267,266}},
-  {277, { 51.962,  -6.000}, 23450, 23250, 23350, 23050, 23150, {276,286,287,278,268,267}},
-  {278, { 51.962,   0.000}, 23451, 23251, 23351, 23051, 23151, {277,287,288,279,269,268}},
-  {279, { 51.962,   6.000}, 23452, 23252, 23352, 23052, 23152, {278,288,289,280,270,269}},
-  {280, { 51.962,  12.000}, 23453, 23253, 23353, 23053, 23153, {279,289,290,281,271,270}},
-  {281, { 51.962,  18.000}, 23454, 23254, 23354, 23054, 23154, {280,290,291,282,272,271}},
-  {282, { 51.962,  24.000}, 23455, 23255, 23355, 23055, 23155, {281,291,346,337,272}},
-  {283, { 57.158, -27.000}, 23456, 23256, 23356, 23056, 23156, {273,274,284}},
-  {284, { 57.158, -21.000}, 23457, 23257, 23357, 23057, 23157, {283,285,275,274}},
-  {285, { 57.158, -15.000}, 23458, 23258, 23358, 23058, 23158, {284,286,276,275}},
-  {286, { 57.158,  -9.000}, 23459, 23259, 23359, 23059, 23159, {285,287,277,276}},
-  {287, { 57.158,  -3.000}, 23460, 23260, 23360, 23060, 23160, {286,288,278,277}},
-  {288, { 57.158,   3.000}, 23461, 23261, 23361, 23061, 23161, {287,289,279,278}},
-  {289, { 57.158,   9.000}, 23462, 23262, 23362, 23062, 23162, {288,290,280,279}},
-  {290, { 57.158,  15.000}, 23463, 23263, 23363, 23063, 23163, {289,291,281,280}},
-  {291, { 57.158,  21.000}, 23464, 23264, 23364, 23064, 23164, {290,282,281}},
-  {304, { 15.588,   9.000}, 24404, 24204, 24304, 24004, 24104, {237,307,308,305,296,298,233}},
-  {305, { 10.392,  12.000}, 24405, 24205, 24305, 24005, 24105, {304,308,309,306,300,302,297,296}},
-  {306, {  5.196,  15.000}, 24406, 24206, 24306, 24006, 24106, {305,309,310,377,369,371,301,300}},
-  {307, { 20.785,  12.000}, 24407, 24207, 24307, 24007, 24107, {237,242,311,312,308,304}},
-  {308, { 15.588,  15.000}, 24408, 24208, 24308, 24008, 24108, {304,307,312,313,309,305}},
-  {309, { 10.392,  18.000}, 24409, 24209, 24309, 24009, 24109, {305,308,313,314,310,306}},
-  {310, {  5.196,  21.000}, 24410, 24210, 24310, 24010, 24110, {306,309,314,315,380,377}},
-  {311, { 25.981,  15.000}, 24411, 24211, 24311, 24011, 24111, {242,248,316,317,312,307}},
-  {312, { 20.785,  18.000}, 24412, 24212, 24312, 24012, 24112, {307,311,317,318,313,308}},
-  {313, { 15.588,  21.000}, 24413, 24213, 24313, 24013, 24113, {308,312,318,319,314,309}},
-  {314, { 10.392,  24.000}, 24414, 24214, 24314, 24014, 24114, {309,313,319,320,315,310}},
-  {315, {  5.196,  27.000}, 24415, 24215, 24315, 24015, 24115, {310,314,320,321,384,380}},
-  {316, { 31.177,  18.000}, 24416, 24216, 24316, 24016, 24116, {248,255,322,323,317,311}},
-  {317, { 25.981,  21.000}, 24417, 24217, 24317, 24017, 24117, {311,316,323,324,318,312}},
-  {318, { 20.785,  24.000}, 24418, 24218, 24318, 24018, 24118, {312,317,324,325,319,313}},
-  {319, { 15.588,  27.000}, 24419, 24219, 24319, 24019, 24119, {313,318,325,326,320,314}},
-  {320, { 10.392,  30.000}, 24420, 24220, 24320, 24020, 24120, {314,319,326,327,321,315}},
-  {321, {  5.196,  33.000}, 24421, 24221, 24321, 24021, 24121, {315,320,327,328,389,384}},
-  {322, { 36.373,  21.000}, 24422, 24222, 24322, 24022, 24122, {255,263,329,330,323,316}},
-  {323, { 31.177,  24.000}, 24423, 24223, 24323, 24023, 24123, {316,322,330,331,324,317}},
-  {324, { 25.981,  27.000}, 24424, 24224, 24324, 24024, 24124, {317,323,331,332,325,318}},
-  {325, { 20.785,  30.000}, 24425, 24225, 24325, 24025, 24125, {318,324,332,333,326,319}},
-  {326, { 15.588,  33.000}, 24426, 24226, 24326, 24026, 24126, {319,325,333,334,327,320}},
-  {327, { 10.392,  36.000}, 24427, 24227, 24327, 24027, 24127, {320,326,334,335,328,321}},
-  {328, {  5.196,  39.000}, 24428, 24228, 24328, 24028, 24128, {321,327,335,336,395,389}},
-  {329, { 41.569,  24.000}, 24429, 24229, 24329, 24029, 24129, {263,272,337,338,330,322}},
-  {330, { 36.373,  27.000}, 24430, 24230, 24330, 24030, 24130, {322,329,338,339,331,323}},
-  {331, { 31.177,  30.000}, 24431, 24231, 24331, 24031, 24131, {323,330,339,340,332,324}},
-  {332, { 25.981,  33.000}, 24432, 24232, 24332, 24032, 24132, {324,331,340,341,333,325}},
-  {333, { 20.785,  36.000}, 24433, 24233, 24333, 24033, 24133, {325,332,341,342,334,326}},
-  {334, { 15.588,  39.000}, 24434, 24234, 24334, 24034, 24134, {326,333,342,343,335,327}},
-  {335, { 10.392,  42.000}, 24435, 24235, 24335, 24035, 24135, {327,334,343,344,336,328}},
-  {336, {  5.196,  45.000}, 24436, 24236, 24336, 24036, 24136, {328,335,344,345,402,395}},
-  {337, { 46.765,  27.000}, 24437, 24237, 24337, 24037, 24137, {272,282,346,347,338,329}},
-  {338, { 41.569,  30.000}, 24438, 24238, 24338, 24038, 24138, {329,337,347,348,339,330}},
-  {339, { 36.373,  33.000}, 24439, 24239, 24339, 24039, 24139, {330,338,348,349,340,331}},
-  {340, { 31.177,  36.000}, 24440, 24240, 24340, 24040, 24140, {331,339,349,350,341,332}},
-  {341, { 25.981,  39.000}, 24441, 24241, 24341, 24041, 24141, {332,340,350,351,342,333}},
-  {342, { 20.785,  42.000}, 24442, 24242, 24342, 24042, 24142, {333,341,351,352,343,334}},
-  {343, { 15.588,  45.000}, 24443, 24243, 24343, 24043, 24143, {334,342,352,353,344,335}},
-  {344, { 10.392,  48.000}, 24444, 24244, 24344, 24044, 24144, {335,343,353,354,345,336}},
-  {345, {  5.196,  51.000}, 24445, 24245, 24345, 24045, 24145, {336,344,354,355,410,402}},
-  {346, { 51.962,  30.000}, 24446, 24246, 24346, 24046, 24146, {282,356,347,337}},
-  {347, { 46.765,  33.000}, 24447, 24247, 24347, 24047, 24147, {337,346,356,357,348,338}},
-  {348, { 41.569,  36.000}, 24448, 24248, 24348, 24048, 24148, {338,347,357,358,349,339}},
-  {349, { 36.373,  39.000}, 24449, 24249, 24349, 24049, 24149, {339,348,358,359,350,340}},
-  {350, { 31.177,  42.000}, 24450, 24250, 24350, 24050, 24150, {340,349,359,360,351,341}},
-  {351, { 25.981,  45.000}, 24451, 24251, 24351, 24051, 24151, {341,350,360,361,352,342}},
-  {352, { 20.785,  48.000}, 24452, 24252, 24352, 24052, 24152, {342,351,361,362,353,343}},
-  {353, { 15.588,  51.000}, 24453, 24253, 24353, 24053, 24153, {343,352,362,363,354,344}},
-  {354, { 10.392,  54.000}, 24454, 24254, 24354, 24054, 24154, {344,353,363,364,355,345}},
-  {355, {  5.196,  57.000}, 24455, 24255, 24355, 24055, 24155, {345,354,364,419,410}},
-  {356, { 51.962,  36.000}, 24456, 24256, 24356, 24056, 24156, {346,357,347}},
-  {357, { 46.765,  39.000}, 24457, 24257, 24357, 24057, 24157, {356,347,348,358}},
-  {358, { 41.569,  42.000}, 24458, 24258, 24358, 24058, 24158, {357,348,349,359}},
-  {359, { 36.373,  45.000}, 24459, 24259, 24359, 24059, 24159, {358,349,350,360}},
-  {360, { 31.177,  48.000}, 24460, 24260, 24360, 24060, 24160, {359,350,351,361}},
-  {361, { 25.981,  51.000}, 24461, 24261, 24361, 24061, 24161, {360,351,352,362}},
-  {362, { 20.785,  54.000}, 24462, 24262, 24362, 24062, 24162, {361,352,353,363}},
-  {363, { 15.588,  57.000}, 24463, 24263, 24363, 24063, 24163, {362,353,354,364}},
-  {364, { 10.392,  60.000}, 24464, 24264, 24364, 24064, 24164, {363,354,355}},
-  {377, {  0.000,  18.000}, 25404, 25204, 25304, 25004, 25104, {306,310,380,381,378,370,369}},
-  {378, { -5.196,  15.000}, 25405, 25205, 25305, 25005, 25105, {370,377,381,382,379,374,373,372}},
-  {379, {-10.392,  12.000}, 25406, 25206, 25306, 25006, 25106, {374,378,382,383,12,5,4,376}},
-  {380, {  0.000,  24.000}, 25407, 25207, 25307, 25007, 25107, {377,310,315,384,385,381}},
-  {381, { -5.196,  21.000}, 25408, 25208, 25308, 25008, 25108, {378,377,380,385,386,382}},
-  {382, {-10.392,  18.000}, 25409, 25209, 25309, 25009, 25109, {379,378,381,386,387,383}},
-  {383, {-15.588,  15.000}, 25410, 25210, 25310, 25010, 25110, {12,379,382,387,388,15}},
-  {384, {  0.000,  30.000}, 25411, 25211, 25311, 25011, 25111, {380,315,321,389,390,385}},
-  {385, { -5.196,  27.000}, 25412, 25212, 25312, 25012, 25112, {381,380,384,390,391,386}},
-  {386, {-10.392,  24.000}, 25413, 25213, 25313, 25013, 25113, {382,381,385,391,392,387}},
-  {387, {-15.588,  21.000}, 25414, 25214, 25314, 25014, 25114, {383,382,386,392,393,388}},
-  {388, {-20.785,  18.000}, 25415, 25215, 25315, 25015, 25115, {15,383,387,393,394,19}},
-  {389, {  0.000,  36.000}, 25416, 25216, 25316, 25016, 25116, {384,321,328,395,396,390}},
-  {390, { -5.196,  33.000}, 25417, 25217, 25317, 25017, 25117, {385,384,389,396,397,391}},
-  {391, {-10.392,  30.000}, 25418, 25218, 25318, 25018, 25118, {386,385,390,397,398,392}},
-  {392, {-15.588,  27.000}, 25419, 25219, 25319, 25019, 25119, {387,386,391,398,399,393}},
-  {393, {-20.785,  24.000}, 25420, 25220, 25320, 25020, 25120, {388,387,392,399,400,394}},
-  {394, {-25.981,  21.000}, 25421, 25221, 25321, 25021, 25121, {19,388,393,400,401,24}},
-  {395, {  0.000,  42.000}, 25422, 25222, 25322, 25022, 25122, {389,328,336,402,403,396}},
-  {396, { -5.196,  39.000}, 25423, 25223, 25323, 25023, 25123, {390,389,395,403,404,397}},
-  {397, {-10.392,  36.000}, 25424, 25224, 25324, 25024, 25124, {391,390,396,404,405,398}},
-  {398, {-15.588,  33.000}, 25425, 25225, 25325, 25025, 25125, {392,391,397,405,406,399}},
-  {399, {-20.785,  30.000}, 25426, 25226, 25326, 25026, 25126, {393,392,398,406,407,400}},
-  {400, {-25.981,  27.000}, 25427, 25227, 25327, 25027, 25127, {394,393,399,407,408,401}},
-  {401, {-31.177,  24.000}, 25428, 25228, 25328, 25028, 25128, {24,394,400,408,409,30}},
-  {402, {  0.000,  48.000}, 25429, 25229, 25329, 25029, 25129, {395,336,345,410,411,403}},
-  {403, { -5.196,  45.000}, 25430, 25230, 25330, 25030, 25130, {396,395,402,411,412,404}},
-  {404, {-10.392,  42.000}, 25431, 25231, 25331, 25031, 25131, {397,396,403,412,413,405}},
-  {405, {-15.588,  39.000}, 25432, 25232, 25332, 25032, 25132, {398,397,404,413,414,406}},
-  {406, {-20.785,  36.000}, 25433, 25233, 25333, 25033, 25133, {399,398,405,414,415,407}},
-  {407, {-25.981,  33.000}, 25434, 25234, 25334, 25034, 25134, {400,399,406,415,416,408}},
-  {408, {-31.177,  30.000}, 25435, 25235, 25335, 25035, 25135, {401,400,407,416,417,409}},
-  {409, {-36.373,  27.000}, 25436, 25236, 25336, 25036, 25136, {30,401,408,417,418,37}},
-  {410, {  0.000,  54.000}, 25437, 25237, 25337, 25037, 25137, {402,345,355,419,420,411}},
-  {411, { -5.196,  51.000}, 25438, 25238, 25338, 25038, 25138, {403,402,410,420,421,412}},
-  {412, {-10.392,  48.000}, 25439, 25239, 25339, 25039, 25139, {404,403,411,421,422,413}},
-  {413, {-15.588,  45.000}, 25440, 25240, 25340, 25040, 25140, {405,404,412,422,423,414}},
-  {414, {-20.785,  42.000}, 25441, 25241, 25341, 25041, 25141, {406,405,413,423,424,415}},
-  {415, {-25.981,  39.000}, 25442, 25242, 25342, 25042, 25142, {407,406,414,424,425,416}},
-  {416, {-31.177,  36.000}, 25443, 25243, 25343, 25043, 25143, {408,407,415,425,426,417}},
-  {417, {-36.373,  33.000}, 25444, 25244, 25344, 25044, 25144, {409,408,416,426,427,418}},
-  {418, {-41.569,  30.000}, 25445, 25245, 25345, 25045, 25145, {37,409,417,427,428,45}},
-  {419, {  0.000,  60.000}, 25446, 25246, 25346, 25046, 25146, {355,410,420}},
-  {420, { -5.196,  57.000}, 25447, 25247, 25347, 25047, 25147, {419,410,411,421,429}},
-  {421, {-10.392,  54.000}, 25448, 25248, 25348, 25048, 25148, {412,411,420,429,430,422}},
-  {422, {-15.588,  51.000}, 25449, 25249, 25349, 25049, 25149, {413,412,421,430,431,423}},
-  {423, {-20.785,  48.000}, 25450, 25250, 25350, 25050, 25150, {414,413,422,431,432,424}},
-  {424, {-25.981,  45.000}, 25451, 25251, 25351, 25051, 25151, {415,414,423,432,433,425}},
-  {425, {-31.177,  42.000}, 25452, 25252, 25352, 25052, 25152, {416,415,424,433,434,426}},
-  {426, {-36.373,  39.000}, 25453, 25253, 25353, 25053, 25153, {417,416,425,434,435,427}},
-  {427, {-41.569,  36.000}, 25454, 25254, 25354, 25054, 25154, {418,417,426,435,436,428}},
-  {428, {-46.765,  33.000}, 25455, 25255, 25355, 25055, 25155, {45,418,427,436,437,54}},
-  {429, {-10.392,  60.000}, 25456, 25256, 25356, 25056, 25156, {420,421,430}},
-  {430, {-15.588,  57.000}, 25457, 25257, 25357, 25057, 25157, {429,421,422,431}},
-  {431, {-20.785,  54.000}, 25458, 25258, 25358, 25058, 25158, {430,422,423,432}},
-  {432, {-25.981,  51.000}, 25459, 25259, 25359, 25059, 25159, {431,423,424,433}},
-  {433, {-31.177,  48.000}, 25460, 25260, 25360, 25060, 25160, {432,424,425,434}},
-  {434, {-36.373,  45.000}, 25461, 25261, 25361, 25061, 25161, {433,425,426,435}},
-  {435, {-41.569,  42.000}, 25462, 25262, 25362, 25062, 25162, {434,426,427,436}},
-  {436, {-46.765,  39.000}, 25463, 25263, 25363, 25063, 25163, {435,427,428,437}},
-  {437, {-51.962,  36.000}, 25464, 25264, 25364, 25064, 25164, {436,428,54}},
+constexpr ant::expconfig::detector::TAPS::BaF2_row_t
+ant::expconfig::detector::TAPS_2009_03::BaF2_table[] = {
+  // element, {xy}, TAC, LG, SG, LGS, SGS, neighbours begin/end in BaF2_neighbours
+  { 12, {-15.588,   9.000}, 20404, 20204, 20304, 20004, 20104,    0,    7},
+  { 13, {-15.588,   3.000}, 20405, 20205, 20305, 20005, 20105,    7,   15},
+  { 14, {-15.588,  -3.000}, 20406, 20206, 20306, 20006, 20106,   15,   23},
+  { 15, {-20.785,  12.000}, 20407, 20207, 20307, 20007, 20107,   23,   29},
+  { 16, {-20.785,   6.000}, 20408, 20208, 20308, 20008, 20108,   29,   35},
+  { 17, {-20.785,   0.000}, 20409, 20209, 20309, 20009, 20109,   35,   41},
+  { 18, {-20.785,  -6.000}, 20410, 20210, 20310, 20010, 20110,   41,   47},
+  { 19, {-25.981,  15.000}, 20411, 20211, 20311, 20011, 20111,   47,   53},
+  { 20, {-25.981,   9.000}, 20412, 20212, 20312, 20012, 20112,   53,   59},
+  { 21, {-25.981,   3.000}, 20413, 20213, 20313, 20013, 20113,   59,   65},
+  { 22, {-25.981,  -3.000}, 20414, 20214, 20314, 20014, 20114,   65,   71},
+  { 23, {-25.981,  -9.000}, 20415, 20215, 20315, 20015, 20115,   71,   77},
+  { 24, {-31.177,  18.000}, 20416, 20216, 20316, 20016, 20116,   77,   83},
+  { 25, {-31.177,  12.000}, 20417, 20217, 20317, 20017, 20117,   83,   89},
+  { 26, {-31.177,   6.000}, 20418, 20218, 20318, 20018, 20118,   89,   95},
+  { 27, {-31.177,   0.000}, 20419, 20219, 20319, 20019, 20119,   95,  101},
+  { 28, {-31.177,  -6.000}, 20420, 20220, 20320, 20020, 20120,  101,  107},
+  { 29, {-31.177, -12.000}, 20421, 20221, 20321, 20021, 20121,  107,  113},
+  { 30, {-36.373,  21.000}, 20422, 20222, 20322, 20022, 20122,  113,  119},
+  { 31, {-36.373,  15.000}, 20423, 20223, 20323, 20023, 20123,  119,  125},
+  { 32, {-36.373,   9.000}, 20424, 20224, 20324, 20024, 20124,  125,  131},
+  { 33, {-36.373,   3.000}, 20425, 20225, 20325, 20025, 20125,  131,  137},
+  { 34, {-36.373,  -3.000}, 20426, 20226, 20326, 20026, 20126,  137,  143},
+  { 35, {-36.373,  -9.000}, 20427, 20227, 20327, 20027, 20127,  143,  149},
+  { 36, {-36.373, -15.000}, 20428, 20228, 20328, 20028, 20128,  149,  155},
+  { 37, {-41.569,  24.000}, 20429, 20229, 20329, 20029, 20129,  155,  161},
+  { 38, {-41.569,  18.000}, 20430, 20230, 20330, 20030, 20130,  161,  167},
+  { 39, {-41.569,  12.000}, 20431, 20231, 20331, 20031, 20131,  167,  173},
+  { 40, {-41.569,   6.000}, 20432, 20232, 20332, 20032, 20132,  173,  179},
+  { 41, {-41.569,   0.000}, 20433, 20233, 20333, 20033, 20133,  179,  185},
+  { 42, {-41.569,  -6.000}, 20434, 20234, 20334, 20034, 20134,  185,  191},
+  { 43, {-41.569, -12.000}, 20435, 20235, 20335, 20035, 20135,  191,  197},
+  { 44, {-41.569, -18.000}, 20436, 20236, 20336, 20036, 20136,  197,  203},
+  { 45, {-46.765,  27.000}, 20437, 20237, 20337, 20037, 20137,  203,  209},
+  { 46, {-46.765,  21.000}, 20438, 20238, 20338, 20038, 20138,  209,  215},
+  { 47, {-46.765,  15.000}, 20439, 20239, 20339, 20039, 20139,  215,  221},
+  { 48, {-46.765,   9.000}, 20440, 20240, 20340, 20040, 20140,  221,  227},
+  { 49, {-46.765,   3.000}, 20441, 20241, 20341, 20041, 20141,  227,  233},
+  { 50, {-46.765,  -3.000}, 20442, 20242, 20342, 20042, 20142,  233,  239},
+  { 51, {-46.765,  -9.000}, 20443, 20243, 20343, 20043, 20143,  239,  245},
+  { 52, {-46.765, -15.000}, 20444, 20244, 20344, 20044, 20144,  245,  251},
+  { 53, {-46.765, -21.000}, 20445, 20245, 20345, 20045, 20145,  251,  257},
+  { 54, {-51.962,  30.000}, 20446, 20246, 20346, 20046, 20146,  257,  262},
+  { 55, {-51.962,  24.000}, 20447, 20247, 20347, 20047, 20147,  262,  268},
+  { 56, {-51.962,  18.000}, 20448, 20248, 20348, 20048, 20148,  268,  274},
+  { 57, {-51.962,  12.000}, 20449, 20249, 20349, 20049, 20149,  274,  280},
+  { 58, {-51.962,   6.000}, 20450, 20250, 20350, 20050, 20150,  280,  286},
+  { 59, {-51.962,   0.000}, 20451, 20251, 20351, 20051, 20151,  286,  292},
+  { 60, {-51.962,  -6.000}, 20452, 20252, 20352, 20052, 20152,  292,  298},
+  { 61, {-51.962, -12.000}, 20453, 20253, 20353, 20053, 20153,  298,  304},
+  { 62, {-51.962, -18.000}, 20454, 20254, 20354, 20054, 20154,  304,  310},
+  { 63, {-51.962, -24.000}, 20455, 20255, 20355, 20055, 20155,  310,  315},
+  { 64, {-57.158,  27.000}, 20456, 20256, 20356, 20056, 20156,  315,  318},
+  { 65, {-57.158,  21.000}, 20457, 20257, 20357, 20057, 20157,  318,  322},
+  { 66, {-57.158,  15.000}, 20458, 20258, 20358, 20058, 20158,  322,  326},
+  { 67, {-57.158,   9.000}, 20459, 20259, 20359, 20059, 20159,  326,  330},
+  { 68, {-57.158,   3.000}, 20460, 20260, 20360, 20060, 20160,  330,  334},
+  { 69, {-57.158,  -3.000}, 20461, 20261, 20361, 20061, 20161,  334,  338},
+  { 70, {-57.158,  -9.000}, 20462, 20262, 20362, 20062, 20162,  338,  342},
+  { 71, {-57.158, -15.000}, 20463, 20263, 20363, 20063, 20163,  342,  346},
+  { 72, {-57.158, -21.000}, 20464, 20264, 20364, 20064, 20164,  346,  349},
+  { 85, {-15.588,  -9.000}, 21404, 21204, 21304, 21004, 21104,  349,  356},
+  { 86, {-10.392, -12.000}, 21405, 21205, 21305, 21005, 21105,  356,  364},
+  { 87, { -5.196, -15.000}, 21406, 21206, 21306, 21006, 21106,  364,  372},
+  { 88, {-20.785, -12.000}, 21407, 21207, 21307, 21007, 21107,  372,  378},
+  { 89, {-15.588, -15.000}, 21408, 21208, 21308, 21008, 21108,  378,  384},
+  { 90, {-10.392, -18.000}, 21409, 21209, 21309, 21009, 21109,  384,  390},
+  { 91, { -5.196, -21.000}, 21410, 21210, 21310, 21010, 21110,  390,  396},
+  { 92, {-25.981, -15.000}, 21411, 21211, 21311, 21011, 21111,  396,  402},
+  { 93, {-20.785, -18.000}, 21412, 21212, 21312, 21012, 21112,  402,  408},
+  { 94, {-15.588, -21.000}, 21413, 21213, 21313, 21013, 21113,  408,  414},
+  { 95, {-10.392, -24.000}, 21414, 21214, 21314, 21014, 21114,  414,  420},
+  { 96, { -5.196, -27.000}, 21415, 21215, 21315, 21015, 21115,  420,  426},
+  { 97, {-31.177, -18.000}, 21416, 21216, 21316, 21016, 21116,  426,  432},
+  { 98, {-25.981, -21.000}, 21417, 21217, 21317, 21017, 21117,  432,  438},
+  { 99, {-20.785, -24.000}, 21418, 21218, 21318, 21018, 21118,  438,  444},
+  {100, {-15.588, -27.000}, 21419, 21219, 21319, 21019, 21119,  444,  450},
+  {101, {-10.392, -30.000}, 21420, 21220, 21320, 21020, 21120,  450,  456},
+  {102, { -5.196, -33.000}, 21421, 21221, 21321, 21021, 21121,  456,  462},
+  {103, {-36.373, -21.000}, 21422, 21222, 21322, 21022, 21122,  462,  468},
+  {104, {-31.177, -24.000}, 21423, 21223, 21323, 21023, 21123,  468,  474},
+  {105, {-25.981, -27.000}, 21424, 21224, 21324, 21024, 21124,  474,  480},
+  {106, {-20.785, -30.000}, 21425, 21225, 21325, 21025, 21125,  480,  486},
+  {107, {-15.588, -33.000}, 21426, 21226, 21326, 21026, 21126,  486,  492},
+  {108, {-10.392, -36.000}, 21427, 21227, 21327, 21027, 21127,  492,  498},
+  {109, { -5.196, -39.000}, 21428, 21228, 21328, 21028, 21128,  498,  504},
+  {110, {-41.569, -24.000}, 21429, 21229, 21329, 21029, 21129,  504,  510},
+  {111, {-36.373, -27.000}, 21430, 21230, 21330, 21030, 21130,  510,  516},
+  {112, {-31.177, -30.000}, 21431, 21231, 21331, 21031, 21131,  516,  522},
+  {113, {-25.981, -33.000}, 21432, 21232, 21332, 21032, 21132,  522,  528},
+  {114, {-20.785, -36.000}, 21433, 21233, 21333, 21033, 21133,  528,  534},
+  {115, {-15.588, -39.000}, 21434, 21234, 21334, 21034, 21134,  534,  540},
+  {116, {-10.392, -42.000}, 21435, 21235, 21335, 21035, 21135,  540,  546},
+  {117, { -5.196, -45.000}, 21436, 21236, 21336, 21036, 21136,  546,  552},
+  {118, {-46.765, -27.000}, 21437, 21237, 21337, 21037, 21137,  552,  558},
+  {119, {-41.569, -30.000}, 21438, 21238, 21338, 21038, 21138,  558,  564},
+  {120, {-36.373, -33.000}, 21439, 21239, 21339, 21039, 21139,  564,  570},
+  {121, {-31.177, -36.000}, 21440, 21240, 21340, 21040, 21140,  570,  576},
+  {122, {-25.981, -39.000}, 21441, 21241, 21341, 21041, 21141,  576,  582},
+  {123, {-20.785, -42.000}, 21442, 21242, 21342, 21042, 21142,  582,  588},
+  {124, {-15.588, -45.000}, 21443, 21243, 21343, 21043, 21143,  588,  594},
+  {125, {-10.392, -48.000}, 21444, 21244, 21344, 21044, 21144,  594,  600},
+  {126, { -5.196, -51.000}, 21445, 21245, 21345, 21045, 21145,  600,  606},
+  {127, {-51.962, -30.000}, 21446, 21246, 21346, 21046, 21146,  606,  610},
+  {128, {-46.765, -33.000}, 21447, 21247, 21347, 21047, 21147,  610,  616},
+  {129, {-41.569, -36.000}, 21448, 21248, 21348, 21048, 21148,  616,  622},
+  {130, {-36.373, -39.000}, 21449, 21249, 21349, 21049, 21149,  622,  628},
+  {131, {-31.177, -42.000}, 21450, 21250, 21350, 21050, 21150,  628,  634},
+  {132, {-25.981, -45.000}, 21451, 21251, 21351, 21051, 21151,  634,  640},
+  {133, {-20.785, -48.000}, 21452, 21252, 21352, 21052, 21152,  640,  646},
+  {134, {-15.588, -51.000}, 21453, 21253, 21353, 21053, 21153,  646,  652},
+  {135, {-10.392, -54.000}, 21454, 21254, 21354, 21054, 21154,  652,  658},
+  {136, { -5.196, -57.000}, 21455, 21255, 21355, 21055, 21155,  658,  663},
+  {137, {-51.962, -36.000}, 21456, 21256, 21356, 21056, 21156,  663,  666},
+  {138, {-46.765, -39.000}, 21457, 21257, 21357, 21057, 21157,  666,  670},
+  {139, {-41.569, -42.000}, 21458, 21258, 21358, 21058, 21158,  670,  674},
+  {140, {-36.373, -45.000}, 21459, 21259, 21359, 21059, 21159,  674,  678},
+  {141, {-31.177, -48.000}, 21460, 21260, 21360, 21060, 21160,  678,  682},
+  {142, {-25.981, -51.000}, 21461, 21261, 21361, 21061, 21161,  682,  686},
+  {143, {-20.785, -54.000}, 21462, 21262, 21362, 21062, 21162,  686,  690},
+  {144, {-15.588, -57.000}, 21463, 21263, 21363, 21063, 21163,  690,  694},
+  {145, {-10.392, -60.000}, 21464, 21264, 21364, 21064, 21164,  694,  697},
+  {158, {  0.000, -18.000}, 22404, 22204, 22304, 22004, 22104,  697,  704},
+  {159, {  5.196, -15.000}, 22405, 22205, 22305, 22005, 22105,  704,  712},
+  {160, { 10.392, -12.000}, 22406, 22206, 22306, 22006, 22106,  712,  720},
+  {161, {  0.000, -24.000}, 22407, 22207, 22307, 22007, 22107,  720,  726},
+  {162, {  5.196, -21.000}, 22408, 22208, 22308, 22008, 22108,  726,  732},
+  {163, { 10.392, -18.000}, 22409, 22209, 22309, 22009, 22109,  732,  738},
+  {164, { 15.588, -15.000}, 22410, 22210, 22310, 22010, 22110,  738,  744},
+  {165, {  0.000, -30.000}, 22411, 22211, 22311, 22011, 22111,  744,  750},
+  {166, {  5.196, -27.000}, 22412, 22212, 22312, 22012, 22112,  750,  756},
+  {167, { 10.392, -24.000}, 22413, 22213, 22313, 22013, 22113,  756,  762},
+  {168, { 15.588, -21.000}, 22414, 22214, 22314, 22014, 22114,  762,  768},
+  {169, { 20.785, -18.000}, 22415, 22215, 22315, 22015, 22115,  768,  774},
+  {170, {  0.000, -36.000}, 22416, 22216, 22316, 22016, 22116,  774,  780},
+  {171, {  5.196, -33.000}, 22417, 22217, 22317, 22017, 22117,  780,  786},
+  {172, { 10.392, -30.000}, 22418, 22218, 22318, 22018, 22118,  786,  792},
+  {173, { 15.588, -27.000}, 22419, 22219, 22319, 22019, 22119,  792,  798},
+  {174, { 20.785, -24.000}, 22420, 22220, 22320, 22020, 22120,  798,  804},
+  {175, { 25.981, -21.000}, 22421, 22221, 22321, 22021, 22121,  804,  810},
+  {176, {  0.000, -42.000}, 22422, 22222, 22322, 22022, 22122,  810,  816},
+  {177, {  5.196, -39.000}, 22423, 22223, 22323, 22023, 22123,  816,  822},
+  {178, { 10.392, -36.000}, 22424, 22224, 22324, 22024, 22124,  822,  828},
+  {179, { 15.588, -33.000}, 22425, 22225, 22325, 22025, 22125,  828,  834},
+  {180, { 20.785, -30.000}, 22426, 22226, 22326, 22026, 22126,  834,  840},
+  {181, { 25.981, -27.000}, 22427, 22227, 22327, 22027, 22127,  840,  846},
+  {182, { 31.177, -24.000}, 22428, 22228, 22328, 22028, 22128,  846,  852},
+  {183, {  0.000, -48.000}, 22429, 22229, 22329, 22029, 22129,  852,  858},
+  {184, {  5.196, -45.000}, 22430, 22230, 22330, 22030, 22130,  858,  864},
+  {185, { 10.392, -42.000}, 22431, 22231, 22331, 22031, 22131,  864,  870},
+  {186, { 15.588, -39.000}, 22432, 22232, 22332, 22032, 22132,  870,  876},
+  {187, { 20.785, -36.000}, 22433, 22233, 22333, 22033, 22133,  876,  882},
+  {188, { 25.981, -33.000}, 22434, 22234, 22334, 22034, 22134,  882,  888},
+  {189, { 31.177, -30.000}, 22435, 22235, 22335, 22035, 22135,  888,  894},
+  {190, { 36.373, -27.000}, 22436, 22236, 22336, 22036, 22136,  894,  900},
+  {191, {  0.000, -54.000}, 22437, 22237, 22337, 22037, 22137,  900,  906},
+  {192, {  5.196, -51.000}, 22438, 22238, 22338, 22038, 22138,  906,  912},
+  {193, { 10.392, -48.000}, 22439, 22239, 22339, 22039, 22139,  912,  918},
+  {194, { 15.588, -45.000}, 22440, 22240, 22340, 22040, 22140,  918,  924},
+  {195, { 20.785, -42.000}, 22441, 22241, 22341, 22041, 22141,  924,  930},
+  {196, { 25.981, -39.000}, 22442, 22242, 22342, 22042, 22142,  930,  936},
+  {197, { 31.177, -36.000}, 22443, 22243, 22343, 22043, 22143,  936,  942},
+  {198, { 36.373, -33.000}, 22444, 22244, 22344, 22044, 22144,  942,  948},
+  {199, { 41.569, -30.000}, 22445, 22245, 22345, 22045, 22145,  948,  954},
+  {200, {  0.000, -60.000}, 22446, 22246, 22346, 22046, 22146,  954,  957},
+  {201, {  5.196, -57.000}, 22447, 22247, 22347, 22047, 22147,  957,  962},
+  {202, { 10.392, -54.000}, 22448, 22248, 22348, 22048, 22148,  962,  968},
+  {203, { 15.588, -51.000}, 22449, 22249, 22349, 22049, 22149,  968,  974},
+  {204, { 20.785, -48.000}, 22450, 22250, 22350, 22050, 22150,  974,  980},
+  {205, { 25.981, -45.000}, 22451, 22251, 22351, 22051, 22151,  980,  986},
+  {206, { 31.177, -42.000}, 22452, 22252, 22352, 22052, 22152,  986,  992},
+  {207, { 36.373, -39.000}, 22453, 22253, 22353, 22053, 22153,  992,  998},
+  {208, { 41.569, -36.000}, 22454, 22254, 22354, 22054, 22154,  998, 1004},
+  {209, { 46.765, -33.000}, 22455, 22255, 22355, 22055, 22155, 1004, 1010},
+  {210, { 10.392, -60.000}, 22456, 22256, 22356, 22056, 22156, 1010, 1013},
+  {211, { 15.588, -57.000}, 22457, 22257, 22357, 22057, 22157, 1013, 1017},
+  {212, { 20.785, -54.000}, 22458, 22258, 22358, 22058, 22158, 1017, 1021},
+  {213, { 25.981, -51.000}, 22459, 22259, 22359, 22059, 22159, 1021, 1025},
+  {214, { 31.177, -48.000}, 22460, 22260, 22360, 22060, 22160, 1025, 1029},
+  {215, { 36.373, -45.000}, 22461, 22261, 22361, 22061, 22161, 1029, 1033},
+  {216, { 41.569, -42.000}, 22462, 22262, 22362, 22062, 22162, 1033, 1037},
+  {217, { 46.765, -39.000}, 22463, 22263, 22363, 22063, 22163, 1037, 1041},
+  {218, { 51.962, -36.000}, 22464, 22264, 22364, 22064, 22164, 1041, 1044},
+  {231, { 15.588,  -9.000}, 23404, 23204, 23304, 23004, 23104, 1044, 1051},
+  {232, { 15.588,  -3.000}, 23405, 23205, 23305, 23005, 23105, 1051, 1059},
+  {233, { 15.588,   3.000}, 23406, 23206, 23306, 23006, 23106, 1059, 1067},
+  {234, { 20.785, -12.000}, 23407, 23207, 23307, 23007, 23107, 1067, 1073},
+  {235, { 20.785,  -6.000}, 23408, 23208, 23308, 23008, 23108, 1073, 1079},
+  {236, { 20.785,   0.000}, 23409, 23209, 23309, 23009, 23109, 1079, 1085},
+  {237, { 20.785,   6.000}, 23410, 23210, 23310, 23010, 23110, 1085, 1091},
+  {238, { 25.981, -15.000}, 23411, 23211, 23311, 23011, 23111, 1091, 1097},
+  {239, { 25.981,  -9.000}, 23412, 23212, 23312, 23012, 23112, 1097, 1103},
+  {240, { 25.981,  -3.000}, 23413, 23213, 23313, 23013, 23113, 1103, 1109},
+  {241, { 25.981,   3.000}, 23414, 23214, 23314, 23014, 23114, 1109, 1115},
+  {242, { 25.981,   9.000}, 23415, 23215, 23315, 23015, 23115, 1115, 1121},
+  {243, { 31.177, -18.000}, 23416, 23216, 23316, 23016, 23116, 1121, 1127},
+  {244, { 31.177, -12.000}, 23417, 23217, 23317, 23017, 23117, 1127, 1133},
+  {245, { 31.177,  -6.000}, 23418, 23218, 23318, 23018, 23118, 1133, 1139},
+  {246, { 31.177,   0.000}, 23419, 23219, 23319, 23019, 23119, 1139, 1145},
+  {247, { 31.177,   6.000}, 23420, 23220, 23320, 23020, 23120, 1145, 1151},
+  {248, { 31.177,  12.000}, 23421, 23221, 23321, 23021, 23121, 1151, 1157},
+  {249, { 36.373, -21.000}, 23422, 23222, 23322, 23022, 23122, 1157, 1163},
+  {250, { 36.373, -15.000}, 23423, 23223, 23323, 23023, 23123, 1163, 1169},
+  {251, { 36.373,  -9.000}, 23424, 23224, 23324, 23024, 23124, 1169, 1175},
+  {252, { 36.373,  -3.000}, 23425, 23225, 23325, 23025, 23125, 1175, 1181},
+  {253, { 36.373,   3.000}, 23426, 23226, 23326, 23026, 23126, 1181, 1187},
+  {254, { 36.373,   9.000}, 23427, 23227, 23327, 23027, 23127, 1187, 1193},
+  {255, { 36.373,  15.000}, 23428, 23228, 23328, 23028, 23128, 1193, 1199},
+  {256, { 41.569, -24.000}, 23429, 23229, 23329, 23029, 23129, 1199, 1205},
+  {257, { 41.569, -18.000}, 23430, 23230, 23330, 23030, 23130, 1205, 1211},
+  {258, { 41.569, -12.000}, 23431, 23231, 23331, 23031, 23131, 1211, 1217},
+  {259, { 41.569,  -6.000}, 23432, 23232, 23332, 23032, 23132, 1217, 1223},
+  {260, { 41.569,   0.000}, 23433, 23233, 23333, 23033, 23133, 1223, 1229},
+  {261, { 41.569,   6.000}, 23434, 23234, 23334, 23034, 23134, 1229, 1235},
+  {262, { 41.569,  12.000}, 23435, 23235, 23335, 23035, 23135, 1235, 1241},
+  {263, { 41.569,  18.000}, 23436, 23236, 23336, 23036, 23136, 1241, 1247},
+  {264, { 46.765, -27.000}, 23437, 23237, 23337, 23037, 23137, 1247, 1253},
+  {265, { 46.765, -21.000}, 23438, 23238, 23338, 23038, 23138, 1253, 1259},
+  {266, { 46.765, -15.000}, 23439, 23239, 23339, 23039, 23139, 1259, 1265},
+  {267, { 46.765,  -9.000}, 23440, 23240, 23340, 23040, 23140, 1265, 1271},
+  {268, { 46.765,  -3.000}, 23441, 23241, 23341, 23041, 23141, 1271, 1277},
+  {269, { 46.765,   3.000}, 23442, 23242, 23342, 23042, 23142, 1277, 1283},
+  {270, { 46.765,   9.000}, 23443, 23243, 23343, 23043, 23143, 1283, 1289},
+  {271, { 46.765,  15.000}, 23444, 23244, 23344, 23044, 23144, 1289, 1295},
+  {272, { 46.765,  21.000}, 23445, 23245, 23345, 23045, 23145, 1295, 1301},
+  {273, { 51.962, -30.000}, 23446, 23246, 23346, 23046, 23146, 1301, 1306},
+  {274, { 51.962, -24.000}, 23447, 23247, 23347, 23047, 23147, 1306, 1312},
+  {275, { 51.962, -18.000}, 23448, 23248, 23348, 23048, 23148, 1312, 1318},
+  {276, { 51.962, -12.000}, 23449, 23249, 23349, 23049, 23149, 1318, 1324},
+  {277, { 51.962,  -6.000}, 23450, 23250, 23350, 23050, 23150, 1324, 1330},
+  {278, { 51.962,   0.000}, 23451, 23251, 23351, 23051, 23151, 1330, 1336},
+  {279, { 51.962,   6.000}, 23452, 23252, 23352, 23052, 23152, 1336, 1342},
+  {280, { 51.962,  12.000}, 23453, 23253, 23353, 23053, 23153, 1342, 1348},
+  {281, { 51.962,  18.000}, 23454, 23254, 23354, 23054, 23154, 1348, 1354},
+  {282, { 51.962,  24.000}, 23455, 23255, 23355, 23055, 23155, 1354, 1359},
+  {283, { 57.158, -27.000}, 23456, 23256, 23356, 23056, 23156, 1359, 1362},
+  {284, { 57.158, -21.000}, 23457, 23257, 23357, 23057, 23157, 1362, 1366},
+  {285, { 57.158, -15.000}, 23458, 23258, 23358, 23058, 23158, 1366, 1370},
+  {286, { 57.158,  -9.000}, 23459, 23259, 23359, 23059, 23159, 1370, 1374},
+  {287, { 57.158,  -3.000}, 23460, 23260, 23360, 23060, 23160, 1374, 1378},
+  {288, { 57.158,   3.000}, 23461, 23261, 23361, 23061, 23161, 1378, 1382},
+  {289, { 57.158,   9.000}, 23462, 23262, 23362, 23062, 23162, 1382, 1386},
+  {290, { 57.158,  15.000}, 23463, 23263, 23363, 23063, 23163, 1386, 1390},
+  {291, { 57.158,  21.000}, 23464, 23264, 23364, 23064, 23164, 1390, 1393},
+  {304, { 15.588,   9.000}, 24404, 24204, 24304, 24004, 24104, 1393, 1400},
+  {305, { 10.392,  12.000}, 24405, 24205, 24305, 24005, 24105, 1400, 1408},
+  {306, {  5.196,  15.000}, 24406, 24206, 24306, 24006, 24106, 1408, 1416},
+  {307, { 20.785,  12.000}, 24407, 24207, 24307, 24007, 24107, 1416, 1422},
+  {308, { 15.588,  15.000}, 24408, 24208, 24308, 24008, 24108, 1422, 1428},
+  {309, { 10.392,  18.000}, 24409, 24209, 24309, 24009, 24109, 1428, 1434},
+  {310, {  5.196,  21.000}, 24410, 24210, 24310, 24010, 24110, 1434, 1440},
+  {311, { 25.981,  15.000}, 24411, 24211, 24311, 24011, 24111, 1440, 1446},
+  {312, { 20.785,  18.000}, 24412, 24212, 24312, 24012, 24112, 1446, 1452},
+  {313, { 15.588,  21.000}, 24413, 24213, 24313, 24013, 24113, 1452, 1458},
+  {314, { 10.392,  24.000}, 24414, 24214, 24314, 24014, 24114, 1458, 1464},
+  {315, {  5.196,  27.000}, 24415, 24215, 24315, 24015, 24115, 1464, 1470},
+  {316, { 31.177,  18.000}, 24416, 24216, 24316, 24016, 24116, 1470, 1476},
+  {317, { 25.981,  21.000}, 24417, 24217, 24317, 24017, 24117, 1476, 1482},
+  {318, { 20.785,  24.000}, 24418, 24218, 24318, 24018, 24118, 1482, 1488},
+  {319, { 15.588,  27.000}, 24419, 24219, 24319, 24019, 24119, 1488, 1494},
+  {320, { 10.392,  30.000}, 24420, 24220, 24320, 24020, 24120, 1494, 1500},
+  {321, {  5.196,  33.000}, 24421, 24221, 24321, 24021, 24121, 1500, 1506},
+  {322, { 36.373,  21.000}, 24422, 24222, 24322, 24022, 24122, 1506, 1512},
+  {323, { 31.177,  24.000}, 24423, 24223, 24323, 24023, 24123, 1512, 1518},
+  {324, { 25.981,  27.000}, 24424, 24224, 24324, 24024, 24124, 1518, 1524},
+  {325, { 20.785,  30.000}, 24425, 24225, 24325, 24025, 24125, 1524, 1530},
+  {326, { 15.588,  33.000}, 24426, 24226, 24326, 24026, 24126, 1530, 1536},
+  {327, { 10.392,  36.000}, 24427, 24227, 24327, 24027, 24127, 1536, 1542},
+  {328, {  5.196,  39.000}, 24428, 24228, 24328, 24028, 24128, 1542, 1548},
+  {329, { 41.569,  24.000}, 24429, 24229, 24329, 24029, 24129, 1548, 1554},
+  {330, { 36.373,  27.000}, 24430, 24230, 24330, 24030, 24130, 1554, 1560},
+  {331, { 31.177,  30.000}, 24431, 24231, 24331, 24031, 24131, 1560, 1566},
+  {332, { 25.981,  33.000}, 24432, 24232, 24332, 24032, 24132, 1566, 1572},
+  {333, { 20.785,  36.000}, 24433, 24233, 24333, 24033, 24133, 1572, 1578},
+  {334, { 15.588,  39.000}, 24434, 24234, 24334, 24034, 24134, 1578, 1584},
+  {335, { 10.392,  42.000}, 24435, 24235, 24335, 24035, 24135, 1584, 1590},
+  {336, {  5.196,  45.000}, 24436, 24236, 24336, 24036, 24136, 1590, 1596},
+  {337, { 46.765,  27.000}, 24437, 24237, 24337, 24037, 24137, 1596, 1602},
+  {338, { 41.569,  30.000}, 24438, 24238, 24338, 24038, 24138, 1602, 1608},
+  {339, { 36.373,  33.000}, 24439, 24239, 24339, 24039, 24139, 1608, 1614},
+  {340, { 31.177,  36.000}, 24440, 24240, 24340, 24040, 24140, 1614, 1620},
+  {341, { 25.981,  39.000}, 24441, 24241, 24341, 24041, 24141, 1620, 1626},
+  {342, { 20.785,  42.000}, 24442, 24242, 24342, 24042, 24142, 1626, 1632},
+  {343, { 15.588,  45.000}, 24443, 24243, 24343, 24043, 24143, 1632, 1638},
+  {344, { 10.392,  48.000}, 24444, 24244, 24344, 24044, 24144, 1638, 1644},
+  {345, {  5.196,  51.000}, 24445, 24245, 24345, 24045, 24145, 1644, 1650},
+  {346, { 51.962,  30.000}, 24446, 24246, 24346, 24046, 24146, 1650, 1654},
+  {347, { 46.765,  33.000}, 24447, 24247, 24347, 24047, 24147, 1654, 1660},
+  {348, { 41.569,  36.000}, 24448, 24248, 24348, 24048, 24148, 1660, 1666},
+  {349, { 36.373,  39.000}, 24449, 24249, 24349, 24049, 24149, 1666, 1672},
+  {350, { 31.177,  42.000}, 24450, 24250, 24350, 24050, 24150, 1672, 1678},
+  {351, { 25.981,  45.000}, 24451, 24251, 24351, 24051, 24151, 1678, 1684},
+  {352, { 20.785,  48.000}, 24452, 24252, 24352, 24052, 24152, 1684, 1690},
+  {353, { 15.588,  51.000}, 24453, 24253, 24353, 24053, 24153, 1690, 1696},
+  {354, { 10.392,  54.000}, 24454, 24254, 24354, 24054, 24154, 1696, 1702},
+  {355, {  5.196,  57.000}, 24455, 24255, 24355, 24055, 24155, 1702, 1707},
+  {356, { 51.962,  36.000}, 24456, 24256, 24356, 24056, 24156, 1707, 1710},
+  {357, { 46.765,  39.000}, 24457, 24257, 24357, 24057, 24157, 1710, 1714},
+  {358, { 41.569,  42.000}, 24458, 24258, 24358, 24058, 24158, 1714, 1718},
+  {359, { 36.373,  45.000}, 24459, 24259, 24359, 24059, 24159, 1718, 1722},
+  {360, { 31.177,  48.000}, 24460, 24260, 24360, 24060, 24160, 1722, 1726},
+  {361, { 25.981,  51.000}, 24461, 24261, 24361, 24061, 24161, 1726, 1730},
+  {362, { 20.785,  54.000}, 24462, 24262, 24362, 24062, 24162, 1730, 1734},
+  {363, { 15.588,  57.000}, 24463, 24263, 24363, 24063, 24163, 1734, 1738},
+  {364, { 10.392,  60.000}, 24464, 24264, 24364, 24064, 24164, 1738, 1741},
+  {377, {  0.000,  18.000}, 25404, 25204, 25304, 25004, 25104, 1741, 1748},
+  {378, { -5.196,  15.000}, 25405, 25205, 25305, 25005, 25105, 1748, 1756},
+  {379, {-10.392,  12.000}, 25406, 25206, 25306, 25006, 25106, 1756, 1764},
+  {380, {  0.000,  24.000}, 25407, 25207, 25307, 25007, 25107, 1764, 1770},
+  {381, { -5.196,  21.000}, 25408, 25208, 25308, 25008, 25108, 1770, 1776},
+  {382, {-10.392,  18.000}, 25409, 25209, 25309, 25009, 25109, 1776, 1782},
+  {383, {-15.588,  15.000}, 25410, 25210, 25310, 25010, 25110, 1782, 1788},
+  {384, {  0.000,  30.000}, 25411, 25211, 25311, 25011, 25111, 1788, 1794},
+  {385, { -5.196,  27.000}, 25412, 25212, 25312, 25012, 25112, 1794, 1800},
+  {386, {-10.392,  24.000}, 25413, 25213, 25313, 25013, 25113, 1800, 1806},
+  {387, {-15.588,  21.000}, 25414, 25214, 25314, 25014, 25114, 1806, 1812},
+  {388, {-20.785,  18.000}, 25415, 25215, 25315, 25015, 25115, 1812, 1818},
+  {389, {  0.000,  36.000}, 25416, 25216, 25316, 25016, 25116, 1818, 1824},
+  {390, { -5.196,  33.000}, 25417, 25217, 25317, 25017, 25117, 1824, 1830},
+  {391, {-10.392,  30.000}, 25418, 25218, 25318, 25018, 25118, 1830, 1836},
+  {392, {-15.588,  27.000}, 25419, 25219, 25319, 25019, 25119, 1836, 1842},
+  {393, {-20.785,  24.000}, 25420, 25220, 25320, 25020, 25120, 1842, 1848},
+  {394, {-25.981,  21.000}, 25421, 25221, 25321, 25021, 25121, 1848, 1854},
+  {395, {  0.000,  42.000}, 25422, 25222, 25322, 25022, 25122, 1854, 1860},
+  {396, { -5.196,  39.000}, 25423, 25223, 25323, 25023, 25123, 1860, 1866},
+  {397, {-10.392,  36.000}, 25424, 25224, 25324, 25024, 25124, 1866, 1872},
+  {398, {-15.588,  33.000}, 25425, 25225, 25325, 25025, 25125, 1872, 1878},
+  {399, {-20.785,  30.000}, 25426, 25226, 25326, 25026, 25126, 1878, 1884},
+  {400, {-25.981,  27.000}, 25427, 25227, 25327, 25027, 25127, 1884, 1890},
+  {401, {-31.177,  24.000}, 25428, 25228, 25328, 25028, 25128, 1890, 1896},
+  {402, {  0.000,  48.000}, 25429, 25229, 25329, 25029, 25129, 1896, 1902},
+  {403, { -5.196,  45.000}, 25430, 25230, 25330, 25030, 25130, 1902, 1908},
+  {404, {-10.392,  42.000}, 25431, 25231, 25331, 25031, 25131, 1908, 1914},
+  {405, {-15.588,  39.000}, 25432, 25232, 25332, 25032, 25132, 1914, 1920},
+  {406, {-20.785,  36.000}, 25433, 25233, 25333, 25033, 25133, 1920, 1926},
+  {407, {-25.981,  33.000}, 25434, 25234, 25334, 25034, 25134, 1926, 1932},
+  {408, {-31.177,  30.000}, 25435, 25235, 25335, 25035, 25135, 1932, 1938},
+  {409, {-36.373,  27.000}, 25436, 25236, 25336, 25036, 25136, 1938, 1944},
+  {410, {  0.000,  54.000}, 25437, 25237, 25337, 25037, 25137, 1944, 1950},
+  {411, { -5.196,  51.000}, 25438, 25238, 25338, 25038, 25138, 1950, 1956},
+  {412, {-10.392,  48.000}, 25439, 25239, 25339, 25039, 25139, 1956, 1962},
+  {413, {-15.588,  45.000}, 25440, 25240, 25340, 25040, 25140, 1962, 1968},
+  {414, {-20.785,  42.000}, 25441, 25241, 25341, 25041, 25141, 1968, 1974},
+  {415, {-25.981,  39.000}, 25442, 25242, 25342, 25042, 25142, 1974, 1980},
+  {416, {-31.177,  36.000}, 25443, 25243, 25343, 25043, 25143, 1980, 1986},
+  {417, {-36.373,  33.000}, 25444, 25244, 25344, 25044, 25144, 1986, 1992},
+  {418, {-41.569,  30.000}, 25445, 25245, 25345, 25045, 25145, 1992, 1998},
+  {419, {  0.000,  60.000}, 25446, 25246, 25346, 25046, 25146, 1998, 2001},
+  {420, { -5.196,  57.000}, 25447, 25247, 25347, 25047, 25147, 2001, 2006},
+  {421, {-10.392,  54.000}, 25448, 25248, 25348, 25048, 25148, 2006, 2012},
+  {422, {-15.588,  51.000}, 25449, 25249, 25349, 25049, 25149, 2012, 2018},
+  {423, {-20.785,  48.000}, 25450, 25250, 25350, 25050, 25150, 2018, 2024},
+  {424, {-25.981,  45.000}, 25451, 25251, 25351, 25051, 25151, 2024, 2030},
+  {425, {-31.177,  42.000}, 25452, 25252, 25352, 25052, 25152, 2030, 2036},
+  {426, {-36.373,  39.000}, 25453, 25253, 25353, 25053, 25153, 2036, 2042},
+  {427, {-41.569,  36.000}, 25454, 25254, 25354, 25054, 25154, 2042, 2048},
+  {428, {-46.765,  33.000}, 25455, 25255, 25355, 25055, 25155, 2048, 2054},
+  {429, {-10.392,  60.000}, 25456, 25256, 25356, 25056, 25156, 2054, 2057},
+  {430, {-15.588,  57.000}, 25457, 25257, 25357, 25057, 25157, 2057, 2061},
+  {431, {-20.785,  54.000}, 25458, 25258, 25358, 25058, 25158, 2061, 2065},
+  {432, {-25.981,  51.000}, 25459, 25259, 25359, 25059, 25159, 2065, 2069},
+  {433, {-31.177,  48.000}, 25460, 25260, 25360, 25060, 25160, 2069, 2073},
+  {434, {-36.373,  45.000}, 25461, 25261, 25361, 25061, 25161, 2073, 2077},
+  {435, {-41.569,  42.000}, 25462, 25262, 25362, 25062, 25162, 2077, 2081},
+  {436, {-46.765,  39.000}, 25463, 25263, 25363, 25063, 25163, 2081, 2085},
+  {437, {-51.962,  36.000}, 25464, 25264, 25364, 25064, 25164, 2085, 2088},
+};
+constexpr unsigned
+ant::expconfig::detector::TAPS_2009_03::BaF2_neighbours[] = {
+  /*  12 */ 5,379,383,15,16,13,7,
+  /*  13 */ 9,7,5,12,16,17,14,11,
+  /*  14 */ 78,11,9,13,17,18,85,80,
+  /*  15 */ 12,383,388,19,20,16,
+  /*  16 */ 13,12,15,20,21,17,
+  /*  17 */ 13,16,21,22,18,14,
+  /*  18 */ 88,85,14,17,22,23,
+  /*  19 */ 20,15,388,394,24,25,
+  /*  20 */ 21,16,15,19,25,26,
+  /*  21 */ 22,17,16,20,26,27,
+  /*  22 */ 23,18,17,21,27,28,
+  /*  23 */ 92,88,18,22,28,29,
+  /*  24 */ 25,19,394,401,30,31,
+  /*  25 */ 26,20,19,24,31,32,
+  /*  26 */ 27,21,20,25,32,33,
+  /*  27 */ 28,22,21,26,33,34,
+  /*  28 */ 29,23,22,27,34,35,
+  /*  29 */ 97,92,23,28,35,36,
+  /*  30 */ 31,24,401,409,37,38,
+  /*  31 */ 32,25,24,30,38,39,
+  /*  32 */ 33,26,25,31,39,40,
+  /*  33 */ 34,27,26,32,40,41,
+  /*  34 */ 35,28,27,33,41,42,
+  /*  35 */ 36,29,28,34,42,43,
+  /*  36 */ 103,97,29,35,43,44,
+  /*  37 */ 38,30,409,418,45,46,
+  /*  38 */ 39,31,30,37,46,47,
+  /*  39 */ 40,32,31,38,47,48,
+  /*  40 */ 41,33,32,39,48,49,
+  /*  41 */ 42,34,33,40,49,50,
+  /*  42 */ 43,35,34,41,50,51,
+  /*  43 */ 44,36,35,42,51,52,
+  /*  44 */ 110,103,36,43,52,53,
+  /*  45 */ 46,37,418,428,54,55,
+  /*  46 */ 47,38,37,45,55,56,
+  /*  47 */ 48,39,38,46,56,57,
+  /*  48 */ 49,40,39,47,57,58,
+  /*  49 */ 50,41,40,48,58,59,
+  /*  50 */ 51,42,41,49,59,60,
+  /*  51 */ 52,43,42,50,60,61,
+  /*  52 */ 53,44,43,51,61,62,
+  /*  53 */ 118,110,44,52,62,63,
+  /*  54 */ 55,45,428,437,64,
+  /*  55 */ 56,46,45,54,64,65,
+  /*  56 */ 57,47,46,55,65,66,
+  /*  57 */ 58,48,47,56,66,67,
+  /*  58 */ 59,49,48,57,67,68,
+  /*  59 */ 60,50,49,58,68,69,
+  /*  60 */ 61,51,50,59,69,70,
+  /*  61 */ 62,52,51,60,70,71,
+  /*  62 */ 63,53,52,61,71,72,
+  /*  63 */ 127,118,53,62,72,
+  /*  64 */ 65,55,54,
+  /*  65 */ 66,56,55,64,
+  /*  66 */ 67,57,56,65,
+  /*  67 */ 68,58,57,66,
+  /*  68 */ 69,59,58,67,
+  /*  69 */ 70,60,59,68,
+  /*  70 */ 71,61,60,69,
+  /*  71 */ 72,62,61,70,
+  /*  72 */ 63,62,71,
+  /*  85 */ 80,78,14,18,88,89,86,
+  /*  86 */ 84,82,79,80,85,89,90,87,
+  /*  87 */ 153,151,83,84,86,90,91,158,
+  /*  88 */ 93,89,85,18,23,92,
+  /*  89 */ 94,90,86,85,88,93,
+  /*  90 */ 95,91,87,86,89,94,
+  /*  91 */ 96,161,158,87,90,95,
+  /*  92 */ 98,93,88,23,29,97,
+  /*  93 */ 99,94,89,88,92,98,
+  /*  94 */ 100,95,90,89,93,99,
+  /*  95 */ 101,96,91,90,94,100,
+  /*  96 */ 102,165,161,91,95,101,
+  /*  97 */ 104,98,92,29,36,103,
+  /*  98 */ 105,99,93,92,97,104,
+  /*  99 */ 106,100,94,93,98,105,
+  /* 100 */ 107,101,95,94,99,106,
+  /* 101 */ 108,102,96,95,100,107,
+  /* 102 */ 109,170,165,96,101,108,
+  /* 103 */ 111,104,97,36,44,110,
+  /* 104 */ 112,105,98,97,103,111,
+  /* 105 */ 113,106,99,98,104,112,
+  /* 106 */ 114,107,100,99,105,113,
+  /* 107 */ 115,108,101,100,106,114,
+  /* 108 */ 116,109,102,101,107,115,
+  /* 109 */ 117,176,170,102,108,116,
+  /* 110 */ 119,111,103,44,53,118,
+  /* 111 */ 120,112,104,103,110,119,
+  /* 112 */ 121,113,105,104,111,120,
+  /* 113 */ 122,114,106,105,112,121,
+  /* 114 */ 123,115,107,106,113,122,
+  /* 115 */ 124,116,108,107,114,123,
+  /* 116 */ 125,117,109,108,115,124,
+  /* 117 */ 126,183,176,109,116,125,
+  /* 118 */ 128,119,110,53,63,127,
+  /* 119 */ 129,120,111,110,118,128,
+  /* 120 */ 130,121,112,111,119,129,
+  /* 121 */ 131,122,113,112,120,130,
+  /* 122 */ 132,123,114,113,121,131,
+  /* 123 */ 133,124,115,114,122,132,
+  /* 124 */ 134,125,116,115,123,133,
+  /* 125 */ 135,126,117,116,124,134,
+  /* 126 */ 136,191,183,117,125,135,
+  /* 127 */ 137,128,118,63,
+  /* 128 */ 138,129,119,118,127,137,
+  /* 129 */ 139,130,120,119,128,138,
+  /* 130 */ 140,131,121,120,129,139,
+  /* 131 */ 141,132,122,121,130,140,
+  /* 132 */ 142,133,123,122,131,141,
+  /* 133 */ 143,134,124,123,132,142,
+  /* 134 */ 144,135,125,124,133,143,
+  /* 135 */ 145,136,126,125,134,144,
+  /* 136 */ 200,191,126,135,145,
+  /* 137 */ 138,128,127,
+  /* 138 */ 139,129,128,137,
+  /* 139 */ 140,130,129,138,
+  /* 140 */ 141,131,130,139,
+  /* 141 */ 142,132,131,140,
+  /* 142 */ 143,133,132,141,
+  /* 143 */ 144,134,133,142,
+  /* 144 */ 145,135,134,143,
+  /* 145 */ 136,135,144,
+  /* 158 */ 159,152,153,87,91,161,162,
+  /* 159 */ 160,156,157,150,152,158,162,163,
+  /* 160 */ 231,225,226,154,156,159,163,164,
+  /* 161 */ 165,166,162,158,91,96,
+  /* 162 */ 166,167,163,159,158,161,
+  /* 163 */ 167,168,164,160,159,162,
+  /* 164 */ 168,169,234,231,160,163,
+  /* 165 */ 170,171,166,161,96,102,
+  /* 166 */ 171,172,167,162,161,165,
+  /* 167 */ 172,173,168,163,162,166,
+  /* 168 */ 173,174,169,164,163,167,
+  /* 169 */ 174,175,238,234,164,168,
+  /* 170 */ 176,177,171,165,102,109,
+  /* 171 */ 177,178,172,166,165,170,
+  /* 172 */ 178,179,173,167,171,166,
+  /* 173 */ 179,180,174,168,172,167,
+  /* 174 */ 180,181,175,169,173,168,
+  /* 175 */ 181,182,243,238,169,174,
+  /* 176 */ 183,184,177,170,109,117,
+  /* 177 */ 184,185,178,171,170,176,
+  /* 178 */ 185,186,179,172,171,177,
+  /* 179 */ 186,187,180,173,172,178,
+  /* 180 */ 187,188,181,174,173,179,
+  /* 181 */ 188,189,182,175,174,180,
+  /* 182 */ 189,190,249,243,175,181,
+  /* 183 */ 191,192,184,176,117,126,
+  /* 184 */ 192,193,185,177,176,183,
+  /* 185 */ 193,194,186,178,177,184,
+  /* 186 */ 194,195,187,179,178,185,
+  /* 187 */ 195,196,188,180,179,186,
+  /* 188 */ 196,197,189,181,180,187,
+  /* 189 */ 197,198,190,182,181,188,
+  /* 190 */ 198,199,256,249,182,189,
+  /* 191 */ 200,201,192,183,126,136,
+  /* 192 */ 201,202,193,184,183,191,
+  /* 193 */ 202,203,194,185,184,192,
+  /* 194 */ 203,204,195,186,185,193,
+  /* 195 */ 204,205,196,187,186,194,
+  /* 196 */ 205,206,197,188,187,195,
+  /* 197 */ 206,207,198,189,188,196,
+  /* 198 */ 207,208,199,190,189,197,
+  /* 199 */ 208,209,264,256,190,198,
+  /* 200 */ 201,191,136,
+  /* 201 */ 210,202,192,191,200,
+  /* 202 */ 210,211,203,193,192,201,
+  /* 203 */ 211,212,204,194,193,202,
+  /* 204 */ 212,213,205,195,194,203,
+  /* 205 */ 213,214,206,196,195,204,
+  /* 206 */ 214,215,207,197,196,205,
+  /* 207 */ 215,216,208,198,197,206,
+  /* 208 */ 216,217,209,199,198,207,
+  /* 209 */ 217,218,273,264,199,208,
+  /* 210 */ 211,202,201,
+  /* 211 */ 212,203,202,210,
+  /* 212 */ 213,204,203,211,
+  /* 213 */ 214,205,204,212,
+  /* 214 */ 215,206,205,213,
+  /* 215 */ 216,207,206,214,
+  /* 216 */ 217,208,207,215,
+  /* 217 */ 218,209,208,216,
+  /* 218 */ 273,209,217,
+  /* 231 */ 234,235,232,223,225,160,164,
+  /* 232 */ 235,236,233,227,229,223,225,231,
+  /* 233 */ 236,237,304,296,298,227,229,232,
+  /* 234 */ 169,238,239,235,231,164,
+  /* 235 */ 234,239,240,236,232,231,
+  /* 236 */ 235,240,241,237,233,232,
+  /* 237 */ 236,241,242,307,304,233,
+  /* 238 */ 175,243,244,239,234,169,
+  /* 239 */ 238,244,245,240,235,234,
+  /* 240 */ 239,245,246,241,236,235,
+  /* 241 */ 240,246,247,242,237,236,
+  /* 242 */ 241,247,248,311,307,237,
+  /* 243 */ 182,249,250,244,238,175,
+  /* 244 */ 243,250,251,245,239,238,
+  /* 245 */ 244,251,252,246,240,239,
+  /* 246 */ 245,252,253,247,241,240,
+  /* 247 */ 246,253,254,248,242,241,
+  /* 248 */ 247,254,255,316,311,242,
+  /* 249 */ 190,256,257,250,243,182,
+  /* 250 */ 249,257,258,251,244,243,
+  /* 251 */ 250,258,259,252,245,244,
+  /* 252 */ 251,259,260,253,246,245,
+  /* 253 */ 252,260,261,254,247,246,
+  /* 254 */ 253,261,262,255,248,247,
+  /* 255 */ 254,262,263,322,316,248,
+  /* 256 */ 199,264,265,257,249,190,
+  /* 257 */ 256,265,266,258,250,249,
+  /* 258 */ 257,266,267,259,251,250,
+  /* 259 */ 258,267,268,260,252,251,
+  /* 260 */ 259,268,269,261,253,252,
+  /* 261 */ 260,269,270,262,254,253,
+  /* 262 */ 261,270,271,263,255,254,
+  /* 263 */ 262,271,272,329,322,255,
+  /* 264 */ 209,273,274,265,256,199,
+  /* 265 */ 264,274,275,266,257,256,
+  /* 266 */ 265,275,276,267,258,257,
+  /* 267 */ 266,276,277,268,259,258,
+  /* 268 */ 267,277,278,269,260,259,
+  /* 269 */ 268,278,279,270,261,260,
+  /* 270 */ 269,279,280,271,262,261,
+  /* 271 */ 270,280,281,272,263,262,
+  /* 272 */ 271,281,282,337,329,263,
+  /* 273 */ 283,274,264,209,218,
+  /* 274 */ 273,283,284,275,265,264,
+  /* 275 */ 274,284,285,276,266,265,
+  /* 276 */ 275,285,286,277,267,266,
+  /* 277 */ 276,286,287,278,268,267,
+  /* 278 */ 277,287,288,279,269,268,
+  /* 279 */ 278,288,289,280,270,269,
+  /* 280 */ 279,289,290,281,271,270,
+  /* 281 */ 280,290,291,282,272,271,
+  /* 282 */ 281,291,346,337,272,
+  /* 283 */ 273,274,284,
+  /* 284 */ 283,285,275,274,
+  /* 285 */ 284,286,276,275,
+  /* 286 */ 285,287,277,276,
+  /* 287 */ 286,288,278,277,
+  /* 288 */ 287,289,279,278,
+  /* 289 */ 288,290,280,279,
+  /* 290 */ 289,291,281,280,
+  /* 291 */ 290,282,281,
+  /* 304 */ 237,307,308,305,296,298,233,
+  /* 305 */ 304,308,309,306,300,302,297,296,
+  /* 306 */ 305,309,310,377,369,371,301,300,
+  /* 307 */ 237,242,311,312,308,304,
+  /* 308 */ 304,307,312,313,309,305,
+  /* 309 */ 305,308,313,314,310,306,
+  /* 310 */ 306,309,314,315,380,377,
+  /* 311 */ 242,248,316,317,312,307,
+  /* 312 */ 307,311,317,318,313,308,
+  /* 313 */ 308,312,318,319,314,309,
+  /* 314 */ 309,313,319,320,315,310,
+  /* 315 */ 310,314,320,321,384,380,
+  /* 316 */ 248,255,322,323,317,311,
+  /* 317 */ 311,316,323,324,318,312,
+  /* 318 */ 312,317,324,325,319,313,
+  /* 319 */ 313,318,325,326,320,314,
+  /* 320 */ 314,319,326,327,321,315,
+  /* 321 */ 315,320,327,328,389,384,
+  /* 322 */ 255,263,329,330,323,316,
+  /* 323 */ 316,322,330,331,324,317,
+  /* 324 */ 317,323,331,332,325,318,
+  /* 325 */ 318,324,332,333,326,319,
+  /* 326 */ 319,325,333,334,327,320,
+  /* 327 */ 320,326,334,335,328,321,
+  /* 328 */ 321,327,335,336,395,389,
+  /* 329 */ 263,272,337,338,330,322,
+  /* 330 */ 322,329,338,339,331,323,
+  /* 331 */ 323,330,339,340,332,324,
+  /* 332 */ 324,331,340,341,333,325,
+  /* 333 */ 325,332,341,342,334,326,
+  /* 334 */ 326,333,342,343,335,327,
+  /* 335 */ 327,334,343,344,336,328,
+  /* 336 */ 328,335,344,345,402,395,
+  /* 337 */ 272,282,346,347,338,329,
+  /* 338 */ 329,337,347,348,339,330,
+  /* 339 */ 330,338,348,349,340,331,
+  /* 340 */ 331,339,349,350,341,332,
+  /* 341 */ 332,340,350,351,342,333,
+  /* 342 */ 333,341,351,352,343,334,
+  /* 343 */ 334,342,352,353,344,335,
+  /* 344 */ 335,343,353,354,345,336,
+  /* 345 */ 336,344,354,355,410,402,
+  /* 346 */ 282,356,347,337,
+  /* 347 */ 337,346,356,357,348,338,
+  /* 348 */ 338,347,357,358,349,339,
+  /* 349 */ 339,348,358,359,350,340,
+  /* 350 */ 340,349,359,360,351,341,
+  /* 351 */ 341,350,360,361,352,342,
+  /* 352 */ 342,351,361,362,353,343,
+  /* 353 */ 343,352,362,363,354,344,
+  /* 354 */ 344,353,363,364,355,345,
+  /* 355 */ 345,354,364,419,410,
+  /* 356 */ 346,357,347,
+  /* 357 */ 356,347,348,358,
+  /* 358 */ 357,348,349,359,
+  /* 359 */ 358,349,350,360,
+  /* 360 */ 359,350,351,361,
+  /* 361 */ 360,351,352,362,
+  /* 362 */ 361,352,353,363,
+  /* 363 */ 362,353,354,364,
+  /* 364 */ 363,354,355,
+  /* 377 */ 306,310,380,381,378,370,369,
+  /* 378 */ 370,377,381,382,379,374,373,372,
+  /* 379 */ 374,378,382,383,12,5,4,376,
+  /* 380 */ 377,310,315,384,385,381,
+  /* 381 */ 378,377,380,385,386,382,
+  /* 382 */ 379,378,381,386,387,383,
+  /* 383 */ 12,379,382,387,388,15,
+  /* 384 */ 380,315,321,389,390,385,
+  /* 385 */ 381,380,384,390,391,386,
+  /* 386 */ 382,381,385,391,392,387,
+  /* 387 */ 383,382,386,392,393,388,
+  /* 388 */ 15,383,387,393,394,19,
+  /* 389 */ 384,321,328,395,396,390,
+  /* 390 */ 385,384,389,396,397,391,
+  /* 391 */ 386,385,390,397,398,392,
+  /* 392 */ 387,386,391,398,399,393,
+  /* 393 */ 388,387,392,399,400,394,
+  /* 394 */ 19,388,393,400,401,24,
+  /* 395 */ 389,328,336,402,403,396,
+  /* 396 */ 390,389,395,403,404,397,
+  /* 397 */ 391,390,396,404,405,398,
+  /* 398 */ 392,391,397,405,406,399,
+  /* 399 */ 393,392,398,406,407,400,
+  /* 400 */ 394,393,399,407,408,401,
+  /* 401 */ 24,394,400,408,409,30,
+  /* 402 */ 395,336,345,410,411,403,
+  /* 403 */ 396,395,402,411,412,404,
+  /* 404 */ 397,396,403,412,413,405,
+  /* 405 */ 398,397,404,413,414,406,
+  /* 406 */ 399,398,405,414,415,407,
+  /* 407 */ 400,399,406,415,416,408,
+  /* 408 */ 401,400,407,416,417,409,
+  /* 409 */ 30,401,408,417,418,37,
+  /* 410 */ 402,345,355,419,420,411,
+  /* 411 */ 403,402,410,420,421,412,
+  /* 412 */ 404,403,411,421,422,413,
+  /* 413 */ 405,404,412,422,423,414,
+  /* 414 */ 406,405,413,423,424,415,
+  /* 415 */ 407,406,414,424,425,416,
+  /* 416 */ 408,407,415,425,426,417,
+  /* 417 */ 409,408,416,426,427,418,
+  /* 418 */ 37,409,417,427,428,45,
+  /* 419 */ 355,410,420,
+  /* 420 */ 419,410,411,421,429,
+  /* 421 */ 412,411,420,429,430,422,
+  /* 422 */ 413,412,421,430,431,423,
+  /* 423 */ 414,413,422,431,432,424,
+  /* 424 */ 415,414,423,432,433,425,
+  /* 425 */ 416,415,424,433,434,426,
+  /* 426 */ 417,416,425,434,435,427,
+  /* 427 */ 418,417,426,435,436,428,
+  /* 428 */ 45,418,427,436,437,54,
+  /* 429 */ 420,421,430,
+  /* 430 */ 429,421,422,431,
+  /* 431 */ 430,422,423,432,
+  /* 432 */ 431,423,424,433,
+  /* 433 */ 432,424,425,434,
+  /* 434 */ 433,425,426,435,
+  /* 435 */ 434,426,427,436,
+  /* 436 */ 435,427,428,437,
+  /* 437 */ 436,428,54,
 };
@@ -1,77 +1,152 @@
 #include "detectors/TAPS.h"
-const std::vector<ant::expconfig::detector::TAPS_2009_03::PbWO4_Element_t>
-ant::expconfig::detector::TAPS_2009_03::PbWO4_elements_init = {
-  // element, {xy}, TDC, QDCH, QDCL, {neigbours}
-  {  0, { -3.849,   4.333}, 30201, 30001, 30101, {368,366,375,376,1,3,2}},
-  {  1, { -6.543,   4.333}, 30204, 30004, 30104, {0,375,376,4,6,8,3,2}},
-  {  2, { -3.849,   1.667}, 30202, 30002, 30102, {368,0,1,3,74,73}},
-  {  3, { -6.543,   1.667}, 30203, 30003, 30103, {2,0,1,6,8,10,74,73}},
-  {  4, { -9.045,   7.333}, 30205, 30005, 30105, {376,374,379,5,7,6,1}},
-  {  5, {-11.739,   7.333}, 30208, 30008, 30108, {4,379,12,13,7,6}},
-  {  6, { -9.045,   4.667}, 30206, 30006, 30106, {1,376,4,5,7,9,8,3}},
-  {  7, {-11.739,   4.667}, 30207, 30007, 30107, {6,4,5,12,13,9,8}},
-  {  8, { -9.045,   1.333}, 30209, 30009, 30109, {3,1,6,7,9,11,10,74}},
-  {  9, {-11.739,   1.333}, 30212, 30012, 30112, {8,6,7,13,14,11,10}},
-  { 10, { -9.045,  -1.333}, 30210, 30010, 30110, {74,3,8,9,11,78,77,76}},
-  { 11, {-11.739,  -1.333}, 30211, 30011, 30111, {10,8,9,13,14,78,77}},
-  { 73, { -3.849,  -1.667}, 30213, 30013, 30113, {2,3,74,76,75,147}},
-  { 74, { -6.543,  -1.667}, 30216, 30016, 30116, {73,2,3,8,10,77,76,75}},
-  { 75, { -3.849,  -4.333}, 30214, 30014, 30114, {147,73,74,76,82,81,149}},
-  { 76, { -6.543,  -4.333}, 30215, 30015, 30115, {75,73,74,10,77,79,82,81}},
-  { 77, { -9.045,  -4.667}, 30217, 30017, 30117, {76,74,10,11,78,80,79,82}},
-  { 78, {-11.739,  -4.667}, 30220, 30020, 30120, {77,10,11,14,85,80,79}},
-  { 79, { -9.045,  -7.333}, 30218, 30018, 30118, {82,76,77,78,80,86,84}},
-  { 80, {-11.739,  -7.333}, 30219, 30019, 30119, {79,77,78,14,85,86}},
-  { 81, { -3.849,  -7.667}, 30221, 30021, 30121, {149,147,75,76,82,84,83,151}},
-  { 82, { -6.543,  -7.667}, 30224, 30024, 30124, {81,75,76,77,79,86,84,83}},
-  { 83, { -3.849, -10.333}, 30222, 30022, 30122, {151,149,81,82,84,87,153}},
-  { 84, { -6.543, -10.333}, 30223, 30023, 30123, {83,81,82,79,86,87}},
-  {146, {  1.347,  -4.667}, 30225, 30025, 30125, {222,220,147,149,148,155}},
-  {147, { -1.347,  -4.667}, 30228, 30028, 30128, {146,73,75,81,149,148}},
-  {148, {  1.347,  -7.333}, 30226, 30026, 30126, {155,222,146,147,149,151,150,157}},
-  {149, { -1.347,  -7.333}, 30227, 30027, 30127, {148,146,147,75,81,83,151,150}},
-  {150, {  1.347, -10.667}, 30229, 30029, 30129, {157,155,148,149,151,153,152,159}},
-  {151, { -1.347, -10.667}, 30232, 30032, 30132, {150,148,149,81,83,87,153,152}},
-  {152, {  1.347, -13.333}, 30230, 30030, 30130, {159,157,150,151,153,158}},
-  {153, { -1.347, -13.333}, 30231, 30031, 30131, {152,150,151,83,87,158}},
-  {154, {  6.543,  -7.667}, 30233, 30033, 30133, {226,224,221,222,155,157,156,160}},
-  {155, {  3.849,  -7.667}, 30236, 30036, 30136, {154,221,222,146,148,150,157,156}},
-  {156, {  6.543, -10.333}, 30234, 30034, 30134, {160,226,154,155,157,159}},
-  {157, {  3.849, -10.333}, 30235, 30035, 30135, {156,154,155,148,150,152,159}},
-  {219, {  6.543,  -1.667}, 30237, 30037, 30137, {230,228,294,295,220,222,221,224}},
-  {220, {  3.849,  -1.667}, 30240, 30040, 30140, {219,294,295,146,222,221}},
-  {221, {  6.543,  -4.333}, 30238, 30038, 30138, {224,230,219,220,222,155,154,226}},
-  {222, {  3.849,  -4.333}, 30239, 30039, 30139, {221,219,220,146,148,155,154}},
-  {223, { 11.739,  -4.667}, 30241, 30041, 30141, {232,229,230,224,226,225,231}},
-  {224, {  9.045,  -4.667}, 30244, 30044, 30144, {223,229,230,219,221,154,226,225}},
-  {225, { 11.739,  -7.333}, 30242, 30042, 30142, {231,232,223,224,226,160,231}},
-  {226, {  9.045,  -7.333}, 30243, 30043, 30143, {225,223,224,221,154,156,160}},
-  {227, { 11.739,   1.333}, 30245, 30045, 30145, {233,298,299,228,230,229,232}},
-  {228, {  9.045,   1.333}, 30248, 30048, 30148, {227,298,299,292,294,219,230,229}},
-  {229, { 11.739,  -1.333}, 30246, 30046, 30146, {232,233,227,228,230,224,223}},
-  {230, {  9.045,  -1.333}, 30247, 30047, 30147, {229,227,228,294,219,221,224,223}},
-  {292, {  6.543,   4.333}, 30249, 30049, 30149, {299,297,302,303,293,295,294,228}},
-  {293, {  3.849,   4.333}, 30252, 30052, 30152, {292,302,303,365,367,295,294}},
-  {294, {  6.543,   1.667}, 30250, 30050, 30150, {228,299,292,293,295,220,219,230}},
-  {295, {  3.849,   1.667}, 30251, 30051, 30151, {294,292,293,367,220,219,294}},
-  {296, { 11.739,   7.333}, 30253, 30053, 30153, {304,305,297,299,298,233}},
-  {297, {  9.045,   7.333}, 30256, 30056, 30156, {296,305,300,302,292,299,298}},
-  {298, { 11.739,   4.667}, 30254, 30054, 30154, {233,304,296,297,299,228,227}},
-  {299, {  9.045,   4.667}, 30255, 30055, 30155, {298,296,297,302,292,294,228,227}},
-  {300, {  6.543,  10.333}, 30257, 30057, 30157, {305,306,301,303,302,297}},
-  {301, {  3.849,  10.333}, 30260, 30060, 30160, {300,306,369,371,365,303,302}},
-  {302, {  6.543,   7.667}, 30258, 30058, 30158, {297,305,300,301,303,293,292,299}},
-  {303, {  3.849,   7.667}, 30259, 30059, 30159, {302,300,301,371,365,367,293,292}},
-  {365, {  1.347,   7.333}, 30261, 30061, 30161, {303,301,371,372,366,368,367,293}},
-  {366, { -1.347,   7.333}, 30264, 30064, 30164, {365,371,372,373,375,0,368,367}},
-  {367, {  1.347,   4.667}, 30262, 30062, 30162, {293,303,365,366,368,295}},
-  {368, { -1.347,   4.667}, 30263, 30063, 30163, {367,365,366,375,0,2}},
-  {369, {  1.347,  13.333}, 30265, 30065, 30165, {306,377,370,372,371,301}},
-  {370, { -1.347,  13.333}, 30268, 30068, 30168, {369,377,378,373,372,371}},
-  {371, {  1.347,  10.667}, 30266, 30066, 30166, {301,306,369,370,372,366,365,303}},
-  {372, { -1.347,  10.667}, 30267, 30067, 30167, {371,369,370,378,373,375,366,365}},
-  {373, { -3.849,  10.333}, 30269, 30069, 30169, {372,370,378,374,376,375,366}},
-  {374, { -6.543,  10.333}, 30272, 30072, 30172, {373,378,379,4,376,375}},
-  {375, { -3.849,   7.667}, 30270, 30070, 30170, {366,372,373,374,376,1,0,368}},
-  {376, { -6.543,   7.667}, 30271, 30071, 30171, {375,373,374,379,4,6,1,0}},
+constexpr ant::expconfig::detector::TAPS::PbWO4_row_t
+ant::expconfig::detector::TAPS_2009_03::PbWO4_table[] = {
+  // element, {xy}, TDC, QDCH, QDCL, neighbours begin/end in PbWO4_neighbours
+  {  0, { -3.849,   4.333}, 30201, 30001, 30101,    0,    7},
+  {  1, { -6.543,   4.333}, 30204, 30004, 30104,    7,   15},
+  {  2, { -3.849,   1.667}, 30202, 30002, 30102,   15,   21},
+  {  3, { -6.543,   1.667}, 30203, 30003, 30103,   21,   29},
+  {  4, { -9.045,   7.333}, 30205, 30005, 30105,   29,   36},
+  {  5, {-11.739,   7.333}, 30208, 30008, 30108,   36,   42},
+  {  6, { -9.045,   4.667}, 30206, 30006, 30106,   42,   50},
+  {  7, {-11.739,   4.667}, 30207, 30007, 30107,   50,   57},
+  {  8, { -9.045,   1.333}, 30209, 30009, 30109,   57,   65},
+  {  9, {-11.739,   1.333}, 30212, 30012, 30112,   65,   72},
+  { 10, { -9.045,  -1.333}, 30210, 30010, 30110,   72,   80},
+  { 11, {-11.739,  -1.333}, 30211, 30011, 30111,   80,   87},
+  { 73, { -3.849,  -1.667}, 30213, 30013, 30113,   87,   93},
+  { 74, { -6.543,  -1.667}, 30216, 30016, 30116,   93,  101},
+  { 75, { -3.849,  -4.333}, 30214, 30014, 30114,  101,  108},
+  { 76, { -6.543,  -4.333}, 30215, 30015, 30115,  108,  116},
+  { 77, { -9.045,  -4.667}, 30217, 30017, 30117,  116,  124},
+  { 78, {-11.739,  -4.667}, 30220, 30020, 30120,  124,  131},
+  { 79, { -9.045,  -7.333}, 30218, 30018, 30118,  131,  138},
+  { 80, {-11.739,  -7.333}, 30219, 30019, 30119,  138,  144},
+  { 81, { -3.849,  -7.667}, 30221, 30021, 30121,  144,  152},
+  { 82, { -6.543,  -7.667}, 30224, 30024, 30124,  152,  160},
+  { 83, { -3.849, -10.333}, 30222, 30022, 30122,  160,  167},
+  { 84, { -6.543, -10.333}, 30223, 30023, 30123,  167,  173},
+  {146, {  1.347,  -4.667}, 30225, 30025, 30125,  173,  179},
+  {147, { -1.347,  -4.667}, 30228, 30028, 30128,  179,  185},
+  {148, {  1.347,  -7.333}, 30226, 30026, 30126,  185,  193},
+  {149, { -1.347,  -7.333}, 30227, 30027, 30127,  193,  201},
+  {150, {  1.347, -10.667}, 30229, 30029, 30129,  201,  209},
+  {151, { -1.347, -10.667}, 30232, 30032, 30132,  209,  217},
+  {152, {  1.347, -13.333}, 30230, 30030, 30130,  217,  223},
+  {153, { -1.347, -13.333}, 30231, 30031, 30131,  223,  229},
+  {154, {  6.543,  -7.667}, 30233, 30033, 30133,  229,  237},
+  {155, {  3.849,  -7.667}, 30236, 30036, 30136,  237,  245},
+  {156, {  6.543, -10.333}, 30234, 30034, 30134,  245,  251},
+  {157, {  3.849, -10.333}, 30235, 30035, 30135,  251,  258},
+  {219, {  6.543,  -1.667}, 30237, 30037, 30137,  258,  266},
+  {220, {  3.849,  -1.667}, 30240, 30040, 30140,  266,  272},
+  {221, {  6.543,  -4.333}, 30238, 30038, 30138,  272,  280},
+  {222, {  3.849,  -4.333}, 30239, 30039, 30139,  280,  287},
+  {223, { 11.739,  -4.667}, 30241, 30041, 30141,  287,  294},
+  {224, {  9.045,  -4.667}, 30244, 30044, 30144,  294,  302},
+  {225, { 11.739,  -7.333}, 30242, 30042, 30142,  302,  309},
+  {226, {  9.045,  -7.333}, 30243, 30043, 30143,  309,  316},
+  {227, { 11.739,   1.333}, 30245, 30045, 30145,  316,  323},
+  {228, {  9.045,   1.333}, 30248, 30048, 30148,  323,  331},
+  {229, { 11.739,  -1.333}, 30246, 30046, 30146,  331,  338},
+  {230, {  9.045,  -1.333}, 30247, 30047, 30147,  338,  346},
+  {292, {  6.543,   4.333}, 30249, 30049, 30149,  346,  354},
+  {293, {  3.849,   4.333}, 30252, 30052, 30152,  354,  361},
+  {294, {  6.543,   1.667}, 30250, 30050, 30150,  361,  369},
+  {295, {  3.849,   1.667}, 30251, 30051, 30151,  369,  376},
+  {296, { 11.739,   7.333}, 30253, 30053, 30153,  376,  382},
+  {297, {  9.045,   7.333}, 30256, 30056, 30156,  382,  389},
+  {298, { 11.739,   4.667}, 30254, 30054, 30154,  389,  396},
+  {299, {  9.045,   4.667}, 30255, 30055, 30155,  396,  404},
+  {300, {  6.543,  10.333}, 30257, 30057, 30157,  404,  410},
+  {301, {  3.849,  10.333}, 30260, 30060, 30160,  410,  417},
+  {302, {  6.543,   7.667}, 30258, 30058, 30158,  417,  425},
+  {303, {  3.849,   7.667}, 30259, 30059, 30159,  425,  433},
+  {365, {  1.347,   7.333}, 30261, 30061, 30161,  433,  441},
+  {366, { -1.347,   7.333}, 30264, 30064, 30164,  441,  449},
+  {367, {  1.347,   4.667}, 30262, 30062, 30162,  449,  455},
+  {368, { -1.347,   4.667}, 30263, 30063, 30163,  455,  461},
+  {369, {  1.347,  13.333}, 30265, 30065, 30165,  461,  467},
+  {370, { -1.347,  13.333}, 30268, 30068, 30168,  467,  473},
+  {371, {  1.347,  10.667}, 30266, 30066, 30166,  473,  481},
+  {372, { -1.347,  10.667}, 30267, 30067, 30167,  481,  489},
+  {373, { -3.849,  10.333}, 30269, 30069, 30169,  489,  496},
+  {374, { -6.543,  10.333}, 30272, 30072, 30172,  496,  502},
+  {375, { -3.849,   7.667}, 30270, 30070, 30170,  502,  510},
+  {376, { -6.543,   7.667}, 30271, 30071, 30171,  510,  518},
+};
+constexpr unsigned
+ant::expconfig::detector::TAPS_2009_03::PbWO4_neighbours[] = {
+  /*   0 */ 368,366,375,376,1,3,2,
+  /*   1 */ 0,375,376,4,6,8,3,2,
+  /*   2 */ 368,0,1,3,74,73,
+  /*   3 */ 2,0,1,6,8,10,74,73,
+  /*   4 */ 376,374,379,5,7,6,1,
+  /*   5 */ 4,379,12,13,7,6,
+  /*   6 */ 1,376,4,5,7,9,8,3,
+  /*   7 */ 6,4,5,12,13,9,8,
+  /*   8 */ 3,1,6,7,9,11,10,74,
+  /*   9 */ 8,6,7,13,14,11,10,
+  /*  10 */ 74,3,8,9,11,78,77,76,
+  /*  11 */ 10,8,9,13,14,78,77,
+  /*  73 */ 2,3,74,76,75,147,
+  /*  74 */ 73,2,3,8,10,77,76,75,
+  /*  75 */ 147,73,74,76,82,81,149,
+  /*  76 */ 75,73,74,10,77,79,82,81,
+  /*  77 */ 76,74,10,11,78,80,79,82,
+  /*  78 */ 77,10,11,14,85,80,79,
+  /*  79 */ 82,76,77,78,80,86,84,
+  /*  80 */ 79,77,78,14,85,86,
+  /*  81 */ 149,147,75,76,82,84,83,151,
+  /*  82 */ 81,75,76,77,79,86,84,83,
+  /*  83 */ 151,149,81,82,84,87,153,
+  /*  84 */ 83,81,82,79,86,87,
+  /* 146 */ 222,220,147,149,148,155,
+  /* 147 */ 146,73,75,81,149,148,
+  /* 148 */ 155,222,146,147,149,151,150,157,
+  /* 149 */ 148,146,147,75,81,83,151,150,
+  /* 150 */ 157,155,148,149,151,153,152,159,
+  /* 151 */ 150,148,149,81,83,87,153,152,
+  /* 152 */ 159,157,150,151,153,158,
+  /* 153 */ 152,150,151,83,87,158,
+  /* 154 */ 226,224,221,222,155,157,156,160,
+  /* 155 */ 154,221,222,146,148,150,157,156,
+  /* 156 */ 160,226,154,155,157,159,
+  /* 157 */ 156,154,155,148,150,152,159,
+  /* 219 */ 230,228,294,295,220,222,221,224,
+  /* 220 */ 219,294,295,146,222,221,
+  /* 221 */ 224,230,219,220,222,155,154,226,
+  /* 222 */ 221,219,220,146,148,155,154,
+  /* 223 */ 232,229,230,224,226,225,231,
+  /* 224 */ 223,229,230,219,221,154,226,225,
+  /* 225 */ 231,232,223,224,226,160,231,
+  /* 226 */ 225,223,224,221,154,156,160,
+  /* 227 */ 233,298,299,228,230,229,232,
+  /* 228 */ 227,298,299,292,294,219,230,229,
+  /* 229 */ 232,233,227,228,230,224,223,
+  /* 230 */ 229,227,228,294,219,221,224,223,
+  /* 292 */ 299,297,302,303,293,295,294,228,
+  /* 293 */ 292,302,303,365,367,295,294,
+  /* 294 */ 228,299,292,293,295,220,219,230,
+  /* 295 */ 294,292,293,367,220,219,294,
+  /* 296 */ 304,305,297,299,298,233,
+  /* 297 */ 296,305,300,302,292,299,298,
+  /* 298 */ 233,304,296,297,299,228,227,
+  /* 299 */ 298,296,297,302,292,294,228,227,
+  /* 300 */ 305,306,301,303,302,297,
+  /* 301 */ 300,306,369,371,365,303,302,
+  /* 302 */ 297,305,300,301,303,293,292,299,
+  /* 303 */ 302,300,301,371,365,367,293,292,
+  /* 365 */ 303,301,371,372,366,368,367,293,
+  /* 366 */ 365,371,372,373,375,0,368,367,
+  /* 367 */ 293,303,365,366,368,295,
+  /* 368 */ 367,365,366,375,0,2,
+  /* 369 */ 306,377,370,372,371,301,
+  /* 370 */ 369,377,378,373,372,371,
+  /* 371 */ 301,306,369,370,372,366,365,303,
+  /* 372 */ 371,369,370,378,373,375,366,365,
+  /* 373 */ 372,370,378,374,376,375,366,
+  /* 374 */ 373,378,379,4,376,375,
+  /* 375 */ 366,372,373,374,376,1,0,368,
+  /* 376 */ 375,373,374,379,4,6,1,0,
 };
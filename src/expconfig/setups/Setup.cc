@@ -2,6 +2,7 @@
 
 #include "base/Paths.h"
 #include "base/Logger.h"
+#include "base/StageTimer.h"
 
 #include "calibration/modules/ClusterCorrection.h"
 
@@ -68,9 +69,22 @@ std::string Setup::GetPhysicsFilesDirectory() const
     return std::string(ANT_PATH_DATABASE)+"/"+GetName()+"/physics_files";
 }
 
+namespace {
+Setup_traits::taggerhits_config_t makeTaggerHitsConfig(ant::OptionsPtr opts) {
+    Setup_traits::taggerhits_config_t config;
+    config.DoubleHitWindow    = opts->Get<double>("TaggerDoubleHitWindow", config.DoubleHitWindow);
+    config.AfterPulseWindow   = opts->Get<double>("TaggerAfterPulseWindow", config.AfterPulseWindow);
+    // must cover the CB time window, see taggerhits_config_t
+    config.PromptRandomMargin = opts->Get<double>("TaggerPromptRandomMargin", config.PromptRandomMargin);
+    return config;
+}
+}
+
 Setup::Setup(const std::string& name, OptionsPtr opts) :
     name_(name),
-    includeIgnoredElements(opts->Get<bool>("IncludeIgnoredElements", false))
+    options_(opts->Flatten()),
+    includeIgnoredElements(opts->Get<bool>("IncludeIgnoredElements", false)),
+    taggerHitsConfig(makeTaggerHitsConfig(opts))
 {
     std::string calibrationDataFolder = std::string(ANT_PATH_DATABASE)+"/"+GetName()+"/calibration";
     calibrationDataManager = std::make_shared<calibration::DataManager>(calibrationDataFolder);
@@ -81,18 +95,28 @@ void Setup::BuildMappings(std::vector<UnpackerAcquConfig::hit_mapping_t>& hit_ma
                           std::vector<UnpackerAcquConfig::scaler_mapping_t>& scaler_mappings) const
 {
     // the base setup simply asks its underlying
-    // detectors for the mappings
+    // detectors for the mappings, this is only called
+    // when an Acqu file is opened, so it is not cached
     for(auto detector : detectors) {
         auto cfg = std::dynamic_pointer_cast<UnpackerAcquConfig, Detector_t>(detector);
         if(cfg == nullptr)
             continue;
+        const auto start = StageTimer::Now();
         //std::vector<hit_mapping_t> hit_mappings_;
         //std::vector<scaler_mapping_t> scaler_mappings_;
         cfg->BuildMappings(hit_mappings, scaler_mappings);
+        AddStartupTime("BuildMappings", Detector_t::ToString(detector->Type), start);
         /// \todo check that the detectors do not add overlapping mappings
     }
 }
 
+void Setup::AddStartupTime(const std::string& category, const std::string& name, std::uint64_t start)
+{
+    if(!StageTimer::IsEnabled())
+        return;
+    const auto ticks = StageTimer::Now() - start;
+    StageTimer::Get("Startup/"+category+"/"+name).Add(ticks);
+}
 
 /**
  * @brief Check options for manual modifications of cluster energies
@@ -13,6 +13,7 @@
 #include "calibration/DataManager.h"
 #include "base/piecewise_interval.h"
 #include "base/OptionsList.h"
+#include "base/StageTimer.h"
 
 #include <functional>
 #include <string>
@@ -34,7 +35,9 @@ class Setup :
 {
 private:
     const std::string name_;
+    const std::string options_;
     const bool includeIgnoredElements;
+    const taggerhits_config_t taggerHitsConfig;
 
     ant::PiecewiseInterval<double> prompt = {};
     ant::PiecewiseInterval<double> random = {};
@@ -62,6 +65,10 @@ public:
         return name_;
     }
 
+    virtual std::string GetOptions() const override final {
+        return options_;
+    }
+
     virtual double GetElectronBeamEnergy() const override {
         return std::numeric_limits<double>::quiet_NaN();
     }
@@ -70,6 +77,10 @@ public:
         return includeIgnoredElements;
     }
 
+    virtual taggerhits_config_t GetTaggerHitsConfig() const override {
+        return taggerHitsConfig;
+    }
+
     virtual ant::PiecewiseInterval<double> GetPromptWindows() const override {
         return prompt;
     }
@@ -102,9 +113,18 @@ protected:
     }
     template<typename T, typename... Args>
     void AddCalibration(Args&&... args) {
+        const auto start = StageTimer::Now();
         AddCalibration(std::make_shared<T>(std::forward<Args>(args)...));
+        AddStartupTime("Calibration", calibrations.back()->GetName(), start);
     }
 
+    /**
+     * @brief AddStartupTime records the construction time for the startup profile, if timing is enabled
+     * @param category such as "Calibration", the timer is named Startup/category/name
+     * @param start ticks before construction
+     */
+    static void AddStartupTime(const std::string& category, const std::string& name, std::uint64_t start);
+
     void BuildMappings(std::vector<hit_mapping_t>& hit_mappings,
                        std::vector<scaler_mapping_t>& scaler_mappings) const override;
 
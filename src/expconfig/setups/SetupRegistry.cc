@@ -3,6 +3,7 @@
 #include "Setup.h"
 
 #include "base/Logger.h"
+#include "base/StageTimer.h"
 #include "base/std_ext/string.h"
 
 #include <stdexcept>
@@ -26,7 +27,8 @@ shared_ptr<Setup> SetupRegistry::GetSetup(const string& name)
         auto it_setupcreator = setup_creators.find(name);
         if(it_setupcreator == setup_creators.end())
             return nullptr;
-        // found creator
+        // found creator, constructing includes the detectors and calibrations
+        StageTimer::Scope timing(StageTimer::Get("Startup/Setup/"+name));
         auto setup = it_setupcreator->second(name, get_instance().options);
         if(setup->GetName() != name)
             throw std::runtime_error(std_ext::formatter()
@@ -7,6 +7,7 @@ open(my $fh, "<$inputfile") or die "Cannot open $inputfile: $!\n";
 my $n = 0;
 my $m = 0;
 my @lines;
+my @neighbours;
 while(my $line = <$fh>) {
   chomp $line;
   if($line =~ /Element:/) {
@@ -18,17 +19,28 @@ while(my $line = <$fh>) {
     $TDC =~ s/M\d$//;
     my @xyz = @cols[11..13];
     push(@lines,
-         sprintf("{%3d, {%10.6f, %10.6f, %10.6f}, %04d, %04d, {%%s}}, \n",
+         sprintf("{%3d, {%10.6f, %10.6f, %10.6f}, %04d, %04d, ",
                  $n, @xyz, $ADC, $TDC));
     $n++;
   }
   elsif($line =~ /Next-Neighbour:/) {
     #print $line, "\n";
     my @cols = split(/\s+/,$line);
-    my @neighbours = @cols[3..$#cols];
-    printf($lines[$m], join(",", @neighbours));
+    push(@neighbours, [@cols[3..$#cols]]);
     $m++;
   }
 }
 
 close $fh;
+
+# rows refer to their range in the neighbours table (compressed sparse rows)
+my $offset = 0;
+for(my $i=0;$i<@lines;$i++) {
+  my $nNeighbours = @{$neighbours[$i]};
+  printf("%s%4d, %4d},\n", $lines[$i], $offset, $offset+$nNeighbours);
+  $offset += $nNeighbours;
+}
+print "\n";
+for(my $i=0;$i<@neighbours;$i++) {
+  printf("/* %3d */ %s,\n", $i, join(",", @{$neighbours[$i]}));
+}
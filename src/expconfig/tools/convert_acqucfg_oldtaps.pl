@@ -47,11 +47,18 @@ while (my $line = <$fh>) {
 #print Dumper($data->[16]);
 #print join("", @lines_pbwo4);
 
+# rows refer to their range in the neighbours table (compressed sparse rows)
+my $offset = 0;
 for($n=0;$n<@{$data};$n++) {
   my @xy = @{$data->[$n]->{position}};
   my @channels = @{$data->[$n]->{channels}};
-  my $neighbours = join(",", @{$data->[$n]->{neighbours}});
-  printf("{%3d, {%7.3f, %7.3f}, %04d, %04d, %04d, %04d, %04d, {%s}}, \n", $n, @xy, $channels[0], $channels[1], $channels[1]+100, $channels[1]-200, $channels[1]-100, $neighbours);
+  my $nNeighbours = @{$data->[$n]->{neighbours}};
+  printf("{%3d, {%7.3f, %7.3f}, %04d, %04d, %04d, %04d, %04d, %4d, %4d}, \n", $n, @xy, $channels[0], $channels[1], $channels[1]+100, $channels[1]-200, $channels[1]-100, $offset, $offset+$nNeighbours);
+  $offset += $nNeighbours;
+}
+print "\n";
+for($n=0;$n<@{$data};$n++) {
+  printf("/* %3d */ %s,\n", $n, join(",", @{$data->[$n]->{neighbours}}));
 }
 
 close $fh;
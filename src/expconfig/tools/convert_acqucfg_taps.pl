@@ -86,17 +86,25 @@ while (my $line = <$fh_S>) {
 #print Dumper($data->[16]);
 #print join("", @lines_pbwo4);
 
+# rows refer to their range in the neighbours table (compressed sparse rows)
+my $offset = 0;
+my @neighbours;
 for($n=0;$n<@{$data};$n++) {
   my @xy = @{$data->[$n]->{position}};
   my @channels = @{$data->[$n]->{channels}};
-  my $neighbours = join(",", @{$data->[$n]->{neighbours}});
+  my $nNeighbours = @{$data->[$n]->{neighbours}};
   if(is_pbwo4($n)) {
-    printf("{%3d, {%7.3f, %7.3f}, %04d, %04d, %04d, {%s}}, \n", $n, @xy, @channels, $neighbours);
+    printf("{%3d, {%7.3f, %7.3f}, %04d, %04d, %04d, %4d, %4d}, \n", $n, @xy, @channels, $offset, $offset+$nNeighbours);
   }
   else {
-    #printf("{%3d, {%7.3f, %7.3f}, %04d, %04d, %04d, %04d, %04d, {%s}}, \n", $n, @xy, @channels, $neighbours);
+    #printf("{%3d, {%7.3f, %7.3f}, %04d, %04d, %04d, %04d, %04d, %4d, %4d}, \n", $n, @xy, @channels, $offset, $offset+$nNeighbours);
+    next;
   }
+  push(@neighbours, sprintf("/* %3d */ %s,\n", $n, join(",", @{$data->[$n]->{neighbours}})));
+  $offset += $nNeighbours;
 }
+print "\n";
+print join("", @neighbours);
 
 close $fh;
 close $fh_S;
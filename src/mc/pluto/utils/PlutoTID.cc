@@ -3,6 +3,7 @@
 #include "base/WrapTFile.h"
 #include "base/Logger.h"
 #include "tree/TID.h"
+#include "tree/TIDIndex.h"
 
 #include "TTree.h"
 #include "TRandom2.h"
@@ -52,13 +53,18 @@ void PlutoTID::AddTID(const std::string &filename)
         TRandom2 rng;
         rng.SetSeed();
 
+        TIDIndex index;
+
         for(decltype(nEvents) i=0; i<nEvents; ++i) {
 
             unsigned r = floor(rng.Uniform(1 << random_bits));
             tid.Lower = (i << random_bits) + r;
 
             data_tid->Fill();
+            index.Add(tid, i);
         }
+
+        index.Write(*data_tid->GetDirectory(), tidtree_name);
     } else {
         LOG(WARNING) << "No pluto data Tree found";
     }
@@ -75,9 +81,15 @@ void PlutoTID::CopyTIDPlutoGeant(const string& pluto_filename, const string& gea
     if(intree) {
         WrapTFileOutput outfile(geant_filename, true, WrapTFileOutput::mode_t::update);
         intree->SetBranchStatus("tid",1);
+        // entries are the same, so the index can be copied as well
+        TIDIndex index;
+        if(!index.Read(input, tidtree_name))
+            index = TIDIndex::Build(*intree, "tid");
+
         auto outtree = intree->CloneTree(-1,"fast SortBasketsByBranch");
         outtree->SetName(geant_tidtree_name.c_str());
         outtree->Write();
+        index.Write(*outtree->GetDirectory(), geant_tidtree_name);
 
     } else {
         LOG(ERROR) << "TTree \"" << tidtree_name << "\" not found";
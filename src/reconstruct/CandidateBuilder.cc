@@ -8,6 +8,9 @@
 #include "base/std_ext/math.h"
 #include "base/std_ext/misc.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace ant;
 using namespace std;
 using namespace ant::reconstruct;
@@ -25,6 +28,39 @@ CandidateBuilder::CandidateBuilder() :
     tapsveto(ExpConfig::Setup::GetDetector<det_type<decltype(tapsveto)>::type>()),
     config(ExpConfig::Setup::Get().GetCandidateBuilderConfig())
 {
+    // twice the PID segmentation, as one PID element
+    // covers about two elements in phi including epsilon
+    if(pid)
+        pid_cb_nPhiBins = std::max(1u, 2*pid->GetNChannels());
+
+    if(taps)
+        taps_veto_map.Build(*taps);
+}
+
+void CandidateBuilder::taps_veto_map_t::Build(const detector::TAPS& taps)
+{
+    const auto nChannels = taps.GetNChannels();
+
+    // convert neighbouring baf2/pbwo4 channel ids to channel identifiers
+    // which could be matched with Veto channels
+    Center.resize(nChannels);
+    vector<vector<unsigned>> neighbours(nChannels);
+    unsigned maxVetoChannel = 0;
+    for(unsigned ch=0;ch<nChannels;ch++) {
+        Center[ch] = taps.GetHexChannel(ch);
+        for(auto neighbour : taps.GetClusterElement(ch)->Neighbours) {
+            const auto hexChannel = taps.GetHexChannel(neighbour);
+            neighbours[ch].push_back(hexChannel);
+            maxVetoChannel = std::max(maxVetoChannel, hexChannel);
+        }
+    }
+
+    NWords = maxVetoChannel/64 + 1;
+    Neighbours.assign(nChannels*NWords, 0);
+    for(unsigned ch=0;ch<nChannels;ch++) {
+        for(auto hexChannel : neighbours[ch])
+            Neighbours[ch*NWords + hexChannel/64] |= std::uint64_t(1) << (hexChannel % 64);
+    }
 }
 
 void CandidateBuilder::Build_PID_CB(sorted_clusters_t& sorted_clusters,
@@ -44,6 +80,37 @@ void CandidateBuilder::Build_PID_CB(sorted_clusters_t& sorted_clusters,
     if(pid_clusters.empty())
         return;
 
+    // sort the CB clusters into phi bins (keeping their order within each bin),
+    // then each PID cluster only checks the bins covering its phi window
+    const int nBins = pid_cb_nPhiBins;
+    const double binWidth = 2*M_PI/nBins;
+    auto get_bin = [nBins, binWidth] (double phi) {
+        if(!std::isfinite(phi))
+            return 0;
+        const auto bin = static_cast<int>(std::floor((phi + M_PI)/binWidth));
+        return std::max(0, std::min(bin, nBins-1));
+    };
+
+    vector<TClusterList::iterator> cb_its;
+    vector<int> cb_bins;
+    vector<unsigned> binStart(nBins+1, 0);
+    for(auto it_cb_cluster = cb_clusters.begin(); it_cb_cluster != cb_clusters.end(); ++it_cb_cluster) {
+        cb_its.push_back(it_cb_cluster);
+        cb_bins.push_back(get_bin(it_cb_cluster->Position.Phi()));
+        binStart[cb_bins.back()+1]++;
+    }
+    for(int bin=0;bin<nBins;bin++)
+        binStart[bin+1] += binStart[bin];
+    vector<unsigned> binned(cb_its.size());
+    {
+        auto fill = binStart;
+        for(unsigned i=0;i<cb_its.size();i++)
+            binned[fill[cb_bins[i]]++] = i;
+    }
+
+    vector<bool> cb_matched(cb_its.size(), false);
+    vector<unsigned> matches;
+
     auto it_pid_cluster = pid_clusters.begin();
 
     while(it_pid_cluster != pid_clusters.end()) {
@@ -52,46 +119,73 @@ void CandidateBuilder::Build_PID_CB(sorted_clusters_t& sorted_clusters,
         const auto pid_phi = pid_cluster.Position.Phi();
         const auto dphi_max = (pid->dPhi(pid_cluster.CentralElement) + config.PID_Phi_Epsilon);
 
-        bool matched = false;
+        auto check_bin = [&] (int bin) {
+            for(auto j=binStart[bin]; j<binStart[bin+1]; j++) {
+                const auto i = binned[j];
+                if(cb_matched[i])
+                    continue;
+                const auto cb_phi = cb_its[i]->Position.Phi();
+
+                // calculate phi angle difference.
+                // Phi_mpi_pi() takes care of wrap-arounds at 180/-180 deg
+                const auto dphi = fabs(vec2::Phi_mpi_pi(cb_phi - pid_phi));
+                if(dphi < dphi_max ) // match!
+                    matches.push_back(i);
+            }
+        };
 
-        auto it_cb_cluster = cb_clusters.begin();
+        matches.clear();
 
-        while(it_cb_cluster != cb_clusters.end()) {
-            auto& cb_cluster = *it_cb_cluster;
-            const auto cb_phi = cb_cluster.Position.Phi();
+        // add one bin as margin on each side for rounding at the bin edges
+        const double lo = std::floor((pid_phi - dphi_max + M_PI)/binWidth) - 1;
+        const double hi = std::floor((pid_phi + dphi_max + M_PI)/binWidth) + 1;
+        if(std::isfinite(lo) && std::isfinite(hi) && hi - lo + 1 < nBins) {
+            for(auto b = static_cast<int>(lo); b <= static_cast<int>(hi); b++)
+                check_bin(((b % nBins) + nBins) % nBins);
+        }
+        else {
+            for(int bin=0;bin<nBins;bin++)
+                check_bin(bin);
+        }
 
-            // calculate phi angle difference.
-            // Phi_mpi_pi() takes care of wrap-arounds at 180/-180 deg
-            const auto dphi = fabs(vec2::Phi_mpi_pi(cb_phi - pid_phi));
-            if(dphi < dphi_max ) { // match!
+        // keep the order of the CB clusters as given
+        std::sort(matches.begin(), matches.end());
 
-                candidates.emplace_back(
-                            Detector_t::Type_t::CB | Detector_t::Type_t::PID,
-                            cb_cluster.Energy,
-                            cb_cluster.Position.Theta(),
-                            cb_cluster.Position.Phi(),
-                            cb_cluster.Time,
-                            cb_cluster.Hits.size(),
-                            pid_cluster.Energy,
-                            numeric_limits<double>::quiet_NaN(), // no tracker information
-                            TClusterList{it_cb_cluster, it_pid_cluster}
-                            );
-                all_clusters.push_back(it_cb_cluster);
-                it_cb_cluster = cb_clusters.erase(it_cb_cluster);
-                matched = true;
-            }
-            else {
-                ++it_cb_cluster;
-            }
+        for(auto i : matches) {
+            auto it_cb_cluster = cb_its[i];
+            auto& cb_cluster = *it_cb_cluster;
+            candidates.emplace_back(
+                        Detector_t::Type_t::CB | Detector_t::Type_t::PID,
+                        cb_cluster.Energy,
+                        cb_cluster.Position.Theta(),
+                        cb_cluster.Position.Phi(),
+                        cb_cluster.Time,
+                        cb_cluster.Hits.size(),
+                        pid_cluster.Energy,
+                        numeric_limits<double>::quiet_NaN(), // no tracker information
+                        TClusterList{it_cb_cluster, it_pid_cluster}
+                        );
+            all_clusters.push_back(it_cb_cluster);
+            cb_matched[i] = true;
         }
 
-        if(matched) {
+        if(!matches.empty()) {
             all_clusters.push_back(it_pid_cluster);
             it_pid_cluster = pid_clusters.erase(it_pid_cluster);
         } else {
             ++it_pid_cluster;
         }
     }
+
+    // remove the matched CB clusters at once
+    if(std::find(cb_matched.begin(), cb_matched.end(), true) != cb_matched.end()) {
+        TClusterList unmatched;
+        for(unsigned i=0;i<cb_its.size();i++) {
+            if(!cb_matched[i])
+                unmatched.push_back(cb_its[i]);
+        }
+        cb_clusters = std::move(unmatched);
+    }
 }
 
 void CandidateBuilder::Build_TAPS_Veto(sorted_clusters_t& sorted_clusters,
@@ -113,28 +207,19 @@ void CandidateBuilder::Build_TAPS_Veto(sorted_clusters_t& sorted_clusters,
 
 
     auto it_taps_cluster = taps_clusters.begin();
-    vector<unsigned> neighbours;
 
     while (it_taps_cluster != taps_clusters.end()) {
 
         const auto& taps_cluster = *it_taps_cluster;
-        auto center = taps->GetHexChannel(taps_cluster.CentralElement);
+        const auto central = taps_cluster.CentralElement;
+        const auto center = taps_veto_map.Center[central];
+
+        // only check neighbouring Veto elements for clusters with at least 2 crystals
+        const bool checkNeighbours = taps_cluster.Hits.size() > 1;
 
         auto it_veto_cluster = veto_clusters.begin();
 
         auto matched_veto = veto_clusters.end();
-        neighbours.clear();
-
-        // only check neighbouring Veto elements for clusters with at least 2 crystals
-        if (taps_cluster.Hits.size() > 1) {
-            neighbours = taps->GetClusterElement(taps_cluster.CentralElement)->Neighbours;
-            // convert neighbouring baf2/pbwo4 channel ids to channel identifiers
-            // which could be matched with Veto channels
-            transform(neighbours.begin(), neighbours.end(),
-                      neighbours.begin(), [=] (const unsigned channel) {
-                return taps->GetHexChannel(channel);
-            });
-        }
 
         while (it_veto_cluster != veto_clusters.end()) {
 
@@ -145,8 +230,7 @@ void CandidateBuilder::Build_TAPS_Veto(sorted_clusters_t& sorted_clusters,
                 matched_veto = it_veto_cluster;
 
             // check the neighbouring Vetos
-            if (find(neighbours.begin(), neighbours.end(),
-                     veto_cluster.CentralElement) != neighbours.end()) {
+            if (checkNeighbours && taps_veto_map.IsNeighbour(central, veto_cluster.CentralElement)) {
                 // in case the currently checked Veto is one of the central elements neighbours,
                 // check if the deposited energy is higher than in the stored matched Veto element (if existent)
                 if (matched_veto == veto_clusters.end() || veto_cluster.Energy > matched_veto->Energy)
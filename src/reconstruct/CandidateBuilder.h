@@ -10,6 +10,8 @@
 #include <map>
 #include <list>
 #include <memory>
+#include <vector>
+#include <cstdint>
 
 namespace ant {
 
@@ -43,6 +45,32 @@ protected:
 
     const expconfig::Setup_traits::candidatebuilder_config_t config;
 
+    /**
+     * @brief pid_cb_nPhiBins number of phi bins the CB clusters are sorted into for PID matching
+     */
+    unsigned pid_cb_nPhiBins = 1;
+
+    /**
+     * @brief The taps_veto_map_t struct precomputes for each TAPS element
+     * its hexagonal veto element and the veto elements of its neighbours
+     */
+    struct taps_veto_map_t {
+        std::vector<unsigned> Center;
+        // bitmap with NWords per TAPS element
+        std::vector<std::uint64_t> Neighbours;
+        unsigned NWords = 0;
+
+        void Build(const expconfig::detector::TAPS& taps);
+
+        bool IsNeighbour(unsigned taps_channel, unsigned veto_channel) const {
+            const auto word = veto_channel / 64;
+            if(word >= NWords)
+                return false;
+            return (Neighbours[taps_channel*NWords + word] >> (veto_channel % 64)) & 1;
+        }
+    };
+    taps_veto_map_t taps_veto_map;
+
     void Build_PID_CB(
             sorted_clusters_t& sorted_clusters,
             candidates_t& candidates, clusters_t& all_clusters
@@ -3,12 +3,15 @@
 #include "Clustering.h"
 #include "CandidateBuilder.h"
 #include "UpdateableManager.h"
+#include "ReconstructCache.h"
 
 #include "expconfig/ExpConfig.h"
 
 #include "tree/TEventData.h"
 
 #include "base/std_ext/container.h"
+#include "base/std_ext/string.h"
+#include "base/CounterRNG.h"
 #include "base/Logger.h"
 
 #include <algorithm>
@@ -16,6 +19,11 @@
 #include <iterator>
 #include <limits>
 #include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <typeinfo>
+#include <map>
 
 using namespace std;
 using namespace ant;
@@ -51,6 +59,31 @@ List getSortedHooks() {
     return hooks;
 }
 
+template<typename List>
+vector<StageTimer*> getHookTimers(const List& hooks) {
+    vector<string> names;
+    for(const auto& hook : hooks) {
+        const auto& h = *hook;
+        auto demangled = abi::__cxa_demangle(typeid(h).name(), nullptr, nullptr, nullptr);
+        string name = demangled ? demangled : typeid(h).name();
+        free(demangled);
+        if(std_ext::string_starts_with(name, "ant::"))
+            name = name.substr(5);
+        names.emplace_back(move(name));
+    }
+    // each hook gets its own timer, so hooks of the same class
+    // (such as the per-detector calibration::Time) are numbered in their order
+    vector<StageTimer*> timers;
+    map<string, unsigned> seen;
+    for(const auto& name : names) {
+        auto timername = "ReconstructHook/"+name;
+        if(count(names.begin(), names.end(), name)>1)
+            timername += std_ext::formatter() << "#" << seen[name]++;
+        timers.push_back(&StageTimer::Get(timername));
+    }
+    return timers;
+}
+
 Reconstruct::sorted_detectors_t Reconstruct::sorted_detectors_t::Build()
 {
     sorted_detectors_t sorted_detectors;
@@ -65,6 +98,11 @@ Reconstruct::sorted_detectors_t Reconstruct::sorted_detectors_t::Build()
 
 Reconstruct::Reconstruct(clustering_t clustering_, candidatebuilder_t candidatebuilder_) :
     includeIgnoredElements(ExpConfig::Setup::Get().GetIncludeIgnoredElements()),
+    taggerDoubleHitWindow(ExpConfig::Setup::Get().GetTaggerHitsConfig().DoubleHitWindow),
+    taggerAfterPulseWindow(ExpConfig::Setup::Get().GetTaggerHitsConfig().AfterPulseWindow),
+    taggerTimeWindows(GetTaggerTimeWindows(ExpConfig::Setup::Get().GetPromptWindows(),
+                                           ExpConfig::Setup::Get().GetRandomWindows(),
+                                           ExpConfig::Setup::Get().GetTaggerHitsConfig().PromptRandomMargin)),
     sorted_detectors(sorted_detectors_t::Build()),
     hooks_readhits(getSortedHooks<decltype(hooks_readhits)>()),
     hooks_clusterhits(getSortedHooks<decltype(hooks_clusterhits)>()),
@@ -72,23 +110,55 @@ Reconstruct::Reconstruct(clustering_t clustering_, candidatebuilder_t candidateb
     hooks_eventdata(getSortedHooks<decltype(hooks_eventdata)>()),
     clustering(move(clustering_)),
     candidatebuilder(move(candidatebuilder_)),
-    updateablemanager(std_ext::make_unique<UpdateableManager>(ExpConfig::Setup::Get().GetUpdateables()))
+    updateablemanager(std_ext::make_unique<UpdateableManager>(ExpConfig::Setup::Get().GetUpdateables())),
+    timer_reconstruct(StageTimer::Get("Reconstruct")),
+    timer_buildhits(StageTimer::Get("Reconstruct/BuildHits")),
+    timer_clustering(StageTimer::Get("Reconstruct/Clustering")),
+    timer_candidatebuilder(StageTimer::Get("Reconstruct/CandidateBuilder")),
+    timers_readhits(getHookTimers(hooks_readhits)),
+    timers_clusterhits(getHookTimers(hooks_clusterhits)),
+    timers_clusters(getHookTimers(hooks_clusters)),
+    timers_eventdata(getHookTimers(hooks_eventdata))
 {
+    // the windows are applied to the raw tagger time, but defined for the one corrected
+    // by the CB reference time, which usually lies within the CB time window of +-25ns
+    constexpr double typicalCBTimeSpread = 25; // ns
+    const auto margin = ExpConfig::Setup::Get().GetTaggerHitsConfig().PromptRandomMargin;
+    LOG_IF(margin < typicalCBTimeSpread, WARNING)
+            << "TaggerPromptRandomMargin=" << margin << "ns is smaller than the typical CB time spread of "
+            << typicalCBTimeSpread << "ns, prompt tagger hits might be dropped";
 }
 
 // implement the destructor here,
 // makes forward declaration work properly
 Reconstruct::~Reconstruct() = default;
 
+void Reconstruct::EnableCache(const string& filename)
+{
+    auto calibrationDataManager = ExpConfig::Setup::Get().GetCalibrationDataManager();
+    if(!calibrationDataManager)
+        throw Exception("Setup does not provide calibration data manager, needed for reconstruct cache");
+    cache = std_ext::make_unique<ReconstructCache>(filename, calibrationDataManager);
+}
+
 void Reconstruct::DoReconstruct(TEventData& reconstructed) const
 {
     // ignore empty events
     if(reconstructed.DetectorReadHits.empty())
         return;
 
+    StageTimer::Scope timing(timer_reconstruct);
+
     // update the updateables :)
     updateablemanager->UpdateParameters(reconstructed.ID);
 
+    // smearing hooks draw their random numbers for this event
+    CounterRNG::SetEvent(reconstructed.ID.Value());
+
+    // reuse the event from the cache if the calibrations applicable to it did not change
+    if(cache && cache->Restore(reconstructed))
+        return;
+
     // apply the hooks for detector read hits (mostly calibrations),
     // note that this also changes the hits itself
 
@@ -101,41 +171,58 @@ void Reconstruct::DoReconstruct(TEventData& reconstructed) const
     // put into the AdaptorTClusterHit to track Energy/Timing information
     // for subsequent clustering
     sorted_bydetectortype_t<TClusterHit> sorted_clusterhits;
-    BuildHits(sorted_clusterhits, reconstructed.TaggerHits);
+    {
+        StageTimer::Scope timing(timer_buildhits);
+        BuildHits(sorted_clusterhits, reconstructed.TaggerHits);
+    }
 
     // apply hooks which modify clusterhits
+    auto it_timer = timers_clusterhits.begin();
     for(const auto& hook : hooks_clusterhits) {
+        StageTimer::Scope timing(**it_timer++);
         hook->ApplyTo(sorted_clusterhits);
     }
 
     // then build clusters (at least for calorimeters this is not trivial)
     sorted_clusters_t sorted_clusters;
-    BuildClusters(move(sorted_clusterhits), sorted_clusters);
+    {
+        StageTimer::Scope timing(timer_clustering);
+        BuildClusters(move(sorted_clusterhits), sorted_clusters);
+    }
 
     // apply hooks which modify clusters
+    it_timer = timers_clusters.begin();
     for(const auto& hook : hooks_clusters) {
+        StageTimer::Scope timing(**it_timer++);
         hook->ApplyTo(sorted_clusters);
     }
 
     // do the candidate building (if available)
-    if(candidatebuilder) {
-        candidatebuilder->Build(move(sorted_clusters),
-                                reconstructed.Candidates, reconstructed.Clusters);
-    }
-    else {
-        /// \todo it would be better if a seperate "simple" candidatebuilder was used here
-        for(auto& det_entry : sorted_clusters) {
-            auto& clusters = det_entry.second;
-            for(auto it_cluster = clusters.begin(); it_cluster != clusters.end(); ++it_cluster)
-                reconstructed.Clusters.push_back(it_cluster);
+    {
+        StageTimer::Scope timing(timer_candidatebuilder);
+        if(candidatebuilder) {
+            candidatebuilder->Build(move(sorted_clusters),
+                                    reconstructed.Candidates, reconstructed.Clusters);
+        }
+        else {
+            /// \todo it would be better if a seperate "simple" candidatebuilder was used here
+            for(auto& det_entry : sorted_clusters) {
+                auto& clusters = det_entry.second;
+                for(auto it_cluster = clusters.begin(); it_cluster != clusters.end(); ++it_cluster)
+                    reconstructed.Clusters.push_back(it_cluster);
+            }
         }
     }
 
     // apply hooks which may modify the whole event
+    it_timer = timers_eventdata.begin();
     for(const auto& hook : hooks_eventdata) {
+        StageTimer::Scope timing(**it_timer++);
         hook->ApplyTo(reconstructed);
     }
 
+    if(cache)
+        cache->Store(reconstructed);
 }
 
 void Reconstruct::ApplyHooksToReadHits(std::vector<TDetectorReadHit>& detectorReadHits) const
@@ -151,7 +238,9 @@ void Reconstruct::ApplyHooksToReadHits(std::vector<TDetectorReadHit>& detectorRe
 
     // apply calibration
     // this may change the given readhits
+    auto it_timer = timers_readhits.begin();
     for(const auto& hook : hooks_readhits) {
+        StageTimer::Scope timing(**it_timer++);
         hook->ApplyTo(sorted_readhits);
     }
 }
@@ -237,13 +326,11 @@ void Reconstruct::HandleTagger(const shared_ptr<TaggerDetector_t>& taggerdetecto
                                std::vector<TTaggerHit>& taggerhits
                                ) const
 {
-
-    // gather electron hits by channel
-    struct taggerhit_t {
-        std::vector<TDetectorReadHit::Value_t> Timings;
-        std::vector<TDetectorReadHit::Value_t> Energies;
-    };
-    map<unsigned, taggerhit_t > hits;
+    // gather electron hits by channel into the flat arrays,
+    // which keep their capacity from event to event
+    auto& arrays = tagger_arrays;
+    if(arrays.Channels.size() < taggerdetector->GetNChannels())
+        arrays.Channels.resize(taggerdetector->GetNChannels());
 
     for(const TDetectorReadHit& readhit : readhits) {
         if(!includeIgnoredElements && taggerdetector->IsIgnored(readhit.Channel))
@@ -253,30 +340,112 @@ void Reconstruct::HandleTagger(const shared_ptr<TaggerDetector_t>& taggerdetecto
         if(readhit.Values.empty())
             continue;
 
-        auto& item = hits[readhit.Channel];
+        if(readhit.Channel >= arrays.Channels.size())
+            arrays.Channels.resize(readhit.Channel+1);
+        auto& item = arrays.Channels[readhit.Channel];
+        if(!item.Seen) {
+            item.Seen = true;
+            arrays.Seen.push_back(readhit.Channel);
+        }
+
         if(readhit.ChannelType == Channel_t::Type_t::Timing) {
-            std_ext::concatenate(item.Timings, readhit.Values);
+            for(const auto& v : readhit.Values)
+                arrays.Hits.emplace_back(readhit.Channel, v.Calibrated);
+            item.NTimes += readhit.Values.size();
         }
-        else if(readhit.ChannelType == Channel_t::Type_t::Integral) {
-            std_ext::concatenate(item.Energies, readhit.Values);
+        else if(readhit.ChannelType == Channel_t::Type_t::Integral && !item.HasEnergy) {
+            /// \todo handle energies here better? (actually test with appropiate QDC run)
+            item.HasEnergy = true;
+            item.Energy = readhit.Values.front().Calibrated;
         }
     }
 
-    for(const auto& hit : hits) {
-        const auto channel = hit.first;
-        const auto& item = hit.second;
-        // create a taggerhit from each timing for now
-        /// \todo handle double hits here?
-        /// \todo handle energies here better? (actually test with appropiate QDC run)
-        const auto qdc_energy = item.Energies.empty() ? std_ext::NaN : item.Energies.front().Calibrated;
-        for(const auto& timing : item.Timings) {
-            taggerhits.emplace_back(channel,
-                                    taggerdetector->GetPhotonEnergy(channel),
-                                    timing.Calibrated,
-                                    qdc_energy
-                                    );
+    // group the times by channel (counting sort), keeping their order within a channel
+    sort(arrays.Seen.begin(), arrays.Seen.end());
+    unsigned offset = 0;
+    for(auto channel : arrays.Seen) {
+        auto& item = arrays.Channels[channel];
+        item.Offset = offset;
+        offset += item.NTimes;
+        item.NTimes = 0;
+    }
+    arrays.Times.resize(offset);
+    for(const auto& hit : arrays.Hits) {
+        auto& item = arrays.Channels[hit.first];
+        arrays.Times[item.Offset + item.NTimes++] = hit.second;
+    }
+
+    const bool merge = taggerDoubleHitWindow > 0 || taggerAfterPulseWindow > 0;
+    for(auto channel : arrays.Seen) {
+        auto& item = arrays.Channels[channel];
+        auto first = arrays.Times.begin() + item.Offset;
+        auto last = first + item.NTimes;
+        if(merge)
+            last = MergeTaggerTimes(first, last, taggerDoubleHitWindow, taggerAfterPulseWindow);
+
+        if(first != last) {
+            const auto photonE = taggerdetector->GetPhotonEnergy(channel);
+            const auto qdc_energy = item.HasEnergy ? item.Energy : std_ext::NaN;
+            for(auto it = first; it != last; ++it) {
+                // drop hits which can't be prompt or random anyway
+                if(!taggerTimeWindows.empty() && !taggerTimeWindows.Contains(*it))
+                    continue;
+                taggerhits.emplace_back(channel, photonE, *it, qdc_energy);
+            }
         }
+
+        // ready for the next event
+        item = tagger_channel_t();
     }
+
+    arrays.Seen.clear();
+    arrays.Hits.clear();
+}
+
+vector<double>::iterator Reconstruct::MergeTaggerTimes(
+        vector<double>::iterator first, vector<double>::iterator last,
+        double doubleHitWindow, double afterPulseWindow)
+{
+    // NaN times can't be ordered, leave them at the end
+    const auto last_sane = stable_partition(first, last, [] (double t) { return !std::isnan(t); });
+    sort(first, last_sane);
+
+    auto out = first;
+    for(auto it = first; it != last_sane; ) {
+        // double hits are the same electron seen more than once
+        auto next = it+1;
+        double sum = *it;
+        while(next != last_sane && *next - *(next-1) < doubleHitWindow)
+            sum += *next++;
+        const double time = sum/distance(it, next);
+
+        // after-pulses follow the electron's hit
+        while(afterPulseWindow > 0 && next != last_sane && *next - time <= afterPulseWindow)
+            ++next;
+
+        *out++ = time;
+        it = next;
+    }
+
+    return move(last_sane, last, out);
+}
+
+PiecewiseInterval<double> Reconstruct::GetTaggerTimeWindows(
+        const PiecewiseInterval<double>& prompt, const PiecewiseInterval<double>& random,
+        double margin)
+{
+    PiecewiseInterval<double> windows;
+    if(std::isnan(margin))
+        return windows;
+
+    for(const auto& window : prompt)
+        windows.emplace_back(window.Start()-margin, window.Stop()+margin);
+    for(const auto& window : random)
+        windows.emplace_back(window.Start()-margin, window.Stop()+margin);
+
+    // join the overlapping ones, usually leaves one window
+    windows.Compact();
+    return windows;
 }
 
 void Reconstruct::BuildClusters(
@@ -2,8 +2,11 @@
 
 #include <memory>
 #include <list>
+#include <vector>
 
 #include "Reconstruct_traits.h"
+#include "base/StageTimer.h"
+#include "base/piecewise_interval.h"
 
 namespace ant {
 
@@ -11,6 +14,7 @@ struct TTaggerHit;
 
 namespace reconstruct {
 class UpdateableManager;
+class ReconstructCache;
 }
 
 class Reconstruct : public Reconstruct_traits {
@@ -31,6 +35,13 @@ public:
 
     virtual ~Reconstruct();
 
+    /**
+     * @brief EnableCache reuses the reconstructed events of a previous pass over the same input,
+     * if their calibration did not change, see reconstruct::ReconstructCache
+     * @param filename of the cache file, created if not existing
+     */
+    void EnableCache(const std::string& filename);
+
     class Exception : public std::runtime_error {
         using std::runtime_error::runtime_error; // use base class constructor
     };
@@ -39,6 +50,12 @@ protected:
 
     const bool includeIgnoredElements = false;
 
+    // tagger hit building, see expconfig::Setup_traits::taggerhits_config_t
+    const double taggerDoubleHitWindow;
+    const double taggerAfterPulseWindow;
+    // prompt and random windows widened by the margin, empty if not filtering
+    const PiecewiseInterval<double> taggerTimeWindows;
+
     // sorted_readhits is mutable in order to
     using sorted_readhits_t = ReconstructHook::Base::readhits_t;
     mutable sorted_readhits_t sorted_readhits;
@@ -56,6 +73,41 @@ protected:
             const std::vector<std::reference_wrapper<TDetectorReadHit>>& readhits,
             std::vector<TTaggerHit>& taggerhits) const;
 
+    /**
+     * @brief MergeTaggerTimes sorts the hit times of one tagger channel and merges them
+     * @param first,last the times, NaN ones are kept unchanged at the end
+     * @param doubleHitWindow successive times closer than this are merged into their mean, 0 disables
+     * @param afterPulseWindow times up to this after a kept time are dropped, 0 disables
+     * @return the new end of the times
+     */
+    static std::vector<double>::iterator MergeTaggerTimes(
+            std::vector<double>::iterator first, std::vector<double>::iterator last,
+            double doubleHitWindow, double afterPulseWindow);
+
+    /**
+     * @brief GetTaggerTimeWindows widens the prompt and random windows by the margin
+     * @return the merged windows, empty if the margin is NaN or there are no windows
+     */
+    static PiecewiseInterval<double> GetTaggerTimeWindows(
+            const PiecewiseInterval<double>& prompt, const PiecewiseInterval<double>& random,
+            double margin);
+
+    // flat per-channel arrays for HandleTagger, reused for each event
+    struct tagger_channel_t {
+        bool Seen = false;
+        bool HasEnergy = false;
+        double Energy = 0;
+        unsigned NTimes = 0;
+        unsigned Offset = 0;
+    };
+    struct tagger_arrays_t {
+        std::vector<tagger_channel_t> Channels;            // indexed by channel
+        std::vector<unsigned> Seen;                        // channels seen in this event
+        std::vector<std::pair<unsigned, double>> Hits;     // channel and time, as read
+        std::vector<double> Times;                         // grouped by channel
+    };
+    mutable tagger_arrays_t tagger_arrays;
+
     using sorted_clusterhits_t = ReconstructHook::Base::clusterhits_t;
     using sorted_clusters_t = ReconstructHook::Base::clusters_t;
     void BuildClusters(const sorted_clusterhits_t& sorted_clusterhits,
@@ -101,6 +153,18 @@ protected:
     const clustering_t       clustering;
     const candidatebuilder_t candidatebuilder;
     const std::unique_ptr<reconstruct::UpdateableManager> updateablemanager;
+    std::unique_ptr<reconstruct::ReconstructCache> cache;
+
+    // timers for the stages and the hooks (in same order as hooks_*), see StageTimer::Enable
+    StageTimer& timer_reconstruct;
+    StageTimer& timer_buildhits;
+    StageTimer& timer_clustering;
+    StageTimer& timer_candidatebuilder;
+    using timers_t = std::vector<StageTimer*>;
+    const timers_t timers_readhits;
+    const timers_t timers_clusterhits;
+    const timers_t timers_clusters;
+    const timers_t timers_eventdata;
 };
 
 }
@@ -0,0 +1,373 @@
+#include "ReconstructCache.h"
+
+#include "expconfig/ExpConfig.h"
+#include "calibration/DataManager.h"
+
+#include "tree/TEventData.h"
+#include "tree/stream_TBuffer.h" // for cereal
+
+#include "base/CounterRNG.h"
+#include "base/GitInfo.h"
+#include "base/std_ext/hash.h"
+#include "base/Logger.h"
+
+#include <cstdio>
+#include <cstring>
+#include <streambuf>
+#include <tuple>
+
+using namespace std;
+using namespace ant;
+using namespace ant::reconstruct;
+
+// tell cereal to use the correct TParticle load/save due to inheritance from LorentzVec
+namespace cereal
+{
+  template <class Archive>
+  struct specialize<Archive, TParticle, cereal::specialization::member_load_save> {};
+}
+
+namespace {
+
+constexpr char     FileMarker[8] = {'A','n','t','R','e','c','o','C'};
+constexpr uint32_t FileVersion = 1;
+
+// reads the cached event from memory
+struct membuf_t : std::streambuf {
+    membuf_t(char* begin, char* end) {
+        setg(begin, begin, end);
+    }
+};
+
+template<typename T>
+void write(ostream& s, const T& v) {
+    s.write(reinterpret_cast<const char*>(addressof(v)), sizeof(v));
+}
+
+void write(ostream& s, const string& v) {
+    write(s, uint32_t(v.size()));
+    s.write(v.data(), v.size());
+}
+
+template<typename T>
+bool read(istream& s, T& v) {
+    s.read(reinterpret_cast<char*>(addressof(v)), sizeof(v));
+    return bool(s);
+}
+
+bool read(istream& s, string& v) {
+    uint32_t n = 0;
+    if(!read(s, n))
+        return false;
+    v.resize(n);
+    s.read(&v[0], n);
+    return bool(s);
+}
+
+string makeVersion() {
+    // the reconstruction depends on the software, the setup with its options
+    // (such as cluster smearing, ignored elements and the tagger hit merging)
+    // and for MC on the seed. No other Ant flag changes the reconstruction.
+    const auto& setup = ExpConfig::Setup::Get();
+    return std_ext::formatter()
+            << GitInfo().GetDescription() << " "
+            << setup.GetName() << " "
+            << "options=" << setup.GetOptions() << " "
+            << "seed=" << CounterRNG::GetSeed();
+}
+
+uint64_t hashRawHits(const TEventData& reconstructed) {
+    std_ext::fnv1a_t h;
+    h.add(reconstructed.Trigger.DAQEventID);
+    h.add(reconstructed.DetectorReadHits.size());
+    for(const TDetectorReadHit& readhit : reconstructed.DetectorReadHits) {
+        h.add(readhit.DetectorType);
+        h.add(readhit.ChannelType);
+        h.add(readhit.Channel);
+        h.add(readhit.RawData);
+        // Geant input provides values instead of raw data
+        h.add(readhit.Values.size());
+        for(const auto& value : readhit.Values)
+            h.add(value.Uncalibrated);
+    }
+    return h.Value;
+}
+
+} // namespace
+
+ReconstructCache::ReconstructCache(const string& filename_,
+                                   shared_ptr<const calibration::DataManager> calibrationDataManager_) :
+    filename(filename_),
+    filename_new(filename_+".new"),
+    calibrationDataManager(move(calibrationDataManager_)),
+    previous(filename, ios::binary),
+    current(filename_new, ios::binary | ios::trunc)
+{
+    if(!current)
+        throw Exception("Cannot open reconstruct cache "+filename_new+" for writing");
+
+    const auto version = makeVersion();
+    write(current, FileMarker);
+    write(current, FileVersion);
+    write(current, version);
+
+    if(!previous) {
+        LOG(INFO) << "Reconstruct cache " << filename << " not found, creating new one";
+        return;
+    }
+
+    char marker[sizeof(FileMarker)];
+    uint32_t fileversion = 0;
+    string previous_version;
+    if(!read(previous, marker) || memcmp(marker, FileMarker, sizeof(marker)) != 0
+       || !read(previous, fileversion) || fileversion != FileVersion
+       || !read(previous, previous_version)) {
+        LOG(WARNING) << "Reconstruct cache " << filename << " has unknown format, creating new one";
+        previous.close();
+        return;
+    }
+    if(previous_version != version) {
+        LOG(INFO) << "Reconstruct cache " << filename << " was made with '" << previous_version
+                  << "' instead of '" << version << "', creating new one";
+        previous.close();
+        return;
+    }
+    LOG(INFO) << "Using reconstruct cache " << filename;
+}
+
+ReconstructCache::~ReconstructCache()
+{
+    try {
+        Close();
+    }
+    catch(const Exception& e) {
+        LOG(ERROR) << e.what();
+    }
+}
+
+bool ReconstructCache::ReadRecord()
+{
+    if(record != record_t::None)
+        return true;
+    if(!previous.is_open())
+        return false;
+
+    uint8_t type;
+    if(!read(previous, type)) {
+        previous.close();
+        return false;
+    }
+
+    if(type == uint8_t(record_t::State)) {
+        calibration_state_t state;
+        uint32_t n = 0;
+        bool good = read(previous, state.Hash) && read(previous, n);
+        for(uint32_t i=0;good && i<n;i++) {
+            string id;
+            uint64_t hash = 0;
+            good = read(previous, id) && read(previous, hash);
+            state.Items.emplace(id, hash);
+        }
+        if(good) {
+            record = record_t::State;
+            record_key.CalibrationHash = state.Hash;
+            previous_states[state.Hash] = move(state);
+            return true;
+        }
+    }
+    else if(type == uint8_t(record_t::Event)) {
+        uint32_t size = 0;
+        bool good = read(previous, record_key.IDFlags)
+                    && read(previous, record_key.IDTimestamp)
+                    && read(previous, record_key.IDLower)
+                    && read(previous, record_key.RawHash)
+                    && read(previous, record_key.CalibrationHash)
+                    && read(previous, size);
+        if(good) {
+            record_data.resize(size);
+            good = bool(previous.read(record_data.data(), size));
+        }
+        if(good) {
+            record = record_t::Event;
+            return true;
+        }
+    }
+
+    LOG(WARNING) << "Reconstruct cache " << filename << " is corrupt, ignoring the remaining events";
+    previous.close();
+    return false;
+}
+
+void ReconstructCache::CopyRecord()
+{
+    if(record == record_t::State) {
+        const auto& state = previous_states[record_key.CalibrationHash];
+        write(current, uint8_t(record_t::State));
+        write(current, state.Hash);
+        write(current, uint32_t(state.Items.size()));
+        for(const auto& item : state.Items) {
+            write(current, item.first);
+            write(current, item.second);
+        }
+        // the events might need the current state again
+        written_state = 0;
+    }
+    else if(record == record_t::Event) {
+        WriteEvent(record_key, record_data.data(), record_data.size());
+    }
+    record = record_t::None;
+}
+
+void ReconstructCache::WriteState()
+{
+    const auto hash = calibrationDataManager->GetLoadedHash();
+    if(written_state == hash)
+        return;
+    const auto& loaded = calibrationDataManager->GetLoaded();
+    write(current, uint8_t(record_t::State));
+    write(current, hash);
+    write(current, uint32_t(loaded.size()));
+    for(const auto& item : loaded) {
+        write(current, item.first);
+        write(current, item.second.Hash);
+    }
+    written_state = hash;
+}
+
+void ReconstructCache::WriteEvent(const key_t& key_, const char* data, size_t size)
+{
+    write(current, uint8_t(record_t::Event));
+    write(current, key_.IDFlags);
+    write(current, key_.IDTimestamp);
+    write(current, key_.IDLower);
+    write(current, key_.RawHash);
+    write(current, key_.CalibrationHash);
+    write(current, uint32_t(size));
+    current.write(data, size);
+}
+
+void ReconstructCache::LogChangedCalibrations(uint64_t previousHash)
+{
+    const auto currentHash = calibrationDataManager->GetLoadedHash();
+    if(!logged_changes.emplace(previousHash, currentHash).second)
+        return;
+
+    const auto it_previous = previous_states.find(previousHash);
+    if(it_previous == previous_states.end())
+        return;
+    const auto& items = it_previous->second.Items;
+
+    std_ext::formatter changed;
+    for(const auto& item : calibrationDataManager->GetLoaded()) {
+        auto it_item = items.find(item.first);
+        if(it_item == items.end() || it_item->second != item.second.Hash)
+            changed << item.first << " ";
+    }
+    VLOG(3) << "Reconstructing events again due to changed calibrations: " << changed.str();
+}
+
+bool ReconstructCache::Restore(TEventData& reconstructed)
+{
+    if(closed)
+        return false;
+
+    key.IDFlags = reconstructed.ID.Flags;
+    key.IDTimestamp = reconstructed.ID.Timestamp;
+    key.IDLower = reconstructed.ID.Lower;
+    key.RawHash = hashRawHits(reconstructed);
+    key.CalibrationHash = calibrationDataManager->GetLoadedHash();
+
+    auto make_tuple = [] (const key_t& k) {
+        return std::tie(k.IDFlags, k.IDTimestamp, k.IDLower);
+    };
+
+    // keep all events of the previous cache before this one
+    while(ReadRecord()) {
+        if(record == record_t::State || make_tuple(record_key) < make_tuple(key)) {
+            CopyRecord();
+            continue;
+        }
+        break;
+    }
+
+    if(record != record_t::Event || make_tuple(record_key) != make_tuple(key))
+        return false;
+
+    // the previous reconstruction of this event is outdated in any case now
+    record = record_t::None;
+
+    if(record_key.RawHash != key.RawHash) {
+        LOG_N_TIMES(10, WARNING) << "Reconstruct cache has different raw data for event " << reconstructed.ID;
+        return false;
+    }
+    if(record_key.CalibrationHash != key.CalibrationHash) {
+        LogChangedCalibrations(record_key.CalibrationHash);
+        return false;
+    }
+
+    {
+        membuf_t buf(record_data.data(), record_data.data()+record_data.size());
+        istream instream(addressof(buf));
+        cereal::BinaryInputArchive ar(instream);
+        TEventData restored;
+        ar(restored);
+        reconstructed = move(restored);
+    }
+
+    WriteState();
+    WriteEvent(key, record_data.data(), record_data.size());
+    nRestored++;
+    return true;
+}
+
+void ReconstructCache::Store(const TEventData& reconstructed)
+{
+    if(closed)
+        return;
+
+    WriteState();
+
+    // serialize directly to the file, and fill in the size afterwards
+    write(current, uint8_t(record_t::Event));
+    write(current, key.IDFlags);
+    write(current, key.IDTimestamp);
+    write(current, key.IDLower);
+    write(current, key.RawHash);
+    write(current, key.CalibrationHash);
+    const auto pos_size = current.tellp();
+    write(current, uint32_t(0));
+    const auto pos_begin = current.tellp();
+    {
+        cereal::BinaryOutputArchive ar(current);
+        ar(reconstructed);
+    }
+    const auto pos_end = current.tellp();
+    current.seekp(pos_size);
+    write(current, uint32_t(pos_end - pos_begin));
+    current.seekp(pos_end);
+
+    if(!current)
+        throw Exception("Error while writing reconstruct cache "+filename_new);
+    nStored++;
+}
+
+void ReconstructCache::Close()
+{
+    if(closed)
+        return;
+    closed = true;
+
+    // keep the events which were not visited
+    while(ReadRecord())
+        CopyRecord();
+
+    current.close();
+    if(!current) {
+        remove(filename_new.c_str());
+        throw Exception("Error while writing reconstruct cache "+filename_new);
+    }
+    if(rename(filename_new.c_str(), filename.c_str()) != 0)
+        throw Exception("Cannot replace reconstruct cache "+filename);
+
+    LOG(INFO) << "Reconstruct cache: Restored " << nRestored << " of " << nRestored+nStored << " events";
+}
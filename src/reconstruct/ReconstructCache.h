@@ -0,0 +1,118 @@
+#pragma once
+
+#include <memory>
+#include <fstream>
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+namespace ant {
+
+struct TEventData;
+
+namespace calibration {
+class DataManager;
+}
+
+namespace reconstruct {
+
+/**
+ * @brief The ReconstructCache class stores reconstructed events,
+ * such that reprocessing the same input after a calibration update only reconstructs the affected events
+ *
+ * The key of each event is a hash of its unpacked raw hits and a hash of the calibration data
+ * which is currently loaded by the updateables, given by calibration::DataManager::GetLoaded.
+ * That is one (calibration ID, TID range, data hash) item per calibration, so an event is reused if
+ * neither its raw data nor any calibration data applicable to it has changed.
+ *
+ * The cache is a sequential file in the order of the events. The previous cache is read along
+ * while a new one is written, which replaces the previous one at the end, including the
+ * not visited events of the previous cache. The cache is discarded as a whole if the
+ * software version, the setup, the setup options or the random seed changed.
+ *
+ * @note Updateables not loading their parameters via the calibration::DataManager are not tracked
+ */
+class ReconstructCache {
+public:
+    /**
+     * @param filename of the cache, read if existing and replaced with the new cache at the end
+     * @param calibrationDataManager the data manager used by the calibrations of the setup
+     */
+    ReconstructCache(const std::string& filename,
+                     std::shared_ptr<const calibration::DataManager> calibrationDataManager);
+    ~ReconstructCache();
+
+    /**
+     * @brief Restore replaces the given event with the cached reconstruction, if available
+     * @param reconstructed the unpacked event, must be called after the updateables were updated
+     * @return true if restored, otherwise Store must be called after reconstruction
+     */
+    bool Restore(TEventData& reconstructed);
+
+    /**
+     * @brief Store puts the reconstructed event into the new cache
+     * @param reconstructed the event given to the preceding call of Restore, now reconstructed
+     */
+    void Store(const TEventData& reconstructed);
+
+    /**
+     * @brief Close copies the not visited events of the previous cache and replaces it with the new one,
+     * called by the destructor
+     */
+    void Close();
+
+    unsigned long long GetNRestored() const { return nRestored; }
+    unsigned long long GetNStored() const { return nStored; }
+
+    class Exception : public std::runtime_error {
+        using std::runtime_error::runtime_error; // use base class constructor
+    };
+
+protected:
+    struct key_t {
+        std::uint32_t IDFlags = 0;
+        std::uint32_t IDTimestamp = 0;
+        std::uint32_t IDLower = 0;
+        std::uint64_t RawHash = 0;
+        std::uint64_t CalibrationHash = 0;
+    };
+
+    struct calibration_state_t {
+        std::uint64_t Hash = 0;
+        std::map<std::string, std::uint64_t> Items; // calibration ID to hash
+    };
+
+    bool ReadRecord();
+    void CopyRecord();
+    void WriteState();
+    void WriteEvent(const key_t& key, const char* data, std::size_t size);
+    void LogChangedCalibrations(std::uint64_t previousHash);
+
+    const std::string filename;
+    const std::string filename_new;
+    const std::shared_ptr<const calibration::DataManager> calibrationDataManager;
+
+    std::ifstream previous;
+    std::ofstream current;
+    bool closed = false;
+
+    // the record read from the previous cache, not yet copied or used
+    enum class record_t : std::uint8_t { None, State, Event };
+    record_t record = record_t::None;
+    key_t record_key;
+    std::vector<char> record_data;
+    std::map<std::uint64_t, calibration_state_t> previous_states;
+
+    key_t key;
+    std::uint64_t written_state = 0;
+    std::set<std::pair<std::uint64_t, std::uint64_t>> logged_changes;
+    std::vector<char> buffer;
+
+    unsigned long long nRestored = 0;
+    unsigned long long nStored = 0;
+};
+
+}} // namespace ant::reconstruct
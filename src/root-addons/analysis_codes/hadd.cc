@@ -2,6 +2,8 @@
 
 #include "hstack.h"
 #include "tree/TAntHeader.h"
+#include "tree/TIDIndex.h"
+#include "base/std_ext/string.h"
 #include "base/ProgressCounter.h"
 
 #include "TDirectory.h"
@@ -10,9 +12,13 @@
 #include "TKey.h"
 #include "TClass.h"
 #include "TH1.h"
+#include "TTree.h"
 #include "TFileMergeInfo.h"
 
 #include <algorithm>
+#include <map>
+#include <atomic>
+#include <thread>
 
 using namespace std;
 using namespace ant;
@@ -40,7 +46,169 @@ void add_by_name(C& c, const string& name, Args&&... args) {
     }
 }
 
-void hadd::MergeRecursive(TDirectory& target, const hadd::sources_t& sources, unsigned& nPaths)
+// runs f(i) for i in [0,n) on up to nThreads threads,
+// work is distributed dynamically as the items may vary a lot in size
+template<typename F>
+void parallel_for(size_t n, unsigned nThreads, F f) {
+    nThreads = std::min<size_t>(nThreads, n);
+    if(nThreads < 2) {
+        for(size_t i=0;i<n;i++)
+            f(i);
+        return;
+    }
+    atomic<size_t> next_i{0};
+    auto worker = [&next_i, n, &f] () {
+        for(size_t i = next_i++; i < n; i = next_i++)
+            f(i);
+    };
+    vector<thread> threads;
+    for(unsigned t=1;t<nThreads;t++)
+        threads.emplace_back(worker);
+    worker(); // calling thread helps out
+    for(auto& t : threads)
+        t.join();
+}
+
+bool have_same_compression(const TKey& key, const TDirectory& target) {
+    const auto source_file = key.GetFile();
+    const auto target_file = target.GetFile();
+    if(!source_file || !target_file)
+        return false;
+    return source_file->GetCompressionSettings() == target_file->GetCompressionSettings();
+}
+
+bool has_labels(const TH1& h) {
+    return h.GetXaxis()->GetLabels() != nullptr;
+}
+
+unique_ptr<TH1> read_hist(TKey& key) {
+    unique_ptr<TH1> h(dynamic_cast<TH1*>(key.ReadObj()));
+    if(!h)
+        throw std::runtime_error("Cannot read histogram " + string(key.GetName())
+                                 + " from " + key.GetMotherDir()->GetPath());
+    // owned by us, and no directory list is touched when deleting it in another thread
+    h->SetDirectory(nullptr);
+    return h;
+}
+
+// merges h into sum if any of both has labels
+void merge_labeled(TH1& sum, TH1& h) {
+    // check for empty hists without labels,
+    // IMHO, this is a bug in ROOT that empty hists cannot be merged with labeled hists
+    const TH1& h_withLabels = has_labels(sum) ? sum : h;
+    for(auto item : {addressof(sum), addressof(h)}) {
+        if(has_labels(*item))
+            continue;
+        for(int bin=0;bin<item->GetNbinsX()+1;bin++)
+            if(item->GetBinContent(bin) != 0)
+                throw std::runtime_error("Found non-empty unlabeled hist " + string(item->GetName()));
+        // prepare the axis labels of the empty hist, labeled hist should have at least
+        // one bin filled
+        item->Fill(h_withLabels.GetXaxis()->GetBinLabel(1), 0.0);
+    }
+    TList c;
+    c.Add(addressof(h));
+    sum.Merge(addressof(c));
+}
+
+// histograms are read key by key and added to the first one,
+// so at most two histograms per name are in memory. The names of one
+// batch are added up in parallel, the I/O is still done by the calling thread
+void merge_hists(TDirectory& target, const vector<pair_t<vector<TKey*>>>& hists, unsigned nThreads)
+{
+    nThreads = std::max(nThreads, 1u);
+    for(size_t batch=0; batch<hists.size(); batch += nThreads) {
+        const auto n = std::min<size_t>(nThreads, hists.size()-batch);
+        vector<unique_ptr<TH1>> sums(n);
+        for(size_t i=0;i<n;i++)
+            sums[i] = read_hist(*hists[batch+i].Item.front());
+
+        vector<unique_ptr<TH1>> items(n);
+        vector<bool> labeled(n);
+        for(size_t k=1;;k++) {
+            bool any = false;
+            for(size_t i=0;i<n;i++) {
+                const auto& keys = hists[batch+i].Item;
+                items[i] = k < keys.size() ? read_hist(*keys[k]) : nullptr;
+                labeled[i] = items[i] && (has_labels(*sums[i]) || has_labels(*items[i]));
+                any |= items[i] != nullptr;
+            }
+            if(!any)
+                break;
+
+            // histograms without labels are simply added up
+            parallel_for(n, nThreads, [&sums, &items, &labeled] (size_t i) {
+                if(items[i] && !labeled[i])
+                    sums[i]->Add(items[i].get());
+            });
+            for(size_t i=0;i<n;i++) {
+                if(labeled[i])
+                    merge_labeled(*sums[i], *items[i]);
+            }
+        }
+
+        for(const auto& sum : sums)
+            target.WriteTObject(sum.get());
+    }
+}
+
+// entry offset of each source directory in the merged tree
+using entry_offsets_t = map<const TDirectory*, long long>;
+
+entry_offsets_t merge_trees(TDirectory& target, const string& name, const vector<TKey*>& keys, bool fastClone)
+{
+    entry_offsets_t offsets;
+    // read the input trees one by one, this keeps the memory bounded
+    // even for many large input files
+    TTree* out = nullptr;
+    for(auto key : keys) {
+        unique_ptr<TTree> tree(dynamic_cast<TTree*>(key->ReadObj()));
+        if(!tree)
+            throw std::runtime_error("Cannot read tree " + name + " from " + key->GetMotherDir()->GetPath());
+        // TTreeCloner copies the baskets without decompressing,
+        // which only makes sense if the compression is the same
+        const char* option = fastClone && have_same_compression(*key, target) ? "fast" : "";
+        target.cd();
+        offsets[key->GetMotherDir()] = out ? out->GetEntries() : 0;
+        if(!out) {
+            out = tree->CloneTree(-1, option);
+            if(!out)
+                throw std::runtime_error("Cannot clone tree " + name);
+            out->SetDirectory(addressof(target));
+        }
+        else {
+            TList l;
+            l.Add(tree.get());
+            out->Merge(addressof(l), option);
+        }
+    }
+    if(!out)
+        return offsets;
+    target.cd();
+    out->Write("", TObject::kOverwrite);
+    // tree is attached to target and was just written
+    delete out;
+    return offsets;
+}
+
+void merge_tidindex(TDirectory& target, const string& treename, const vector<TKey*>& keys,
+                    const entry_offsets_t& offsets)
+{
+    // the entries in the sidecar index refer to the unmerged tree,
+    // so shift them by the entries of the preceding sources
+    TIDIndex index;
+    for(auto key : keys) {
+        auto it_offset = offsets.find(key->GetMotherDir());
+        if(it_offset == offsets.end())
+            throw std::runtime_error("Found TID index without tree " + treename + " in " + key->GetMotherDir()->GetPath());
+        unique_ptr<TTree> tree(dynamic_cast<TTree*>(key->ReadObj()));
+        index.Append(*tree, it_offset->second);
+    }
+    index.Write(target, treename);
+}
+
+void hadd::MergeRecursive(TDirectory& target, const hadd::sources_t& sources, unsigned& nPaths,
+                          const hadd::options_t& options)
 {
 
         nPaths++;
@@ -48,9 +216,12 @@ void hadd::MergeRecursive(TDirectory& target, const hadd::sources_t& sources, un
 
         vector<pair_t<sources_t>> dirs;
 
-        vector<pair_t<unique_ptrs_t<TH1>>>    hists;
+        // keys are owned by sources, histograms and trees are read on demand
+        vector<pair_t<vector<TKey*>>>         hists;
         vector<pair_t<unique_ptrs_t<hstack>>> stacks;
         vector<pair_t<unique_ptrs_t<TAntHeader>>> headers;
+        vector<pair_t<vector<TKey*>>> trees;
+        vector<pair_t<vector<TKey*>>> tidindices;
 
         for(auto& source : sources) {
             TList* keys = source->GetListOfKeys();
@@ -75,8 +246,7 @@ void hadd::MergeRecursive(TDirectory& target, const hadd::sources_t& sources, un
                     add_by_name(dirs, keyname, dir);
                 }
                 else if(cl->InheritsFrom(TH1::Class())) {
-                    auto obj = dynamic_cast<TH1*>(key->ReadObj());
-                    add_by_name(hists, keyname, obj);
+                    add_by_name(hists, keyname, key);
                 }
                 else if(cl->InheritsFrom(hstack::Class())) {
                     auto obj = dynamic_cast<hstack*>(key->ReadObj());
@@ -86,6 +256,15 @@ void hadd::MergeRecursive(TDirectory& target, const hadd::sources_t& sources, un
                     auto obj = dynamic_cast<TAntHeader*>(key->ReadObj());
                     add_by_name(headers, keyname, obj);
                 }
+                else if(cl->InheritsFrom(TTree::Class())) {
+                    if(!options.Trees)
+                        continue;
+                    const string indexsuffix = TIDIndex::IndexName("");
+                    if(std_ext::string_ends_with(keyname, indexsuffix))
+                        add_by_name(tidindices, keyname.substr(0, keyname.size()-indexsuffix.size()), key);
+                    else
+                        add_by_name(trees, keyname, key);
+                }
             }
         }
 
@@ -93,54 +272,13 @@ void hadd::MergeRecursive(TDirectory& target, const hadd::sources_t& sources, un
 
         for(const auto& it_dirs : dirs) {
             auto newdir = target.mkdir(it_dirs.Name.c_str());
-            MergeRecursive(*newdir, it_dirs.Item, nPaths);
+            MergeRecursive(*newdir, it_dirs.Item, nPaths, options);
         }
 
         target.cd();
         TFileMergeInfo info(addressof(target)); // for calling Merge
 
-        for(const auto& it_hists : hists) {
-            auto& items = it_hists.Item;
-
-            // check if at least one hist has labels,
-            // the others could be never filled (so ROOT treats them as normal hists)
-            const auto hasLabels = [] (const unique_ptr<TH1>& h) {
-                return h->GetXaxis()->GetLabels() != nullptr;
-            };
-            const auto it_h_withLabels = std::find_if(items.begin(), items.end(), hasLabels);
-
-            auto& first = items.front();
-            if(it_h_withLabels != items.end()) {
-
-                // again, scan the histograms for empty hists without labels
-                // IMHO, this is a bug in ROOT that empty hists cannot be merged with labeled hists
-                auto& h_withLabels = *it_h_withLabels;
-                for(auto& h : items) {
-                    if(hasLabels(h))
-                        continue;
-                    for(int bin=0;bin<h->GetNbinsX()+1;bin++)
-                        if(h->GetBinContent(bin) != 0)
-                            throw std::runtime_error("Found non-empty unlabeled hist "
-                                                     + string(h->GetDirectory()->GetPath()));
-                    // prepare the axis labels of the empty hist, labeled hist should have at least
-                    // one bin filled
-                    h->Fill(h_withLabels->GetXaxis()->GetBinLabel(1), 0.0);
-                }
-
-                auto& first = items.front();
-                TList c;
-                for(auto it = next(items.begin()); it != items.end(); ++it) {
-                    c.Add(it->get());
-                }
-                first->Merge(addressof(c));
-            }
-            else {
-                for(auto it = next(items.begin()); it != items.end(); ++it) {
-                    first->Add(it->get());
-                }
-            }
-            target.WriteTObject(first.get());
-        }
+        merge_hists(target, hists, options.nThreads);
 
         for(const auto& it : stacks) {
             auto& items = it.Item;
@@ -164,4 +302,12 @@ void hadd::MergeRecursive(TDirectory& target, const hadd::sources_t& sources, un
             target.WriteTObject(first.get());
         }
 
+        map<string, entry_offsets_t> tree_offsets;
+        for(const auto& it : trees) {
+            tree_offsets[it.Name] = merge_trees(target, it.Name, it.Item, options.FastCloneTrees);
+        }
+
+        for(const auto& it : tidindices) {
+            merge_tidindex(target, it.Name, it.Item, tree_offsets[it.Name]);
+        }
 }
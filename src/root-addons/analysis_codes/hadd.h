@@ -12,7 +12,25 @@ struct hadd {
     using unique_ptrs_t = std::vector<std::unique_ptr<T>>;
     using sources_t = unique_ptrs_t<const TDirectory>;
 
-    static void MergeRecursive(TDirectory& target, const sources_t& sources, unsigned& nPaths);
+    struct options_t {
+        /**
+         * @brief nThreads number of threads used to add up histograms,
+         * all I/O is still done by the calling thread
+         */
+        unsigned nThreads = 1;
+        /**
+         * @brief Trees merge TTrees found in the sources, otherwise they're skipped
+         */
+        bool Trees = true;
+        /**
+         * @brief FastCloneTrees copies the compressed baskets of the TTrees
+         * if the compression settings of source and target match
+         */
+        bool FastCloneTrees = true;
+    };
+
+    static void MergeRecursive(TDirectory& target, const sources_t& sources, unsigned& nPaths,
+                               const options_t& options = options_t());
 
 };
 
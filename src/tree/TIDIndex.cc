@@ -0,0 +1,194 @@
+#include "TIDIndex.h"
+
+#include "base/WrapTFile.h"
+#include "base/std_ext/misc.h"
+#include "base/Logger.h"
+
+#include "TTree.h"
+#include "TDirectory.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace ant;
+
+TID TIDIndex::item_t::GetTID() const
+{
+    TID id;
+    id.Flags = Flags;
+    id.Timestamp = Timestamp;
+    id.Lower = Lower;
+    return id;
+}
+
+string TIDIndex::IndexName(const string& treename)
+{
+    return treename + "_TIDIndex";
+}
+
+void TIDIndex::Add(const TID& id, long long entry)
+{
+    if(id.IsInvalid())
+        return;
+    items.emplace_back(id, entry);
+    if(sorted && items.size()>1)
+        sorted = !(items.back() < items[items.size()-2]);
+}
+
+void TIDIndex::Sort()
+{
+    if(sorted)
+        return;
+    // stable keeps entries with same TID in order
+    std::stable_sort(items.begin(), items.end());
+    sorted = true;
+}
+
+TIDIndex::items_t::const_iterator TIDIndex::lower_bound(const item_t& item) const
+{
+    if(!sorted)
+        throw std::runtime_error("TIDIndex not sorted, call Sort() before lookup");
+    return std::lower_bound(items.begin(), items.end(), item);
+}
+
+long long TIDIndex::GetEntry(const TID& id) const
+{
+    if(id.IsInvalid())
+        return -1;
+    const item_t item(id, 0);
+    auto it = lower_bound(item);
+    if(it == items.end() || item < *it)
+        return -1;
+    return it->Entry;
+}
+
+vector<long long> TIDIndex::GetEntries(const interval<TID>& range) const
+{
+    vector<long long> entries;
+    if(range.Start().IsInvalid() || range.Stop().IsInvalid())
+        return entries;
+    const item_t stop(range.Stop(), 0);
+    for(auto it = lower_bound(item_t(range.Start(), 0)); it != items.end() && !(stop < *it); ++it)
+        entries.push_back(it->Entry);
+    return entries;
+}
+
+vector<pair<long long, long long>> TIDIndex::Intersect(const TIDIndex& a, const TIDIndex& b)
+{
+    const bool swapped = a.Size() > b.Size();
+    const TIDIndex& small = swapped ? b : a;
+    const TIDIndex& large = swapped ? a : b;
+
+    if(!small.sorted || !large.sorted)
+        throw std::runtime_error("TIDIndex not sorted, call Sort() before intersecting");
+
+    vector<pair<long long, long long>> common;
+    auto it_large = large.items.cbegin();
+    for(const auto& item : small.items) {
+        // search only the remaining part, as both are sorted
+        it_large = std::lower_bound(it_large, large.items.cend(), item);
+        if(it_large == large.items.end())
+            break;
+        if(item < *it_large)
+            continue;
+        if(swapped)
+            common.emplace_back(it_large->Entry, item.Entry);
+        else
+            common.emplace_back(item.Entry, it_large->Entry);
+    }
+    return common;
+}
+
+TIDIndex TIDIndex::Build(TTree& tree, const string& branchname)
+{
+    TIDIndex index;
+
+    auto branch = tree.GetBranch(branchname.c_str());
+    if(!branch)
+        throw std::runtime_error("Cannot find branch " + branchname + " in tree " + tree.GetName());
+
+    TID* tid = nullptr;
+    // only read the TID branch
+    tree.SetBranchStatus("*", 0);
+    // TID branch might be split
+    tree.SetBranchStatus((branchname+"*").c_str(), 1);
+    tree.SetBranchAddress(branchname.c_str(), addressof(tid));
+    std_ext::execute_on_destroy restore([&tree, &tid, branch] () {
+        tree.SetBranchStatus("*", 1);
+        branch->ResetAddress();
+        delete tid;
+    });
+
+    const auto nEntries = tree.GetEntries();
+    index.items.reserve(nEntries);
+    for(long long entry=0;entry<nEntries;entry++) {
+        branch->GetEntry(entry);
+        index.Add(*tid, entry);
+    }
+    index.Sort();
+    return index;
+}
+
+void TIDIndex::Write(TDirectory& dir, const string& treename)
+{
+    Sort();
+
+    const auto prev_Directory = gDirectory;
+    std_ext::execute_on_destroy restoreDir([prev_Directory] () {
+        gDirectory = prev_Directory;
+    });
+    dir.cd();
+
+    auto tree = new TTree(IndexName(treename).c_str(), ("TID index of "+treename).c_str());
+    UInt_t flags, timestamp, lower;
+    Long64_t entry;
+    tree->Branch("Flags", addressof(flags), "Flags/i");
+    tree->Branch("Timestamp", addressof(timestamp), "Timestamp/i");
+    tree->Branch("Lower", addressof(lower), "Lower/i");
+    tree->Branch("Entry", addressof(entry), "Entry/L");
+    for(const auto& item : items) {
+        flags = item.Flags;
+        timestamp = item.Timestamp;
+        lower = item.Lower;
+        entry = item.Entry;
+        tree->Fill();
+    }
+    tree->Write();
+    delete tree;
+}
+
+bool TIDIndex::Read(const WrapTFileInput& input, const string& treename)
+{
+    TTree* tree = nullptr;
+    if(!input.GetObject(IndexName(treename), tree))
+        return false;
+
+    Clear();
+    Append(*tree);
+    VLOG(5) << "Read TID index with " << Size() << " items for tree " << treename;
+    return true;
+}
+
+void TIDIndex::Append(TTree& indextree, long long entryOffset)
+{
+    UInt_t flags, timestamp, lower;
+    Long64_t entry;
+    indextree.SetBranchAddress("Flags", addressof(flags));
+    indextree.SetBranchAddress("Timestamp", addressof(timestamp));
+    indextree.SetBranchAddress("Lower", addressof(lower));
+    indextree.SetBranchAddress("Entry", addressof(entry));
+
+    const auto nEntries = indextree.GetEntries();
+    items.reserve(items.size() + nEntries);
+    for(long long i=0;i<nEntries;i++) {
+        indextree.GetEntry(i);
+        TID id;
+        id.Flags = flags;
+        id.Timestamp = timestamp;
+        id.Lower = lower;
+        Add(id, entry + entryOffset);
+    }
+    indextree.ResetBranchAddresses();
+    // written sorted, but appending might break that
+    Sort();
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "TID.h"
+#include "base/interval.h"
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <tuple>
+
+class TTree;
+class TDirectory;
+
+namespace ant {
+
+class WrapTFileInput;
+
+/**
+ * @brief The TIDIndex class is a sorted TID to entry number lookup for a TTree
+ *
+ * The index is stored as a small sidecar TTree next to the indexed tree,
+ * named by IndexName(). It allows random access by TID without scanning the tree:
+ *
+ *     WrapTFileInput input(filename);
+ *     TIDIndex index;
+ *     if(index.Read(input, "treeEvents"))
+ *       for(auto entry : index.GetEntries(tid_range))
+ *         tree->GetEntry(entry);
+ *
+ * Invalid TIDs are never indexed.
+ */
+class TIDIndex {
+public:
+    struct item_t {
+        std::uint32_t Flags;
+        std::uint32_t Timestamp;
+        std::uint32_t Lower;
+        long long     Entry;
+
+        item_t(const TID& id, long long entry) :
+            Flags(id.Flags), Timestamp(id.Timestamp), Lower(id.Lower), Entry(entry) {}
+
+        TID GetTID() const;
+
+        bool operator<(const item_t& other) const {
+            return std::tie(Flags, Timestamp, Lower) < std::tie(other.Flags, other.Timestamp, other.Lower);
+        }
+    };
+
+    using items_t = std::vector<item_t>;
+
+    static std::string IndexName(const std::string& treename);
+
+    /**
+     * @brief Add remembers that the given entry has the given id
+     * @param id the TID, ignored if invalid
+     * @param entry the entry number in the indexed tree
+     */
+    void Add(const TID& id, long long entry);
+
+    /**
+     * @brief Sort makes the index usable for lookups, cheap if already sorted
+     */
+    void Sort();
+
+    std::size_t Size() const { return items.size(); }
+    bool Empty() const { return items.empty(); }
+    void Clear() { items.clear(); sorted = true; }
+
+    const items_t& Items() const { return items; }
+
+    /**
+     * @brief GetEntry finds the entry number of the given id
+     * @return entry number, or -1 if not found
+     */
+    long long GetEntry(const TID& id) const;
+
+    /**
+     * @brief GetEntries finds all entries within the given TID range (inclusive)
+     * @return entry numbers, ordered by TID
+     */
+    std::vector<long long> GetEntries(const interval<TID>& range) const;
+
+    /**
+     * @brief Intersect finds the entries with common TID in both indices
+     * @return pairs of (entry in a, entry in b), ordered by TID
+     * @note binary searches the smaller index in the larger one
+     */
+    static std::vector<std::pair<long long, long long>> Intersect(const TIDIndex& a, const TIDIndex& b);
+
+    /**
+     * @brief Build creates the index by reading the TID branch of the given tree once
+     * @param tree the tree to index
+     * @param branchname name of the branch holding an ant::TID
+     */
+    static TIDIndex Build(TTree& tree, const std::string& branchname);
+
+    /**
+     * @brief Write stores the sorted index in given directory as sidecar tree for treename
+     */
+    void Write(TDirectory& dir, const std::string& treename);
+
+    /**
+     * @brief Read loads the index for treename
+     * @return false if no index was found
+     */
+    bool Read(const WrapTFileInput& input, const std::string& treename);
+
+    /**
+     * @brief Append adds the items of a stored index tree
+     * @param indextree tree as written by Write()
+     * @param entryOffset added to each entry number, useful when indexed trees are concatenated
+     */
+    void Append(TTree& indextree, long long entryOffset = 0);
+
+protected:
+    items_t items;
+    bool sorted = true;
+
+    items_t::const_iterator lower_bound(const item_t& item) const;
+};
+
+}
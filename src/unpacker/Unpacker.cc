@@ -1,6 +1,7 @@
 #include "Unpacker.h"
 #include "UnpackerAcqu.h"
 #include "UnpackerA2Geant.h"
+#include "UnpackerRawHitsCache.h"
 
 #include "base/Logger.h"
 
@@ -17,6 +18,7 @@ std::unique_ptr<Unpacker::Module> Unpacker::Get(const string& filename)
     std::list< std::unique_ptr<Module> > modules;
     modules.push_back(std_ext::make_unique<UnpackerAcqu>());
     modules.push_back(std_ext::make_unique<UnpackerA2Geant>());
+    modules.push_back(std_ext::make_unique<UnpackerRawHitsCache>());
 
     // remove the unpacker if it says that it could not open the file
     modules.remove_if([&filename] (const unique_ptr<Module>& m) {
@@ -19,6 +19,10 @@
  * Please see ant::UnpackerA2Geant as a simple example based on ROOT tree
  * reading, and  ant::UnpackerAcqu for a more complicated example.
  *
+ * The output of ant::UnpackerAcqu can be written to a raw hits cache with
+ * ant::UnpackerRawHitsCache::Writer, which is read back much faster by
+ * ant::UnpackerRawHitsCache in subsequent passes.
+ *
  */
 
 #include <string>
@@ -6,12 +6,21 @@
 #include "tree/TEventData.h"
 
 #include "base/WrapTFile.h"
+#include "base/CounterRNG.h"
 #include "base/Logger.h"
 
 #include "TTree.h"
+#include "TROOT.h"
+#include "RVersion.h"
 
 #include <memory>
 #include <random>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
 
 using namespace std;
 using namespace ant;
@@ -27,17 +36,23 @@ struct promptrandom_t {
     promptrandom_t(
             tagger_t tagger,
             UnpackerA2GeantConfig::promptrandom_config_t config) :
-        r_prompt(config.PromptOffset, config.PromptSigma),
+        prompt_offset(config.PromptOffset),
+        prompt_sigma(config.PromptSigma),
         n_randoms(static_cast<unsigned>( // round-off error negligble
                       config.TimeWindow.Length()*config.RandomPromptRatio)
                   ),
-        r_random_timing(config.TimeWindow.Start(), config.TimeWindow.Stop()),
+        random_window(config.TimeWindow),
         r_random_channel(make_r_tagg_ch(tagger))
     {
     }
 
+    // makes the hits only depend on the event, not on the order of events
+    void Start(const TID& tid) {
+        r_gen.Start(tid.Value());
+    }
+
     double SmearPrompt(double in) {
-        return in + r_prompt(r_gen);
+        return in + r_gen.Gaus(prompt_offset, prompt_sigma);
     }
 
     struct hit_t {
@@ -49,7 +64,8 @@ struct promptrandom_t {
         vector<hit_t> hits(n_randoms);
         for(unsigned i=0;i<n_randoms;i++) {
             auto& hit = hits[i];
-            hit.Timing = r_random_timing(r_gen);
+            hit.Timing = r_gen.Uniform(random_window.Start(), random_window.Stop());
+            // discrete_distribution keeps no state between calls
             hit.Channel = r_random_channel(r_gen);
         }
         return hits;
@@ -59,11 +75,12 @@ struct promptrandom_t {
 protected:
 
 
-    default_random_engine r_gen;
+    CounterRNG r_gen{CounterRNG::Stream_t::TaggerPromptRandom};
 
-    normal_distribution<double> r_prompt;
+    const double prompt_offset;
+    const double prompt_sigma;
     const unsigned n_randoms;
-    uniform_real_distribution<double> r_random_timing;
+    const interval<double> random_window;
     discrete_distribution<unsigned> r_random_channel;
 
     static decltype(r_random_channel) make_r_tagg_ch(tagger_t tagger) {
@@ -76,10 +93,96 @@ protected:
     }
 };
 
+/**
+ * @brief The readahead_t struct runs the given read function on a helper thread,
+ * keeping at most N events in the queue
+ *
+ * The helper thread is the only one calling read, so the order of the events
+ * (and of the random numbers drawn for them) is the same as without read ahead.
+ * A default constructed (empty) event marks the end of the input.
+ */
+struct readahead_t {
+
+    using read_t = std::function<TEvent()>;
+
+    readahead_t(read_t read, unsigned n) :
+        Read(move(read)), N(n),
+        worker([this] () { run(); })
+    {}
+
+    ~readahead_t() {
+        {
+            lock_guard<mutex> lock(m);
+            stop = true;
+        }
+        cv_space.notify_all();
+        worker.join();
+    }
+
+    TEvent Next() {
+        unique_lock<mutex> lock(m);
+        cv_filled.wait(lock, [this] () { return !queue.empty() || finished; });
+        if(queue.empty()) {
+            if(error)
+                rethrow_exception(error);
+            return {};
+        }
+        TEvent event(move(queue.front()));
+        queue.pop_front();
+        lock.unlock();
+        cv_space.notify_one();
+        return event;
+    }
+
+protected:
+    void run() {
+        try {
+            while(true) {
+                TEvent event = Read();
+                const bool last = !event;
+                unique_lock<mutex> lock(m);
+                if(last)
+                    break;
+                cv_space.wait(lock, [this] () { return queue.size() < N || stop; });
+                if(stop)
+                    break;
+                queue.emplace_back(move(event));
+                lock.unlock();
+                cv_filled.notify_one();
+            }
+        }
+        catch(...) {
+            lock_guard<mutex> lock(m);
+            error = current_exception();
+        }
+        {
+            lock_guard<mutex> lock(m);
+            finished = true;
+        }
+        cv_filled.notify_all();
+    }
+
+    const read_t Read;
+    const unsigned N;
+
+    mutex m;
+    condition_variable cv_filled;
+    condition_variable cv_space;
+    deque<TEvent> queue;
+    bool stop = false;
+    bool finished = false;
+    exception_ptr error;
+
+    // started last, after everything above is initialized
+    thread worker;
+};
+
 }}}
 
 using namespace ant::unpacker::geant;
 
+UnpackerA2Geant::io_settings_t UnpackerA2Geant::IOSettings;
+
 UnpackerA2Geant::UnpackerA2Geant() {}
 
 UnpackerA2Geant::~UnpackerA2Geant() {}
@@ -100,12 +203,18 @@ bool UnpackerA2Geant::OpenFile(const string& filename)
         return false;
 
     geantTree.LinkBranches();
+    // validate the other expected branches as well before deactivating them
+    geantTreeUnused.LinkBranches(geantTree.Tree);
+    // don't read the many unused branches, and read the used ones in large chunks
+    geantTree.PruneBranches();
+    geantTree.EnableCache(IOSettings.CacheSize);
 
     if(inputfile->GetObject("h12_tid", tidTree.Tree)) {
         if(tidTree.Tree->GetEntries() != geantTree.Tree->GetEntries()) {
             throw Exception("Geant Tree and TID Tree size mismatch");
         }
         tidTree.LinkBranches();
+        tidTree.EnableCache();
     } else {
         // think of some better timestamp?
         tidTree.tid = TID(static_cast<std::uint32_t>(std::time(nullptr)),
@@ -121,10 +230,11 @@ bool UnpackerA2Geant::OpenFile(const string& filename)
     // heuristically detect some older format, flag is used in unpacking
     {
         auto& t = geantTree;
+        auto& u = geantTreeUnused;
         if(!t.tcryst.IsPresent && !t.tveto.IsPresent &&
-           !t.ivtaps.IsPresent && !t.imwpc.IsPresent &&
-           !t.mposx.IsPresent &&  !t.mposy.IsPresent &&
-           !t.mposz.IsPresent && !t.emwpc.IsPresent) {
+           !t.ivtaps.IsPresent && !u.imwpc.IsPresent &&
+           !u.mposx.IsPresent &&  !u.mposy.IsPresent &&
+           !u.mposz.IsPresent && !u.emwpc.IsPresent) {
             LOG(INFO) << "Detected old format tree input, as some branches are missing.";
             oldTreeFormat = true;
         }
@@ -159,8 +269,18 @@ bool UnpackerA2Geant::OpenFile(const string& filename)
                            );
     }
 
-
-
+    if(IOSettings.ReadAhead>0) {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+        ROOT::EnableThreadSafety();
+        readahead = std_ext::make_unique<unpacker::geant::readahead_t>(
+                        [this] () { return ReadEvent(); },
+                        IOSettings.ReadAhead
+                        );
+        LOG(INFO) << "Unpacking up to " << IOSettings.ReadAhead << " events ahead";
+#else
+        LOG(WARNING) << "ROOT version too old for reading ahead on helper thread, disabled";
+#endif
+    }
 
     LOG(INFO) << "Successfully opened '" << filename
               << "' with " << geantTree.Tree->GetEntries() << " entries"
@@ -170,13 +290,15 @@ bool UnpackerA2Geant::OpenFile(const string& filename)
     return true;
 }
 
-struct r_t {
-    std::default_random_engine r_gen;
-    std::normal_distribution<double> r_prompt;
-};
-
-
 TEvent UnpackerA2Geant::NextEvent()
+{
+    TEvent event = readahead ? readahead->Next() : ReadEvent();
+    if(event)
+        ++delivered_entries;
+    return event;
+}
+
+TEvent UnpackerA2Geant::ReadEvent()
 {
     // shortcut, as geantTree is used very often here
     auto& t = geantTree;
@@ -184,7 +306,8 @@ TEvent UnpackerA2Geant::NextEvent()
     if(current_entry>=t.Tree->GetEntriesFast()-1)
         return {};
 
-    t.Tree->GetEntry(++current_entry);
+    // only reads the branches accessed below, decompression comes from the cache
+    t.GetEntry(++current_entry);
 
     // read TIDs in sync
     if(tidTree)
@@ -298,6 +421,8 @@ TEvent UnpackerA2Geant::NextEvent()
     const double photon_energy = GeVtoMeV*t.beam[4];
 
     if(taggerdetector) {
+        promptrandom->Start(tidTree.tid);
+
         // could the prompt photon have been detected?
         unsigned ch;
         if(taggerdetector->TryGetChannelFromPhoton(photon_energy, ch))
@@ -328,7 +453,8 @@ TEvent UnpackerA2Geant::NextEvent()
 
 double UnpackerA2Geant::PercentDone() const
 {
-    return double(current_entry) / double(geantTree.Tree->GetEntries());
+    // current_entry might be ahead if events are read on the helper thread
+    return double(delivered_entries) / double(geantTree.Tree->GetEntries());
 }
 
 
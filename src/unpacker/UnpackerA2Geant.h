@@ -24,6 +24,7 @@ class WrapTFileInput;
 namespace unpacker {
 namespace geant {
 struct promptrandom_t;
+struct readahead_t;
 }}
 
 /**
@@ -44,7 +45,26 @@ public:
 
     virtual double PercentDone() const override;
 
+    /**
+     * @brief The io_settings_t struct tunes the reading of the Geant tree,
+     * must be set before the unpacker is created by Unpacker::Get
+     */
+    struct io_settings_t {
+        /**
+         * @brief CacheSize of the TTreeCache in bytes, zero means ROOT's default
+         */
+        Long64_t CacheSize = 0;
+        /**
+         * @brief ReadAhead number of events unpacked ahead on a helper thread, zero disables the thread
+         * @note the events are still produced in order, so the tagger smearing is reproducible
+         */
+        unsigned ReadAhead = 0;
+    };
+    static io_settings_t IOSettings;
+
 private:
+    TEvent ReadEvent();
+
     // important to declare inputfile before WrapTTree
     std::unique_ptr<WrapTFileInput> inputfile;
 
@@ -57,6 +77,7 @@ private:
     std::unique_ptr<unpacker::geant::promptrandom_t> promptrandom;
 
     long long current_entry = -1;
+    long long delivered_entries = 0;
 
     struct TIDTree_t : WrapTTree {
         ADD_BRANCH_T(TID, tid)
@@ -64,25 +85,34 @@ private:
 
     TIDTree_t tidTree;
 
+    // only the branches consumed by NextEvent are read,
+    // all others are deactivated after linking
     struct GeantTree_t : WrapTTree {
-        ADD_BRANCH_T(ROOTArray<Float_t>, plab)
         ADD_BRANCH_T(ROOTArray<Float_t>, tctaps)
         ADD_BRANCH_T(ROOTArray<Float_t>, vertex)
         ADD_BRANCH_T(ROOTArray<Float_t>, beam)
-        ADD_BRANCH_T(ROOTArray_Float<3>, dircos)
         ADD_BRANCH_T(ROOTArray<Float_t>, ecryst)
         ADD_BRANCH_OPT_T(ROOTArray<Float_t>, tcryst)
         ADD_BRANCH_T(ROOTArray<Float_t>, ectapfs)
         ADD_BRANCH_T(ROOTArray<Float_t>, ectapsl)
-        ADD_BRANCH_T(ROOTArray<Float_t>, elab)
         ADD_BRANCH_T(ROOTArray<Float_t>, eveto)
         ADD_BRANCH_OPT_T(ROOTArray<Float_t>, tveto)
         ADD_BRANCH_T(ROOTArray<Float_t>, evtaps)
         ADD_BRANCH_T(ROOTArray<Int_t>,   icryst)
         ADD_BRANCH_T(ROOTArray<Int_t>,   ictaps)
         ADD_BRANCH_OPT_T(ROOTArray<Int_t>,   ivtaps)
-        ADD_BRANCH_T(ROOTArray<Int_t>,   idpart)
         ADD_BRANCH_T(ROOTArray<Int_t>,   iveto)
+    };
+
+    GeantTree_t geantTree;
+
+    // linked to the same tree only to check the expected format,
+    // the branches are never read
+    struct GeantTreeUnused_t : WrapTTree {
+        ADD_BRANCH_T(ROOTArray<Float_t>, plab)
+        ADD_BRANCH_T(ROOTArray_Float<3>, dircos)
+        ADD_BRANCH_T(ROOTArray<Float_t>, elab)
+        ADD_BRANCH_T(ROOTArray<Int_t>,   idpart)
         ADD_BRANCH_OPT_T(ROOTArray<Int_t>,   imwpc)
         ADD_BRANCH_OPT_T(ROOTArray<Float_t>, mposx)
         ADD_BRANCH_OPT_T(ROOTArray<Float_t>, mposy)
@@ -90,10 +120,13 @@ private:
         ADD_BRANCH_OPT_T(ROOTArray<Float_t>, emwpc)
     };
 
-    GeantTree_t geantTree;
+    GeantTreeUnused_t geantTreeUnused;
 
     bool oldTreeFormat = false;
 
+    // declared last, such that the helper thread is stopped before anything else is destroyed
+    std::unique_ptr<unpacker::geant::readahead_t> readahead;
+
 };
 
 /**
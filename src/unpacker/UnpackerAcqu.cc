@@ -9,6 +9,8 @@
 using namespace std;
 using namespace ant;
 
+UnpackerAcqu::settings_t UnpackerAcqu::Settings;
+
 UnpackerAcqu::UnpackerAcqu() {}
 UnpackerAcqu::~UnpackerAcqu() {}
 
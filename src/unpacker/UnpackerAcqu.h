@@ -32,6 +32,23 @@ public:
 
     virtual double PercentDone() const override;
 
+    /**
+     * @brief The settings_t struct tunes the unpacking,
+     * must be set before the unpacker is created by Unpacker::Get
+     */
+    struct settings_t {
+        /**
+         * @brief Workers number of threads unpacking the file records in parallel, zero unpacks on the reading thread
+         * @note the events are identical to the serial unpacking
+         */
+        unsigned Workers = 0;
+        /**
+         * @brief RecordsPerWorker number of records handed to each worker at once
+         */
+        unsigned RecordsPerWorker = 4;
+    };
+    static settings_t Settings;
+
 private:
     std::list<TEvent> queue; // std::list supports splice
     std::unique_ptr<UnpackerAcquFileFormat> file;
@@ -0,0 +1,465 @@
+#include "UnpackerRawHitsCache.h"
+
+#include "expconfig/ExpConfig.h"
+
+#include "tree/TEvent.h"
+#include "tree/TEventData.h"
+
+#include "base/std_ext/memory.h"
+#include "base/std_ext/string.h"
+#include "base/Logger.h"
+
+// ignore warnings from library
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
+#include "cereal/cereal.hpp"
+#include "cereal/types/string.hpp"
+#include "cereal/types/vector.hpp"
+#include "cereal/archives/binary.hpp"
+#pragma GCC diagnostic pop
+
+#include <zlib.h>
+
+#include <streambuf>
+#include <istream>
+#include <ostream>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+using namespace ant;
+
+namespace ant {
+namespace unpacker {
+namespace rawhitscache {
+
+constexpr char          FileMarker[8] = {'A','n','t','R','a','w','H','C'};
+constexpr std::uint32_t FileVersion   = 2;
+constexpr std::uint32_t ChunkMarker   = 0x4b4e4843; // "CHNK"
+constexpr std::uint32_t EndMarker     = 0x20444e45; // "END "
+
+// written after the last chunk once the raw data unpacker has finished,
+// caches without it are incomplete
+struct trailer_t {
+    std::uint32_t Marker;
+    std::uint32_t nEvents[2]; // low and high word
+    std::uint64_t Events() const { return nEvents[0] | (std::uint64_t(nEvents[1]) << 32); }
+};
+
+/**
+ * @brief The columns_t struct holds the events of one chunk column-wise
+ *
+ * Packed, the columns follow each other in the order of declaration,
+ * preceded by the number of events, hits, raw bytes and extra bytes.
+ * The buffers are kept over chunks, so unpacking does not allocate after the first chunk.
+ */
+struct columns_t {
+    // per event
+    vector<uint32_t> IDs; // Flags, Timestamp, Lower, Reserved of TID
+    vector<uint32_t> DAQEventIDs;
+    vector<uint32_t> nHits;
+    vector<uint32_t> nExtraBytes;
+
+    // per hit
+    vector<uint8_t>  DetectorTypes;
+    vector<uint8_t>  ChannelTypes;
+    vector<uint32_t> Channels;
+    vector<uint16_t> nRawBytes;
+
+    // concatenated RawData and cereal serialized extras of all events
+    vector<uint8_t>  RawBytes;
+    vector<char>     ExtraBytes;
+
+    uint32_t size() const { return DAQEventIDs.size(); }
+
+    void clear() {
+        IDs.clear();
+        DAQEventIDs.clear();
+        nHits.clear();
+        nExtraBytes.clear();
+        DetectorTypes.clear();
+        ChannelTypes.clear();
+        Channels.clear();
+        nRawBytes.clear();
+        RawBytes.clear();
+        ExtraBytes.clear();
+    }
+
+    /**
+     * @brief Compress packs and compresses the columns
+     * @param out the compressed bytes
+     * @return number of packed bytes before compression
+     */
+    uint32_t Compress(vector<char>& out) {
+        const uint32_t counts[4] = {size(), uint32_t(Channels.size()),
+                                    uint32_t(RawBytes.size()), uint32_t(ExtraBytes.size())};
+        packed.clear();
+        append(packed, counts, 4);
+        append(packed, IDs.data(), IDs.size());
+        append(packed, DAQEventIDs.data(), DAQEventIDs.size());
+        append(packed, nHits.data(), nHits.size());
+        append(packed, nExtraBytes.data(), nExtraBytes.size());
+        append(packed, DetectorTypes.data(), DetectorTypes.size());
+        append(packed, ChannelTypes.data(), ChannelTypes.size());
+        append(packed, Channels.data(), Channels.size());
+        append(packed, nRawBytes.data(), nRawBytes.size());
+        append(packed, RawBytes.data(), RawBytes.size());
+        append(packed, ExtraBytes.data(), ExtraBytes.size());
+
+        // the raw data compresses well already at the fastest level
+        uLongf n = compressBound(packed.size());
+        out.resize(n);
+        if(compress2(reinterpret_cast<Bytef*>(out.data()), addressof(n),
+                     reinterpret_cast<const Bytef*>(packed.data()), packed.size(),
+                     Z_BEST_SPEED) != Z_OK)
+            throw UnpackerRawHitsCache::Exception("Compressing chunk failed");
+        out.resize(n);
+        return packed.size();
+    }
+
+    /**
+     * @brief Decompress fills the columns from the compressed bytes
+     * @param in compressed bytes
+     * @param nPacked number of packed bytes as returned by Compress
+     */
+    void Decompress(const vector<char>& in, uint32_t nPacked) {
+        packed.resize(nPacked);
+        uLongf n = nPacked;
+        if(uncompress(reinterpret_cast<Bytef*>(packed.data()), addressof(n),
+                      reinterpret_cast<const Bytef*>(in.data()), in.size()) != Z_OK
+           || n != nPacked)
+            throw UnpackerRawHitsCache::Exception("Decompressing chunk failed");
+
+        const char* it = packed.data();
+        const char* end = it + packed.size();
+        uint32_t counts[4];
+        extract(it, end, counts, 4);
+        const auto nEvents = counts[0];
+        const auto nHits_  = counts[1];
+        extract(it, end, IDs, 4*nEvents);
+        extract(it, end, DAQEventIDs, nEvents);
+        extract(it, end, nHits, nEvents);
+        extract(it, end, nExtraBytes, nEvents);
+        extract(it, end, DetectorTypes, nHits_);
+        extract(it, end, ChannelTypes, nHits_);
+        extract(it, end, Channels, nHits_);
+        extract(it, end, nRawBytes, nHits_);
+        extract(it, end, RawBytes, counts[2]);
+        extract(it, end, ExtraBytes, counts[3]);
+        if(it != end)
+            throw UnpackerRawHitsCache::Exception("Chunk has unexpected size");
+    }
+
+protected:
+    vector<char> packed;
+
+    template<typename T>
+    static void append(vector<char>& v, const T* data, size_t n) {
+        const auto bytes = n*sizeof(T);
+        const auto pos = v.size();
+        v.resize(pos + bytes);
+        if(bytes>0)
+            memcpy(addressof(v[pos]), data, bytes);
+    }
+
+    template<typename T>
+    static void extract(const char*& it, const char* end, T* data, size_t n) {
+        const auto bytes = n*sizeof(T);
+        if(size_t(end - it) < bytes)
+            throw UnpackerRawHitsCache::Exception("Chunk is truncated");
+        if(bytes>0)
+            memcpy(data, it, bytes);
+        it += bytes;
+    }
+
+    template<typename T>
+    static void extract(const char*& it, const char* end, vector<T>& v, size_t n) {
+        v.resize(n);
+        extract(it, end, v.data(), n);
+    }
+};
+
+// streambuf to let cereal write to the end of, or read from, the extra bytes
+struct extrabuf_t : std::streambuf {
+    explicit extrabuf_t(vector<char>& out_) : out(addressof(out_)) {}
+    extrabuf_t(const char* begin, const char* end) {
+        // reading only, so casting away const is fine
+        setg(const_cast<char*>(begin), const_cast<char*>(begin), const_cast<char*>(end));
+    }
+protected:
+    std::streamsize xsputn(const char_type* s, std::streamsize n) override {
+        out->insert(out->end(), s, s+n);
+        return n;
+    }
+    int_type overflow(int_type ch) override {
+        if(ch != traits_type::eof())
+            out->push_back(ch);
+        return ch;
+    }
+    vector<char>* out = nullptr;
+};
+
+}} // namespace unpacker::rawhitscache
+
+} // namespace ant
+
+using namespace ant::unpacker::rawhitscache;
+
+constexpr unsigned UnpackerRawHitsCache::ChunkEvents;
+
+UnpackerRawHitsCache::UnpackerRawHitsCache() :
+    columns(std_ext::make_unique<columns_t>())
+{}
+
+UnpackerRawHitsCache::~UnpackerRawHitsCache() {}
+
+bool UnpackerRawHitsCache::OpenFile(const string& filename)
+{
+    file.open(filename, ios::binary);
+    if(!file)
+        return false;
+
+    char marker[sizeof(FileMarker)];
+    file.read(marker, sizeof(marker));
+    if(file.gcount() != sizeof(marker) || memcmp(marker, FileMarker, sizeof(marker)) != 0)
+        return false;
+
+    uint32_t version = 0;
+    file.read(reinterpret_cast<char*>(addressof(version)), sizeof(version));
+    if(version != FileVersion)
+        throw Exception(std_ext::formatter() << "Raw hits cache " << filename
+                        << " has version " << version << ", but expected " << FileVersion);
+
+    TID id;
+    file.read(reinterpret_cast<char*>(addressof(id.Flags)), sizeof(id.Flags));
+    file.read(reinterpret_cast<char*>(addressof(id.Timestamp)), sizeof(id.Timestamp));
+    file.read(reinterpret_cast<char*>(addressof(id.Lower)), sizeof(id.Lower));
+    file.read(reinterpret_cast<char*>(addressof(id.Reserved)), sizeof(id.Reserved));
+    if(!file)
+        throw Exception("Raw hits cache " + filename + " has incomplete header");
+
+    // as the raw data unpacker, find the setup by the first event
+    ExpConfig::Setup::SetByTID(id);
+
+    filepos = file.tellg();
+    file.seekg(0, ios::end);
+    const std::streamsize end = file.tellg();
+
+    // chunks are only read up to the trailer
+    trailer_t trailer{};
+    if(end >= filepos + std::streamsize(sizeof(trailer))) {
+        file.seekg(end - std::streamsize(sizeof(trailer)));
+        file.read(reinterpret_cast<char*>(addressof(trailer)), sizeof(trailer));
+    }
+    if(!file || trailer.Marker != EndMarker)
+        throw Exception("Raw hits cache " + filename + " is incomplete, as its writing did not finish");
+    filesize = end - sizeof(trailer);
+    nEventsExpected = trailer.Events();
+    file.seekg(filepos);
+
+    LOG(INFO) << "Successfully opened raw hits cache " << filename;
+    return true;
+}
+
+double UnpackerRawHitsCache::PercentDone() const
+{
+    return filesize > 0 ? double(filepos)/filesize : 1.0;
+}
+
+bool UnpackerRawHitsCache::ReadChunk()
+{
+    if(filepos == filesize) {
+        if(nEvents != nEventsExpected)
+            throw Exception(std_ext::formatter() << "Raw hits cache contains " << nEvents
+                            << " events, but expected " << nEventsExpected);
+        return false;
+    }
+
+    uint32_t header[3]; // marker, packed size, compressed size
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+    if(file.gcount() != sizeof(header) || header[0] != ChunkMarker)
+        throw Exception(std_ext::formatter() << "Raw hits cache has corrupt chunk header at byte " << filepos);
+
+    compressed.resize(header[2]);
+    file.read(compressed.data(), compressed.size());
+    if(file.gcount() != streamsize(compressed.size()))
+        throw Exception(std_ext::formatter() << "Raw hits cache has truncated chunk at byte " << filepos);
+    filepos += sizeof(header) + compressed.size();
+    if(filepos > filesize)
+        throw Exception(std_ext::formatter() << "Raw hits cache has chunk overlapping trailer at byte " << filepos);
+
+    columns->Decompress(compressed, header[1]);
+    nEvents += columns->size();
+
+    nextEvent = 0;
+    nextHit = 0;
+    nextRawByte = 0;
+    nextExtraByte = 0;
+    return true;
+}
+
+TEvent UnpackerRawHitsCache::NextEvent()
+{
+    while(nextEvent == columns->size()) {
+        if(!ReadChunk())
+            return {};
+    }
+
+    const columns_t& c = *columns;
+    const auto i = nextEvent++;
+
+    TID id;
+    id.Flags     = c.IDs[4*i+0];
+    id.Timestamp = c.IDs[4*i+1];
+    id.Lower     = c.IDs[4*i+2];
+    id.Reserved  = c.IDs[4*i+3];
+
+    TEvent event(id);
+    TEventData& eventdata = event.Reconstructed();
+    eventdata.Trigger.DAQEventID = c.DAQEventIDs[i];
+
+    auto& hits = eventdata.DetectorReadHits;
+    hits.resize(c.nHits[i]);
+    for(auto& hit : hits) {
+        const auto h = nextHit++;
+        hit.DetectorType = static_cast<Detector_t::Type_t>(c.DetectorTypes[h]);
+        hit.ChannelType  = static_cast<Channel_t::Type_t>(c.ChannelTypes[h]);
+        hit.Channel      = c.Channels[h];
+        const auto begin = c.RawBytes.begin() + nextRawByte;
+        nextRawByte += c.nRawBytes[h];
+        hit.RawData.assign(begin, c.RawBytes.begin() + nextRawByte);
+    }
+
+    if(c.nExtraBytes[i]>0) {
+        const char* begin = addressof(c.ExtraBytes[nextExtraByte]);
+        nextExtraByte += c.nExtraBytes[i];
+        extrabuf_t buf(begin, begin + c.nExtraBytes[i]);
+        istream instream(addressof(buf));
+        cereal::BinaryInputArchive ar(instream);
+        ar(eventdata.Trigger, eventdata.SlowControls, eventdata.UnpackerMessages);
+    }
+
+    return event;
+}
+
+UnpackerRawHitsCache::Writer::Writer(unique_ptr<Unpacker::Module> unpacker_, const string& filename) :
+    unpacker(move(unpacker_)),
+    file(filename, ios::binary | ios::trunc),
+    columns(std_ext::make_unique<columns_t>())
+{
+    if(!file)
+        throw Exception("Cannot open raw hits cache " + filename + " for writing");
+}
+
+UnpackerRawHitsCache::Writer::~Writer()
+{
+    // stopped early, the cache lacks the trailer and is rejected when read
+    if(file.is_open())
+        LOG(WARNING) << "Raw hits cache is incomplete, as not all events were unpacked";
+}
+
+TEvent UnpackerRawHitsCache::Writer::NextEvent()
+{
+    auto event = unpacker->NextEvent();
+    if(event)
+        Write(event.Reconstructed());
+    else
+        Finish();
+    return event;
+}
+
+double UnpackerRawHitsCache::Writer::PercentDone() const
+{
+    return unpacker->PercentDone();
+}
+
+bool UnpackerRawHitsCache::Writer::ProvidesSlowControl() const
+{
+    return unpacker->ProvidesSlowControl();
+}
+
+void UnpackerRawHitsCache::Writer::Write(const TEventData& eventdata)
+{
+    if(!file.is_open())
+        return;
+
+    const TID& id = eventdata.ID;
+
+    if(!headerWritten)
+        WriteHeader(id);
+
+    columns_t& c = *columns;
+
+    c.IDs.insert(c.IDs.end(), {id.Flags, id.Timestamp, id.Lower, id.Reserved});
+    c.DAQEventIDs.push_back(eventdata.Trigger.DAQEventID);
+    c.nHits.push_back(eventdata.DetectorReadHits.size());
+
+    for(const TDetectorReadHit& hit : eventdata.DetectorReadHits) {
+        if(hit.RawData.size() > numeric_limits<uint16_t>::max())
+            throw Exception(std_ext::formatter() << "RawData of hit too large for raw hits cache: " << hit);
+        c.DetectorTypes.push_back(static_cast<uint8_t>(hit.DetectorType));
+        c.ChannelTypes.push_back(static_cast<uint8_t>(hit.ChannelType));
+        c.Channels.push_back(hit.Channel);
+        c.nRawBytes.push_back(hit.RawData.size());
+        c.RawBytes.insert(c.RawBytes.end(), hit.RawData.begin(), hit.RawData.end());
+    }
+
+    // the extras are rarely present
+    const auto extraBytes_before = c.ExtraBytes.size();
+    if(!eventdata.Trigger.DAQErrors.empty() ||
+       !eventdata.SlowControls.empty() ||
+       !eventdata.UnpackerMessages.empty())
+    {
+        extrabuf_t buf(c.ExtraBytes);
+        ostream outstream(addressof(buf));
+        cereal::BinaryOutputArchive ar(outstream);
+        ar(eventdata.Trigger, eventdata.SlowControls, eventdata.UnpackerMessages);
+    }
+    c.nExtraBytes.push_back(c.ExtraBytes.size() - extraBytes_before);
+    nEvents++;
+
+    if(c.size() == ChunkEvents)
+        WriteChunk();
+}
+
+void UnpackerRawHitsCache::Writer::WriteHeader(const TID& id)
+{
+    const uint32_t header[5] = {FileVersion, id.Flags, id.Timestamp, id.Lower, id.Reserved};
+    file.write(FileMarker, sizeof(FileMarker));
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    headerWritten = true;
+}
+
+void UnpackerRawHitsCache::Writer::WriteChunk()
+{
+    if(columns->size() == 0)
+        return;
+
+    const uint32_t nPacked = columns->Compress(compressed);
+    const uint32_t header[3] = {ChunkMarker, nPacked, uint32_t(compressed.size())};
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(compressed.data(), compressed.size());
+    if(!file)
+        throw Exception("Error while writing raw hits cache");
+
+    columns->clear();
+}
+
+void UnpackerRawHitsCache::Writer::Finish()
+{
+    if(!file.is_open())
+        return;
+
+    if(!headerWritten) {
+        LOG(WARNING) << "No events written to raw hits cache";
+        WriteHeader(TID());
+    }
+
+    WriteChunk();
+
+    const trailer_t trailer{EndMarker, {uint32_t(nEvents), uint32_t(nEvents >> 32)}};
+    file.write(reinterpret_cast<const char*>(addressof(trailer)), sizeof(trailer));
+    file.close();
+    if(!file)
+        throw Exception("Error while finishing raw hits cache");
+}
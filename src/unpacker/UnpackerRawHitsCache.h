@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Unpacker.h"
+
+#include <memory>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace ant {
+
+struct TEventData;
+struct TID;
+
+namespace unpacker {
+namespace rawhitscache {
+struct columns_t;
+}}
+
+/**
+ * @brief The UnpackerRawHitsCache class reads back the raw hits cache
+ *
+ * The cache is written once per raw file by UnpackerRawHitsCache::Writer and
+ * contains what the raw data unpacker produced: the event IDs, DAQ event IDs,
+ * DetectorReadHits with their RawData, and the rarely present slow controls,
+ * unpacker messages and DAQ errors.
+ *
+ * The events are stored in zlib compressed chunks, each chunk keeps the per-event
+ * and per-hit fields as separate columns. A trailer with the number of events marks
+ * the cache as complete, incomplete caches are rejected. Reading a chunk reuses the buffers of the
+ * previous chunk, so only the hits of the delivered TEvent are allocated.
+ *
+ * @note the cache stores native byte order and is thus not portable to big endian machines
+ */
+class UnpackerRawHitsCache : public Unpacker::Module
+{
+public:
+    UnpackerRawHitsCache();
+    virtual ~UnpackerRawHitsCache();
+    virtual bool OpenFile(const std::string& filename) override;
+    virtual TEvent NextEvent() override;
+    virtual bool ProvidesSlowControl() const override { return true; }
+
+    class Exception : public Unpacker::Exception {
+        using Unpacker::Exception::Exception; // use base class constructor
+    };
+
+    virtual double PercentDone() const override;
+
+    /**
+     * @brief The Writer class writes the events of some raw data unpacker to a cache file
+     *
+     * It is itself an Unpacker::Module, which passes on the events of the given unpacker unchanged,
+     * so the cache is written during an ordinary pass over the raw file.
+     * The last chunk and the trailer are written when the given unpacker runs out of events.
+     * If the Writer is destroyed before, the cache stays incomplete and cannot be read.
+     */
+    class Writer : public Unpacker::Module {
+    public:
+        /**
+         * @param unpacker the raw data unpacker, events must have reconstructed data only
+         * @param filename of the cache file, overwritten if existing
+         * @throw Exception if the file cannot be opened
+         */
+        Writer(std::unique_ptr<Unpacker::Module> unpacker, const std::string& filename);
+        virtual ~Writer();
+
+        virtual TEvent NextEvent() override;
+        virtual double PercentDone() const override;
+        virtual bool ProvidesSlowControl() const override;
+
+        /**
+         * @brief Write adds the unpacked data of one event to the cache
+         * @param eventdata as given by the raw data unpacker, before reconstruction
+         */
+        void Write(const TEventData& eventdata);
+
+    protected:
+        virtual bool OpenFile(const std::string&) override { return false; }
+
+        /**
+         * @brief Finish writes the last chunk and the trailer, further writes are ignored
+         */
+        void Finish();
+
+        void WriteHeader(const TID& id);
+        void WriteChunk();
+
+        std::unique_ptr<Unpacker::Module> unpacker;
+        std::ofstream file;
+        std::unique_ptr<unpacker::rawhitscache::columns_t> columns;
+        std::vector<char> compressed;
+        bool headerWritten = false;
+        std::uint64_t nEvents = 0;
+    };
+
+    /**
+     * @brief ChunkEvents is the number of events stored per chunk
+     */
+    static constexpr unsigned ChunkEvents = 2048;
+
+private:
+    bool ReadChunk();
+
+    std::ifstream file;
+    // filesize is where the trailer starts
+    std::streamsize filesize = 0;
+    std::streamsize filepos = 0;
+    std::uint64_t nEvents = 0;
+    std::uint64_t nEventsExpected = 0;
+
+    std::unique_ptr<unpacker::rawhitscache::columns_t> columns;
+    std::vector<char> compressed;
+
+    // position of the next event in the current chunk
+    std::uint32_t nextEvent = 0;
+    std::uint32_t nextHit = 0;
+    std::uint32_t nextRawByte = 0;
+    std::uint32_t nextExtraByte = 0;
+};
+
+} // namespace ant
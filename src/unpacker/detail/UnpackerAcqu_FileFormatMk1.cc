@@ -251,7 +251,10 @@ void acqu::FileFormatMk1::HandleDAQError(vector<TDAQError>& errors,
     // mapping is according to Acqu's Mk1ErrorCheck routine in TAcquRoot.h
     errors.emplace_back(err->fCrate, err->fBus, err->fCode, "Mk1-UNKNOWN");
 
-    VLOG_N_TIMES(1000, 2) << errors.back();
+    // at most 1000 lines, deferred when unpacking on a worker
+    static logger::detail::site_t errors_site;
+    if(VLOG_IS_ON(2))
+        Log(2, std_ext::formatter() << errors.back(), addressof(errors_site), 1000);
 
     advance(it, wordsize);
     good = true;
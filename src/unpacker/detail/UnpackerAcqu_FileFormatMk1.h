@@ -25,6 +25,9 @@ protected:
     virtual void FillInfo(reader_t& reader, buffer_t& buffer, Info& info) override;
     virtual void FillFirstDataBuffer(reader_t& reader, buffer_t& buffer) const override;
     virtual void UnpackEvent(TEventData& eventdata, it_t& it, const it_t& it_endbuffer, bool& good) noexcept override;
+    virtual std::unique_ptr<FileFormatBase> MakeWorker() const override {
+        return std::unique_ptr<FileFormatBase>(new FileFormatMk1(*this));
+    }
 
     void FindScalerBlocks(const std::vector<Info::HardwareModule>& scalerinfos);
 
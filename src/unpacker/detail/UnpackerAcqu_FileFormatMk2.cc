@@ -327,7 +327,10 @@ void acqu::FileFormatMk2::HandleDAQError(std::vector<TDAQError>& errors,
 
     errors.emplace_back(err->fModID, err->fModIndex, err->fErrCode, modname);
 
-    VLOG_N_TIMES(1000, 2) << errors.back();
+    // not VLOG_N_TIMES, the workers must not log
+    static logger::detail::site_t errors_site;
+    if(VLOG_IS_ON(2))
+        Log(2, std_ext::formatter() << errors.back(), addressof(errors_site), 1000);
 
     advance(it, wordsize);
     good = true;
@@ -21,6 +21,9 @@
 #include <ctime>
 #include <iterator> // for std::next
 #include <cstdlib>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 using namespace std;
 using namespace ant;
@@ -132,11 +135,107 @@ void acqu::FileFormatBase::Setup(reader_t &&reader_, buffer_t &&buffer_) {
         }
     }
 
+    if(UnpackerAcqu::Settings.Workers>0 && !buffer.empty()) {
+        VLOG(5) << "Unpacking records with " << UnpackerAcqu::Settings.Workers << " workers";
+        workers = std_ext::make_unique<acqu::workers_t>(*this, UnpackerAcqu::Settings.Workers);
+    }
 }
 
-acqu::FileFormatBase::~FileFormatBase()
+/**
+ * @brief The workers_t struct runs the workers, each unpacks every n-th record of a batch
+ */
+struct acqu::workers_t {
+
+    workers_t(const FileFormatBase& format, unsigned n) {
+        for(unsigned i=0;i<n;i++)
+            formats.emplace_back(format.MakeWorker());
+        for(unsigned i=0;i<n;i++)
+            threads.emplace_back([this, i] () { run(i); });
+    }
+
+    ~workers_t() {
+        {
+            lock_guard<mutex> lock(mtx);
+            stop = true;
+        }
+        cv_start.notify_all();
+        for(auto& t : threads)
+            t.join();
+    }
+
+    void Start(vector<FileFormatBase::record_t>& records_) {
+        {
+            lock_guard<mutex> lock(mtx);
+            records = addressof(records_);
+            nBusy = formats.size();
+            ++generation;
+        }
+        cv_start.notify_all();
+    }
+
+    void Wait() {
+        unique_lock<mutex> lock(mtx);
+        cv_done.wait(lock, [this] () { return nBusy == 0; });
+    }
+
+    unsigned size() const { return formats.size(); }
+
+protected:
+    void run(unsigned i) {
+        unsigned last_generation = 0;
+        while(true) {
+            {
+                unique_lock<mutex> lock(mtx);
+                cv_start.wait(lock, [this, last_generation] () { return stop || generation != last_generation; });
+                if(stop)
+                    return;
+                last_generation = generation;
+            }
+
+            auto& r = *records;
+            for(auto j=i;j<r.size();j+=formats.size())
+                formats[i]->UnpackRecord(r[j]);
+
+            {
+                lock_guard<mutex> lock(mtx);
+                --nBusy;
+            }
+            cv_done.notify_one();
+        }
+    }
+
+    vector<unique_ptr<FileFormatBase>> formats;
+    vector<thread> threads;
+
+    mutex mtx;
+    condition_variable cv_start;
+    condition_variable cv_done;
+    vector<FileFormatBase::record_t>* records = nullptr;
+    unsigned generation = 0;
+    unsigned nBusy = 0;
+    bool stop = false;
+};
+
+acqu::FileFormatBase::FileFormatBase() = default;
+
+acqu::FileFormatBase::FileFormatBase(const FileFormatBase& other) :
+    UnpackerAcquFileFormat(other),
+    trueRecordLength(other.trueRecordLength),
+    nUnpackedBuffers(0),
+    nEventsInBuffer(0),
+    info(other.info),
+    id(other.id),
+    // the hit mappings are owned by other, which outlives its workers
+    hit_mappings_ptr(other.hit_mappings_ptr),
+    scaler_mappings(other.scaler_mappings)
 {
+    defer_log = true;
+}
 
+acqu::FileFormatBase::~FileFormatBase()
+{
+    // stop the workers before the records go away
+    workers = nullptr;
 }
 
 double acqu::FileFormatBase::PercentDone() const
@@ -205,10 +304,17 @@ void acqu::FileFormatBase::LogMessage(
         bool emit_warning
         ) const
 {
-
     messages.emplace_back(level, msg);
+    LogLine(level, msg, emit_warning);
+}
 
-    unsigned levelnum = 1;
+void acqu::FileFormatBase::LogLine(
+        TUnpackerMessage::Level_t level,
+        const string& msg,
+        bool emit_warning
+        ) const
+{
+    int levelnum = 1;
     switch(level) {
     case TUnpackerMessage::Level_t::Info:
         levelnum = 3;
@@ -222,11 +328,35 @@ void acqu::FileFormatBase::LogMessage(
 
     const string& msg_ = std_ext::formatter()
                          << "(nUnpackedBuffers=" << nUnpackedBuffers << ", nEventsInBuffer=" << nEventsInBuffer << ")"
-                         << " [TUnpackerMessage] " << messages.back().Message;
+                         << " [TUnpackerMessage] " << msg;
     if(emit_warning)
-        LOG(WARNING) << msg_;
+        levelnum = 0;
+    Log(levelnum, msg_);
+}
+
+void acqu::FileFormatBase::Log(int level, const string& msg,
+                               logger::detail::site_t* site, unsigned long long n) const
+{
+    // disabled verbose lines are not counted, as for VLOG_N_TIMES
+    if(level>0 && !VLOG_IS_ON(level))
+        return;
+    log_line_t line{level, msg, site, n};
+    if(defer_log)
+        deferred_log.emplace_back(move(line));
+    else
+        EmitLog(line);
+}
+
+void acqu::FileFormatBase::EmitLog(const log_line_t& line)
+{
+    if(line.Site && !line.Site->FirstN(line.N))
+        return;
+    if(line.Level < 0)
+        LOG(ERROR) << line.Message;
+    else if(line.Level == 0)
+        LOG(WARNING) << line.Message;
     else
-        VLOG(levelnum) << msg_;
+        VLOG(line.Level) << line.Message;
 }
 
 void acqu::FileFormatBase::AppendMessagesToEvent(TEvent& event) const
@@ -248,6 +378,12 @@ void acqu::FileFormatBase::FillEvents(queue_t& queue) noexcept
     // this method never throws exceptions, but just adds TUnpackerMessage to event
     // if something strange while unpacking is encountered
 
+    // the records taken ahead must still be unpacked
+    if(workers && !records.empty()) {
+        FillEventsParallel(queue);
+        return;
+    }
+
     // we use the buffer as some state-variable
     // if the buffer is already empty now, there is nothing more to read
     if(buffer.empty()) {
@@ -262,6 +398,11 @@ void acqu::FileFormatBase::FillEvents(queue_t& queue) noexcept
         return;
     }
 
+    if(workers) {
+        FillEventsParallel(queue);
+        return;
+    }
+
     // start parsing the filled buffer
     // however, we fill a temporary queue first
     auto it = buffer.cbegin();
@@ -291,7 +432,17 @@ void acqu::FileFormatBase::FillEvents(queue_t& queue) noexcept
 
     nUnpackedBuffers++;
 
+    ReadNextRecord();
+
+    // the above refill might have created messages,
+    // and to suppress empty events with messages only,
+    // we simply append them to the last event if any present
+    if(!queue.empty())
+        AppendMessagesToEvent(queue.back());
+}
 
+void acqu::FileFormatBase::ReadNextRecord() noexcept
+{
     // refill the buffer
     try {
         reader->read(buffer.data(), trueRecordLength);
@@ -320,11 +471,144 @@ void acqu::FileFormatBase::FillEvents(queue_t& queue) noexcept
         }
         buffer.clear();
     }
+}
 
-    // the above refill might have created messages,
-    // and to suppress empty events with messages only,
-    // we simply append them to the last event if any present
-    if(!queue.empty())
+void acqu::FileFormatBase::TakeRecords(vector<record_t>& records_) noexcept
+{
+    records_.resize(workers->size()*max(UnpackerAcqu::Settings.RecordsPerWorker, 1u));
+    auto it_record = records_.begin();
+    for(; it_record != records_.end() && !buffer.empty(); ++it_record) {
+        auto& record = *it_record;
+        record.Number = nUnpackedBuffers + distance(records_.begin(), it_record);
+        // keep the memory of the record buffers
+        swap(record.Buffer, buffer);
+        buffer.resize(trueRecordLength);
+        // the read messages are kept apart from the pending messages,
+        // and logged when the record is spliced, as in the serial unpacking
+        record.ReadMessages.clear();
+        swap(messages, record.ReadMessages);
+        defer_log = true;
+        ReadNextRecord();
+        defer_log = false;
+        deferred_log.clear();
+        swap(messages, record.ReadMessages);
+    }
+    records_.erase(it_record, records_.end());
+}
+
+void acqu::FileFormatBase::FillEventsParallel(queue_t& queue) noexcept
+{
+    if(records.empty())
+        TakeRecords(records);
+
+    // read the next records while the workers unpack the current ones
+    workers->Start(records);
+    TakeRecords(records_next);
+    workers->Wait();
+
+    for(auto& record : records)
+        SpliceRecord(queue, record);
+
+    swap(records, records_next);
+}
+
+void acqu::FileFormatBase::UnpackRecord(record_t& record) noexcept
+{
+    // the worker starts each record from scratch,
+    // so id.Lower==0 skips the AcquID check for the first event
+    id = TID();
+    AcquID_last = 0;
+    nUnpackedBuffers = record.Number;
+    messages.clear();
+    record.Events.clear();
+
+    auto it = record.Buffer.cbegin();
+    record.Good = UnpackDataBuffer(record.Events, it, record.Buffer.cend());
+    record.NEvents = id.Lower;
+    record.LastAcquID = AcquID_last;
+    record.NEventsInBuffer = nEventsInBuffer;
+    record.UnpackedWords = distance(record.Buffer.cbegin(), it);
+    record.Messages = move(messages);
+    messages.clear();
+    record.Log = move(deferred_log);
+    deferred_log.clear();
+}
+
+void acqu::FileFormatBase::SpliceRecord(queue_t& queue, record_t& record) noexcept
+{
+    // do what FillEvents does with the unpacked record,
+    // such that the events and messages are identical to the serial unpacking
+
+    // the worker did not check the first AcquID against the previous record
+    nEventsInBuffer = 0;
+    if(!record.Events.empty()) {
+        const unsigned acquID = record.Events.front().Reconstructed().Trigger.DAQEventID;
+        if(AcquID_last>acquID) {
+            Log(8, std_ext::formatter() << "Overflow of Acqu EventId detected from "
+                << AcquID_last << " to " << acquID);
+        }
+        if(id.Lower>0 && acquID != AcquID_last+1) {
+            LogMessage(TUnpackerMessage::Level_t::DataError,
+                       std_ext::formatter()
+                       << "AcquID=" << acquID << " not consecutive from last AcquID=" << AcquID_last,
+                       true // emit warning
+                       );
+        }
+        AcquID_last = record.LastAcquID;
+
+        // the pending messages belong in front of the first event's messages,
+        // (if the first event was unpacked successfully, they went to it)
+        if(record.NEvents>0) {
+            auto& u_messages = record.Events.front().Reconstructed().UnpackerMessages;
+            u_messages.insert(u_messages.begin(), messages.begin(), messages.end());
+            messages.clear();
+        }
+    }
+
+    for(const auto& line : record.Log)
+        EmitLog(line);
+
+    const auto size_before = queue.size();
+
+    if(!record.Good) {
+        LOG(WARNING) << "Error while unpacking buffer n=" << record.Number
+                     << ", discarding all unpacked data from buffer.";
+
+        // the discarded events have consumed IDs
+        for(unsigned i=0;i<record.NEvents;i++)
+            ++id;
+
+        messages.insert(messages.end(), record.Messages.begin(), record.Messages.end());
+        messages.emplace_back(
+                    TUnpackerMessage::Level_t::DataDiscard,
+                    "Discarded buffer number {}"
+                    );
+        messages.back().Payload.push_back(record.Number);
+
+        queue.emplace_back(id);
+        AppendMessagesToEvent(queue.back());
+    }
+    else {
+        VLOG(7) << "Successfully unpacked " << record.UnpackedWords << " words ("
+                << 100.0*record.UnpackedWords/record.Buffer.size() << " %) from buffer ";
+        for(auto& event : record.Events) {
+            event.Reconstructed().ID = id;
+            ++id;
+        }
+        queue.splice(queue.end(), move(record.Events));
+        // left-overs are pending for the next event
+        messages.insert(messages.end(), record.Messages.begin(), record.Messages.end());
+    }
+    record.Events.clear();
+
+    nUnpackedBuffers++;
+
+    // as after the refill in FillEvents
+    nEventsInBuffer = record.NEventsInBuffer;
+    for(const auto& message : record.ReadMessages)
+        LogLine(message.Level, message.Message, false);
+    messages.insert(messages.end(), record.ReadMessages.begin(), record.ReadMessages.end());
+    if(queue.size() != size_before)
         AppendMessagesToEvent(queue.back());
 }
 
@@ -425,8 +709,8 @@ bool acqu::FileFormatBase::UnpackDataBuffer(UnpackerAcquFileFormat::queue_t& que
         // extract and check serial ID (first word of event)
         const unsigned acquID = *it;
         if(AcquID_last>acquID) {
-            VLOG(8) << "Overflow of Acqu EventId detected from "
-                    << AcquID_last << " to " << acquID;
+            Log(8, std_ext::formatter() << "Overflow of Acqu EventId detected from "
+                << AcquID_last << " to " << acquID);
         }
         if(id.Lower>0 && acquID != AcquID_last+1) {
             LogMessage(TUnpackerMessage::Level_t::DataError,
@@ -497,7 +781,7 @@ bool acqu::FileFormatBase::UnpackDataBuffer(UnpackerAcquFileFormat::queue_t& que
 
 void acqu::FileFormatBase::FillDetectorReadHits(const hit_storage_t& hit_storage,
                                                 const hit_mappings_ptr_t& hit_mappings_ptr,
-                                                vector<TDetectorReadHit>& hits) noexcept
+                                                vector<TDetectorReadHit>& hits) const noexcept
 {
     // the order of hits corresponds to the given mappings
     hits.reserve(2*hit_storage.size());
@@ -515,11 +799,11 @@ void acqu::FileFormatBase::FillDetectorReadHits(const hit_storage_t& hit_storage
         for(const UnpackerAcquConfig::hit_mapping_t* mapping : hit_mappings_ptr[ch]) {
             using RawChannel_t = UnpackerAcquConfig::RawChannel_t<uint16_t>;
             if(mapping->RawChannels.size() != 1) {
-                LOG(ERROR) << "Not implemented";
+                Log(-1, "Not implemented");
                 continue;
             }
             if(mapping->RawChannels[0].Mask != RawChannel_t::NoMask()) {
-                LOG(ERROR) << "Not implemented";
+                Log(-1, "Not implemented");
                 continue;
             }
             std::vector<std::uint8_t> rawData(sizeof(uint16_t)*values.size());
@@ -532,7 +816,7 @@ void acqu::FileFormatBase::FillDetectorReadHits(const hit_storage_t& hit_storage
 }
 
 void acqu::FileFormatBase::FillSlowControls(const scalers_t& scalers, const scaler_mappings_t& scaler_mappings,
-                                           vector<TSlowControl>& slowcontrols) noexcept
+                                           vector<TSlowControl>& slowcontrols) const noexcept
 {
     if(scalers.empty())
         return;
@@ -570,6 +854,7 @@ void acqu::FileFormatBase::FillSlowControls(const scalers_t& scalers, const scal
             }
         }
 
-        VLOG(9) << sc;
+        if(VLOG_IS_ON(9))
+            Log(9, std_ext::formatter() << sc);
     }
 }
@@ -14,6 +14,7 @@
 
 namespace ant {
 
+namespace logger { namespace detail { struct site_t; } }
 
 /**
  * @brief The UnpackerAcquFile class
@@ -60,13 +61,48 @@ protected:
 namespace unpacker {
 namespace acqu {
 
+struct workers_t; // the threads for parallel unpacking
+
 // FileFormatBase provides a common class for Mk1/Mk2 formats
 class FileFormatBase : public UnpackerAcquFileFormat {
 public:
+    FileFormatBase();
     virtual ~FileFormatBase();
 
     virtual double PercentDone() const override;
 
+    /**
+     * @brief The log_line_t struct is a log line deferred until the record is spliced
+     */
+    struct log_line_t {
+        int Level; // -1 is error, 0 is warning, otherwise verbosity
+        std::string Message;
+        // if set, only the first N lines of this site are written
+        logger::detail::site_t* Site;
+        unsigned long long N;
+    };
+
+    /**
+     * @brief The record_t struct is one file record for parallel unpacking
+     */
+    struct record_t {
+        std::vector<std::uint32_t> Buffer;
+        unsigned Number = 0;
+        // messages from reading the following record,
+        // the serial unpacking appends them after this record
+        std::vector<TUnpackerMessage> ReadMessages;
+
+        // filled by the worker, the event IDs are fixed when spliced
+        queue_t Events;
+        bool Good = false;
+        unsigned NEvents = 0; // number of event IDs used
+        unsigned LastAcquID = 0;
+        unsigned NEventsInBuffer = 0;
+        unsigned UnpackedWords = 0;
+        std::vector<TUnpackerMessage> Messages; // not appended to any event
+        std::vector<log_line_t> Log; // deferred log lines of the worker
+    };
+
 private:
     std::unique_ptr<RawFileReader> reader;
     std::vector<std::uint32_t>     buffer;
@@ -78,8 +114,33 @@ private:
     unsigned nUnpackedBuffers;
     unsigned nEventsInBuffer;
     time_t GetTimeStamp();
+
+    // parallel unpacking, see UnpackerAcqu::Settings
+    std::unique_ptr<workers_t> workers;
+    std::vector<record_t> records;
+    std::vector<record_t> records_next;
+    // the worker threads must not log, Log() defers the lines
+    // until the main thread splices the record
+    bool defer_log = false;
+    mutable std::vector<log_line_t> deferred_log;
+    static void EmitLog(const log_line_t& line);
+    void LogLine(TUnpackerMessage::Level_t level, const std::string& msg, bool emit_warning) const;
+    void ReadNextRecord() noexcept;
+    void TakeRecords(std::vector<record_t>& records_) noexcept;
+    void FillEventsParallel(queue_t& queue) noexcept;
+    void SpliceRecord(queue_t& queue, record_t& record) noexcept;
+    friend struct workers_t;
 protected:
 
+    // copies only what is needed to unpack records (used by MakeWorker)
+    FileFormatBase(const FileFormatBase& other);
+
+    /**
+     * @brief MakeWorker creates a copy of the format, which unpacks records on a worker thread
+     */
+    virtual std::unique_ptr<FileFormatBase> MakeWorker() const = 0;
+    void UnpackRecord(record_t& record) noexcept;
+
     using reader_t = decltype(reader);
     using buffer_t = decltype(buffer);
     using it_t = buffer_t::const_iterator;
@@ -137,6 +198,13 @@ protected:
     // unpacker messages handling
     void LogMessage(TUnpackerMessage::Level_t level,
                     const std::string& msg, bool emit_warning = false) const;
+    /**
+     * @brief Log writes the line, or defers it if running as worker. Use instead of LOG/VLOG
+     * @param level -1 is error, 0 is warning, otherwise verbosity
+     * @param site if given, only the first n lines of the site are written (like VLOG_N_TIMES)
+     */
+    void Log(int level, const std::string& msg,
+             logger::detail::site_t* site = nullptr, unsigned long long n = 0) const;
     void AppendMessagesToEvent(TEvent& event) const;
 
     // Mk1/Mk2 specific methods
@@ -149,10 +217,10 @@ protected:
 
     std::uint32_t GetDataBufferMarker() const;
     bool SearchFirstDataBuffer(reader_t& reader, buffer_t& buffer, size_t offset) const;
-    static void FillDetectorReadHits(const hit_storage_t& hit_storage, const hit_mappings_ptr_t& hit_mappings_ptr,
-                                     std::vector<TDetectorReadHit>& hits) noexcept;
-    static void FillSlowControls(const scalers_t& scalers, const scaler_mappings_t& scaler_mappings,
-                                 std::vector<TSlowControl>& slowcontrols) noexcept;
+    void FillDetectorReadHits(const hit_storage_t& hit_storage, const hit_mappings_ptr_t& hit_mappings_ptr,
+                              std::vector<TDetectorReadHit>& hits) const noexcept;
+    void FillSlowControls(const scalers_t& scalers, const scaler_mappings_t& scaler_mappings,
+                          std::vector<TSlowControl>& slowcontrols) const noexcept;
 
 };
 
@@ -0,0 +1,171 @@
+#include "catch.hpp"
+
+#include "analysis/utils/Combinatorics.h"
+#include "analysis/utils/IMMatrix.h"
+
+#include <random>
+#include <set>
+
+using namespace std;
+using namespace ant;
+using namespace ant::analysis;
+
+void test_ksubsets();
+void test_pairmatchings();
+void test_immatrix();
+void test_rankpairings();
+
+TEST_CASE("Combinatorics: KSubsets", "[analysis]") {
+    test_ksubsets();
+}
+
+TEST_CASE("Combinatorics: PairMatchings", "[analysis]") {
+    test_pairmatchings();
+}
+
+TEST_CASE("Combinatorics: IMMatrix", "[analysis]") {
+    test_immatrix();
+}
+
+TEST_CASE("Combinatorics: RankPairings", "[analysis]") {
+    test_rankpairings();
+}
+
+template<unsigned K>
+void compare_with_NchooseK(unsigned n) {
+    vector<unsigned> data(n);
+    for(unsigned i=0;i<n;i++)
+        data[i] = i;
+
+    auto nchoosek = utils::makeCombination(data, K);
+    unsigned count = 0;
+    for(utils::KSubsets<K> s(n); !s.done(); ++s) {
+        REQUIRE_FALSE(nchoosek.done());
+        for(unsigned i=0;i<K;i++)
+            REQUIRE(s[i] == nchoosek.at(i));
+        ++nchoosek;
+        ++count;
+    }
+    REQUIRE(nchoosek.done());
+    REQUIRE(count == unsigned(std_ext::calcNchooseK(n, K)));
+}
+
+void test_ksubsets() {
+    for(unsigned n=1;n<10;n++) {
+        compare_with_NchooseK<1>(n);
+        compare_with_NchooseK<2>(n);
+        compare_with_NchooseK<3>(n);
+        compare_with_NchooseK<4>(n);
+    }
+    // k > n gives nothing
+    REQUIRE(utils::KSubsets<3>(2).done());
+}
+
+template<unsigned NPairs>
+void check_matchings() {
+    using matchings_t = utils::PairMatchings<NPairs>;
+    std::set<typename matchings_t::pairs_t> seen;
+    for(matchings_t m; !m.done(); ++m) {
+        // every element used exactly once, ordered pairs
+        std::set<unsigned> elements;
+        for(unsigned p=0;p<NPairs;p++) {
+            REQUIRE(m[p].first < m[p].second);
+            if(p>0)
+                REQUIRE(m[p-1].first < m[p].first);
+            elements.insert(m[p].first);
+            elements.insert(m[p].second);
+        }
+        REQUIRE(elements.size() == 2*NPairs);
+        REQUIRE(*elements.rbegin() == 2*NPairs-1);
+        REQUIRE(seen.insert(*m).second);
+    }
+    REQUIRE(seen.size() == matchings_t::Count());
+}
+
+void test_pairmatchings() {
+    static_assert(utils::PairMatchings<2>::Count() == 3, "2pi0 has 3 pairings");
+    static_assert(utils::PairMatchings<3>::Count() == 15, "3pi0 has 15 pairings");
+    check_matchings<1>();
+    check_matchings<2>();
+    check_matchings<3>();
+    check_matchings<4>();
+}
+
+TParticleList make_photons(std::mt19937& rng, unsigned n) {
+    std::uniform_real_distribution<double> E(20, 800);
+    std::uniform_real_distribution<double> theta(0.1, 2.8);
+    std::uniform_real_distribution<double> phi(-M_PI, M_PI);
+    TParticleList photons;
+    for(unsigned i=0;i<n;i++)
+        photons.emplace_back(make_shared<TParticle>(ParticleTypeDatabase::Photon, E(rng), theta(rng), phi(rng)));
+    return photons;
+}
+
+void test_immatrix() {
+    std::mt19937 rng(3);
+    utils::IMMatrix ims;
+    for(unsigned n=0;n<9;n++) {
+        const auto photons = make_photons(rng, n);
+        ims.Set(photons, true);
+        REQUIRE(ims.size() == n);
+
+        for(unsigned i=0;i<n;i++) {
+            for(unsigned j=i+1;j<n;j++) {
+                const auto IM_ij = (*photons[i] + *photons[j]).M();
+                REQUIRE(ims.IM(i,j) == Approx(IM_ij));
+                REQUIRE(ims.IM(j,i) == Approx(IM_ij));
+                for(unsigned k=j+1;k<n;k++) {
+                    const auto IM_ijk = (*photons[i] + *photons[j] + *photons[k]).M();
+                    REQUIRE(ims.IM(i,j,k) == Approx(IM_ijk));
+                    REQUIRE(ims.IM(std::array<unsigned,3>{i,j,k}) == Approx(IM_ijk));
+                }
+            }
+        }
+
+        // subset sums in the same order as NchooseK
+        for(unsigned k=1;k<=n;k++) {
+            auto comb = utils::makeCombination(photons, k);
+            ims.ForEachSubset(k, [&comb] (const LorentzVec& sum) {
+                REQUIRE_FALSE(comb.done());
+                LorentzVec expected;
+                for(const auto& p : comb)
+                    expected += *p;
+                REQUIRE(sum.M() == Approx(expected.M()));
+                REQUIRE(sum.E == Approx(expected.E));
+                ++comb;
+            });
+            REQUIRE(comb.done());
+        }
+    }
+}
+
+void test_rankpairings() {
+    std::mt19937 rng(5);
+    const auto photons = make_photons(rng, 7);
+    const utils::IMMatrix ims(photons);
+    const double mass = ParticleTypeDatabase::Pi0.Mass();
+    const double sigma = 10;
+
+    // pair the last 6 photons
+    const std::array<unsigned, 6> indices{1,2,3,4,5,6};
+    const auto ranked = utils::RankPairings<3>(ims, indices, mass, sigma);
+    REQUIRE(ranked.size() == 15);
+
+    double prev = -1;
+    for(const auto& r : ranked) {
+        REQUIRE(r.Chi2 >= prev);
+        prev = r.Chi2;
+        double chi2 = 0;
+        for(const auto& pair : r.Pairs) {
+            REQUIRE(pair.first > 0);
+            const auto IM = (*photons[pair.first] + *photons[pair.second]).M();
+            chi2 += std_ext::sqr((IM - mass)/sigma);
+        }
+        REQUIRE(r.Chi2 == Approx(chi2));
+    }
+
+    const auto ranked_2pi0 = utils::RankPairings<2>(utils::IMMatrix(TParticleList(photons.begin(), photons.begin()+4)),
+                                                    mass, sigma);
+    REQUIRE(ranked_2pi0.size() == 3);
+    REQUIRE(ranked_2pi0.front().Chi2 <= ranked_2pi0.back().Chi2);
+}
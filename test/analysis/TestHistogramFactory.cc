@@ -1,6 +1,7 @@
 #include "catch.hpp"
 
 #include "analysis/plot/HistogramFactory.h"
+#include "analysis/plot/ThreadHist.h"
 #include "base/WrapTFile.h"
 #include "base/tmpfile_t.h"
 
@@ -9,6 +10,12 @@
 #include "TH3D.h"
 #include "TGraph.h"
 #include "TTree.h"
+#include "TRandom3.h"
+
+#include <thread>
+#include <array>
+#include <atomic>
+#include <algorithm>
 
 using namespace std;
 using namespace ant;
@@ -17,6 +24,8 @@ using namespace ant::analysis;
 void dotest_make();
 void dotest_nameclash();
 void dotest_numdir();
+void dotest_threadhists();
+void dotest_threadslots();
 
 
 TEST_CASE("HistogramFactory: Make", "[analysis]") {
@@ -32,6 +41,14 @@ TEST_CASE("HistogramFactory: Numbered directories", "[analysis]") {
     dotest_numdir();
 }
 
+TEST_CASE("HistogramFactory: Thread histograms", "[analysis]") {
+    dotest_threadhists();
+}
+
+TEST_CASE("HistogramFactory: Thread slots", "[analysis]") {
+    dotest_threadslots();
+}
+
 
 void dotest_make() {
     gDirectory->Clear();
@@ -88,3 +105,106 @@ void dotest_numdir() {
     // back in old dir
     REQUIRE(dynamic_cast<TDirectory*>(gDirectory->FindObject("Test_2")));
 }
+
+void dotest_threadhists() {
+    gDirectory->Clear();
+
+    HistogramFactory h("Test");
+    HistogramFactory h_sub("Sub", h);
+
+    auto h1 = h.makeThreadTH1D("h1", {"x", BinSettings(100,-3,3)});
+    auto h2 = h_sub.makeThreadTH2D("h2", {"x", BinSettings(50,-3,3)}, {"y", BinSettings(40,-2,2)});
+    auto h1_ref = h.makeTH1D("h1_ref", {"x", BinSettings(100,-3,3)});
+    auto h2_ref = h.makeTH2D("h2_ref", {"x", BinSettings(50,-3,3)}, {"y", BinSettings(40,-2,2)});
+
+    // draw some random numbers in advance, use some weights
+    const unsigned nThreads = 4;
+    const unsigned nFills = 3000; // larger than ThreadHist::BufferSize
+    TRandom3 rng(0);
+    vector<vector<array<double,3>>> values(nThreads);
+    for(auto& v : values) {
+        for(unsigned i=0;i<nFills;i++) {
+            v.push_back({rng.Gaus(), rng.Gaus(), i % 3 == 0 ? 2.0 : 1.0});
+            h1_ref->Fill(v.back()[0], v.back()[2]);
+            h2_ref->Fill(v.back()[0], v.back()[1], v.back()[2]);
+        }
+    }
+
+    vector<thread> threads;
+    for(unsigned t=0;t<nThreads;t++) {
+        threads.emplace_back([t, h1, h2, &values] () {
+            ThreadSlot::Set(t);
+            for(auto& v : values[t]) {
+                h1->Fill(v[0], v[2]);
+                h2->Fill(v[0], v[1], v[2]);
+            }
+        });
+    }
+    for(auto& t : threads)
+        t.join();
+
+    // nothing in there before merge
+    CHECK(h1->Hist->GetEntries() == 0);
+
+    // parent merges children as well
+    h.MergeThreadHists();
+
+    CHECK(h1->Hist->GetEntries() == Approx(h1_ref->GetEntries()));
+    CHECK(h1->Hist->GetMean() == Approx(h1_ref->GetMean()));
+    CHECK(h1->Hist->GetRMS() == Approx(h1_ref->GetRMS()));
+    for(int bin=0;bin<h1->Hist->GetNcells();bin++) {
+        REQUIRE(h1->Hist->GetBinContent(bin) == Approx(h1_ref->GetBinContent(bin)));
+        REQUIRE(h1->Hist->GetBinError(bin) == Approx(h1_ref->GetBinError(bin)));
+    }
+
+    CHECK(h2->Hist->GetEntries() == Approx(h2_ref->GetEntries()));
+    CHECK(h2->Hist->GetCorrelationFactor() == Approx(h2_ref->GetCorrelationFactor()));
+    for(int bin=0;bin<h2->Hist->GetNcells();bin++) {
+        REQUIRE(h2->Hist->GetBinContent(bin) == Approx(h2_ref->GetBinContent(bin)));
+    }
+
+    // merging again does not change anything
+    h.MergeThreadHists();
+    CHECK(h1->Hist->GetEntries() == Approx(h1_ref->GetEntries()));
+}
+
+void dotest_threadslots() {
+    gDirectory->Clear();
+
+    HistogramFactory h("Test");
+    auto h1 = h.makeThreadTH1D("h1", {"x", BinSettings(10,0,10)});
+
+    // slots of exited threads are re-used
+    const unsigned nThreads = 2*ThreadSlot::MaxSlots+1;
+    vector<unsigned> slots(nThreads);
+    for(unsigned t=0;t<nThreads;t++) {
+        thread([t, h1, &slots] () {
+            slots[t] = ThreadSlot::Get();
+            h1->Fill(t % 10);
+        }).join();
+    }
+    for(auto slot : slots)
+        REQUIRE(slot < ThreadSlot::MaxSlots);
+
+    // running at the same time, each thread gets its own slot
+    vector<unsigned> concurrent_slots(8);
+    vector<thread> threads;
+    atomic<unsigned> nStarted{0};
+    for(unsigned t=0;t<concurrent_slots.size();t++) {
+        threads.emplace_back([t, h1, &concurrent_slots, &nStarted] () {
+            concurrent_slots[t] = ThreadSlot::Get();
+            h1->Fill(t);
+            // keep the slot until all threads have one
+            nStarted++;
+            while(nStarted < concurrent_slots.size())
+                this_thread::yield();
+        });
+    }
+    for(auto& t : threads)
+        t.join();
+    sort(concurrent_slots.begin(), concurrent_slots.end());
+    REQUIRE(unique(concurrent_slots.begin(), concurrent_slots.end()) == concurrent_slots.end());
+
+    h.MergeThreadHists();
+    CHECK(h1->Hist->GetEntries() == Approx(nThreads + concurrent_slots.size()));
+}
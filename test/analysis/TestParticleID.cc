@@ -8,6 +8,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <random>
 
 
 using namespace std;
@@ -35,6 +36,7 @@ void test_electoncut();
 void test_electonantprotoncut();
 void test_tof();
 void test_tofdee();
+void test_rasterized();
 
 
 struct testdata {
@@ -75,6 +77,10 @@ TEST_CASE("ParticleID: tof + dEE cut", "[analysis]") {
     test_tofdee();
 }
 
+TEST_CASE("ParticleID: rasterized cuts", "[analysis]") {
+    test_rasterized();
+}
+
 void test_makeTCutG() {
     auto cut = root::makeTCutG("a", {{1,1},{3,1},{3,3},{1,3}});
     REQUIRE(cut->IsInside(2,2));
@@ -155,6 +161,65 @@ void test_tofdee() {
 }
 
 
+void test_rasterized() {
+    std::mt19937 rng(0);
+
+    // some concave and self-intersecting polygons besides the cuts above
+    const vector<std::shared_ptr<TCutG>> cuts{
+        data.dEE_electron, data.dEE_proton, data.tofcut,
+        root::makeTCutG("concave", {{0,0},{10,0},{10,10},{5,2},{0,10}}),
+        root::makeTCutG("crossed", {{0,0},{10,10},{10,0},{0,10}}),
+        root::makeTCutG("banana", {{20,1},{100,3},{400,4},{400,6},{100,4.5},{20,8}})
+    };
+
+    for(const auto& cut : cuts) {
+        INFO("cut=" << cut->GetName());
+        const auto n = cut->GetN();
+        const double* x = cut->GetX();
+        const double* y = cut->GetY();
+        const auto xrange = std::minmax_element(x, x+n);
+        const auto yrange = std::minmax_element(y, y+n);
+        // sample slightly beyond the bounding box
+        const auto dx = *xrange.second - *xrange.first;
+        const auto dy = *yrange.second - *yrange.first;
+        std::uniform_real_distribution<double> rnd_x(*xrange.first - 0.1*dx, *xrange.second + 0.1*dx);
+        std::uniform_real_distribution<double> rnd_y(*yrange.first - 0.1*dy, *yrange.second + 0.1*dy);
+        std::uniform_int_distribution<int> rnd_point(0, n-1);
+
+        for(unsigned nBins : {1, 10, 256}) {
+            RasterizedCut rasterized(cut, nBins);
+            unsigned nInside = 0;
+            for(int i=0;i<100000;i++) {
+                auto px = rnd_x(rng);
+                auto py = rnd_y(rng);
+                // hit the vertices and their horizontal/vertical lines as well
+                if(i % 10 == 0)
+                    px = x[rnd_point(rng)];
+                if(i % 15 == 0)
+                    py = y[rnd_point(rng)];
+                const bool expected = cut->IsInside(px, py);
+                if(expected)
+                    nInside++;
+                if(rasterized.IsInside(px, py) != expected) {
+                    INFO("nBins=" << nBins << " x=" << px << " y=" << py);
+                    REQUIRE(rasterized.IsInside(px, py) == expected);
+                }
+            }
+            REQUIRE(nInside > 0);
+        }
+    }
+
+    // rasterized BasicParticleID must identify the same
+    BasicParticleID pid;
+    pid.dEE_electron = data.dEE_electron;
+    pid.dEE_proton = data.dEE_proton;
+    pid.tof = data.tofcut;
+    pid.Rasterize(64);
+    REQUIRE(pid.Identify(data.gamma)   == &ParticleTypeDatabase::Photon);
+    REQUIRE(pid.Identify(data.proton)  == &ParticleTypeDatabase::Proton);
+    REQUIRE(pid.Identify(data.neutron) == &ParticleTypeDatabase::Neutron);
+    REQUIRE(pid.Identify(data.electron)== &ParticleTypeDatabase::eCharged);
+}
 
 
 testdata::testdata()
@@ -17,8 +17,12 @@
 
 #include "base/tmpfile_t.h"
 #include "base/WrapTFile.h"
+#include "base/std_ext/system.h"
 
 #include "TTree.h"
+#include "TH1D.h"
+#include "TROOT.h"
+#include "RVersion.h"
 
 
 #include <iostream>
@@ -33,12 +37,27 @@ void dotest_raw_nowrite();
 void dotest_plutogeant(bool insertGoat, bool checktaggerhits = false);
 void dotest_pluto(bool insertGoat);
 void dotest_runall();
+void dotest_checkpoint();
 
 TEST_CASE("PhysicsManager: Raw Input", "[analysis]") {
     test::EnsureSetup();
     dotest_raw();
 }
 
+TEST_CASE("PhysicsManager: Raw Input with parallel compression", "[analysis]") {
+    test::EnsureSetup();
+    PhysicsManager::IOSettings.ParallelCompression = true;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+    ROOT::EnableImplicitMT(2);
+#endif
+    // same results expected, in particular the order of saved events
+    dotest_raw();
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+    ROOT::DisableImplicitMT();
+#endif
+    PhysicsManager::IOSettings = PhysicsManager::io_settings_t();
+}
+
 TEST_CASE("PhysicsManager: Raw Input without TEvent writing", "[analysis]") {
     test::EnsureSetup();
     dotest_raw_nowrite();
@@ -74,6 +93,11 @@ TEST_CASE("PhysicsManager: Run all physics", "[analysis]") {
     dotest_runall();
 }
 
+TEST_CASE("PhysicsManager: Resume from checkpoint", "[analysis]") {
+    test::EnsureSetup();
+    dotest_checkpoint();
+}
+
 struct TestPhysics : Physics
 {
     bool finishCalled = false;
@@ -371,3 +395,90 @@ void dotest_runall() {
 
 }
 
+struct CheckpointPhysics : Physics
+{
+    volatile bool* interrupt;
+    unsigned interruptAfter;
+    unsigned seenEvents = 0;
+    TH1D* h_candidates;
+
+    CheckpointPhysics(volatile bool* interrupt_ = nullptr, unsigned interruptAfter_ = 0) :
+        Physics("CheckpointPhysics", nullptr),
+        interrupt(interrupt_),
+        interruptAfter(interruptAfter_)
+    {
+        h_candidates = HistFac.makeTH1D("Candidates","nCandidates","",BinSettings(20),"h_candidates");
+    }
+
+    virtual void ProcessEvent(const TEvent& event, physics::manager_t& manager) override
+    {
+        seenEvents++;
+        h_candidates->Fill(event.Reconstructed().Candidates.size());
+        manager.SaveEvent();
+        if(interrupt && seenEvents == interruptAfter)
+            *interrupt = true;
+    }
+};
+
+void dotest_checkpoint()
+{
+    const unsigned expectedEvents = 221;
+    const std::uint32_t timestamp = 1408221194;
+
+    tmpfile_t tmpfile;
+    const string checkpoint = tmpfile.filename+".checkpoint";
+
+    auto make_readers = [] () {
+        auto unpacker = Unpacker::Get(string(TEST_BLOBS_DIRECTORY)+"/Acqu_oneevent-big.dat.xz");
+        auto reconstruct = std_ext::make_unique<Reconstruct>();
+        list< unique_ptr<analysis::input::DataReader> > readers;
+        readers.emplace_back(std_ext::make_unique<input::AntReader>(nullptr, move(unpacker), move(reconstruct)));
+        return readers;
+    };
+
+    // interrupted run, leaves checkpoint behind
+    {
+        tmpfile_t tmpfile_interrupted;
+        WrapTFileOutput outfile(tmpfile_interrupted.filename, true);
+
+        volatile bool interrupt = false;
+        PhysicsManagerTester pm(addressof(interrupt));
+        auto physics = new CheckpointPhysics(addressof(interrupt), 100);
+        pm.AddPhysics(unique_ptr<Physics>(physics));
+        pm.EnableCheckpoints(checkpoint, 0, false);
+        pm.ReadFrom(make_readers(), numeric_limits<long long>::max());
+
+        REQUIRE(physics->seenEvents == 100);
+        REQUIRE(std_ext::system::testopen(checkpoint));
+        // trees are stored incrementally, checkpoint taken after each block
+        REQUIRE(std_ext::system::testopen(checkpoint+".0"));
+        REQUIRE(std_ext::system::testopen(checkpoint+".1"));
+    }
+
+    // resumed run, same result as without interruption
+    {
+        WrapTFileOutput outfile(tmpfile.filename, true);
+
+        PhysicsManagerTester pm;
+        auto physics = new CheckpointPhysics();
+        pm.AddPhysics(unique_ptr<Physics>(physics));
+        pm.EnableCheckpoints(checkpoint, 0, true);
+        pm.ReadFrom(make_readers(), numeric_limits<long long>::max());
+
+        REQUIRE(pm.GetProcessedTIDRange() == interval<TID>(TID(timestamp, 0u), TID(timestamp, expectedEvents-1)));
+
+        // only events after the checkpoint were analyzed again
+        REQUIRE(physics->seenEvents > 0);
+        REQUIRE(physics->seenEvents < expectedEvents);
+        REQUIRE(physics->h_candidates->GetEntries() == expectedEvents);
+        REQUIRE(physics->h_candidates->Integral(0, 21) == expectedEvents);
+
+        // complete run removes the checkpoint
+        REQUIRE_FALSE(std_ext::system::testopen(checkpoint));
+        REQUIRE_FALSE(std_ext::system::testopen(checkpoint+".0"));
+
+        auto tree = outfile.GetSharedClone<TTree>("treeEvents");
+        REQUIRE(tree != nullptr);
+        REQUIRE(tree->GetEntries() == expectedEvents);
+    }
+}
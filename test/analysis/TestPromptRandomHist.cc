@@ -0,0 +1,166 @@
+#include "catch.hpp"
+
+#include "analysis/plot/PromptRandomHist.h"
+#include "analysis/plot/HistogramFactory.h"
+
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TDirectory.h"
+
+#include <vector>
+#include <type_traits>
+#include <stdexcept>
+
+using namespace std;
+using namespace ant;
+using namespace ant::analysis;
+
+// the histograms register at their Switch
+static_assert(!std::is_copy_constructible<PromptRandom::Switch>::value, "Switch must not be copyable");
+static_assert(!std::is_copy_assignable<PromptRandom::Switch>::value, "Switch must not be copyable");
+
+void dotest_classify();
+void dotest_fillregistered();
+
+TEST_CASE("PromptRandomHist: Classify tagger times", "[analysis]") {
+    dotest_classify();
+}
+
+TEST_CASE("PromptRandomHist: Fill registered", "[analysis]") {
+    dotest_fillregistered();
+}
+
+void setup_windows(PromptRandom::Switch& s) {
+    s.AddPromptRange({-2.5,2.5});
+    s.AddRandomRange({-15,-5});
+    s.AddRandomRange({  5,15});
+    // overlaps with prompt, random has precedence
+    s.AddRandomRange({  2,4});
+}
+
+// prompt, random, outside and exactly at all window edges
+const vector<double> tagtimes = {
+    0, -1, 1.5,
+    -10, 10, 3, 2.2,
+    -30, 20, -4, 4.5, -15.1,
+    -15, -5, 5, 15, -2.5, 2.5, 2, 4
+};
+
+void dotest_classify() {
+    PromptRandom::Switch s;
+    setup_windows(s);
+    REQUIRE(s.Ratio() == Approx(5.0/22.0));
+
+    s.SetTaggerTimes(tagtimes);
+    REQUIRE(s.NHits() == tagtimes.size());
+
+    vector<double> weights;
+    vector<unsigned> prompt_hits;
+    vector<unsigned> random_hits;
+    for(unsigned i=0;i<tagtimes.size();i++) {
+        s.SetTaggerTime(tagtimes[i]);
+        weights.push_back(s.FillWeight());
+        if(s.State() == PromptRandom::Case::Prompt)
+            prompt_hits.push_back(i);
+        else if(s.State() == PromptRandom::Case::Random)
+            random_hits.push_back(i);
+    }
+
+    CHECK(s.FillWeights() == weights);
+    CHECK(s.PromptHits() == prompt_hits);
+    CHECK(s.RandomHits() == random_hits);
+
+    // check some cases explicitly
+    auto state = [&s] (double t) {
+        s.SetTaggerTime(t);
+        return s.State();
+    };
+    CHECK(state(0)     == PromptRandom::Case::Prompt);
+    CHECK(state(-2.5)  == PromptRandom::Case::Prompt);
+    CHECK(state(2)     == PromptRandom::Case::Random);
+    CHECK(state(2.5)   == PromptRandom::Case::Random);
+    CHECK(state(4.5)   == PromptRandom::Case::Outside);
+    CHECK(state(-15)   == PromptRandom::Case::Random);
+    CHECK(state(-15.1) == PromptRandom::Case::Outside);
+    CHECK(state(15)    == PromptRandom::Case::Random);
+    CHECK(s.FillWeight() == Approx(-s.Ratio()));
+    CHECK(state(20)    == PromptRandom::Case::Outside);
+    CHECK(s.FillWeight() == 0.0);
+
+    // no hits at all
+    s.SetTaggerTimes({});
+    CHECK(s.NHits() == 0);
+    CHECK(s.PromptHits().empty());
+    CHECK(s.RandomHits().empty());
+}
+
+void require_same(const TH1& a, const TH1& b) {
+    REQUIRE(a.GetNcells() == b.GetNcells());
+    for(int bin=0;bin<a.GetNcells();bin++) {
+        REQUIRE(a.GetBinContent(bin) == Approx(b.GetBinContent(bin)));
+        REQUIRE(a.GetBinError(bin) == Approx(b.GetBinError(bin)));
+    }
+}
+
+void dotest_fillregistered() {
+    gDirectory->Clear();
+    HistogramFactory HistFac("Test");
+
+    PromptRandom::Switch s_ref;
+    setup_windows(s_ref);
+    PromptRandom::Hist1 h1_ref(s_ref);
+    PromptRandom::Hist2 h2_ref(s_ref);
+    h1_ref.MakeHistograms(HistFac, "h1_ref", "", BinSettings(10,0,10), "x", "");
+    h2_ref.MakeHistograms(HistFac, "h2_ref", "", BinSettings(10,0,10), BinSettings(5,0,5), "x", "y");
+
+    PromptRandom::Switch s;
+    setup_windows(s);
+    // copies are registered as well
+    vector<PromptRandom::Hist1> h1s(2, {s});
+    PromptRandom::Hist2 h2(s);
+    h1s.front().MakeHistograms(HistFac, "h1", "", BinSettings(10,0,10), "x", "");
+    h2.MakeHistograms(HistFac, "h2", "", BinSettings(10,0,10), BinSettings(5,0,5), "x", "y");
+    // back one stays unused, and without histograms
+    h1s.pop_back();
+
+    const vector<double> xs = {0.5, 3.5, 3.5, 9.5};
+
+    for(unsigned event=0;event<3;event++) {
+        // vary the number of hits, the last event has none
+        const vector<double> event_times(tagtimes.begin()+event, tagtimes.end()-event*9);
+
+        for(auto t : event_times) {
+            s_ref.SetTaggerTime(t);
+            for(auto x : xs) {
+                h1_ref.Fill(x);
+                h2_ref.Fill(x, x/2);
+            }
+        }
+
+        s.SetTaggerTimes(event_times);
+        for(auto x : xs) {
+            h1s.front().Stage(x);
+            h2.Stage(x, x/2);
+        }
+        s.FillRegistered();
+    }
+
+    require_same(*h1s.front().prompt,     *h1_ref.prompt);
+    require_same(*h1s.front().random,     *h1_ref.random);
+    require_same(*h1s.front().subtracted, *h1_ref.subtracted);
+    require_same(*h2.prompt,     *h2_ref.prompt);
+    require_same(*h2.random,     *h2_ref.random);
+    require_same(*h2.subtracted, *h2_ref.subtracted);
+
+    CHECK(h1s.front().prompt->GetEntries() == Approx(h1_ref.prompt->GetEntries()));
+    CHECK(h1s.front().random->GetEntries() == Approx(h1_ref.random->GetEntries()));
+
+    // staged values are filled only once
+    const auto entries = h1s.front().prompt->GetEntries();
+    s.FillRegistered();
+    CHECK(h1s.front().prompt->GetEntries() == entries);
+
+    // the tagger times of the previous event are not used again
+    h1s.front().Stage(1.5);
+    REQUIRE_THROWS_AS(s.FillRegistered(), std::runtime_error);
+}
@@ -0,0 +1,234 @@
+#include "catch.hpp"
+
+#include "analysis/utils/ProtonPhotonCombs.h"
+
+#include "base/std_ext/math.h"
+
+#include <list>
+#include <random>
+
+using namespace std;
+using namespace ant;
+using namespace ant::analysis;
+using comb_t = utils::ProtonPhotonCombs::comb_t;
+
+void test_filters();
+void test_views();
+void test_combfilter();
+
+TEST_CASE("ProtonPhotonCombs: Filters", "[analysis]") {
+    test_filters();
+}
+
+TEST_CASE("ProtonPhotonCombs: Views", "[analysis]") {
+    test_views();
+}
+
+TEST_CASE("ProtonPhotonCombs: Custom comb filter", "[analysis]") {
+    test_combfilter();
+}
+
+TCandidateList make_cands(std::mt19937& rng, unsigned n) {
+    std::uniform_real_distribution<double> E(20, 800);
+    std::uniform_real_distribution<double> theta(0.1, 2.8);
+    std::uniform_real_distribution<double> phi(-M_PI, M_PI);
+    TCandidateList cands;
+    for(auto i=0u;i<n;i++)
+        cands.emplace_back(Detector_t::Type_t::CB, E(rng), theta(rng), phi(rng), 0, 3, 0, 0, TClusterList{});
+    return cands;
+}
+
+// the straight-forward list based implementation,
+// used as reference for the filtered combinations
+struct reference_t {
+    std::list<comb_t> Combs;
+
+    reference_t(const TCandidateList& cands) {
+        TParticleList photons;
+        for(auto cand : cands.get_iter())
+            photons.emplace_back(make_shared<TParticle>(ParticleTypeDatabase::Photon, cand));
+        sort(photons.begin(), photons.end(), [] (const TParticlePtr& a, const TParticlePtr& b) {
+            return a->Ek() > b->Ek();
+        });
+        for(auto cand : cands.get_iter()) {
+            Combs.emplace_back(make_shared<TParticle>(ParticleTypeDatabase::Proton, cand));
+            for(auto& p : photons)
+                if(p->Candidate != cand)
+                    Combs.back().Photons.emplace_back(p);
+        }
+    }
+
+    void FilterMult(unsigned n, double maxDiscardedEk) {
+        Combs.remove_if([n,maxDiscardedEk] (comb_t& c) {
+            if(c.Photons.size()<n)
+                return true;
+            c.DiscardedEk = 0;
+            for(auto i=n;i<c.Photons.size();i++)
+                c.DiscardedEk += c.Photons[i]->Ek();
+            c.Photons.resize(n);
+            return c.DiscardedEk > maxDiscardedEk;
+        });
+    }
+
+    void FilterIM(const IntervalD& cut) {
+        Combs.remove_if([cut] (comb_t& c) {
+            c.PhotonSum = LorentzVec{{0,0,0},0};
+            for(auto& p : c.Photons)
+                c.PhotonSum += *p;
+            return !cut.Contains(c.PhotonSum.M());
+        });
+    }
+
+    void FilterMM(const TTaggerHit& taggerhit, const IntervalD& cut) {
+        const auto beam_target = taggerhit.GetPhotonBeam() + LorentzVec::AtRest(ParticleTypeDatabase::Proton.Mass());
+        Combs.remove_if([cut,beam_target] (comb_t& c) {
+            c.MissingMass = (beam_target - c.PhotonSum).M();
+            return !cut.Contains(c.MissingMass);
+        });
+    }
+};
+
+void require_same(const utils::ProtonPhotonCombs::Combinations_t& combs, const std::list<comb_t>& expected) {
+    REQUIRE(combs.size() == expected.size());
+    auto it_exp = expected.begin();
+    for(const comb_t& c : combs) {
+        REQUIRE(c.Proton->Candidate == it_exp->Proton->Candidate);
+        REQUIRE(c.Photons.size() == it_exp->Photons.size());
+        for(auto i=0u;i<c.Photons.size();i++)
+            REQUIRE(c.Photons[i]->Candidate == it_exp->Photons[i]->Candidate);
+        if(std::isfinite(it_exp->DiscardedEk))
+            REQUIRE(c.DiscardedEk == Approx(it_exp->DiscardedEk));
+        else
+            REQUIRE(std::isnan(c.DiscardedEk));
+        REQUIRE(c.PhotonSum.M() == Approx(it_exp->PhotonSum.M()));
+        if(std::isfinite(it_exp->MissingMass))
+            REQUIRE(c.MissingMass == Approx(it_exp->MissingMass));
+        ++it_exp;
+    }
+}
+
+void test_filters() {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> Ebeam(600, 1500);
+
+    unsigned nNonEmpty = 0;
+    for(auto event=0u;event<50;event++) {
+        const auto cands = make_cands(rng, 2+event % 7);
+        utils::ProtonPhotonCombs proton_photons(cands);
+
+        for(auto hit=0u;hit<10;hit++) {
+            const TTaggerHit taggerhit(hit, Ebeam(rng), 0);
+            const auto nPhotons = 1+hit % 4;
+            const IntervalD IM_cut(100, 900);
+            const IntervalD MM_cut(600, 1200);
+
+            auto combs = proton_photons()
+                         .FilterMult(nPhotons, 300)
+                         .FilterIM(IM_cut)
+                         .FilterMM(taggerhit, MM_cut);
+
+            reference_t ref(cands);
+            ref.FilterMult(nPhotons, 300);
+            ref.FilterIM(IM_cut);
+            ref.FilterMM(taggerhit, MM_cut);
+
+            require_same(combs, ref.Combs);
+            if(!combs.empty())
+                nNonEmpty++;
+
+            // FilterMM calls FilterIM automatically
+            auto combs_mm = proton_photons().FilterMM(taggerhit);
+            reference_t ref_mm(cands);
+            ref_mm.FilterIM(utils::nocut);
+            ref_mm.FilterMM(taggerhit, utils::nocut);
+            require_same(combs_mm, ref_mm.Combs);
+        }
+    }
+    // make sure the cuts did not kill everything
+    REQUIRE(nNonEmpty > 0);
+}
+
+void test_views() {
+    std::mt19937 rng(1);
+    const auto cands = make_cands(rng, 5);
+    utils::ProtonPhotonCombs proton_photons(cands);
+
+    auto all = proton_photons();
+    REQUIRE(all.size() == 5);
+
+    // filtering a copy leaves the original untouched
+    auto mult = all;
+    mult.FilterMult(2);
+    REQUIRE(all.size() == 5);
+    for(auto& c : all)
+        REQUIRE(c.Photons.size() == 4);
+    for(auto& c : mult)
+        REQUIRE(c.Photons.size() == 2);
+
+    // modifications while iterating survive copies
+    for(auto& c : mult)
+        c.Photons.pop_back();
+    const auto mult_copy = mult;
+    for(auto& c : mult_copy)
+        REQUIRE(c.Photons.size() == 1);
+
+    // custom cut sees the materialized combination
+    unsigned nCalled = 0;
+    auto custom = proton_photons().FilterMult(3).FilterCustom([&nCalled] (const comb_t& c) {
+        REQUIRE(c.Photons.size() == 3);
+        nCalled++;
+        return c.Photons.front()->Candidate == c.Photons.back()->Candidate;
+    });
+    REQUIRE(nCalled == 5);
+    REQUIRE(custom.size() == 5);
+
+    // observer is called for each pass
+    unsigned nObserved = 0;
+    proton_photons()
+            .Observe([&nObserved] (const string&) { nObserved++; }, "P ")
+            .FilterCustom([] (const comb_t& c) { return c.Proton->Candidate == nullptr; }, "cut");
+    REQUIRE(nObserved == 10);
+
+    // recycle the buffers
+    for(auto i=0u;i<10;i++) {
+        auto v = proton_photons().FilterMult(4);
+        REQUIRE(v.size() == 5);
+        for(auto& c : v)
+            REQUIRE(c.Photons.size() == 4);
+    }
+
+    // default constructed and assigned
+    utils::ProtonPhotonCombs::Combinations_t empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.begin() == empty.end());
+    empty = proton_photons();
+    REQUIRE(empty.size() == 5);
+    empty = utils::ProtonPhotonCombs::Combinations_t();
+    REQUIRE(empty.empty());
+}
+
+void test_combfilter() {
+    std::mt19937 rng(7);
+    const auto cands = make_cands(rng, 6);
+
+    // same as EtapOmegaG does, but with a larger angle
+    auto remove_forward = [] (comb_t& p) {
+        auto it = p.Photons.begin();
+        while(it != p.Photons.end()) {
+            if(std_ext::radian_to_degree((*it)->Theta())<60)
+                it = p.Photons.erase(it);
+            else
+                ++it;
+        }
+    };
+    utils::ProtonPhotonCombs proton_photons(cands, remove_forward);
+
+    reference_t ref(cands);
+    for(auto& c : ref.Combs)
+        remove_forward(c);
+    ref.FilterMult(2, std_ext::inf);
+    ref.FilterIM(utils::nocut);
+
+    auto combs = proton_photons().FilterMult(2).FilterIM();
+    require_same(combs, ref.Combs);
+}
@@ -4,8 +4,10 @@
 #include "base/WrapTFile.h"
 #include "base/tmpfile_t.h"
 #include "base/std_ext/memory.h"
+#include "base/WrapTTree.h"
 
 #include "TH1D.h"
+#include "TTree.h"
 
 using namespace std;
 using namespace ant;
@@ -104,4 +106,69 @@ TEST_CASE("Hadd: Two simple hists", "[root-addons]") {
         }
     }
 
-}
\ No newline at end of file
+}
+
+struct HaddTree_t : WrapTTree {
+    ADD_BRANCH_T(unsigned, Value)
+};
+
+void write_tree_file(const string& filename, unsigned offset, unsigned n) {
+    WrapTFileOutput out(filename);
+    HaddTree_t t;
+    t.CreateBranches(out.CreateInside<TTree>("t","t"));
+    for(unsigned i=0;i<n;i++) {
+        t.Value = offset + i;
+        t.Tree->Fill();
+    }
+    auto h = out.CreateInside<TH1D>("h","",10,0,10);
+    h->Fill(offset, 1.0);
+}
+
+TEST_CASE("Hadd: Trees and threads", "[root-addons]") {
+
+    tmpfile_t in_file1;
+    write_tree_file(in_file1.filename, 0, 100);
+    tmpfile_t in_file2;
+    write_tree_file(in_file2.filename, 100, 50);
+
+    auto merge = [&in_file1, &in_file2] (const string& outfilename, const hadd::options_t& options) {
+        auto outputfile = std_ext::make_unique<TFile>(outfilename.c_str(), "RECREATE");
+        hadd::sources_t sources;
+        sources.emplace_back(std_ext::make_unique<TFile>(in_file1.filename.c_str(), "READ"));
+        sources.emplace_back(std_ext::make_unique<TFile>(in_file2.filename.c_str(), "READ"));
+        unsigned nPaths = 0;
+        hadd::MergeRecursive(*outputfile, sources, nPaths, options);
+        outputfile->Write();
+    };
+
+    for(bool fastClone : {true, false}) {
+        tmpfile_t tmp_outfile;
+        hadd::options_t options;
+        options.nThreads = 2;
+        options.FastCloneTrees = fastClone;
+        merge(tmp_outfile.filename, options);
+
+        WrapTFileInput input(tmp_outfile.filename);
+        HaddTree_t t;
+        REQUIRE(input.GetObject("t", t.Tree));
+        t.LinkBranches();
+        REQUIRE(t.Tree->GetEntries() == 150);
+        for(long long entry=0;entry<t.Tree->GetEntries();entry++) {
+            t.Tree->GetEntry(entry);
+            REQUIRE(t.Value == entry);
+        }
+        auto h = input.GetSharedHist<TH1D>("h");
+        CHECK(h->GetEntries() == Approx(2.0));
+    }
+
+    {
+        tmpfile_t tmp_outfile;
+        hadd::options_t options;
+        options.Trees = false;
+        merge(tmp_outfile.filename, options);
+
+        WrapTFileInput input(tmp_outfile.filename);
+        TTree* tree = nullptr;
+        CHECK_FALSE(input.GetObject("t", tree));
+    }
+}
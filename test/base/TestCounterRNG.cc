@@ -0,0 +1,139 @@
+#include "catch.hpp"
+
+#include "base/CounterRNG.h"
+
+#include <vector>
+#include <cmath>
+#include <thread>
+
+using namespace std;
+using namespace ant;
+
+void dotest_philox();
+void dotest_reproducible();
+void dotest_batch();
+void dotest_distribution();
+
+TEST_CASE("CounterRNG: Philox known answers", "[base]") {
+    dotest_philox();
+}
+
+TEST_CASE("CounterRNG: Reproducible per event", "[base]") {
+    dotest_reproducible();
+}
+
+TEST_CASE("CounterRNG: Batch generation", "[base]") {
+    dotest_batch();
+}
+
+TEST_CASE("CounterRNG: Distribution", "[base]") {
+    dotest_distribution();
+}
+
+void dotest_philox() {
+    // known answer tests from Random123
+    using c_t = CounterRNG::counter_t;
+    REQUIRE(CounterRNG::Philox4x32({0,0,0,0}, {0,0}) ==
+            c_t({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    REQUIRE(CounterRNG::Philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+            c_t({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    REQUIRE(CounterRNG::Philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+            c_t({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+vector<double> draw(CounterRNG& rng, unsigned n) {
+    vector<double> v;
+    for(unsigned i=0;i<n;i++)
+        v.push_back(i % 3 == 0 ? rng.Gaus(1, 2) : rng.Uniform());
+    return v;
+}
+
+void dotest_reproducible() {
+    CounterRNG::SetSeed(42);
+
+    // events processed in any order give the same numbers
+    CounterRNG rng1(CounterRNG::Stream_t::MCSmear);
+    vector<vector<double>> forward;
+    for(unsigned id=0;id<10;id++) {
+        CounterRNG::SetEvent(id);
+        forward.emplace_back(draw(rng1, 11));
+    }
+
+    CounterRNG rng2(CounterRNG::Stream_t::MCSmear);
+    for(unsigned id=10;id-->0;) {
+        CounterRNG::SetEvent(id);
+        REQUIRE(draw(rng2, 11) == forward[id]);
+    }
+
+    // explicit start is the same as SetEvent
+    CounterRNG rng3(CounterRNG::Stream_t::MCSmear);
+    rng3.Start(5);
+    REQUIRE(draw(rng3, 11) == forward[5]);
+
+    // same in another thread, which has its own current event
+    vector<double> other;
+    thread t([&other] () {
+        CounterRNG rng(CounterRNG::Stream_t::MCSmear);
+        CounterRNG::SetEvent(7);
+        other = draw(rng, 11);
+    });
+    t.join();
+    REQUIRE(other == forward[7]);
+
+    // different streams, substreams, events and seeds differ
+    CounterRNG::SetEvent(3);
+    CounterRNG rng_stream(CounterRNG::Stream_t::ClusterSmearing);
+    CounterRNG rng_substream(CounterRNG::Stream_t::MCSmear, 1);
+    REQUIRE(draw(rng_stream, 11) != forward[3]);
+    REQUIRE(draw(rng_substream, 11) != forward[3]);
+    REQUIRE(forward[3] != forward[4]);
+    CounterRNG::SetSeed(43);
+    CounterRNG::SetEvent(3);
+    REQUIRE(draw(rng1, 11) != forward[3]);
+    CounterRNG::SetSeed(0);
+}
+
+void dotest_batch() {
+    CounterRNG::SetEvent(123);
+    CounterRNG single(CounterRNG::Stream_t::Default);
+    CounterRNG batch(CounterRNG::Stream_t::Default);
+
+    // batches with and without leftovers from previous calls
+    for(unsigned n : {1u, 7u, 16u, 33u, 100u}) {
+        vector<double> expected(n);
+        for(auto& v : expected)
+            v = single.Uniform();
+        vector<double> uniforms(n);
+        batch.Uniform(uniforms.data(), n);
+        REQUIRE(uniforms == expected);
+
+        for(auto& v : expected)
+            v = single.Gaus(3, 0.5);
+        vector<double> gaus(n);
+        batch.Gaus(gaus.data(), n, 3, 0.5);
+        REQUIRE(gaus == expected);
+    }
+}
+
+void dotest_distribution() {
+    CounterRNG::SetEvent(1);
+    CounterRNG rng(CounterRNG::Stream_t::Default);
+    const unsigned n = 100000;
+    vector<double> u(n);
+    rng.Uniform(u.data(), n);
+    vector<double> g(n);
+    rng.Gaus(g.data(), n, 5, 2);
+
+    double sum_u = 0, sum_g = 0, sum_g2 = 0;
+    for(unsigned i=0;i<n;i++) {
+        REQUIRE(u[i] > 0);
+        REQUIRE(u[i] < 1);
+        sum_u += u[i];
+        sum_g += g[i];
+        sum_g2 += g[i]*g[i];
+    }
+    const double mean_g = sum_g/n;
+    REQUIRE(sum_u/n == Approx(0.5).epsilon(0.01));
+    REQUIRE(mean_g == Approx(5).epsilon(0.01));
+    REQUIRE(sqrt(sum_g2/n - mean_g*mean_g) == Approx(2).epsilon(0.01));
+}
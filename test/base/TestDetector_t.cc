@@ -130,3 +130,38 @@ TEST_CASE("Detector_t: Detector interface", "[base]") {
     CHECK(det.IsIgnored(8));
 }
 
+
+TEST_CASE("Detector_t: Neighbour table", "[base]") {
+    // CSR style like the geometry tables, neighbours of 0..2 in one array
+    static const unsigned neighbours[] = {1, 70, /* 1 */ 0, /* 2 */};
+
+    ClusterDetector_t::neighbour_table_t table(80);
+    table.Add(0, neighbours, neighbours+2);
+    table.Add(1, neighbours+2, neighbours+3);
+    table.Add(2, neighbours+3, neighbours+3);
+
+    const auto n0 = table.Get(0);
+    REQUIRE(n0.size() == 2);
+    CHECK(n0[0] == 1);
+    CHECK(n0[1] == 70);
+    CHECK(n0.Contains(1));
+    CHECK(n0.Contains(70));
+    CHECK_FALSE(n0.Contains(0));
+    CHECK_FALSE(n0.Contains(6));
+
+    CHECK(table.Get(1).Contains(0));
+    CHECK_FALSE(table.Get(1).Contains(70));
+    CHECK(table.Get(2).empty());
+    CHECK_FALSE(table.Get(2).Contains(0));
+    CHECK(table.Get(79).empty());
+
+    // view without bitmap scans the list
+    const ClusterDetector_t::neighbours_t view(neighbours, neighbours+2);
+    CHECK(view.Contains(70));
+    CHECK_FALSE(view.Contains(2));
+
+    CHECK_THROWS_AS(table.Get(80), std::out_of_range);
+    const unsigned bad[] = {80};
+    CHECK_THROWS_AS(table.Add(3, bad, bad+1), std::out_of_range);
+    CHECK_THROWS_AS(table.Add(80, bad, bad), std::out_of_range);
+}
@@ -202,6 +202,14 @@ TEST_CASE("Piecewiese Interval: Compact2 ", "[base]") {
     REQUIRE(a == PiecewiseInterval<int>({interval<int>(2,7),interval<int>(-5,1)}));
 }
 
+TEST_CASE("Piecewiese Interval: Compact3 ", "[base]") {
+    // the last one bridges the first two
+    PiecewiseInterval<int> a({interval<int>(0,1), interval<int>(4,5), interval<int>(1,4)});
+    a.Compact();
+    REQUIRE(a.size()==1);
+    REQUIRE(a.front() == interval<int>(0,5));
+}
+
 TEST_CASE("Piecewiese Interval: Parse from string", "[base]") {
     stringstream ss_a;
     ss_a << "[[2:3][5:7]]";
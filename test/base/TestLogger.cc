@@ -0,0 +1,131 @@
+#include "catch.hpp"
+
+#include "base/Logger.h"
+
+using namespace std;
+using namespace ant;
+
+void dotest_n_times();
+void dotest_every_seconds();
+void dotest_compiled();
+void dotest_dangling_else();
+
+TEST_CASE("Logger: N times", "[base]") {
+    dotest_n_times();
+}
+
+TEST_CASE("Logger: Every seconds", "[base]") {
+    dotest_every_seconds();
+}
+
+TEST_CASE("Logger: Compiled levels", "[base]") {
+    dotest_compiled();
+}
+
+TEST_CASE("Logger: Within if/else", "[base]") {
+    dotest_dangling_else();
+}
+
+// the stream expressions are only evaluated if the message is written
+// (the loggers are disabled in tests, but that happens after evaluation)
+struct counter_t {
+    unsigned N = 0;
+    unsigned operator()() { return ++N; }
+};
+
+void dotest_n_times() {
+    counter_t logged;
+    for(int i=0;i<10;i++)
+        LOG_N_TIMES(3, INFO) << logged();
+    REQUIRE(logged.N == 3);
+
+    counter_t logged_once;
+    for(int i=0;i<10;i++)
+        LOG_ONCE(INFO) << logged_once();
+    REQUIRE(logged_once.N == 1);
+
+    // verbose ones count only if enabled
+    const auto prev_level = el::Loggers::verboseLevel();
+    el::Loggers::setVerboseLevel(0);
+    counter_t vlogged;
+    auto vlog = [&vlogged] () {
+        VLOG_N_TIMES(2, 1) << vlogged();
+    };
+    for(int i=0;i<10;i++)
+        vlog();
+    REQUIRE(vlogged.N == 0);
+    el::Loggers::setVerboseLevel(1);
+    for(int i=0;i<10;i++)
+        vlog();
+    el::Loggers::setVerboseLevel(prev_level);
+    REQUIRE(vlogged.N == 2);
+
+    logger::detail::site_t site;
+    REQUIRE(site.FirstN(2));
+    REQUIRE(site.FirstN(2));
+    REQUIRE_FALSE(site.FirstN(2));
+    REQUIRE_FALSE(site.FirstN(2));
+}
+
+void dotest_every_seconds() {
+    counter_t logged;
+    for(int i=0;i<10;i++)
+        LOG_EVERY_SECONDS(3600, INFO) << logged();
+    REQUIRE(logged.N == 1);
+
+    logger::detail::site_t site;
+    REQUIRE(site.Every(0));
+    REQUIRE(site.Every(0));
+    REQUIRE(site.Every(3600));
+    REQUIRE_FALSE(site.Every(3600));
+    REQUIRE_FALSE(site.Every(0));
+}
+
+void dotest_compiled() {
+    REQUIRE(VLOG_IS_COMPILED(0));
+    REQUIRE(VLOG_IS_COMPILED(ANT_MAX_VLOG_LEVEL));
+    REQUIRE_FALSE(VLOG_IS_COMPILED(ANT_MAX_VLOG_LEVEL+1));
+
+    const auto prev_level = el::Loggers::verboseLevel();
+    el::Loggers::setVerboseLevel(9);
+    REQUIRE(VLOG_IS_ON(ANT_MAX_VLOG_LEVEL));
+    REQUIRE_FALSE(VLOG_IS_ON(ANT_MAX_VLOG_LEVEL+1));
+
+    counter_t logged;
+    VLOG(ANT_MAX_VLOG_LEVEL) << logged();
+    VLOG(ANT_MAX_VLOG_LEVEL+1) << logged();
+    el::Loggers::setVerboseLevel(prev_level);
+    REQUIRE(logged.N == 1);
+}
+
+void dotest_dangling_else() {
+    // the else must belong to the outer if, not to the one inside the macro
+    counter_t logged;
+    counter_t other;
+    for(int i=0;i<4;i++) {
+        if(i % 2 == 0)
+            LOG_N_TIMES(1, INFO) << logged();
+        else
+            other();
+    }
+    REQUIRE(logged.N == 1);
+    REQUIRE(other.N == 2);
+
+    counter_t logged_seconds;
+    counter_t other_seconds;
+    for(int i=0;i<4;i++) {
+        if(i % 2 == 0)
+            LOG_EVERY_SECONDS(3600, INFO) << logged_seconds();
+        else
+            other_seconds();
+    }
+    REQUIRE(logged_seconds.N == 1);
+    REQUIRE(other_seconds.N == 2);
+
+    // without an else, compiles without -Wdangling-else
+    counter_t logged_nested;
+    for(int i=0;i<4;i++)
+        if(i % 2 == 0)
+            LOG_N_TIMES(1, INFO) << logged_nested();
+    REQUIRE(logged_nested.N == 1);
+}
@@ -0,0 +1,100 @@
+#include "catch.hpp"
+
+#include "base/StageTimer.h"
+
+#include <thread>
+
+using namespace std;
+using namespace ant;
+
+void dotest_buckets();
+void dotest_scope();
+void dotest_profile();
+
+TEST_CASE("StageTimer: Buckets", "[base]") {
+    dotest_buckets();
+}
+
+TEST_CASE("StageTimer: Scope", "[base]") {
+    dotest_scope();
+}
+
+TEST_CASE("StageTimer: Profile", "[base]") {
+    dotest_profile();
+}
+
+void dotest_buckets() {
+    // small values have their own bucket
+    for(unsigned t=0;t<8;t++)
+        REQUIRE(StageTimer::Bucket(t) == t);
+
+    // buckets are contiguous and the low edges are consistent
+    for(unsigned b=0;b<StageTimer::NBuckets-4;b++) {
+        const auto low = StageTimer::BucketLowEdge(b);
+        const auto high = StageTimer::BucketLowEdge(b+1);
+        REQUIRE(low < high);
+        if(high < 1e15) { // exactly representable
+            REQUIRE(StageTimer::Bucket(low) == b);
+            REQUIRE(StageTimer::Bucket(high-1) == b);
+        }
+    }
+    REQUIRE(StageTimer::Bucket(numeric_limits<uint64_t>::max()) < StageTimer::NBuckets);
+
+    // four buckets per octave
+    REQUIRE(StageTimer::Bucket(1 << 20) + 4 == StageTimer::Bucket(1 << 21));
+}
+
+void dotest_scope() {
+    auto& timer = StageTimer::Get("Test/Scope");
+    REQUIRE(&timer == &StageTimer::Get("Test/Scope"));
+    REQUIRE(timer.GetName() == "Test/Scope");
+
+    // disabled by default
+    REQUIRE_FALSE(StageTimer::IsEnabled());
+    {
+        StageTimer::Scope timing(timer);
+    }
+    REQUIRE(timer.GetCount() == 0);
+
+    StageTimer::Enable();
+    for(int i=0;i<3;i++) {
+        StageTimer::Scope timing(timer);
+        this_thread::sleep_for(chrono::milliseconds(2));
+    }
+    StageTimer::Enable(false);
+
+    REQUIRE(timer.GetCount() == 3);
+    REQUIRE(timer.GetMeanSeconds() == Approx(2e-3).epsilon(0.5));
+    REQUIRE(StageTimer::Summary().find("Test/Scope") != string::npos);
+}
+
+void dotest_profile() {
+    auto& fast = StageTimer::Get("TestProfile/Fast");
+    auto& slow = StageTimer::Get("TestProfile/Slow");
+    StageTimer::Get("TestProfile/Unused");
+
+    StageTimer::Enable();
+    {
+        StageTimer::Scope timing(fast);
+    }
+    {
+        StageTimer::Scope timing(slow);
+        this_thread::sleep_for(chrono::milliseconds(2));
+    }
+    // measured by hand
+    slow.Add(1000);
+
+    const auto profile = StageTimer::Profile("TestProfile/");
+    StageTimer::Enable(false);
+
+    REQUIRE(slow.GetCount() == 2);
+    // most expensive first, unused ones omitted
+    const auto pos_slow = profile.find("TestProfile/Slow");
+    const auto pos_fast = profile.find("TestProfile/Fast");
+    REQUIRE(pos_slow != string::npos);
+    REQUIRE(pos_fast != string::npos);
+    REQUIRE(pos_slow < pos_fast);
+    REQUIRE(profile.find("(2 times)") != string::npos);
+    REQUIRE(profile.find("TestProfile/Unused") == string::npos);
+    REQUIRE(StageTimer::Profile("NoSuchPrefix/").empty());
+}
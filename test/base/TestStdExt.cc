@@ -18,6 +18,7 @@
 #include <iostream>
 #include <random>
 #include <map>
+#include <thread>
 
 using namespace std;
 using namespace ant;
@@ -31,6 +32,7 @@ struct MemtestDummy {
 unsigned MemtestDummy::n = 0;
 
 void TestMakeUnique();
+void TestMakePooled();
 void TestString();
 void TestVector();
 void TestMap();
@@ -43,6 +45,10 @@ TEST_CASE("make_unique", "[base/std_ext]") {
     TestMakeUnique();
 }
 
+TEST_CASE("make_pooled", "[base/std_ext]") {
+    TestMakePooled();
+}
+
 TEST_CASE("string stuff", "[base/std_ext") {
     TestString();
 }
@@ -80,6 +86,33 @@ void TestMakeUnique() {
     REQUIRE(MemtestDummy::n == 0);
 }
 
+void TestMakePooled() {
+    std::shared_ptr<MemtestDummy> d;
+
+    REQUIRE_NOTHROW(d = std_ext::make_pooled<MemtestDummy>());
+    REQUIRE(MemtestDummy::n == 1);
+    const void* addr = d.get();
+    REQUIRE_NOTHROW(d = nullptr);
+    REQUIRE(MemtestDummy::n == 0);
+
+    // freed block is recycled
+    d = std_ext::make_pooled<MemtestDummy>();
+    REQUIRE(d.get() == addr);
+
+    // released by other thread
+    std::thread t([&d] () { d = nullptr; });
+    t.join();
+    REQUIRE(MemtestDummy::n == 0);
+
+    {
+        std_ext::shared_ptr_container<MemtestDummy> c;
+        for(int i=0;i<10;i++)
+            c.emplace_back();
+        REQUIRE(MemtestDummy::n == 10);
+    }
+    REQUIRE(MemtestDummy::n == 0);
+}
+
 void TestString() {
 
     // ends_with
@@ -22,6 +22,9 @@ void dotest_chain();
 void dotest_opt_branches();
 void dotest_stdarray();
 void dotest_templating();
+void dotest_lazy();
+void dotest_columns();
+void dotest_prune();
 
 
 TEST_CASE("WrapTTree: Basics", "[base]") {
@@ -56,6 +59,18 @@ TEST_CASE("WrapTTree: templating", "[base]") {
     dotest_templating();
 }
 
+TEST_CASE("WrapTTree: Lazy reading", "[base]") {
+    dotest_lazy();
+}
+
+TEST_CASE("WrapTTree: Columnar reading", "[base]") {
+    dotest_columns();
+}
+
+TEST_CASE("WrapTTree: Pruned branches and cache", "[base]") {
+    dotest_prune();
+}
+
 
 struct MyTree : WrapTTree {
     ADD_BRANCH_T(bool,           Flag1)        // simple type
@@ -480,3 +495,125 @@ class MyClass {
 void dotest_templating() {
     MyClass<> test;
 }
+
+void make_lazytree(const std::string& filename, unsigned offset) {
+    WrapTFileOutput outputfile(filename, true);
+    MyTree t;
+    t.CreateBranches(outputfile.CreateInside<TTree>("test","test"));
+    for(unsigned entry=0;entry<100;entry++) {
+        t.N1 = offset+entry;
+        t.N2 = 2*(offset+entry);
+        t.SomeArray = vector<double>(entry % 5, entry);
+        t.LV = TLorentzVector(0,0,0,entry);
+        t.Tree->Fill();
+    }
+}
+
+void dotest_lazy() {
+    tmpfile_t tmpfile;
+    make_lazytree(tmpfile.filename, 0);
+
+    WrapTFileInput inputfile(tmpfile.filename);
+    MyTree t;
+    REQUIRE(inputfile.GetObject("test",t.Tree));
+    t.LinkBranches();
+
+    for(unsigned entry=0;entry<100;entry++) {
+        INFO("entry=" << entry);
+        t.GetEntry(entry);
+        REQUIRE(t.N1 == entry);
+        // access some branch only sometimes
+        if(entry % 10 == 0)
+            REQUIRE(t.SomeArray().size() == entry % 5);
+    }
+
+    // untouched branches were never read
+    REQUIRE(t.Tree->GetBranch("N1")->GetReadEntry() == 99);
+    REQUIRE(t.Tree->GetBranch("SomeArray")->GetReadEntry() == 99);
+    REQUIRE(t.Tree->GetBranch("N2")->GetReadEntry() == -1);
+    REQUIRE(t.Tree->GetBranch("LV")->GetReadEntry() == -1);
+
+    // values are not overwritten once set
+    t.GetEntry(3);
+    t.N2 = 7;
+    REQUIRE(t.N2 == 7);
+    REQUIRE(t.LV().E() == Approx(3));
+}
+
+void dotest_columns() {
+    tmpfile_t tmpfile1;
+    make_lazytree(tmpfile1.filename, 0);
+    tmpfile_t tmpfile2;
+    make_lazytree(tmpfile2.filename, 100);
+
+    auto chain = std_ext::make_unique<TChain>("test");
+    REQUIRE(chain->AddFile(tmpfile1.filename.c_str()) == 1);
+    REQUIRE(chain->AddFile(tmpfile2.filename.c_str()) == 1);
+
+    MyTree t;
+    t.LinkBranches(chain.get());
+
+    // columns crossing the file boundary
+    unsigned total = 0;
+    for(long long first=0;first<chain->GetEntries();first += 30) {
+        const auto n = t.ReadColumns(first, 30);
+        REQUIRE(n == std::min<long long>(30, 200-first));
+        const auto& n1 = t.N1.Column();
+        const auto& n2 = t.N2.Column();
+        REQUIRE(n1.size() == unsigned(n));
+        REQUIRE(n2.size() == unsigned(n));
+        for(unsigned i=0;i<n1.size();i++) {
+            REQUIRE(n1[i] == first+i);
+            REQUIRE(n2[i] == short(2*n1[i]));
+        }
+        total += n;
+    }
+    REQUIRE(total == 200);
+
+    // lazy reading and reading columns can be mixed
+    t.GetEntry(150);
+    t.ReadColumns(0, 10);
+    REQUIRE(t.N1 == 150);
+    REQUIRE(t.SomeArray.Column().size() == 10);
+    REQUIRE(t.SomeArray.Column().back().size() == 9 % 5);
+}
+
+void dotest_prune() {
+    tmpfile_t tmpfile;
+    make_lazytree(tmpfile.filename, 0);
+
+    struct N1Tree : WrapTTree {
+        ADD_BRANCH_T(unsigned,       N1)
+    };
+    struct ArrayTree : WrapTTree {
+        ADD_BRANCH_T(vector<double>, SomeArray)
+    };
+
+    WrapTFileInput inputfile(tmpfile.filename);
+    N1Tree t1;
+    ArrayTree t2;
+    REQUIRE(inputfile.GetObject("test",t1.Tree));
+    t2.Tree = t1.Tree;
+    t1.LinkBranches();
+    t2.LinkBranches();
+
+    // both share the tree, so only the first deactivates everything else
+    t1.PruneBranches();
+    t2.PruneBranches(false);
+    t1.EnableCache(1024*1024);
+    t2.EnableCache();
+    REQUIRE(t1.Tree->GetCacheSize() == 1024*1024);
+
+    for(unsigned entry=0;entry<100;entry++) {
+        INFO("entry=" << entry);
+        t1.Tree->GetEntry(entry);
+        REQUIRE(t1.N1 == entry);
+        REQUIRE(t2.SomeArray().size() == entry % 5);
+    }
+
+    // pruned branches were never read
+    REQUIRE(t1.Tree->GetBranch("N1")->GetReadEntry() == 99);
+    REQUIRE(t1.Tree->GetBranch("SomeArray")->GetReadEntry() == 99);
+    REQUIRE(t1.Tree->GetBranch("N2")->GetReadEntry() == -1);
+    REQUIRE(t1.Tree->GetBranch("LV")->GetReadEntry() == -1);
+}
@@ -12,6 +12,10 @@
 
 #include "unpacker/Unpacker.h"
 
+#include "expconfig/detectors/PID.h"
+#include "expconfig/detectors/TAPS.h"
+#include "base/vec/vec2.h"
+
 using namespace std;
 using namespace ant;
 using namespace ant::reconstruct;
@@ -63,10 +67,105 @@ counts_t getCounts(
     return counts;
 }
 
+using matches_t = vector<pair<const TCluster*, const TCluster*>>;
+
+TClusterList copyClusters(CandidateBuilder::sorted_clusters_t& sorted_clusters, Detector_t::Type_t type) {
+    auto it = sorted_clusters.find(type);
+    if(it == sorted_clusters.end())
+        return {};
+    return TClusterList(it->second.begin(), it->second.end());
+}
+
+matches_t getMatches(const CandidateBuilder::candidates_t& candidates, unsigned first) {
+    matches_t matches;
+    for(auto i=first;i<candidates.size();i++)
+        matches.emplace_back(&candidates[i].Clusters.front(), &candidates[i].Clusters.back());
+    return matches;
+}
+
+vector<const TCluster*> getClusters(CandidateBuilder::sorted_clusters_t& sorted_clusters, Detector_t::Type_t type) {
+    vector<const TCluster*> clusters;
+    auto it = sorted_clusters.find(type);
+    if(it != sorted_clusters.end()) {
+        for(const auto& c : it->second)
+            clusters.push_back(&c);
+    }
+    return clusters;
+}
+
+vector<const TCluster*> getClusters(const TClusterList& list) {
+    vector<const TCluster*> clusters;
+    for(const auto& c : list)
+        clusters.push_back(&c);
+    return clusters;
+}
+
 struct CandidateBuilderTester : CandidateBuilder {
 
     using CandidateBuilder::CandidateBuilder; // use base class constructors
 
+    // straightforward matching of each PID cluster against all CB clusters,
+    // used as reference for the phi-binned lookup
+    matches_t reference_PID_CB(TClusterList& cb_clusters, TClusterList& pid_clusters) const {
+        matches_t matches;
+        auto it_pid_cluster = pid_clusters.begin();
+        while(it_pid_cluster != pid_clusters.end()) {
+            const auto pid_phi = it_pid_cluster->Position.Phi();
+            const auto dphi_max = (pid->dPhi(it_pid_cluster->CentralElement) + config.PID_Phi_Epsilon);
+            bool matched = false;
+            auto it_cb_cluster = cb_clusters.begin();
+            while(it_cb_cluster != cb_clusters.end()) {
+                const auto dphi = fabs(vec2::Phi_mpi_pi(it_cb_cluster->Position.Phi() - pid_phi));
+                if(dphi < dphi_max) {
+                    matches.emplace_back(&*it_cb_cluster, &*it_pid_cluster);
+                    it_cb_cluster = cb_clusters.erase(it_cb_cluster);
+                    matched = true;
+                }
+                else {
+                    ++it_cb_cluster;
+                }
+            }
+            if(matched)
+                it_pid_cluster = pid_clusters.erase(it_pid_cluster);
+            else
+                ++it_pid_cluster;
+        }
+        return matches;
+    }
+
+    // searching the converted neighbours for each veto cluster,
+    // used as reference for the adjacency bitmap
+    matches_t reference_TAPS_Veto(TClusterList& taps_clusters, TClusterList& veto_clusters) const {
+        matches_t matches;
+        auto it_taps_cluster = taps_clusters.begin();
+        while(it_taps_cluster != taps_clusters.end()) {
+            const auto center = taps->GetHexChannel(it_taps_cluster->CentralElement);
+            vector<unsigned> neighbours;
+            if(it_taps_cluster->Hits.size() > 1) {
+                for(auto n : taps->GetClusterElement(it_taps_cluster->CentralElement)->Neighbours)
+                    neighbours.push_back(taps->GetHexChannel(n));
+            }
+            auto matched_veto = veto_clusters.end();
+            for(auto it_veto_cluster = veto_clusters.begin(); it_veto_cluster != veto_clusters.end(); ++it_veto_cluster) {
+                if(it_veto_cluster->CentralElement == center)
+                    matched_veto = it_veto_cluster;
+                if(find(neighbours.begin(), neighbours.end(), it_veto_cluster->CentralElement) != neighbours.end()) {
+                    if(matched_veto == veto_clusters.end() || it_veto_cluster->Energy > matched_veto->Energy)
+                        matched_veto = it_veto_cluster;
+                }
+            }
+            if(matched_veto != veto_clusters.end()) {
+                matches.emplace_back(&*it_taps_cluster, &*matched_veto);
+                it_taps_cluster = taps_clusters.erase(it_taps_cluster);
+                veto_clusters.erase(matched_veto);
+            }
+            else {
+                ++it_taps_cluster;
+            }
+        }
+        return matches;
+    }
+
     virtual void BuildCandidates(sorted_clusters_t& sorted_clusters,
             candidates_t& candidates,
             clusters_t& all_clusters
@@ -77,15 +176,33 @@ struct CandidateBuilderTester : CandidateBuilder {
         counts_t diff;
 
         before = getCounts(sorted_clusters, candidates, all_clusters);
-        if(cb && pid)
+        if(cb && pid) {
+            auto cb_clusters = copyClusters(sorted_clusters, Detector_t::Type_t::CB);
+            auto pid_clusters = copyClusters(sorted_clusters, Detector_t::Type_t::PID);
+            const auto expected = reference_PID_CB(cb_clusters, pid_clusters);
+
             Build_PID_CB(sorted_clusters, candidates, all_clusters);
+
+            REQUIRE(getMatches(candidates, before.candidates) == expected);
+            REQUIRE(getClusters(sorted_clusters, Detector_t::Type_t::CB) == getClusters(cb_clusters));
+            REQUIRE(getClusters(sorted_clusters, Detector_t::Type_t::PID) == getClusters(pid_clusters));
+        }
         after = getCounts(sorted_clusters, candidates, all_clusters);
         diff = after - before;
         REQUIRE(diff.candidateclusters + diff.clusters == 0);
 
         before = getCounts(sorted_clusters, candidates, all_clusters);
-        if(taps && tapsveto)
+        if(taps && tapsveto) {
+            auto taps_clusters = copyClusters(sorted_clusters, Detector_t::Type_t::TAPS);
+            auto veto_clusters = copyClusters(sorted_clusters, Detector_t::Type_t::TAPSVeto);
+            const auto expected = reference_TAPS_Veto(taps_clusters, veto_clusters);
+
             Build_TAPS_Veto(sorted_clusters, candidates, all_clusters);
+
+            REQUIRE(getMatches(candidates, before.candidates) == expected);
+            REQUIRE(getClusters(sorted_clusters, Detector_t::Type_t::TAPS) == getClusters(taps_clusters));
+            REQUIRE(getClusters(sorted_clusters, Detector_t::Type_t::TAPSVeto) == getClusters(veto_clusters));
+        }
         after = getCounts(sorted_clusters, candidates, all_clusters);
         diff = after - before;
         REQUIRE(diff.candidateclusters + diff.clusters == 0);
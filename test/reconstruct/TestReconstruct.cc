@@ -12,6 +12,10 @@
 
 #include "unpacker/Unpacker.h"
 
+#include "base/std_ext/math.h"
+
+#include <cmath>
+
 
 using namespace std;
 using namespace ant;
@@ -23,6 +27,8 @@ void dotest_ignoredelements_raw();
 void dotest_ignoredelements_raw_include();
 void dotest_ignoredelements_geant();
 void dotest_ignoredelements_geant_include();
+void dotest_taggertimes();
+void dotest_taggerwindows();
 
 
 TEST_CASE("Reconstruct: Chain sanity checks", "[reconstruct]") {
@@ -50,6 +56,14 @@ TEST_CASE("Reconstruct: Include ignored elements with geant", "[reconstruct]") {
     dotest_ignoredelements_geant_include();
 }
 
+TEST_CASE("Reconstruct: Merge tagger times", "[reconstruct]") {
+    dotest_taggertimes();
+}
+
+TEST_CASE("Reconstruct: Tagger time windows", "[reconstruct]") {
+    dotest_taggerwindows();
+}
+
 template<typename T>
 unsigned getTotalCount(const T& m) {
     unsigned total = 0;
@@ -330,4 +344,56 @@ void dotest_ignoredelements_geant_include() {
     CHECK(clusterHits_after2[Detector_t::Type_t::PID] == 51);
     CHECK(clusterHits_after2[Detector_t::Type_t::TAPSVeto] == 133);
     CHECK(clusterHits_before[Detector_t::Type_t::EPT] == 100);
-}
\ No newline at end of file
+}
+
+struct TaggerTester : Reconstruct {
+    using Reconstruct::MergeTaggerTimes;
+    using Reconstruct::GetTaggerTimeWindows;
+};
+
+vector<double> mergeTaggerTimes(vector<double> times, double doubleHitWindow, double afterPulseWindow) {
+    times.erase(TaggerTester::MergeTaggerTimes(times.begin(), times.end(), doubleHitWindow, afterPulseWindow),
+                times.end());
+    return times;
+}
+
+void dotest_taggertimes() {
+    const vector<double> times{30, -10, 0.5, 0, 45};
+
+    // disabled just sorts
+    REQUIRE(mergeTaggerTimes(times, 0, 0) == vector<double>({-10, 0, 0.5, 30, 45}));
+
+    // double hits are merged into their mean
+    REQUIRE(mergeTaggerTimes(times, 1, 0) == vector<double>({-10, 0.25, 30, 45}));
+    REQUIRE(mergeTaggerTimes({0, 0.75, 1.5, 5}, 1, 0) == vector<double>({0.75, 5}));
+
+    // after-pulses are dropped
+    REQUIRE(mergeTaggerTimes(times, 0, 20) == vector<double>({-10, 30}));
+    REQUIRE(mergeTaggerTimes({0, 0.5, 10, 40}, 1, 15) == vector<double>({0.25, 40}));
+
+    // NaN stays at the end
+    const auto merged = mergeTaggerTimes({std_ext::NaN, 2, 1.5}, 1, 0);
+    REQUIRE(merged.size() == 2);
+    CHECK(merged.front() == Approx(1.75));
+    CHECK(std::isnan(merged.back()));
+
+    REQUIRE(mergeTaggerTimes({}, 1, 10).empty());
+}
+
+void dotest_taggerwindows() {
+    const PiecewiseInterval<double> prompt{{-3, 3}};
+    const PiecewiseInterval<double> random{{-50, -5}, {5, 50}, {200, 250}};
+
+    CHECK(TaggerTester::GetTaggerTimeWindows(prompt, random, std_ext::NaN).empty());
+    CHECK(TaggerTester::GetTaggerTimeWindows({}, {}, 10).empty());
+
+    const auto windows = TaggerTester::GetTaggerTimeWindows(prompt, random, 10);
+    REQUIRE(windows.size() == 2);
+    CHECK(windows.front() == interval<double>(-60, 60));
+    CHECK(windows.back() == interval<double>(190, 260));
+    CHECK(windows.Contains(-55));
+    CHECK_FALSE(windows.Contains(100));
+
+    // without margin, the gaps stay
+    CHECK(TaggerTester::GetTaggerTimeWindows(prompt, random, 0).size() == 4);
+}
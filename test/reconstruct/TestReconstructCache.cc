@@ -0,0 +1,116 @@
+#include "catch.hpp"
+#include "catch_config.h"
+#include "expconfig_helpers.h"
+
+#include "tree/TEvent.h"
+#include "tree/TEventData.h"
+
+#include "reconstruct/Reconstruct.h"
+#include "reconstruct/ReconstructCache.h"
+
+#include "unpacker/Unpacker.h"
+
+#include "base/tmpfile_t.h"
+
+#include <vector>
+
+using namespace std;
+using namespace ant;
+using namespace ant::reconstruct;
+
+void dotest_restore();
+void dotest_setupoptions();
+
+TEST_CASE("ReconstructCache: Restore events", "[reconstruct]") {
+    test::EnsureSetup();
+    dotest_restore();
+}
+
+TEST_CASE("ReconstructCache: Setup options", "[reconstruct]") {
+    test::EnsureSetup();
+    dotest_setupoptions();
+}
+
+struct ReconstructCacheTester : Reconstruct {
+    const ReconstructCache& GetCache() const { return *cache; }
+};
+
+struct event_summary_t {
+    TID ID;
+    size_t nHits = 0;
+    size_t nTaggerHits = 0;
+    size_t nClusters = 0;
+    vector<double> CaloEnergies;
+
+    explicit event_summary_t(const TEventData& reconstructed) :
+        ID(reconstructed.ID),
+        nHits(reconstructed.DetectorReadHits.size()),
+        nTaggerHits(reconstructed.TaggerHits.size()),
+        nClusters(reconstructed.Clusters.size())
+    {
+        for(const auto& cand : reconstructed.Candidates)
+            CaloEnergies.push_back(cand.CaloEnergy);
+    }
+};
+
+vector<event_summary_t> reconstruct_with_cache(const string& cachefile,
+                                               unsigned long long& nRestored,
+                                               unsigned long long& nStored) {
+    auto unpacker = Unpacker::Get(string(TEST_BLOBS_DIRECTORY)+"/Acqu_oneevent-big.dat.xz");
+    ReconstructCacheTester reconstruct;
+    reconstruct.EnableCache(cachefile);
+
+    vector<event_summary_t> summaries;
+    while(auto event = unpacker->NextEvent()) {
+        reconstruct.DoReconstruct(event.Reconstructed());
+        summaries.emplace_back(event.Reconstructed());
+    }
+    nRestored = reconstruct.GetCache().GetNRestored();
+    nStored = reconstruct.GetCache().GetNStored();
+    return summaries;
+}
+
+void dotest_restore() {
+    tmpfile_t tmpfile;
+    // the cache is created from scratch, as the tmpfile is empty
+    unsigned long long nRestored = 0;
+    unsigned long long nStored = 0;
+    const auto first = reconstruct_with_cache(tmpfile.filename, nRestored, nStored);
+    CHECK(nRestored == 0);
+    CHECK(nStored == 221);
+
+    const auto second = reconstruct_with_cache(tmpfile.filename, nRestored, nStored);
+    CHECK(nRestored == 221);
+    CHECK(nStored == 0);
+
+    REQUIRE(first.size() == second.size());
+    for(size_t i=0;i<first.size();i++) {
+        REQUIRE(first[i].ID == second[i].ID);
+        REQUIRE(first[i].nHits == second[i].nHits);
+        REQUIRE(first[i].nTaggerHits == second[i].nTaggerHits);
+        REQUIRE(first[i].nClusters == second[i].nClusters);
+        REQUIRE(first[i].CaloEnergies == second[i].CaloEnergies);
+    }
+}
+
+void dotest_setupoptions() {
+    tmpfile_t tmpfile;
+    unsigned long long nRestored = 0;
+    unsigned long long nStored = 0;
+    reconstruct_with_cache(tmpfile.filename, nRestored, nStored);
+    CHECK(nStored == 221);
+
+    // same setup with different options, such as -S IncludeIgnoredElements=1
+    test::EnsureSetup(true);
+    reconstruct_with_cache(tmpfile.filename, nRestored, nStored);
+    CHECK(nRestored == 0);
+    CHECK(nStored == 221);
+
+    // unchanged options use the cache again
+    reconstruct_with_cache(tmpfile.filename, nRestored, nStored);
+    CHECK(nRestored == 221);
+    CHECK(nStored == 0);
+
+    // back to the setup without options
+    test::EnsureSetup();
+}
@@ -0,0 +1,103 @@
+#include "catch.hpp"
+
+#include "tree/TIDIndex.h"
+#include "base/WrapTFile.h"
+#include "base/tmpfile_t.h"
+
+#include "TTree.h"
+
+using namespace std;
+using namespace ant;
+
+void dotest_lookup();
+void dotest_intersect();
+void dotest_io();
+
+TEST_CASE("TIDIndex: Lookup", "[tree]") {
+    dotest_lookup();
+}
+
+TEST_CASE("TIDIndex: Intersect", "[tree]") {
+    dotest_intersect();
+}
+
+TEST_CASE("TIDIndex: Write and read", "[tree]") {
+    dotest_io();
+}
+
+void dotest_lookup() {
+    TIDIndex index;
+    // add unsorted, every second lower ID only
+    for(unsigned i=0;i<100;i++) {
+        const unsigned lower = 2*((i*37) % 100);
+        index.Add(TID(10, lower), i);
+    }
+    index.Add(TID(), 1000); // invalid is ignored
+    REQUIRE(index.Size() == 100);
+    REQUIRE_THROWS(index.GetEntry(TID(10, 0u)));
+
+    index.Sort();
+
+    // lower=0 was added as entry 0, lower=74 as entry 1
+    CHECK(index.GetEntry(TID(10, 0u)) == 0);
+    CHECK(index.GetEntry(TID(10, 74u)) == 1);
+    CHECK(index.GetEntry(TID(10, 1u)) == -1);
+    CHECK(index.GetEntry(TID(11, 0u)) == -1);
+    CHECK(index.GetEntry(TID()) == -1);
+
+    const auto entries = index.GetEntries({TID(10, 1u), TID(10, 10u)});
+    REQUIRE(entries.size() == 5);
+    for(auto entry : entries)
+        CHECK(entry < 100);
+    CHECK(index.GetEntries({TID(10, 0u), TID(10, 1000u)}).size() == 100);
+    CHECK(index.GetEntries({TID(11, 0u), TID(12, 0u)}).empty());
+}
+
+void dotest_intersect() {
+    TIDIndex a;
+    TIDIndex b;
+    for(unsigned i=0;i<1000;i++)
+        a.Add(TID(0, i), i);
+    // every third, with some offset in entries
+    for(unsigned i=0;i<100;i++)
+        b.Add(TID(0, 3*i), i+5);
+    b.Add(TID(0, 5000u), 105);
+
+    const auto common = TIDIndex::Intersect(a, b);
+    REQUIRE(common.size() == 100);
+    for(unsigned i=0;i<common.size();i++) {
+        CHECK(common[i].first == 3*i);
+        CHECK(common[i].second == i+5);
+    }
+
+    // swapped arguments keep order of pair
+    const auto common_swapped = TIDIndex::Intersect(b, a);
+    REQUIRE(common_swapped.size() == 100);
+    CHECK(common_swapped.back().first == 104);
+    CHECK(common_swapped.back().second == 297);
+
+    CHECK(TIDIndex::Intersect(a, TIDIndex()).empty());
+}
+
+void dotest_io() {
+    tmpfile_t tmpfile;
+
+    {
+        WrapTFileOutput outputfile(tmpfile.filename);
+        TIDIndex index;
+        for(unsigned i=0;i<50;i++)
+            index.Add(TID(1, 50-i, {TID::Flags_t::MC}), i);
+        outputfile.cd();
+        index.Write(*gDirectory, "someTree");
+    }
+
+    WrapTFileInput inputfile(tmpfile.filename);
+    TIDIndex index;
+    CHECK_FALSE(index.Read(inputfile, "otherTree"));
+    REQUIRE(index.Read(inputfile, "someTree"));
+    REQUIRE(index.Size() == 50);
+    CHECK(index.GetEntry(TID(1, 50u, {TID::Flags_t::MC})) == 0);
+    CHECK(index.GetEntry(TID(1, 1u, {TID::Flags_t::MC})) == 49);
+    // flags are part of the key
+    CHECK(index.GetEntry(TID(1, 1u)) == -1);
+}
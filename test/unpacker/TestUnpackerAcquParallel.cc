@@ -0,0 +1,73 @@
+#include "catch.hpp"
+#include "catch_config.h"
+#include "expconfig_helpers.h"
+
+#include "Unpacker.h"
+#include "UnpackerAcqu.h"
+#include "expconfig/ExpConfig.h"
+
+#include "tree/TEvent.h"
+#include "tree/TEventData.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ant;
+
+void dotest(const string& filename);
+
+TEST_CASE("Test UnpackerAcqu: Parallel Mk2", "[unpacker]") {
+    test::EnsureSetup();
+    dotest("Acqu_scalerblock.dat.xz");
+    dotest("Acqu_twoscalerblocks.dat.xz");
+}
+
+TEST_CASE("Test UnpackerAcqu: Parallel Mk1", "[unpacker]") {
+    test::EnsureSetup();
+    dotest("AcquMk1_scalerblock.dat.xz");
+    dotest("AcquMk1_problematic.dat.gz");
+}
+
+vector<TEvent> unpack(const string& filename, unsigned workers) {
+    UnpackerAcqu::Settings.Workers = workers;
+    UnpackerAcqu::Settings.RecordsPerWorker = 1;
+    auto unpacker = Unpacker::Get(filename);
+    UnpackerAcqu::Settings = UnpackerAcqu::settings_t();
+
+    vector<TEvent> events;
+    while(auto event = unpacker->NextEvent())
+        events.emplace_back(move(event));
+    return events;
+}
+
+void dotest(const string& filename) {
+    INFO(filename);
+    const auto serial = unpack(string(TEST_BLOBS_DIRECTORY)+"/"+filename, 0);
+    const auto parallel = unpack(string(TEST_BLOBS_DIRECTORY)+"/"+filename, 3);
+
+    REQUIRE(serial.size() > 1);
+    REQUIRE(parallel.size() == serial.size());
+
+    for(size_t i=0;i<serial.size();i++) {
+        const auto& s = serial[i].Reconstructed();
+        const auto& p = parallel[i].Reconstructed();
+        REQUIRE(p.ID == s.ID);
+        REQUIRE(p.Trigger.DAQEventID == s.Trigger.DAQEventID);
+
+        REQUIRE(p.DetectorReadHits.size() == s.DetectorReadHits.size());
+        for(size_t j=0;j<s.DetectorReadHits.size();j++) {
+            REQUIRE(p.DetectorReadHits[j].Channel == s.DetectorReadHits[j].Channel);
+            REQUIRE(p.DetectorReadHits[j].RawData == s.DetectorReadHits[j].RawData);
+        }
+
+        REQUIRE(p.SlowControls.size() == s.SlowControls.size());
+
+        REQUIRE(p.UnpackerMessages.size() == s.UnpackerMessages.size());
+        for(size_t j=0;j<s.UnpackerMessages.size();j++) {
+            REQUIRE(p.UnpackerMessages[j].Level == s.UnpackerMessages[j].Level);
+            REQUIRE(p.UnpackerMessages[j].Message == s.UnpackerMessages[j].Message);
+            REQUIRE(p.UnpackerMessages[j].Payload == s.UnpackerMessages[j].Payload);
+        }
+    }
+}
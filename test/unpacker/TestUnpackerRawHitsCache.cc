@@ -0,0 +1,107 @@
+#include "catch.hpp"
+#include "catch_config.h"
+#include "expconfig_helpers.h"
+
+#include "Unpacker.h"
+#include "UnpackerRawHitsCache.h"
+#include "expconfig/ExpConfig.h"
+
+#include "tree/TEvent.h"
+#include "tree/TEventData.h"
+
+#include "base/tmpfile_t.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ant;
+
+void dotest(const string& filename, bool scalers);
+void dotest_incomplete();
+
+TEST_CASE("Test UnpackerRawHitsCache: Mk2", "[unpacker]") {
+    test::EnsureSetup();
+    dotest("Acqu_twoscalerblocks.dat.xz", true);
+}
+
+TEST_CASE("Test UnpackerRawHitsCache: Mk1", "[unpacker]") {
+    test::EnsureSetup();
+    dotest("AcquMk1_problematic.dat.gz", false);
+}
+
+TEST_CASE("Test UnpackerRawHitsCache: Incomplete", "[unpacker]") {
+    test::EnsureSetup();
+    dotest_incomplete();
+}
+
+void dotest(const string& filename, bool scalers) {
+    INFO(filename);
+    tmpfile_t tmpfile;
+
+    // the writer passes on the events unchanged
+    vector<TEvent> events;
+    {
+        UnpackerRawHitsCache::Writer writer(Unpacker::Get(string(TEST_BLOBS_DIRECTORY)+"/"+filename),
+                                            tmpfile.filename);
+        while(auto event = writer.NextEvent())
+            events.emplace_back(move(event));
+    }
+    REQUIRE(events.size() > 1);
+
+    auto unpacker = Unpacker::Get(tmpfile.filename);
+    REQUIRE(dynamic_cast<UnpackerRawHitsCache*>(unpacker.get()) != nullptr);
+
+    unsigned nHits = 0;
+    unsigned nSlowControls = 0;
+    for(const auto& expected : events) {
+        auto event = unpacker->NextEvent();
+        REQUIRE(event);
+        const auto& e = expected.Reconstructed();
+        const auto& c = event.Reconstructed();
+
+        REQUIRE(c.ID == e.ID);
+        REQUIRE(c.Trigger.DAQEventID == e.Trigger.DAQEventID);
+        REQUIRE(c.Trigger.DAQErrors.size() == e.Trigger.DAQErrors.size());
+
+        REQUIRE(c.DetectorReadHits.size() == e.DetectorReadHits.size());
+        for(size_t j=0;j<e.DetectorReadHits.size();j++) {
+            REQUIRE(c.DetectorReadHits[j].DetectorType == e.DetectorReadHits[j].DetectorType);
+            REQUIRE(c.DetectorReadHits[j].ChannelType == e.DetectorReadHits[j].ChannelType);
+            REQUIRE(c.DetectorReadHits[j].Channel == e.DetectorReadHits[j].Channel);
+            REQUIRE(c.DetectorReadHits[j].RawData == e.DetectorReadHits[j].RawData);
+            nHits++;
+        }
+
+        REQUIRE(c.SlowControls.size() == e.SlowControls.size());
+        for(size_t j=0;j<e.SlowControls.size();j++) {
+            REQUIRE(c.SlowControls[j].Name == e.SlowControls[j].Name);
+            REQUIRE(c.SlowControls[j].Payload_Int.size() == e.SlowControls[j].Payload_Int.size());
+            nSlowControls++;
+        }
+
+        REQUIRE(c.UnpackerMessages.size() == e.UnpackerMessages.size());
+        for(size_t j=0;j<e.UnpackerMessages.size();j++)
+            REQUIRE(c.UnpackerMessages[j].Message == e.UnpackerMessages[j].Message);
+    }
+    REQUIRE_FALSE(unpacker->NextEvent());
+    REQUIRE(unpacker->PercentDone() == Approx(1.0));
+
+    REQUIRE(nHits > 0);
+    if(scalers)
+        REQUIRE(nSlowControls > 0);
+}
+
+void dotest_incomplete() {
+    tmpfile_t tmpfile;
+
+    // stop before the raw data unpacker has finished
+    {
+        UnpackerRawHitsCache::Writer writer(Unpacker::Get(string(TEST_BLOBS_DIRECTORY)+"/Acqu_twoscalerblocks.dat.xz"),
+                                            tmpfile.filename);
+        for(unsigned n=0;n<2;n++)
+            REQUIRE(writer.NextEvent());
+    }
+
+    REQUIRE_THROWS_AS(Unpacker::Get(tmpfile.filename), UnpackerRawHitsCache::Exception);
+}